@@ -0,0 +1,292 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two unsigned integers given by their 32-bit limbs, as      *
+ *      polynomials in 2^16.                                                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Big_Product                                                           *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for integers stored as arrays of limbs, choosing the *
+ *      method from the lengths.                                              *
+ *  Arguments:                                                                *
+ *      P_limbs (unsigned int *):                                             *
+ *          A pointer to an array of limbs, at least A_len + B_len wide. It   *
+ *          must not overlap A or B.                                          *
+ *      A_limbs (const unsigned int *):                                       *
+ *          The limbs of A, least significant first, 32 bits each.            *
+ *      A_len (size_t):                                                       *
+ *          The number of limbs of A.                                         *
+ *      B_limbs (const unsigned int *):                                       *
+ *          The limbs of B, least significant first, 32 bits each.            *
+ *      B_len (size_t):                                                       *
+ *          The number of limbs of B.                                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Big_Product (polynomial_multiplication.h):                      *
+ *          Used for short operands, and if malloc fails.                     *
+ *      Poly_Multiply_Wide (polynomial_multiplication.h):                     *
+ *          Multiplies the digit polynomials exactly.                         *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the digits and the coefficients of their product.        *
+ *  Method:                                                                   *
+ *      Cut each limb into two 16-bit digits, so that A and B become          *
+ *      polynomials in x = 2^16 with coefficients below 2^16. Their product,  *
+ *      from Poly_Multiply_Wide, has coefficients below 2 min(A_len, B_len)   *
+ *      2^32, which is exact in a long long, and by the NTT once the digit    *
+ *      polynomials are long. The limbs of P are then found in two passes.    *
+ *                                                                            *
+ *      Coefficient c_k sits at bit 16 k. For even k = 2j it covers limbs j   *
+ *      and j + 1, and for odd k = 2j + 1 it covers limbs j, j + 1, and       *
+ *      j + 2. The first pass adds, for each limb, the at most five 32-bit    *
+ *      pieces of the coefficients that land on it. Every limb is done        *
+ *      independently of the others, so this pass vectorizes. The sums are    *
+ *      below 5 2^32, and the second pass carries their top bits up one limb  *
+ *      at a time, a single add and shift per limb.                           *
+ *                                                                            *
+ *      Products longer than NTT_MAX_LENGTH digits are cut into pieces that   *
+ *      are not, and the pieces are added into P.                             *
+ *  Notes:                                                                    *
+ *      All A_len + B_len limbs of P are written, including leading zeros. If *
+ *      either operand is empty, P is zero.                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  The longest piece of an operand, in limbs. Two pieces give a product of   *
+ *  fewer than NTT_MAX_LENGTH digits.                                         */
+#define BIG_PRODUCT_PIECE (NTT_MAX_LENGTH / (size_t)4)
+
+/*  Cuts each limb into its low and high 16-bit digits.                       */
+static void
+big_product_split(int *digits, const unsigned int *limbs, size_t len)
+{
+    size_t n;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        digits[2*n] = (int)(limbs[n] & 0xFFFFU);
+        digits[2*n + 1] = (int)((limbs[n] >> 16) & 0xFFFFU);
+    }
+}
+/*  End of big_product_split.                                                 */
+
+/*  Finds the len limbs of P from the coefficients of the digit product.      *
+ *  coeffs is preceded by three zeros and followed by one, so that every      *
+ *  limb may read the same five coefficients. sums holds len values.          */
+static void
+big_product_carry(unsigned int *P_limbs, size_t len,
+                  const unsigned long long *coeffs, unsigned long long *sums)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    const unsigned long long *c;
+    unsigned long long t;
+    unsigned long long carry = 0ULL;
+
+    /*  The low 32 and 16 bits of a coefficient.                              */
+    const unsigned long long low = 0xFFFFFFFFULL;
+    const unsigned long long half = 0xFFFFULL;
+
+    /*  Limb n gets the low half of c_{2n}, the high half of c_{2n-2}, the    *
+     *  low 16 bits of c_{2n+1}, bits 16 to 47 of c_{2n-1}, and the top of    *
+     *  c_{2n-3}.                                                             */
+    for (n = (size_t)0; n < len; ++n)
+    {
+        c = coeffs + 2*n;
+        sums[n] = (c[0] & low) + (c[-2] >> 32) + ((c[1] & half) << 16) +
+                  ((c[-1] >> 16) & low) + (c[-3] >> 48);
+    }
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        t = sums[n] + carry;
+        P_limbs[n] = (unsigned int)(t & low);
+        carry = t >> 32;
+    }
+}
+/*  End of big_product_carry.                                                 */
+
+/*  Computes P = A*B, with both operands non-empty and at most                *
+ *  BIG_PRODUCT_PIECE long, using the given buffers. digits holds             *
+ *  2 (A_len + B_len) ints and coeffs 3 (A_len + B_len + 1) long longs.       */
+static void
+big_product_piece(unsigned int *P_limbs,
+                  const unsigned int *A_limbs, size_t A_len,
+                  const unsigned int *B_limbs, size_t B_len,
+                  int *digits, unsigned long long *coeffs)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const size_t len = A_len + B_len;
+    int * const A_digits = digits;
+    int * const B_digits = digits + 2*A_len;
+    unsigned long long * const c = coeffs + 3;
+    unsigned long long * const sums = c + 2*len;
+
+    big_product_split(A_digits, A_limbs, A_len);
+    big_product_split(B_digits, B_limbs, B_len);
+
+    /*  The padding, and the product of 2 len - 1 coefficients between it.    */
+    coeffs[0] = coeffs[1] = coeffs[2] = 0ULL;
+    c[2*len - (size_t)1] = 0ULL;
+
+    Poly_Multiply_Wide(
+        (long long *)c, A_digits, 2*A_len, B_digits, 2*B_len
+    );
+
+    big_product_carry(P_limbs, len, c, sums);
+}
+/*  End of big_product_piece.                                                 */
+
+/*  Function for multiplying integers given by their limbs.                   */
+void
+Big_Product(unsigned int *P_limbs,
+            const unsigned int *A_limbs, size_t A_len,
+            const unsigned int *B_limbs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const unsigned int *tmp_limbs;
+    unsigned int *T_limbs;
+    int *digits;
+    unsigned long long *coeffs;
+    unsigned long long t;
+    size_t tmp_len, m, n, k, A_piece, B_piece, T_len;
+    int whole;
+
+    /*  The shorter operand goes first.                                       */
+    if (A_len > B_len)
+    {
+        tmp_limbs = A_limbs;
+        A_limbs = B_limbs;
+        B_limbs = tmp_limbs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    if (A_len <= BIG_NAIVE_CUTOFF)
+    {
+        Naive_Big_Product(P_limbs, A_limbs, A_len, B_limbs, B_len);
+        return;
+    }
+
+    /*  Products short enough for the NTT are done in one piece.              */
+    whole = (A_len + B_len <= 2*BIG_PRODUCT_PIECE);
+    A_piece = (whole || A_len < BIG_PRODUCT_PIECE ? A_len : BIG_PRODUCT_PIECE);
+    B_piece = (whole ? B_len : BIG_PRODUCT_PIECE);
+    T_len = A_piece + B_piece;
+
+    digits = malloc(sizeof(*digits) * 2*T_len);
+    coeffs = malloc(sizeof(*coeffs) * 3*(T_len + (size_t)1));
+
+    /*  If malloc fails, fall back to the schoolbook method.                  */
+    if (!digits || !coeffs)
+    {
+        free(digits);
+        free(coeffs);
+        Naive_Big_Product(P_limbs, A_limbs, A_len, B_limbs, B_len);
+        return;
+    }
+
+    if (whole)
+    {
+        big_product_piece(
+            P_limbs, A_limbs, A_len, B_limbs, B_len, digits, coeffs
+        );
+
+        free(digits);
+        free(coeffs);
+        return;
+    }
+
+    T_limbs = malloc(sizeof(*T_limbs) * T_len);
+
+    if (!T_limbs)
+    {
+        free(digits);
+        free(coeffs);
+        Naive_Big_Product(P_limbs, A_limbs, A_len, B_limbs, B_len);
+        return;
+    }
+
+    for (k = (size_t)0; k < A_len + B_len; ++k)
+        P_limbs[k] = 0U;
+
+    /*  Add the product of every piece of A with every piece of B into P.     */
+    for (m = (size_t)0; m < A_len; m += A_piece)
+    {
+        const size_t A_step = (A_len - m < A_piece ? A_len - m : A_piece);
+
+        for (n = (size_t)0; n < B_len; n += B_piece)
+        {
+            const size_t B_step = (B_len - n < B_piece ? B_len - n : B_piece);
+
+            big_product_piece(
+                T_limbs, A_limbs + m, A_step, B_limbs + n, B_step,
+                digits, coeffs
+            );
+
+            /*  The partial sums never pass A*B, so the carry stops in P.     */
+            t = 0ULL;
+
+            for (k = (size_t)0; k < A_step + B_step; ++k)
+            {
+                t += (unsigned long long)P_limbs[m + n + k] + T_limbs[k];
+                P_limbs[m + n + k] = (unsigned int)(t & 0xFFFFFFFFULL);
+                t >>= 32;
+            }
+
+            for (k = m + n + A_step + B_step; t != 0ULL; ++k)
+            {
+                t += P_limbs[k];
+                P_limbs[k] = (unsigned int)(t & 0xFFFFFFFFULL);
+                t >>= 32;
+            }
+        }
+    }
+
+    free(T_limbs);
+    free(digits);
+    free(coeffs);
+}
+/*  End of Big_Product.                                                       */
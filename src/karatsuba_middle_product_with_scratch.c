@@ -0,0 +1,303 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the middle coefficients of A*B with the transposed           *
+ *      Karatsuba algorithm, with caller supplied scratch space.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Middle_Scratch_Size                                         *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      Karatsuba_Middle_Product_With_Scratch needs.                          *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial. At most A_len.                    *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *  Method:                                                                   *
+ *      Follow the recursion in Karatsuba_Middle_Product_With_Scratch. With   *
+ *      n the smaller of B_len and A_len - B_len + 1, one middle product of   *
+ *      length n is stored, followed by the scratch for the balanced middle   *
+ *      product of length n. Each balanced level with h = n / 2 stores an     *
+ *      operand of length 2h - 1 and two of length h.                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Middle_Product_With_Scratch                                 *
+ *  Purpose:                                                                  *
+ *      Computes the coefficients of x^(B_len - 1), ..., x^(A_len - 1) in     *
+ *      A*B, as Naive_Middle_Product, in about the time of a Karatsuba        *
+ *      product of B_len coefficients.                                        *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial. At most A_len.                    *
+ *      work (int *):                                                         *
+ *          Scratch space, at least                                           *
+ *          Karatsuba_Middle_Scratch_Size(A_len, B_len) wide.                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *      Naive_Middle_Product (polynomial_multiplication.h):                   *
+ *          Used for short operands.                                          *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Combines the three half size middle products.                     *
+ *  Method:                                                                   *
+ *      The balanced case has A of length 2n - 1 and B of length n. For even  *
+ *      n = 2h, write B = B0 + x^h B1, and let A0, Ah, and A2h be the slices  *
+ *      of A of length 2h - 1 starting at 0, h, and 2h. Then, writing MP for  *
+ *      the middle product,                                                   *
+ *                                                                            *
+ *          alpha = MP(A0 + Ah, B1)                                           *
+ *          beta  = MP(Ah, B0 - B1)                                           *
+ *          gamma = MP(Ah + A2h, B0)                                          *
+ *                                                                            *
+ *      and the lower half of the result is alpha + beta, the upper half      *
+ *      gamma - beta. This is the transpose of Karatsuba's algorithm, with    *
+ *      three middle products of half the size. For odd n the last            *
+ *      coefficient of B, and the last output, are peeled off and added with  *
+ *      O(n) work.                                                            *
+ *                                                                            *
+ *      If A is longer, the output is cut into pieces of length B_len, each   *
+ *      a balanced middle product. If A is shorter, B is cut into pieces of   *
+ *      length A_len - B_len + 1 whose middle products are added. Any remnant *
+ *      is the middle product of a smaller pair, found recursively.           *
+ *  Notes:                                                                    *
+ *      This is the product used by Newton iteration, where only the middle   *
+ *      part of a product is unknown. Requires 1 <= B_len <= A_len.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Number of ints of scratch space needed by karatsuba_middle_balanced.      */
+static size_t karatsuba_middle_balanced_scratch(size_t n, size_t cutoff)
+{
+    /*  Small products are done naively, no scratch space needed.             */
+    if (n <= cutoff)
+        return (size_t)0;
+
+    /*  Odd lengths peel off one term and recurse on the even length.         */
+    if (n & (size_t)1)
+        return karatsuba_middle_balanced_scratch(n - (size_t)1, cutoff);
+
+    /*  Storage for the sums of A, the difference of B, and beta.             */
+    return (size_t)2*n - (size_t)1 +
+           karatsuba_middle_balanced_scratch(n >> 1, cutoff);
+}
+/*  End of karatsuba_middle_balanced_scratch.                                 */
+
+/*  Computes the middle product of A, of length 2n - 1, and B, of length n.   */
+static void
+karatsuba_middle_balanced(int *P_coeffs,
+                          const int *A_coeffs,
+                          const int *B_coeffs,
+                          size_t n,
+                          int *work,
+                          size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h;
+    int *S, *D, *beta, *rest;
+    int sum;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    /*  Small products are faster with the naive method.                      */
+    if (n <= cutoff)
+    {
+        Naive_Middle_Product(P_coeffs, A_coeffs, 2*n - one, B_coeffs, n);
+        return;
+    }
+
+    /*  For odd n, the first n - 1 outputs drop the last term of B, which     *
+     *  contributes B[n - 1] A[t], and the last output is a dot product.      */
+    if (n & one)
+    {
+        karatsuba_middle_balanced(
+            P_coeffs, A_coeffs + one, B_coeffs, n - one, work, cutoff
+        );
+
+        Scaled_AddTo(P_coeffs, A_coeffs, n - one, B_coeffs[n - one]);
+
+        sum = 0;
+
+        for (k = (size_t)0; k < n; ++k)
+            sum += A_coeffs[2*n - 2 - k] * B_coeffs[k];
+
+        P_coeffs[n - one] = sum;
+        return;
+    }
+
+    h = n >> 1;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    S = work;
+    D = S + (2*h - one);
+    beta = D + h;
+    rest = beta + h;
+
+    /*  alpha = MP(A0 + Ah, B1) goes in the lower half of P.                  */
+    for (k = (size_t)0; k < 2*h - one; ++k)
+        S[k] = A_coeffs[k] + A_coeffs[h + k];
+
+    karatsuba_middle_balanced(P_coeffs, S, B_coeffs + h, h, rest, cutoff);
+
+    /*  gamma = MP(Ah + A2h, B0) goes in the upper half.                      */
+    for (k = (size_t)0; k < 2*h - one; ++k)
+        S[k] = A_coeffs[h + k] + A_coeffs[2*h + k];
+
+    karatsuba_middle_balanced(P_coeffs + h, S, B_coeffs, h, rest, cutoff);
+
+    /*  beta = MP(Ah, B0 - B1) is added to the lower half and subtracted from *
+     *  the upper half.                                                       */
+    for (k = (size_t)0; k < h; ++k)
+        D[k] = B_coeffs[k] - B_coeffs[h + k];
+
+    karatsuba_middle_balanced(beta, A_coeffs + h, D, h, rest, cutoff);
+
+    Scaled_AddTo(P_coeffs, beta, h, 1);
+    Scaled_AddTo(P_coeffs + h, beta, h, -1);
+}
+/*  End of karatsuba_middle_balanced.                                         */
+
+/*  Number of ints of scratch space needed for a middle product.              */
+size_t Karatsuba_Middle_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    /*  The length of the output.                                             */
+    const size_t L = A_len - B_len + (size_t)1;
+
+    /*  The pieces are balanced middle products of this length or shorter.    */
+    const size_t n = (L < B_len ? L : B_len);
+
+    if (n <= cutoff)
+        return (size_t)0;
+
+    return n + karatsuba_middle_balanced_scratch(n, cutoff);
+}
+/*  End of Karatsuba_Middle_Scratch_Size.                                     */
+
+/*  Function for computing the middle product with Karatsuba's method.        */
+void
+Karatsuba_Middle_Product_With_Scratch(int *P_coeffs,
+                                      const int *A_coeffs, size_t A_len,
+                                      const int *B_coeffs, size_t B_len,
+                                      int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t shift, remainder;
+
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    /*  The length of the output.                                             */
+    const size_t L = A_len - B_len + (size_t)1;
+
+    /*  Small products are faster with the naive method.                      */
+    if (L <= cutoff || B_len <= cutoff)
+    {
+        Naive_Middle_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    /*  A long A gives several balanced pieces of output, side by side.       */
+    if (L >= B_len)
+    {
+        for (shift = (size_t)0; shift + B_len <= L; shift += B_len)
+            karatsuba_middle_balanced(
+                P_coeffs + shift, A_coeffs + shift, B_coeffs, B_len,
+                work, cutoff
+            );
+
+        /*  The remaining outputs see a shorter window of A.                  */
+        remainder = L - shift;
+
+        if (remainder > (size_t)0)
+            Karatsuba_Middle_Product_With_Scratch(
+                P_coeffs + shift, A_coeffs + shift,
+                remainder + B_len - (size_t)1, B_coeffs, B_len, work
+            );
+
+        return;
+    }
+
+    /*  A long B is cut into pieces of length L, with the remnant at the      *
+     *  start. The piece B[j], ..., B[j + L - 1] pairs with the window of A   *
+     *  starting at B_len - j - L.                                            */
+    remainder = B_len % L;
+
+    if (remainder > (size_t)0)
+        Karatsuba_Middle_Product_With_Scratch(
+            P_coeffs, A_coeffs + (B_len - remainder),
+            L + remainder - (size_t)1, B_coeffs, remainder, work
+        );
+    else
+    {
+        karatsuba_middle_balanced(
+            P_coeffs, A_coeffs + (B_len - L), B_coeffs, L, work, cutoff
+        );
+
+        remainder = L;
+    }
+
+    for (shift = remainder; shift < B_len; shift += L)
+    {
+        karatsuba_middle_balanced(
+            work, A_coeffs + (B_len - shift - L), B_coeffs + shift, L,
+            work + L, cutoff
+        );
+
+        Scaled_AddTo(P_coeffs, work, L, 1);
+    }
+}
+/*  End of Karatsuba_Middle_Product_With_Scratch.                             */
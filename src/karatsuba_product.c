@@ -0,0 +1,125 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients using Karatsuba.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Product                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B using the Karatsuba algorithm.                       *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Product (polynomial_multiplication.h):                          *
+ *          Computes P = A*B for small inputs.                                *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Computes the amount of scratch space needed.                      *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *          Performs the Karatsuba recursion with the allocated scratch.      *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space used by the recursion.                *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^h A1 and B = B0 + x^h B1 where h = ceil(n / 2). Then *
+ *                                                                            *
+ *          A*B = A0*B0 + x^h (Z1 - A0*B0 - A1*B1) + x^{2h} A1*B1             *
+ *                                                                            *
+ *      where Z1 = (A0 + A1)*(B0 + B1). This requires three products of half  *
+ *      the size, which are computed recursively, instead of four. Once the   *
+ *      length is at most the karatsuba_cutoff tunable the naive method is    *
+ *      used instead.                                                         *
+ *                                                                            *
+ *      If A_len < B_len, B is split into chunks of length A_len. Each chunk  *
+ *      is multiplied by A with the balanced algorithm, and the overlapping   *
+ *      parts of consecutive products are added together.                     *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower. Use            *
+ *      Karatsuba_Product_With_Scratch to avoid the allocation entirely.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*B for integer polynomials.                   */
+void
+Karatsuba_Product(int *P_coeffs,
+                  const int *A_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed for the recursion.                 */
+    const size_t size = Karatsuba_Scratch_Size(A_len, B_len);
+    int *work;
+
+    /*  Small products need no scratch space at all.                          */
+    if (size == (size_t)0)
+    {
+        Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    Karatsuba_Product_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Karatsuba_Product.                                                 */
@@ -0,0 +1,254 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Karatsuba multiplication using caller supplied scratch space.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Product_With_Scratch                                        *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B using the Karatsuba algorithm without allocating.    *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Karatsuba_Scratch_Size(A_len, B_len) wide.*
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Product (polynomial_multiplication.h):                          *
+ *          Computes P = A*B for small inputs.                                *
+ *      Naive_AddTo_Sum_Product (polynomial_multiplication.h):                *
+ *          Computes P += (A0 + A1)*B for small inputs.                       *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Computes P += c*A, used to combine the partial products.          *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^h A1 and B = B0 + x^h B1 where h = ceil(n / 2). Then *
+ *                                                                            *
+ *          A*B = A0*B0 + x^h (Z1 - A0*B0 - A1*B1) + x^{2h} A1*B1             *
+ *                                                                            *
+ *      where Z1 = (A0 + A1)*(B0 + B1). This requires three products of half  *
+ *      the size, which are computed recursively, instead of four. Once the   *
+ *      length is at most the karatsuba_cutoff tunable the naive method is    *
+ *      used instead.                                                         *
+ *                                                                            *
+ *      If A_len < B_len, B is split into chunks of length A_len. Each chunk  *
+ *      is multiplied by A with the balanced algorithm, and the overlapping   *
+ *      parts of consecutive products are added together.                     *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. The operands are exchanged  *
+ *      first if A is the longer.                                             *
+ *                                                                            *
+ *      No memory is allocated, so one scratch array may be reused for every  *
+ *      product, for example one per thread. The contents of the scratch      *
+ *      array are overwritten and should not be shared between threads.       *
+ *      The tunables must not change between sizing the scratch array with    *
+ *      Karatsuba_Scratch_Size and calling this function.                     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Computes P = A*B for two polynomials of length n.                         */
+static void
+karatsuba_balanced(int *P_coeffs,
+                   const int *A_coeffs,
+                   const int *B_coeffs,
+                   size_t n,
+                   int *work,
+                   size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l;
+    int *A_sum, *B_sum, *Z1, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Small products are faster with the naive method.                      */
+    if (n <= cutoff)
+    {
+        Naive_Product(P_coeffs, A_coeffs, n, B_coeffs, n);
+        return;
+    }
+
+    /*  Count the level for the recursion depth, see POLY_INSTRUMENT.         */
+    POLY_STATS_DESCEND();
+
+    /*  A0 and B0 have length h, A1 and B1 have length l. Note l <= h.        */
+    h = (n + one) >> 1;
+    l = n - h;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_sum = work;
+    B_sum = A_sum + h;
+    Z1 = B_sum + h;
+    rest = Z1 + (2*h - one);
+
+    /*  A0*B0 goes into the lower 2h - 1 coefficients of P, and A1*B1 into    *
+     *  the upper 2l - 1. The coefficient between them must be zero.          */
+    karatsuba_balanced(P_coeffs, A_coeffs, B_coeffs, h, rest, cutoff);
+    karatsuba_balanced(
+        P_coeffs + 2*h, A_coeffs + h, B_coeffs + h, l, rest, cutoff
+    );
+
+    P_coeffs[2*h - one] = 0;
+
+    /*  Compute B0 + B1. B1 may be one shorter than B0.                       */
+    for (k = zero; k < l; ++k)
+        B_sum[k] = B_coeffs[k] + B_coeffs[h + k];
+
+    if (l < h)
+        B_sum[l] = B_coeffs[l];
+
+    /*  If this is the last level of the recursion, (A0 + A1)*(B0 + B1) is    *
+     *  computed without storing A0 + A1. The first l terms of A0 together    *
+     *  with A1 are handled by Naive_AddTo_Sum_Product, and the final term of *
+     *  A0, if A1 is shorter, is added in as a shifted scalar multiple.       */
+    if (h <= cutoff)
+    {
+        for (k = zero; k + one < 2*h; ++k)
+            Z1[k] = 0;
+
+        Naive_AddTo_Sum_Product(Z1, A_coeffs, A_coeffs + h, l, B_sum, h);
+
+        if (l < h)
+            Scaled_AddTo(Z1 + l, B_sum, h, A_coeffs[l]);
+    }
+
+    /*  Otherwise compute A0 + A1 and recurse.                                */
+    else
+    {
+        for (k = zero; k < l; ++k)
+            A_sum[k] = A_coeffs[k] + A_coeffs[h + k];
+
+        if (l < h)
+            A_sum[l] = A_coeffs[l];
+
+        karatsuba_balanced(Z1, A_sum, B_sum, h, rest, cutoff);
+    }
+
+    /*  The middle term is Z1 - A0*B0 - A1*B1, shifted by h.                  */
+    Scaled_AddTo(Z1, P_coeffs, 2*h - one, -1);
+    Scaled_AddTo(Z1, P_coeffs + 2*h, 2*l - one, -1);
+    Scaled_AddTo(P_coeffs + h, Z1, 2*h - one, 1);
+    POLY_STATS_ASCEND();
+}
+/*  End of karatsuba_balanced.                                                */
+
+/*  Computes P = A*B for polynomials of any lengths.                          */
+void
+Karatsuba_Product_With_Scratch(int *P_coeffs,
+                               const int *A_coeffs, size_t A_len,
+                               const int *B_coeffs, size_t B_len,
+                               int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, shift, remainder;
+    int *T_coeffs, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+    {
+        Karatsuba_Product_With_Scratch(
+            P_coeffs, B_coeffs, B_len, A_coeffs, A_len, work
+        );
+
+        return;
+    }
+
+    /*  If A is small enough the naive method handles any length for B.       */
+    if (A_len <= cutoff)
+    {
+        Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    /*  The first chunk of B is multiplied directly into P.                   */
+    karatsuba_balanced(P_coeffs, A_coeffs, B_coeffs, A_len, work, cutoff);
+
+    if (A_len == B_len)
+        return;
+
+    /*  Later chunks overlap the previous product in A_len - 1 terms, so they *
+     *  are computed in a temporary array and then added in.                  */
+    T_coeffs = work;
+    rest = work + (2*A_len - one);
+
+    for (shift = A_len; shift + A_len <= B_len; shift += A_len)
+    {
+        karatsuba_balanced(
+            T_coeffs, A_coeffs, B_coeffs + shift, A_len, rest, cutoff
+        );
+
+        Scaled_AddTo(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+        for (k = A_len - one; k < 2*A_len - one; ++k)
+            P_coeffs[shift + k] = T_coeffs[k];
+    }
+
+    /*  The final chunk of B may be shorter than A.                           */
+    remainder = B_len - shift;
+
+    if (remainder == zero)
+        return;
+
+    Karatsuba_Product_With_Scratch(
+        T_coeffs, B_coeffs + shift, remainder, A_coeffs, A_len, rest
+    );
+
+    Scaled_AddTo(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+    for (k = A_len - one; k < A_len + remainder - one; ++k)
+        P_coeffs[shift + k] = T_coeffs[k];
+}
+/*  End of Karatsuba_Product_With_Scratch.                                    */
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the scratch space needed by Karatsuba_Product_With_Scratch.  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Scratch_Size                                                *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      Karatsuba_Product_With_Scratch needs to compute A*B.                  *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *  Method:                                                                   *
+ *      Follow the recursion in Karatsuba_Product_With_Scratch. Each balanced *
+ *      level of length n, with h = ceil(n / 2), stores A0 + A1, B0 + B1, and *
+ *      Z1 = (A0 + A1)*(B0 + B1), for 4h - 1 ints, and then reuses the rest   *
+ *      of the array for the next level. Unbalanced products additionally     *
+ *      store one chunk product of length 2 A_len - 1.                        *
+ *  Notes:                                                                    *
+ *      The result is 0 if the product is computed naively, and otherwise     *
+ *      is at most about 8 times the shorter length. The lengths may be given *
+ *      in either order. The size depends on the karatsuba_cutoff tunable,    *
+ *      and is only valid while it is fixed.                                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Number of ints of scratch space needed to multiply two length n arrays.   */
+static size_t karatsuba_balanced_scratch(size_t n, size_t cutoff)
+{
+    /*  The length of the lower half of the split.                            */
+    size_t h;
+
+    /*  Small products are done naively, no scratch space needed.             */
+    if (n <= cutoff)
+        return (size_t)0;
+
+    h = (n + (size_t)1) >> 1;
+
+    /*  Storage for A0 + A1, B0 + B1, and Z1, plus the recursive calls.       */
+    return (size_t)4*h - (size_t)1 + karatsuba_balanced_scratch(h, cutoff);
+}
+/*  End of karatsuba_balanced_scratch.                                        */
+
+/*  Number of ints of scratch space needed to multiply A and B.               */
+size_t Karatsuba_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t full, rest, chunks;
+
+    /*  Zero cast to type "size_t".                                           */
+    const size_t zero = (size_t)0;
+
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+        return Karatsuba_Scratch_Size(B_len, A_len);
+
+    /*  Small products are done naively, no scratch space needed.             */
+    if (A_len <= cutoff)
+        return zero;
+
+    full = karatsuba_balanced_scratch(A_len, cutoff);
+
+    if (A_len == B_len)
+        return full;
+
+    /*  Chunks of B after the first are stored in a temporary array of length *
+     *  2*A_len - 1, followed by the scratch space for the product.           */
+    chunks = B_len % A_len;
+    rest = (chunks == zero ? zero : Karatsuba_Scratch_Size(chunks, A_len));
+
+    if (rest > full)
+        full = rest;
+
+    return (size_t)2*A_len - (size_t)1 + full;
+}
+/*  End of Karatsuba_Scratch_Size.                                            */
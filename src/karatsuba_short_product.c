@@ -0,0 +1,121 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the low coefficients of A*B using Karatsuba products.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Short_Product                                               *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod x^len, the first len coefficients of the         *
+ *      product, with the short product of Mulders.                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Short_Scratch_Size (polynomial_multiplication.h):           *
+ *          Computes the amount of scratch space needed.                      *
+ *      Karatsuba_Short_Product_With_Scratch (polynomial_multiplication.h):   *
+ *          Performs the recursion with the allocated scratch.                *
+ *      Naive_Short_Product (polynomial_multiplication.h):                    *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space used by the recursion.                *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Karatsuba_Short_Product_With_Scratch.                                 *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*B mod x^len with Karatsuba products.         */
+void
+Karatsuba_Short_Product(int *P_coeffs,
+                        const int *A_coeffs, size_t A_len,
+                        const int *B_coeffs, size_t B_len,
+                        size_t len)
+{
+    /*  The amount of scratch space needed for the recursion.                 */
+    const size_t size = Karatsuba_Short_Scratch_Size(A_len, B_len, len);
+    int *work;
+
+    /*  Small products need no scratch space at all.                          */
+    if (size == (size_t)0)
+    {
+        Karatsuba_Short_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Short_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len);
+        return;
+    }
+
+    Karatsuba_Short_Product_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, work
+    );
+
+    free(work);
+}
+/*  End of Karatsuba_Short_Product.                                           */
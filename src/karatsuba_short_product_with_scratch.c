@@ -0,0 +1,321 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the low coefficients of A*B using Karatsuba products, with   *
+ *      caller supplied scratch space.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Short_Scratch_Size                                          *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      Karatsuba_Short_Product_With_Scratch needs.                           *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Scratch space for the full products.                              *
+ *  Method:                                                                   *
+ *      Follow the recursion in Karatsuba_Short_Product_With_Scratch. A level *
+ *      stores its full product, followed by the scratch for computing it,    *
+ *      and then reuses the whole array for the two short products.           *
+ *  Notes:                                                                    *
+ *      The lengths of A and B may be given in either order.                  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Short_Product_With_Scratch                                  *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod x^len, the first len coefficients of the         *
+ *      product, with the short product of Mulders.                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *      work (int *):                                                         *
+ *          Scratch space, at least                                           *
+ *          Karatsuba_Short_Scratch_Size(A_len, B_len, len) wide.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *          Computes the full products.                                       *
+ *      Naive_Short_Product (polynomial_multiplication.h):                    *
+ *          Used for short operands.                                          *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds the short products to P.                                     *
+ *  Method:                                                                   *
+ *      Split at k, with len / 2 <= k < len, and write A = A0 + x^k A1 and    *
+ *      B = B0 + x^k B1. The product A1*B1 starts at x^(2k), past the end,    *
+ *      so                                                                    *
+ *                                                                            *
+ *          A*B mod x^len = A0*B0 + x^k (A1 B0 + A0 B1 mod x^(len - k))       *
+ *                                                                            *
+ *      where A0*B0 is a full Karatsuba product, truncated, and the other two *
+ *      terms are short products of length len - k, found recursively. With   *
+ *      k = len / 2 this is no faster than the full product, but with k near  *
+ *      0.7 len the short product costs about 0.8 of the full one.            *
+ *                                                                            *
+ *      If the whole product fits in len coefficients it is computed in full. *
+ *  Notes:                                                                    *
+ *      A and B may have any lengths, and only their first len coefficients   *
+ *      are used. If len is more than A_len + B_len - 1, the rest of P is     *
+ *      zero. The split is KARATSUBA_SHORT_SPLIT tenths of len.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  The length of A0 and B0 for a short product of length len.                */
+static size_t karatsuba_short_split(size_t len)
+{
+    /*  KARATSUBA_SHORT_SPLIT tenths of len, rounded up, but at least half.   */
+    size_t k = (len*(size_t)KARATSUBA_SHORT_SPLIT + (size_t)9) / (size_t)10;
+
+    if (k < (len + (size_t)1) >> 1)
+        k = (len + (size_t)1) >> 1;
+
+    if (k >= len)
+        k = len - (size_t)1;
+
+    return k;
+}
+/*  End of karatsuba_short_split.                                             */
+
+/*  Number of ints of scratch space needed by karatsuba_short.                */
+static size_t
+karatsuba_short_scratch(size_t A_len, size_t B_len, size_t len, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, l, a, b, full, rest;
+
+    if (A_len > len)
+        A_len = len;
+
+    if (B_len > len)
+        B_len = len;
+
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return (size_t)0;
+
+    a = (A_len < B_len ? A_len : B_len);
+    b = (A_len < B_len ? B_len : A_len);
+
+    /*  Whole products, and short operands, as in karatsuba_short.            */
+    if (a + b - (size_t)1 <= len)
+        return Karatsuba_Scratch_Size(a, b);
+
+    if (a <= cutoff)
+        return (size_t)0;
+
+    k = karatsuba_short_split(len);
+    l = len - k;
+
+    a = (A_len < k ? A_len : k);
+    b = (B_len < k ? B_len : k);
+
+    /*  The full product A0*B0, and the scratch for computing it.             */
+    if (a <= b)
+        full = a + b - (size_t)1 + Karatsuba_Scratch_Size(a, b);
+    else
+        full = a + b - (size_t)1 + Karatsuba_Scratch_Size(b, a);
+
+    /*  The two short products, each stored before its own scratch.           */
+    if (A_len > k)
+    {
+        rest = l + karatsuba_short_scratch(A_len - k, B_len, l, cutoff);
+
+        if (rest > full)
+            full = rest;
+    }
+
+    if (B_len > k)
+    {
+        rest = l + karatsuba_short_scratch(A_len, B_len - k, l, cutoff);
+
+        if (rest > full)
+            full = rest;
+    }
+
+    return full;
+}
+/*  End of karatsuba_short_scratch.                                           */
+
+/*  Computes P = A*B mod x^len.                                               */
+static void
+karatsuba_short(int *P_coeffs,
+                const int *A_coeffs, size_t A_len,
+                const int *B_coeffs, size_t B_len,
+                size_t len, int *work, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k, l, a, b, top;
+
+    /*  Coefficients past x^(len - 1) never contribute.                       */
+    if (A_len > len)
+        A_len = len;
+
+    if (B_len > len)
+        B_len = len;
+
+    a = (A_len < B_len ? A_len : B_len);
+    b = (A_len < B_len ? B_len : A_len);
+
+    /*  The product with an empty polynomial is zero.                         */
+    if (a == (size_t)0)
+    {
+        for (n = (size_t)0; n < len; ++n)
+            P_coeffs[n] = 0;
+
+        return;
+    }
+
+    /*  If nothing is cut off, this is an ordinary product.                   */
+    if (a + b - (size_t)1 <= len)
+    {
+        if (A_len <= B_len)
+            Karatsuba_Product_With_Scratch(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+            );
+        else
+            Karatsuba_Product_With_Scratch(
+                P_coeffs, B_coeffs, B_len, A_coeffs, A_len, work
+            );
+
+        for (n = a + b - (size_t)1; n < len; ++n)
+            P_coeffs[n] = 0;
+
+        return;
+    }
+
+    /*  Small products are faster with the naive method.                      */
+    if (a <= cutoff)
+    {
+        Naive_Short_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len);
+        return;
+    }
+
+    k = karatsuba_short_split(len);
+    l = len - k;
+
+    /*  A0*B0, with A0 and B0 possibly shorter than k.                        */
+    a = (A_len < k ? A_len : k);
+    b = (B_len < k ? B_len : k);
+
+    if (a <= b)
+        Karatsuba_Product_With_Scratch(
+            work, A_coeffs, a, B_coeffs, b, work + (a + b - (size_t)1)
+        );
+    else
+        Karatsuba_Product_With_Scratch(
+            work, B_coeffs, b, A_coeffs, a, work + (a + b - (size_t)1)
+        );
+
+    /*  Keep the part of A0*B0 below x^len. Since k >= len / 2 this is all    *
+     *  of P, unless A0 or B0 is short.                                       */
+    top = (a + b - (size_t)1 < len ? a + b - (size_t)1 : len);
+
+    for (n = (size_t)0; n < top; ++n)
+        P_coeffs[n] = work[n];
+
+    for (; n < len; ++n)
+        P_coeffs[n] = 0;
+
+    /*  x^k A1 B0, where only the first l terms of B0 matter.                 */
+    if (A_len > k)
+    {
+        karatsuba_short(
+            work, A_coeffs + k, A_len - k, B_coeffs, B_len, l, work + l, cutoff
+        );
+
+        Scaled_AddTo(P_coeffs + k, work, l, 1);
+    }
+
+    /*  x^k A0 B1, likewise.                                                  */
+    if (B_len > k)
+    {
+        karatsuba_short(
+            work, A_coeffs, A_len, B_coeffs + k, B_len - k, l, work + l, cutoff
+        );
+
+        Scaled_AddTo(P_coeffs + k, work, l, 1);
+    }
+}
+/*  End of karatsuba_short.                                                   */
+
+/*  Function for computing the scratch space needed for a short product.      */
+size_t Karatsuba_Short_Scratch_Size(size_t A_len, size_t B_len, size_t len)
+{
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    return karatsuba_short_scratch(A_len, B_len, len, cutoff);
+}
+/*  End of Karatsuba_Short_Scratch_Size.                                      */
+
+/*  Function for computing P = A*B mod x^len with Karatsuba products.         */
+void
+Karatsuba_Short_Product_With_Scratch(int *P_coeffs,
+                                     const int *A_coeffs, size_t A_len,
+                                     const int *B_coeffs, size_t B_len,
+                                     size_t len, int *work)
+{
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+
+    karatsuba_short(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, work, cutoff
+    );
+}
+/*  End of Karatsuba_Short_Product_With_Scratch.                              */
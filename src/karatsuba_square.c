@@ -0,0 +1,115 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Square a polynomial with integer coefficients using Karatsuba.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Square                                                      *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A using the Karatsuba algorithm.                       *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Square (polynomial_multiplication.h):                           *
+ *          Computes P = A*A for small inputs.                                *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Computes the amount of scratch space needed.                      *
+ *      Karatsuba_Square_With_Scratch (polynomial_multiplication.h):          *
+ *          Performs the Karatsuba recursion with the allocated scratch.      *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space used by the recursion.                *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^h A1 where h = ceil(len / 2). Then                   *
+ *                                                                            *
+ *          A*A = A0*A0 + x^h (Z1 - A0*A0 - A1*A1) + x^{2h} A1*A1             *
+ *                                                                            *
+ *      where Z1 = (A0 + A1)*(A0 + A1). The three squares of half the size    *
+ *      are computed recursively.                                             *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower. Use            *
+ *      Karatsuba_Square_With_Scratch to avoid the allocation entirely.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*A for integer polynomials.                   */
+void Karatsuba_Square(int *P_coeffs, const int *A_coeffs, size_t len)
+{
+    /*  The amount of scratch space needed for the recursion.                 */
+    const size_t size = Karatsuba_Scratch_Size(len, len);
+    int *work;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    /*  Small squares need no scratch space at all.                           */
+    if (len <= Poly_Get_Tunables()->karatsuba_square_cutoff)
+    {
+        Naive_Square(P_coeffs, A_coeffs, len);
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Square(P_coeffs, A_coeffs, len);
+        return;
+    }
+
+    Karatsuba_Square_With_Scratch(P_coeffs, A_coeffs, len, work);
+    free(work);
+}
+/*  End of Karatsuba_Square.                                                  */
@@ -0,0 +1,150 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Karatsuba squaring using caller supplied scratch space.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Square_With_Scratch                                         *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A using the Karatsuba algorithm without allocating.    *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Karatsuba_Scratch_Size(len, len) wide.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Square (polynomial_multiplication.h):                           *
+ *          Computes P = A*A for small inputs.                                *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Computes P += c*A, used to combine the partial products.          *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which to switch to the naive method.       *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^h A1 where h = ceil(len / 2). Then                   *
+ *                                                                            *
+ *          A*A = A0*A0 + x^h (Z1 - A0*A0 - A1*A1) + x^{2h} A1*A1             *
+ *                                                                            *
+ *      where Z1 = (A0 + A1)*(A0 + A1). All three products are squares, so    *
+ *      the recursion only ever squares, and only one sum is formed per       *
+ *      level. Once the length is at most the karatsuba_square_cutoff         *
+ *      tunable, Naive_Square is used instead.                                *
+ *  Notes:                                                                    *
+ *      Poly_Set_Tunables keeps karatsuba_square_cutoff at or above           *
+ *      karatsuba_cutoff, so this recursion is no deeper than that of the     *
+ *      product, and needs less scratch space at each level. An array sized   *
+ *      for the product of A with itself may be used. The tunables must not   *
+ *      change between sizing the scratch array and calling this function.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Computes P = A*A for a polynomial of length n.                            */
+static void
+karatsuba_square(int *P_coeffs, const int *A_coeffs, size_t n,
+                 int *work, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l;
+    int *A_sum, *Z1, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Small squares are faster with the naive method.                       */
+    if (n <= cutoff)
+    {
+        Naive_Square(P_coeffs, A_coeffs, n);
+        return;
+    }
+
+    /*  Count the level for the recursion depth, see POLY_INSTRUMENT.         */
+    POLY_STATS_DESCEND();
+
+    /*  A0 has length h, A1 has length l. Note l <= h.                        */
+    h = (n + one) >> 1;
+    l = n - h;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_sum = work;
+    Z1 = A_sum + h;
+    rest = Z1 + (2*h - one);
+
+    /*  A0*A0 goes into the lower 2h - 1 coefficients of P, and A1*A1 into    *
+     *  the upper 2l - 1. The coefficient between them must be zero.          */
+    karatsuba_square(P_coeffs, A_coeffs, h, rest, cutoff);
+    karatsuba_square(P_coeffs + 2*h, A_coeffs + h, l, rest, cutoff);
+
+    P_coeffs[2*h - one] = 0;
+
+    /*  Compute A0 + A1. A1 may be one shorter than A0.                       */
+    for (k = zero; k < l; ++k)
+        A_sum[k] = A_coeffs[k] + A_coeffs[h + k];
+
+    if (l < h)
+        A_sum[l] = A_coeffs[l];
+
+    karatsuba_square(Z1, A_sum, h, rest, cutoff);
+
+    /*  The middle term is Z1 - A0*A0 - A1*A1, shifted by h.                  */
+    Scaled_AddTo(Z1, P_coeffs, 2*h - one, -1);
+    Scaled_AddTo(Z1, P_coeffs + 2*h, 2*l - one, -1);
+    Scaled_AddTo(P_coeffs + h, Z1, 2*h - one, 1);
+    POLY_STATS_ASCEND();
+}
+/*  End of karatsuba_square.                                                  */
+
+/*  Function for computing P = A*A with the Karatsuba algorithm.              */
+void
+Karatsuba_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                              int *work)
+{
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->karatsuba_square_cutoff;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    karatsuba_square(P_coeffs, A_coeffs, len, work, cutoff);
+}
+/*  End of Karatsuba_Square_With_Scratch.                                     */
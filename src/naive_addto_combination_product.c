@@ -0,0 +1,118 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes P += (c0 A0 + c1 A1 + ...)*B for integer polynomials.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_AddTo_Combination_Product                                       *
+ *  Purpose:                                                                  *
+ *      Computes P += (c[0] A[0] + ... + c[count-1] A[count-1])*B the naive   *
+ *      way, with one sweep over P for all of the terms.                      *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of terms in the linear combination.                    *
+ *      scalars (const int *):                                                *
+ *          The coefficients c[0], ..., c[count-1] of the combination.        *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the A polynomials, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      The combination is formed NAIVE_COMBINATION_ROWS coefficients at a    *
+ *      time in a small buffer on the stack, which is then passed to the row  *
+ *      kernel as the rows of A. Each coefficient of the combination is       *
+ *      built once from all of the terms, and P is only swept by the kernel,  *
+ *      never once per term.                                                  *
+ *  Notes:                                                                    *
+ *      All A_len + B_len - 1 coefficients of P are added to. P must not      *
+ *      overlap any of the A polynomials or B.                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Function for computing P += (c[0] A[0] + ... + c[count-1] A[count-1])*B.  */
+void
+Naive_AddTo_Combination_Product(int *P_coeffs, size_t count,
+                                const int *scalars,
+                                const int * const *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int S_coeffs[NAIVE_COMBINATION_ROWS];
+    const int *A;
+    size_t m, r, i, rows;
+    int c;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    for (m = (size_t)0; m < A_len; m += rows)
+    {
+        rows = A_len - m;
+
+        if (rows > (size_t)NAIVE_COMBINATION_ROWS)
+            rows = (size_t)NAIVE_COMBINATION_ROWS;
+
+        for (r = (size_t)0; r < rows; ++r)
+            S_coeffs[r] = 0;
+
+        /*  The next rows of the combination, summed over all of the terms.   */
+        for (i = (size_t)0; i < count; ++i)
+        {
+            A = A_coeffs[i] + m;
+            c = scalars[i];
+
+            for (r = (size_t)0; r < rows; ++r)
+                S_coeffs[r] += c * A[r];
+        }
+
+        Naive_Kernel(P_coeffs + m, S_coeffs, NULL, rows, B_coeffs, B_len);
+    }
+}
+/*  End of Naive_AddTo_Combination_Product.                                   */
@@ -41,13 +41,19 @@
  *  Output:                                                                   *
  *      None (void).                                                          *
  *  Called Functions:                                                         *
- *      None.                                                                 *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
  *  Method:                                                                   *
- *      Perform the product using the Cauchy product method.                  *
+ *      Add a scaled copy of B to P for each coefficient of A. The inner      *
+ *      loops have contiguous loads that vectorize well.                      *
  *  Notes:                                                                    *
  *      This is a utility function that assumes certain properties of the     *
  *      inputs. Most importantly it assumes the pointers have had memory      *
  *      allocated and are initialized.                                        *
+ *                                                                            *
+ *      All A_len + B_len - 1 coefficients of P are added to. P must not      *
+ *      overlap A or B, see Naive_AddTo_Product_Overlap for that.             *
  ******************************************************************************
  *                                DEPENDENCIES                                *
  ******************************************************************************
@@ -66,76 +72,13 @@
 /*  size_t provided here.                                                     */
 #include <stddef.h>
 
-/*  Function for computing P += A*B for integer polynomials. This method      *
- *  assumes A_len <= B_len.                                                   */
+/*  Function for computing P += A*B for integer polynomials.                  */
 void
 Naive_AddTo_Product(int *P_coeffs,
                     const int *A_coeffs, size_t A_len,
                     const int *B_coeffs, size_t B_len)
 {
-    /*  Declare necessary variables. C89 requires this at the top.            */
-    size_t m, n;
-
-    /*  Useful constants cast to type "size_t".                               */
-    const size_t zero = (size_t)0;
-    const size_t one = (size_t)1;
-
-    /*  The degrees of the polynomials, given by the lengths of the arrays.   */
-    const size_t A_deg = A_len - one;
-    const size_t B_deg = B_len - one;
-
-    /*  First part of the Cauchy product.                                     *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 |   |   |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    1 | x |   |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    0 | x | x |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = zero; n <= A_deg; ++n)
-        for (m = zero; m <= n; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-
-    /*  Second part of the Cauchy product.                                    *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 | x | x | x |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    1 |   | x | x | x |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    0 |   |   | x | x | x |   |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = A_deg + one; n <= B_deg; ++n)
-    {
-        P_coeffs[n] = A_coeffs[0] * B_coeffs[n];
-
-        for (m = one; m <= A_deg; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-    }
-
-    /*  Third part of the Cauchy product.                                     *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 |   |   |   | x | x | x |                                         *
-     *      |-----------------------|                                         *
-     *    1 |   |   |   |   | x | x |                                         *
-     *      |-----------------------|                                         *
-     *    0 |   |   |   |   |   | x |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = B_deg + one; n <= A_deg + B_deg; ++n)
-    {
-        m = n - B_deg;
-        P_coeffs[n] = A_coeffs[m] * B_coeffs[B_deg];
-
-        for (m = m + one; m <= A_deg; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-    }
+    /*  The kernel adds every product to P without clearing anything.         */
+    Naive_Kernel(P_coeffs, A_coeffs, NULL, A_len, B_coeffs, B_len);
 }
 /*  End of Naive_AddTo_Product.                                               */
@@ -0,0 +1,123 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes P += A0*B0 + A1*B1 + ... for integer polynomials.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_AddTo_Sum_Of_Products                                           *
+ *  Purpose:                                                                  *
+ *      Computes P += A[0]*B[0] + ... + A[count-1]*B[count-1] the naive way,  *
+ *      with one sweep over P for all of the terms.                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of products in the sum.                                *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first factors, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second factors, each B_len long.    *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      Cut each A and B into blocks of NAIVE_SUM_BLOCK coefficients. The     *
+ *      product of block a of A with block b of B only touches                *
+ *                                                                            *
+ *          P[(a + b) W], ..., P[(a + b + 2) W - 2]                           *
+ *                                                                            *
+ *      where W = NAIVE_SUM_BLOCK. The pairs of blocks are visited in order   *
+ *      of d = a + b, and for each d every term of the sum is added before    *
+ *      moving on. The window of P for one d stays in cache while all of the  *
+ *      terms are accumulated into it, so P is streamed through memory once,  *
+ *      rather than once per term.                                            *
+ *  Notes:                                                                    *
+ *      All A_len + B_len - 1 coefficients of P are added to. P must not      *
+ *      overlap any of the A or B polynomials.                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Function for computing P += A[0]*B[0] + ... + A[count-1]*B[count-1].      */
+void
+Naive_AddTo_Sum_Of_Products(int *P_coeffs, size_t count,
+                            const int * const *A_coeffs, size_t A_len,
+                            const int * const *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t d, a, i, m, n, rows, cols, a_first;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t W = (size_t)NAIVE_SUM_BLOCK;
+
+    /*  The number of blocks in each A and each B.                            */
+    const size_t A_blocks = (A_len + W - (size_t)1) / W;
+    const size_t B_blocks = (B_len + W - (size_t)1) / W;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    for (d = (size_t)0; d < A_blocks + B_blocks - (size_t)1; ++d)
+    {
+        /*  The blocks of A paired with an existing block b = d - a of B.     */
+        a_first = (d >= B_blocks ? d - B_blocks + (size_t)1 : (size_t)0);
+
+        for (i = (size_t)0; i < count; ++i)
+        {
+            for (a = a_first; a < A_blocks && a <= d; ++a)
+            {
+                m = a * W;
+                n = (d - a) * W;
+                rows = (A_len - m < W ? A_len - m : W);
+                cols = (B_len - n < W ? B_len - n : W);
+
+                Naive_Kernel(
+                    P_coeffs + m + n, A_coeffs[i] + m, NULL, rows,
+                    B_coeffs[i] + n, cols
+                );
+            }
+        }
+    }
+}
+/*  End of Naive_AddTo_Sum_Of_Products.                                       */
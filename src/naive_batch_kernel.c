@@ -0,0 +1,166 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Selects the fastest kernel for naive multiplication of batches.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel                                                    *
+ *  Purpose:                                                                  *
+ *      Computes P[j] = A[j] * B[j] for up to NAIVE_BATCH_LANES products      *
+ *      side by side, using the fastest version supported by the CPU.         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[j] is at least A_len[j] + B_len[j] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands, from 1 to                      *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands, from 1 to                     *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      count (size_t):                                                       *
+ *          The number of products, from 1 to NAIVE_BATCH_LANES.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Batch_Kernel_Portable (polynomial_multiplication.h):            *
+ *          Used if no SIMD version is available.                             *
+ *      Naive_Batch_Kernel_AVX2 (polynomial_multiplication.h):                *
+ *          Used on x86 CPUs with AVX2.                                       *
+ *      Naive_Batch_Kernel_AVX512 (polynomial_multiplication.h):              *
+ *          Used on x86 CPUs with AVX-512F.                                   *
+ *      Naive_Batch_Kernel_NEON (polynomial_multiplication.h):                *
+ *          Used on ARM CPUs with NEON.                                       *
+ *  Method:                                                                   *
+ *      The same as Naive_Kernel, with the pointer set by                     *
+ *      Naive_Batch_Kernel_Init.                                              *
+ *  Notes:                                                                    *
+ *      As for Naive_Kernel, a program calling the library from threads of    *
+ *      its own must call Poly_Kernel_Init before starting them.              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel_Init                                               *
+ *  Purpose:                                                                  *
+ *      Checks the CPU and stores the kernel used by Naive_Batch_Kernel.      *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      __builtin_cpu_supports (GCC built-in):                                *
+ *          Checks for AVX2 and AVX-512F on x86 CPUs.                         *
+ *      Poly_Kernel_Allows (polynomial_multiplication.h):                     *
+ *          Skips the kernels above the cap set by Poly_Set_Kernel_Level.     *
+ *  Notes:                                                                    *
+ *      Called by Poly_Kernel_Init. It must not run while other threads       *
+ *      are computing products.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function pointer type shared by all of the kernels.                       */
+typedef void
+(*naive_batch_kernel_function)(int * const *P_coeffs,
+                               const int * const *A_coeffs,
+                               const size_t *A_len,
+                               const int * const *B_coeffs,
+                               const size_t *B_len,
+                               size_t count);
+
+/*  Forward declaration, the selector is the initial value of the pointer.    */
+static void
+naive_batch_kernel_select(int * const *P_coeffs,
+                          const int * const *A_coeffs, const size_t *A_len,
+                          const int * const *B_coeffs, const size_t *B_len,
+                          size_t count);
+
+/*  The kernel in use. Set by Naive_Batch_Kernel_Init.                        */
+static naive_batch_kernel_function
+naive_batch_kernel_current = naive_batch_kernel_select;
+
+/*  Function for checking the CPU and storing the best kernel.                */
+void Naive_Batch_Kernel_Init(void)
+{
+    naive_batch_kernel_function kernel = Naive_Batch_Kernel_Portable;
+
+#if defined(POLY_HAS_X86_SIMD)
+    __builtin_cpu_init();
+
+    if (Poly_Kernel_Allows(POLY_KERNEL_AVX512) &&
+        __builtin_cpu_supports("avx512f"))
+        kernel = Naive_Batch_Kernel_AVX512;
+    else if (Poly_Kernel_Allows(POLY_KERNEL_AVX2) &&
+             __builtin_cpu_supports("avx2"))
+        kernel = Naive_Batch_Kernel_AVX2;
+#elif defined(POLY_HAS_NEON)
+    if (Poly_Kernel_Allows(POLY_KERNEL_NEON))
+        kernel = Naive_Batch_Kernel_NEON;
+#endif
+
+    naive_batch_kernel_current = kernel;
+}
+/*  End of Naive_Batch_Kernel_Init.                                           */
+
+/*  Chooses the kernel on the first call, and then calls it.                  */
+static void
+naive_batch_kernel_select(int * const *P_coeffs,
+                          const int * const *A_coeffs, const size_t *A_len,
+                          const int * const *B_coeffs, const size_t *B_len,
+                          size_t count)
+{
+    Naive_Batch_Kernel_Init();
+
+    naive_batch_kernel_current(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, count
+    );
+}
+/*  End of naive_batch_kernel_select.                                         */
+
+/*  Function for computing a batch of products with the naive method.         */
+void
+Naive_Batch_Kernel(int * const *P_coeffs,
+                   const int * const *A_coeffs, const size_t *A_len,
+                   const int * const *B_coeffs, const size_t *B_len,
+                   size_t count)
+{
+    naive_batch_kernel_current(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, count
+    );
+}
+/*  End of Naive_Batch_Kernel.                                                */
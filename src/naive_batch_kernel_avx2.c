@@ -0,0 +1,317 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      AVX2 kernel for naive multiplication of a batch of products.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel_AVX2                                               *
+ *  Purpose:                                                                  *
+ *      Computes P[j] = A[j] * B[j] for up to NAIVE_BATCH_LANES products      *
+ *      side by side.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[j] is at least A_len[j] + B_len[j] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands, from 1 to                      *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands, from 1 to                     *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      count (size_t):                                                       *
+ *          The number of products, from 1 to NAIVE_BATCH_LANES.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The 16 lanes of a batch fill two vectors. The operands are loaded 8   *
+ *      coefficients of 8 products at a time, with masked loads that read     *
+ *      zeros past the end of each operand, and transposed in registers, so   *
+ *      that coefficient m of every product sits in two vectors. Each half    *
+ *      of the lanes is then done on its own. The outputs are computed four   *
+ *      at a time, P[k], ..., P[k + 3], in four registers, so each load of    *
+ *      A[m] feeds four vpmulld, and the rows of B slide through registers    *
+ *      with one new load per step. Zero rows around B stand in for the       *
+ *      missing terms at the ends of the tile. The outputs are transposed     *
+ *      back the same way and written with masked stores, so nothing past     *
+ *      the end of any product is touched.                                    *
+ *  Notes:                                                                    *
+ *      Only compiled for x86 with GCC compatible compilers. The function is  *
+ *      built for AVX2 with a target attribute, so the rest of the library    *
+ *      does not need -mavx2. Only call this if the CPU supports AVX2.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) immintrin.h:                                                          *
+ *          Header file providing the AVX2 intrinsics.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The x86 intrinsics are only available with GCC compatible compilers.      */
+#ifdef POLY_HAS_X86_SIMD
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  AVX2 intrinsics found here.                                               */
+#include <immintrin.h>
+
+/*  The kernel assumes two vectors hold every lane.                           */
+#if NAIVE_BATCH_LANES != 16
+#error "Naive_Batch_Kernel_AVX2 requires NAIVE_BATCH_LANES == 16."
+#endif
+
+/*  The mask selecting indices start, ..., start + 7 that are below len, for  *
+ *  start < len.                                                              */
+__attribute__((target("avx2")))
+static __m256i naive_batch_kernel_avx2_mask(size_t start, size_t len)
+{
+    /*  The number of valid indices, at most 8.                               */
+    const size_t valid = (len - start < (size_t)8 ? len - start : (size_t)8);
+
+    return _mm256_cmpgt_epi32(
+        _mm256_set1_epi32((int)valid), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)
+    );
+}
+/*  End of naive_batch_kernel_avx2_mask.                                      */
+
+/*  Transposes the 8 x 8 matrix whose rows are the 8 vectors.                 */
+__attribute__((target("avx2")))
+static void naive_batch_kernel_avx2_transpose(__m256i *rows)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    __m256i t[8], u[8];
+    size_t n, q;
+
+    /*  Interleave pairs of rows.                                             */
+    for (n = (size_t)0; n < (size_t)8; n += (size_t)2)
+    {
+        t[n] = _mm256_unpacklo_epi32(rows[n], rows[n + 1]);
+        t[n + 1] = _mm256_unpackhi_epi32(rows[n], rows[n + 1]);
+    }
+
+    /*  128-bit lane L of u[4g + q] holds column 4L + q of rows 4g to 4g + 3. */
+    for (n = (size_t)0; n < (size_t)8; n += (size_t)4)
+    {
+        u[n] = _mm256_unpacklo_epi64(t[n], t[n + 2]);
+        u[n + 1] = _mm256_unpackhi_epi64(t[n], t[n + 2]);
+        u[n + 2] = _mm256_unpacklo_epi64(t[n + 1], t[n + 3]);
+        u[n + 3] = _mm256_unpackhi_epi64(t[n + 1], t[n + 3]);
+    }
+
+    /*  Join the two halves of each column.                                   */
+    for (q = (size_t)0; q < (size_t)4; ++q)
+    {
+        rows[q] = _mm256_permute2x128_si256(u[q], u[q + 4], 0x20);
+        rows[q + 4] = _mm256_permute2x128_si256(u[q], u[q + 4], 0x31);
+    }
+}
+/*  End of naive_batch_kernel_avx2_transpose.                                 */
+
+/*  Interleaves the first length coefficients of each operand, coefficient m  *
+ *  of lane j at m*16 + j, with zeros in the unused lanes.                    */
+__attribute__((target("avx2")))
+static void
+naive_batch_kernel_avx2_interleave(int *lanes,
+                                   const int * const *coeffs,
+                                   const size_t *lens,
+                                   size_t count, size_t length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    __m256i rows[8];
+    size_t m, h, j, rem;
+
+    for (m = (size_t)0; m < length; m += (size_t)8)
+    {
+        rem = (length - m < (size_t)8 ? length - m : (size_t)8);
+
+        /*  Lanes 8h to 8h + 7 are transposed together.                       */
+        for (h = (size_t)0; h < (size_t)16; h += (size_t)8)
+        {
+            for (j = (size_t)0; j < (size_t)8; ++j)
+            {
+                /*  Operands that end before m are not read past their end.   */
+                if (h + j < count && lens[h + j] > m)
+                    rows[j] = _mm256_maskload_epi32(
+                        coeffs[h + j] + m,
+                        naive_batch_kernel_avx2_mask(m, lens[h + j])
+                    );
+                else
+                    rows[j] = _mm256_setzero_si256();
+            }
+
+            naive_batch_kernel_avx2_transpose(rows);
+
+            for (j = (size_t)0; j < rem; ++j)
+                _mm256_storeu_si256(
+                    (__m256i *)(lanes + 16*(m + j) + h), rows[j]
+                );
+        }
+    }
+}
+/*  End of naive_batch_kernel_avx2_interleave.                                */
+
+/*  Function for computing a batch of products with the naive method.         */
+__attribute__((target("avx2")))
+void
+Naive_Batch_Kernel_AVX2(int * const *P_coeffs,
+                        const int * const *A_coeffs, const size_t *A_len,
+                        const int * const *B_coeffs, const size_t *B_len,
+                        size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t j, h, k, m, first, last, rem, len, P_len;
+    __m256i acc0, acc1, acc2, acc3, a, b0, b1, b2, b3, rows[8];
+    const int *B_row;
+
+    /*  The interleaved operands and products. B has four rows of zeros       *
+     *  before it and three after, and P is rounded up to a whole tile.       */
+    int A_lanes[16 * NAIVE_BATCH_MAX_LENGTH];
+    int B_pad[16 * (NAIVE_BATCH_MAX_LENGTH + 7)];
+    int P_lanes[16 * (2*NAIVE_BATCH_MAX_LENGTH + 2)];
+    int * const B_lanes = B_pad + 16*4;
+
+    /*  Every lane is padded to the longest operands in the batch.            */
+    size_t A_max = (size_t)0;
+    size_t B_max = (size_t)0;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    for (j = (size_t)0; j < count; ++j)
+    {
+        if (A_len[j] > A_max)
+            A_max = A_len[j];
+
+        if (B_len[j] > B_max)
+            B_max = B_len[j];
+    }
+
+    naive_batch_kernel_avx2_interleave(A_lanes, A_coeffs, A_len, count, A_max);
+    naive_batch_kernel_avx2_interleave(B_lanes, B_coeffs, B_len, count, B_max);
+
+    for (m = (size_t)0; m < (size_t)8; ++m)
+        _mm256_storeu_si256((__m256i *)(B_pad + 8*m), _mm256_setzero_si256());
+
+    for (m = (size_t)0; m < (size_t)6; ++m)
+        _mm256_storeu_si256(
+            (__m256i *)(B_lanes + 16*B_max + 8*m), _mm256_setzero_si256()
+        );
+
+    P_len = A_max + B_max - one;
+
+    /*  Each half of the lanes is done separately, so that a tile fits in     *
+     *  the 16 registers.                                                     */
+    for (h = (size_t)0; h < count; h += (size_t)8)
+    {
+        /*  Outputs are computed four at a time, sharing each load of A[m].   */
+        for (k = (size_t)0; k < P_len; k += (size_t)4)
+        {
+            /*  The terms of P[k], ..., P[k + 3] have first <= m <= last.     *
+             *  The rest of the range multiplies A[m] by the zeros around B.  */
+            first = (k < B_max ? (size_t)0 : k - B_max + one);
+            last = (k + (size_t)3 < A_max ? k + (size_t)3 : A_max - one);
+
+            /*  br holds B[k + r - m], and slides down one row per step.      */
+            B_row = B_lanes + 16*(k - first) + h;
+            b0 = _mm256_loadu_si256((const __m256i *)B_row);
+            b1 = _mm256_loadu_si256((const __m256i *)(B_row + 16));
+            b2 = _mm256_loadu_si256((const __m256i *)(B_row + 32));
+            b3 = _mm256_loadu_si256((const __m256i *)(B_row + 48));
+
+            acc0 = _mm256_setzero_si256();
+            acc1 = acc0;
+            acc2 = acc0;
+            acc3 = acc0;
+
+            for (m = first; m <= last; ++m)
+            {
+                a = _mm256_loadu_si256((const __m256i *)(A_lanes + 16*m + h));
+                acc0 = _mm256_add_epi32(acc0, _mm256_mullo_epi32(a, b0));
+                acc1 = _mm256_add_epi32(acc1, _mm256_mullo_epi32(a, b1));
+                acc2 = _mm256_add_epi32(acc2, _mm256_mullo_epi32(a, b2));
+                acc3 = _mm256_add_epi32(acc3, _mm256_mullo_epi32(a, b3));
+
+                B_row -= 16;
+                b3 = b2;
+                b2 = b1;
+                b1 = b0;
+                b0 = _mm256_loadu_si256((const __m256i *)B_row);
+            }
+
+            _mm256_storeu_si256((__m256i *)(P_lanes + 16*k + h), acc0);
+            _mm256_storeu_si256((__m256i *)(P_lanes + 16*k + h + 16), acc1);
+            _mm256_storeu_si256((__m256i *)(P_lanes + 16*k + h + 32), acc2);
+            _mm256_storeu_si256((__m256i *)(P_lanes + 16*k + h + 48), acc3);
+        }
+    }
+
+    /*  Transpose the products back, 8 coefficients of 8 lanes at a time.     */
+    for (k = (size_t)0; k < P_len; k += (size_t)8)
+    {
+        rem = (P_len - k < (size_t)8 ? P_len - k : (size_t)8);
+
+        for (h = (size_t)0; h < count; h += (size_t)8)
+        {
+            for (m = (size_t)0; m < (size_t)8; ++m)
+            {
+                if (m < rem)
+                    rows[m] = _mm256_loadu_si256(
+                        (const __m256i *)(P_lanes + 16*(k + m) + h)
+                    );
+                else
+                    rows[m] = _mm256_setzero_si256();
+            }
+
+            naive_batch_kernel_avx2_transpose(rows);
+
+            for (j = (size_t)0; j < (size_t)8 && h + j < count; ++j)
+            {
+                len = A_len[h + j] + B_len[h + j] - one;
+
+                if (len > k)
+                    _mm256_maskstore_epi32(
+                        P_coeffs[h + j] + k,
+                        naive_batch_kernel_avx2_mask(k, len),
+                        rows[j]
+                    );
+            }
+        }
+    }
+}
+/*  End of Naive_Batch_Kernel_AVX2.                                           */
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
@@ -0,0 +1,308 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      AVX-512 kernel for naive multiplication of a batch of products.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel_AVX512                                             *
+ *  Purpose:                                                                  *
+ *      Computes P[j] = A[j] * B[j] for up to NAIVE_BATCH_LANES products      *
+ *      side by side.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[j] is at least A_len[j] + B_len[j] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands, from 1 to                      *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands, from 1 to                     *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      count (size_t):                                                       *
+ *          The number of products, from 1 to NAIVE_BATCH_LANES.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The 16 lanes of a batch fill one vector. The operands are loaded 16   *
+ *      coefficients of 16 products at a time, with masked loads that read    *
+ *      zeros past the end of each operand, and transposed in registers, so   *
+ *      that coefficient m of every product sits in one vector. The outputs   *
+ *      are computed four at a time, P[k], ..., P[k + 3], in four registers,  *
+ *      so each load of A[m] feeds four vpmulld, and the rows of B slide      *
+ *      through registers with one new load per step. Zero rows around B      *
+ *      stand in for the missing terms at the ends of the tile. The outputs   *
+ *      are transposed back 16 at a time and written with masked stores, so   *
+ *      nothing past the end of any product is touched.                       *
+ *  Notes:                                                                    *
+ *      Only compiled for x86 with GCC compatible compilers. The function is  *
+ *      built for AVX-512F with a target attribute, so the rest of the        *
+ *      library does not need -mavx512f. Only call this if the CPU supports   *
+ *      AVX-512F.                                                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) immintrin.h:                                                          *
+ *          Header file providing the AVX-512 intrinsics.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The x86 intrinsics are only available with GCC compatible compilers.      */
+#ifdef POLY_HAS_X86_SIMD
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  AVX-512 intrinsics found here.                                            */
+#include <immintrin.h>
+
+/*  The kernel assumes one vector holds every lane.                           */
+#if NAIVE_BATCH_LANES != 16
+#error "Naive_Batch_Kernel_AVX512 requires NAIVE_BATCH_LANES == 16."
+#endif
+
+/*  The mask selecting indices start, ..., start + 15 that are below len,     *
+ *  for start < len.                                                          */
+static __mmask16 naive_batch_kernel_avx512_mask(size_t start, size_t len)
+{
+    if (len - start >= (size_t)16)
+        return (__mmask16)0xFFFFU;
+
+    return (__mmask16)((1U << (len - start)) - 1U);
+}
+/*  End of naive_batch_kernel_avx512_mask.                                    */
+
+/*  Transposes the 16 x 16 matrix whose rows are the 16 vectors.              */
+__attribute__((target("avx512f")))
+static void naive_batch_kernel_avx512_transpose(__m512i *rows)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    __m512i t[16], u[16], v0, v1, v2, v3;
+    size_t n, q;
+
+    /*  Interleave pairs of rows.                                             */
+    for (n = (size_t)0; n < (size_t)16; n += (size_t)2)
+    {
+        t[n] = _mm512_unpacklo_epi32(rows[n], rows[n + 1]);
+        t[n + 1] = _mm512_unpackhi_epi32(rows[n], rows[n + 1]);
+    }
+
+    /*  128-bit lane L of u[4g + q] holds column 4L + q of rows 4g to 4g + 3. */
+    for (n = (size_t)0; n < (size_t)16; n += (size_t)4)
+    {
+        u[n] = _mm512_unpacklo_epi64(t[n], t[n + 2]);
+        u[n + 1] = _mm512_unpackhi_epi64(t[n], t[n + 2]);
+        u[n + 2] = _mm512_unpacklo_epi64(t[n + 1], t[n + 3]);
+        u[n + 3] = _mm512_unpackhi_epi64(t[n + 1], t[n + 3]);
+    }
+
+    /*  Gather the four 128-bit pieces of each column.                        */
+    for (q = (size_t)0; q < (size_t)4; ++q)
+    {
+        v0 = _mm512_shuffle_i32x4(u[q], u[q + 4], 0x44);
+        v1 = _mm512_shuffle_i32x4(u[q], u[q + 4], 0xEE);
+        v2 = _mm512_shuffle_i32x4(u[q + 8], u[q + 12], 0x44);
+        v3 = _mm512_shuffle_i32x4(u[q + 8], u[q + 12], 0xEE);
+
+        rows[q] = _mm512_shuffle_i32x4(v0, v2, 0x88);
+        rows[q + 4] = _mm512_shuffle_i32x4(v0, v2, 0xDD);
+        rows[q + 8] = _mm512_shuffle_i32x4(v1, v3, 0x88);
+        rows[q + 12] = _mm512_shuffle_i32x4(v1, v3, 0xDD);
+    }
+}
+/*  End of naive_batch_kernel_avx512_transpose.                               */
+
+/*  Interleaves the first length coefficients of each operand, coefficient m  *
+ *  of lane j at m*16 + j, with zeros in the unused lanes.                    */
+__attribute__((target("avx512f")))
+static void
+naive_batch_kernel_avx512_interleave(int *lanes,
+                                     const int * const *coeffs,
+                                     const size_t *lens,
+                                     size_t count, size_t length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    __m512i rows[16];
+    size_t m, j, rem;
+
+    for (m = (size_t)0; m < length; m += (size_t)16)
+    {
+        for (j = (size_t)0; j < (size_t)16; ++j)
+        {
+            /*  Operands that end before m are not read past their end.       */
+            if (j < count && lens[j] > m)
+                rows[j] = _mm512_maskz_loadu_epi32(
+                    naive_batch_kernel_avx512_mask(m, lens[j]), coeffs[j] + m
+                );
+            else
+                rows[j] = _mm512_setzero_si512();
+        }
+
+        naive_batch_kernel_avx512_transpose(rows);
+        rem = (length - m < (size_t)16 ? length - m : (size_t)16);
+
+        for (j = (size_t)0; j < rem; ++j)
+            _mm512_storeu_si512((void *)(lanes + 16*(m + j)), rows[j]);
+    }
+}
+/*  End of naive_batch_kernel_avx512_interleave.                              */
+
+/*  Function for computing a batch of products with the naive method.         */
+__attribute__((target("avx512f")))
+void
+Naive_Batch_Kernel_AVX512(int * const *P_coeffs,
+                          const int * const *A_coeffs, const size_t *A_len,
+                          const int * const *B_coeffs, const size_t *B_len,
+                          size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t j, k, m, first, last, rem, len, P_len;
+    __m512i acc0, acc1, acc2, acc3, a, b0, b1, b2, b3, rows[16];
+    const int *B_row;
+
+    /*  The interleaved operands and products. B has four rows of zeros       *
+     *  before it and three after, and P is rounded up to a whole tile.       */
+    int A_lanes[16 * NAIVE_BATCH_MAX_LENGTH];
+    int B_pad[16 * (NAIVE_BATCH_MAX_LENGTH + 7)];
+    int P_lanes[16 * (2*NAIVE_BATCH_MAX_LENGTH + 2)];
+    int * const B_lanes = B_pad + 16*4;
+
+    /*  Every lane is padded to the longest operands in the batch.            */
+    size_t A_max = (size_t)0;
+    size_t B_max = (size_t)0;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    for (j = (size_t)0; j < count; ++j)
+    {
+        if (A_len[j] > A_max)
+            A_max = A_len[j];
+
+        if (B_len[j] > B_max)
+            B_max = B_len[j];
+    }
+
+    naive_batch_kernel_avx512_interleave(
+        A_lanes, A_coeffs, A_len, count, A_max
+    );
+
+    naive_batch_kernel_avx512_interleave(
+        B_lanes, B_coeffs, B_len, count, B_max
+    );
+
+    for (m = (size_t)0; m < (size_t)4; ++m)
+        _mm512_storeu_si512((void *)(B_pad + 16*m), _mm512_setzero_si512());
+
+    for (m = B_max; m < B_max + (size_t)3; ++m)
+        _mm512_storeu_si512((void *)(B_lanes + 16*m), _mm512_setzero_si512());
+
+    P_len = A_max + B_max - one;
+
+    /*  Outputs are computed four at a time, sharing each load of A[m].       */
+    for (k = (size_t)0; k < P_len; k += (size_t)4)
+    {
+        /*  The terms of P[k], ..., P[k + 3] have first <= m <= last. The     *
+         *  rest of the range multiplies A[m] by the zeros around B.          */
+        first = (k < B_max ? (size_t)0 : k - B_max + one);
+        last = (k + (size_t)3 < A_max ? k + (size_t)3 : A_max - one);
+
+        /*  br holds B[k + r - m], and slides down one row per step.          */
+        B_row = B_lanes + 16*(k - first);
+        b0 = _mm512_loadu_si512((const void *)B_row);
+        b1 = _mm512_loadu_si512((const void *)(B_row + 16));
+        b2 = _mm512_loadu_si512((const void *)(B_row + 32));
+        b3 = _mm512_loadu_si512((const void *)(B_row + 48));
+
+        acc0 = _mm512_setzero_si512();
+        acc1 = acc0;
+        acc2 = acc0;
+        acc3 = acc0;
+
+        for (m = first; m <= last; ++m)
+        {
+            a = _mm512_loadu_si512((const void *)(A_lanes + 16*m));
+            acc0 = _mm512_add_epi32(acc0, _mm512_mullo_epi32(a, b0));
+            acc1 = _mm512_add_epi32(acc1, _mm512_mullo_epi32(a, b1));
+            acc2 = _mm512_add_epi32(acc2, _mm512_mullo_epi32(a, b2));
+            acc3 = _mm512_add_epi32(acc3, _mm512_mullo_epi32(a, b3));
+
+            B_row -= 16;
+            b3 = b2;
+            b2 = b1;
+            b1 = b0;
+            b0 = _mm512_loadu_si512((const void *)B_row);
+        }
+
+        _mm512_storeu_si512((void *)(P_lanes + 16*k), acc0);
+        _mm512_storeu_si512((void *)(P_lanes + 16*k + 16), acc1);
+        _mm512_storeu_si512((void *)(P_lanes + 16*k + 32), acc2);
+        _mm512_storeu_si512((void *)(P_lanes + 16*k + 48), acc3);
+    }
+
+    /*  Transpose the products back, 16 coefficients at a time.               */
+    for (k = (size_t)0; k < P_len; k += (size_t)16)
+    {
+        rem = (P_len - k < (size_t)16 ? P_len - k : (size_t)16);
+
+        for (m = (size_t)0; m < (size_t)16; ++m)
+        {
+            if (m < rem)
+                rows[m] = _mm512_loadu_si512(
+                    (const void *)(P_lanes + 16*(k + m))
+                );
+            else
+                rows[m] = _mm512_setzero_si512();
+        }
+
+        naive_batch_kernel_avx512_transpose(rows);
+
+        for (j = (size_t)0; j < count; ++j)
+        {
+            len = A_len[j] + B_len[j] - one;
+
+            if (len > k)
+                _mm512_mask_storeu_epi32(
+                    P_coeffs[j] + k,
+                    naive_batch_kernel_avx512_mask(k, len),
+                    rows[j]
+                );
+        }
+    }
+}
+/*  End of Naive_Batch_Kernel_AVX512.                                         */
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
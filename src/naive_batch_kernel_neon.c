@@ -0,0 +1,296 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      NEON kernel for naive multiplication of a batch of products.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel_NEON                                               *
+ *  Purpose:                                                                  *
+ *      Computes P[j] = A[j] * B[j] for up to NAIVE_BATCH_LANES products      *
+ *      side by side.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[j] is at least A_len[j] + B_len[j] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands, from 1 to                      *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands, from 1 to                     *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      count (size_t):                                                       *
+ *          The number of products, from 1 to NAIVE_BATCH_LANES.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The 16 lanes of a batch fill four vectors. The operands are loaded 4  *
+ *      coefficients of 4 products at a time and transposed in registers, so  *
+ *      that coefficient m of every product sits in four vectors. Each        *
+ *      quarter of the lanes is then done on its own. The outputs are         *
+ *      computed four at a time, P[k], ..., P[k + 3], in four registers, so   *
+ *      each load of A[m] feeds four vmlaq_s32, and the rows of B slide       *
+ *      through registers with one new load per step. Zero rows around B      *
+ *      stand in for the missing terms at the ends of the tile. The outputs   *
+ *      are transposed back the same way.                                     *
+ *  Notes:                                                                    *
+ *      Only compiled when NEON is available, which is always the case on     *
+ *      AArch64 targets. NEON has no masked loads, so the partial vectors at  *
+ *      the end of each operand and product go through a small buffer on the  *
+ *      stack.                                                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) arm_neon.h:                                                           *
+ *          Header file providing the NEON intrinsics.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The NEON intrinsics are only available on ARM.                            */
+#ifdef POLY_HAS_NEON
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  NEON intrinsics found here.                                               */
+#include <arm_neon.h>
+
+/*  The kernel assumes four vectors hold every lane.                          */
+#if NAIVE_BATCH_LANES != 16
+#error "Naive_Batch_Kernel_NEON requires NAIVE_BATCH_LANES == 16."
+#endif
+
+/*  Transposes the 4 x 4 matrix whose rows are the 4 vectors.                 */
+static void naive_batch_kernel_neon_transpose(int32x4_t *rows)
+{
+    /*  Pairs of rows with alternate entries swapped.                         */
+    const int32x4x2_t p01 = vtrnq_s32(rows[0], rows[1]);
+    const int32x4x2_t p23 = vtrnq_s32(rows[2], rows[3]);
+
+    rows[0] = vcombine_s32(vget_low_s32(p01.val[0]), vget_low_s32(p23.val[0]));
+    rows[1] = vcombine_s32(vget_low_s32(p01.val[1]), vget_low_s32(p23.val[1]));
+
+    rows[2] = vcombine_s32(
+        vget_high_s32(p01.val[0]), vget_high_s32(p23.val[0])
+    );
+
+    rows[3] = vcombine_s32(
+        vget_high_s32(p01.val[1]), vget_high_s32(p23.val[1])
+    );
+}
+/*  End of naive_batch_kernel_neon_transpose.                                 */
+
+/*  Interleaves the first length coefficients of each operand, coefficient m  *
+ *  of lane j at m*16 + j, with zeros in the unused lanes.                    */
+static void
+naive_batch_kernel_neon_interleave(int *lanes,
+                                   const int * const *coeffs,
+                                   const size_t *lens,
+                                   size_t count, size_t length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int32x4_t rows[4];
+    size_t m, h, j, n, rem;
+    int tail[4];
+
+    for (m = (size_t)0; m < length; m += (size_t)4)
+    {
+        rem = (length - m < (size_t)4 ? length - m : (size_t)4);
+
+        /*  Lanes h to h + 3 are transposed together.                         */
+        for (h = (size_t)0; h < (size_t)16; h += (size_t)4)
+        {
+            for (j = (size_t)0; j < (size_t)4; ++j)
+            {
+                if (h + j >= count || lens[h + j] <= m)
+                    rows[j] = vdupq_n_s32(0);
+                else if (lens[h + j] - m >= (size_t)4)
+                    rows[j] = vld1q_s32(coeffs[h + j] + m);
+                else
+                {
+                    for (n = (size_t)0; n < (size_t)4; ++n)
+                        if (m + n < lens[h + j])
+                            tail[n] = coeffs[h + j][m + n];
+                        else
+                            tail[n] = 0;
+
+                    rows[j] = vld1q_s32(tail);
+                }
+            }
+
+            naive_batch_kernel_neon_transpose(rows);
+
+            for (j = (size_t)0; j < rem; ++j)
+                vst1q_s32(lanes + 16*(m + j) + h, rows[j]);
+        }
+    }
+}
+/*  End of naive_batch_kernel_neon_interleave.                                */
+
+/*  Function for computing a batch of products with the naive method.         */
+void
+Naive_Batch_Kernel_NEON(int * const *P_coeffs,
+                        const int * const *A_coeffs, const size_t *A_len,
+                        const int * const *B_coeffs, const size_t *B_len,
+                        size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t j, h, k, m, n, first, last, rem, len, P_len;
+    int32x4_t acc0, acc1, acc2, acc3, a, b0, b1, b2, b3, rows[4];
+    const int *B_row;
+    int tail[4];
+
+    /*  The interleaved operands and products. B has four rows of zeros       *
+     *  before it and three after, and P is rounded up to a whole tile.       */
+    int A_lanes[16 * NAIVE_BATCH_MAX_LENGTH];
+    int B_pad[16 * (NAIVE_BATCH_MAX_LENGTH + 7)];
+    int P_lanes[16 * (2*NAIVE_BATCH_MAX_LENGTH + 2)];
+    int * const B_lanes = B_pad + 16*4;
+
+    /*  Every lane is padded to the longest operands in the batch.            */
+    size_t A_max = (size_t)0;
+    size_t B_max = (size_t)0;
+
+    /*  Useful constants.                                                     */
+    const size_t one = (size_t)1;
+    const int32x4_t zero = vdupq_n_s32(0);
+
+    for (j = (size_t)0; j < count; ++j)
+    {
+        if (A_len[j] > A_max)
+            A_max = A_len[j];
+
+        if (B_len[j] > B_max)
+            B_max = B_len[j];
+    }
+
+    naive_batch_kernel_neon_interleave(A_lanes, A_coeffs, A_len, count, A_max);
+    naive_batch_kernel_neon_interleave(B_lanes, B_coeffs, B_len, count, B_max);
+
+    for (m = (size_t)0; m < (size_t)16; ++m)
+        vst1q_s32(B_pad + 4*m, zero);
+
+    for (m = (size_t)0; m < (size_t)12; ++m)
+        vst1q_s32(B_lanes + 16*B_max + 4*m, zero);
+
+    P_len = A_max + B_max - one;
+
+    /*  Each quarter of the lanes is done separately, so that a tile stays    *
+     *  in registers.                                                         */
+    for (h = (size_t)0; h < count; h += (size_t)4)
+    {
+        /*  Outputs are computed four at a time, sharing each load of A[m].   */
+        for (k = (size_t)0; k < P_len; k += (size_t)4)
+        {
+            /*  The terms of P[k], ..., P[k + 3] have first <= m <= last.     *
+             *  The rest of the range multiplies A[m] by the zeros around B.  */
+            first = (k < B_max ? (size_t)0 : k - B_max + one);
+            last = (k + (size_t)3 < A_max ? k + (size_t)3 : A_max - one);
+
+            /*  br holds B[k + r - m], and slides down one row per step.      */
+            B_row = B_lanes + 16*(k - first) + h;
+            b0 = vld1q_s32(B_row);
+            b1 = vld1q_s32(B_row + 16);
+            b2 = vld1q_s32(B_row + 32);
+            b3 = vld1q_s32(B_row + 48);
+
+            acc0 = zero;
+            acc1 = zero;
+            acc2 = zero;
+            acc3 = zero;
+
+            for (m = first; m <= last; ++m)
+            {
+                a = vld1q_s32(A_lanes + 16*m + h);
+                acc0 = vmlaq_s32(acc0, a, b0);
+                acc1 = vmlaq_s32(acc1, a, b1);
+                acc2 = vmlaq_s32(acc2, a, b2);
+                acc3 = vmlaq_s32(acc3, a, b3);
+
+                B_row -= 16;
+                b3 = b2;
+                b2 = b1;
+                b1 = b0;
+                b0 = vld1q_s32(B_row);
+            }
+
+            vst1q_s32(P_lanes + 16*k + h, acc0);
+            vst1q_s32(P_lanes + 16*k + h + 16, acc1);
+            vst1q_s32(P_lanes + 16*k + h + 32, acc2);
+            vst1q_s32(P_lanes + 16*k + h + 48, acc3);
+        }
+    }
+
+    /*  Transpose the products back, 4 coefficients of 4 lanes at a time.     */
+    for (k = (size_t)0; k < P_len; k += (size_t)4)
+    {
+        rem = (P_len - k < (size_t)4 ? P_len - k : (size_t)4);
+
+        for (h = (size_t)0; h < count; h += (size_t)4)
+        {
+            for (m = (size_t)0; m < (size_t)4; ++m)
+            {
+                if (m < rem)
+                    rows[m] = vld1q_s32(P_lanes + 16*(k + m) + h);
+                else
+                    rows[m] = zero;
+            }
+
+            naive_batch_kernel_neon_transpose(rows);
+
+            for (j = (size_t)0; j < (size_t)4 && h + j < count; ++j)
+            {
+                len = A_len[h + j] + B_len[h + j] - one;
+
+                if (len <= k)
+                    continue;
+
+                if (len - k >= (size_t)4)
+                    vst1q_s32(P_coeffs[h + j] + k, rows[j]);
+                else
+                {
+                    vst1q_s32(tail, rows[j]);
+
+                    for (n = (size_t)0; k + n < len; ++n)
+                        P_coeffs[h + j][k + n] = tail[n];
+                }
+            }
+        }
+    }
+}
+/*  End of Naive_Batch_Kernel_NEON.                                           */
+
+#endif
+/*  End of #ifdef POLY_HAS_NEON.                                              */
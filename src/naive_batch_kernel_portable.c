@@ -0,0 +1,183 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Portable kernel for naive multiplication of a batch of products.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Batch_Kernel_Portable                                           *
+ *  Purpose:                                                                  *
+ *      Computes P[j] = A[j] * B[j] for up to NAIVE_BATCH_LANES products      *
+ *      side by side.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[j] is at least A_len[j] + B_len[j] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands, from 1 to                      *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands, from 1 to                     *
+ *          NAIVE_BATCH_MAX_LENGTH.                                           *
+ *      count (size_t):                                                       *
+ *          The number of products, from 1 to NAIVE_BATCH_LANES.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The operands are interleaved into buffers on the stack, coefficient   *
+ *      m of product j at m*LANES + j, so the same coefficient of every       *
+ *      product is contiguous. Shorter operands and unused lanes are padded   *
+ *      with zeros. Each output k is the sum of A[m] B[k - m] over the m for  *
+ *      which both exist, computed for all lanes at once in a small array of  *
+ *      accumulators. The inner loop has a fixed trip count and no            *
+ *      dependence between lanes, so compilers vectorize it. The products     *
+ *      are then copied back out.                                             *
+ *  Notes:                                                                    *
+ *      P is written, not added to.                                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Interleaves the first length coefficients of each operand, coefficient m  *
+ *  of lane j at m*LANES + j, with zeros in the unused lanes.                 */
+static void
+naive_batch_kernel_portable_interleave(int *lanes,
+                                       const int * const *coeffs,
+                                       const size_t *lens,
+                                       size_t count, size_t length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, j;
+    int *row;
+
+    /*  The operands, with unused lanes given length zero.                    */
+    const int *src[NAIVE_BATCH_LANES];
+    size_t len[NAIVE_BATCH_LANES];
+
+    for (j = (size_t)0; j < (size_t)NAIVE_BATCH_LANES; ++j)
+    {
+        src[j] = (j < count ? coeffs[j] : NULL);
+        len[j] = (j < count ? lens[j] : (size_t)0);
+    }
+
+    /*  Fill a whole row at a time, which writes the buffer in order.         */
+    for (m = (size_t)0; m < length; ++m)
+    {
+        row = lanes + m*(size_t)NAIVE_BATCH_LANES;
+
+        for (j = (size_t)0; j < (size_t)NAIVE_BATCH_LANES; ++j)
+            row[j] = (m < len[j] ? src[j][m] : 0);
+    }
+}
+/*  End of naive_batch_kernel_portable_interleave.                            */
+
+/*  Function for computing a batch of products with the naive method.         */
+void
+Naive_Batch_Kernel_Portable(int * const *P_coeffs,
+                            const int * const *A_coeffs, const size_t *A_len,
+                            const int * const *B_coeffs, const size_t *B_len,
+                            size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, m, j, first, last, len;
+    int acc[NAIVE_BATCH_LANES];
+    const int *A_row, *B_row;
+
+    /*  The interleaved operands and products.                                */
+    int A_lanes[NAIVE_BATCH_LANES * NAIVE_BATCH_MAX_LENGTH];
+    int B_lanes[NAIVE_BATCH_LANES * NAIVE_BATCH_MAX_LENGTH];
+    int P_lanes[NAIVE_BATCH_LANES * (2*NAIVE_BATCH_MAX_LENGTH - 1)];
+
+    /*  Every lane is padded to the longest operands in the batch.            */
+    size_t A_max = (size_t)0;
+    size_t B_max = (size_t)0;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t one = (size_t)1;
+    const size_t lanes = (size_t)NAIVE_BATCH_LANES;
+
+    for (j = (size_t)0; j < count; ++j)
+    {
+        if (A_len[j] > A_max)
+            A_max = A_len[j];
+
+        if (B_len[j] > B_max)
+            B_max = B_len[j];
+    }
+
+    naive_batch_kernel_portable_interleave(
+        A_lanes, A_coeffs, A_len, count, A_max
+    );
+
+    naive_batch_kernel_portable_interleave(
+        B_lanes, B_coeffs, B_len, count, B_max
+    );
+
+    for (k = (size_t)0; k < A_max + B_max - one; ++k)
+    {
+        /*  A[m] B[k - m] exists for first <= m <= last.                      */
+        first = (k < B_max ? (size_t)0 : k - B_max + one);
+        last = (k < A_max ? k : A_max - one);
+
+        for (j = (size_t)0; j < lanes; ++j)
+            acc[j] = 0;
+
+        for (m = first; m <= last; ++m)
+        {
+            A_row = A_lanes + m*lanes;
+            B_row = B_lanes + (k - m)*lanes;
+
+            for (j = (size_t)0; j < lanes; ++j)
+                acc[j] += A_row[j] * B_row[j];
+        }
+
+        for (j = (size_t)0; j < lanes; ++j)
+            P_lanes[k*lanes + j] = acc[j];
+    }
+
+    for (j = (size_t)0; j < count; ++j)
+    {
+        len = A_len[j] + B_len[j] - one;
+
+        for (k = (size_t)0; k < len; ++k)
+            P_coeffs[j][k] = P_lanes[k*lanes + j];
+    }
+}
+/*  End of Naive_Batch_Kernel_Portable.                                       */
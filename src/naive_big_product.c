@@ -0,0 +1,108 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two unsigned integers given by their 32-bit limbs,         *
+ *      the schoolbook way.                                                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Big_Product                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for integers stored as arrays of limbs.              *
+ *  Arguments:                                                                *
+ *      P_limbs (unsigned int *):                                             *
+ *          A pointer to an array of limbs, at least A_len + B_len wide. It   *
+ *          must not overlap A or B.                                          *
+ *      A_limbs (const unsigned int *):                                       *
+ *          The limbs of A, least significant first, 32 bits each.            *
+ *      A_len (size_t):                                                       *
+ *          The number of limbs of A.                                         *
+ *      B_limbs (const unsigned int *):                                       *
+ *          The limbs of B, least significant first, 32 bits each.            *
+ *      B_len (size_t):                                                       *
+ *          The number of limbs of B.                                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      For each limb a of A, add a times B into P at its offset, carrying    *
+ *      as we go. Each step a b + p + carry is at most 2^64 - 1, so it fits   *
+ *      in an unsigned long long, whose top half is the next carry.           *
+ *  Notes:                                                                    *
+ *      All A_len + B_len limbs of P are written, including leading zeros. If *
+ *      either operand is empty, P is zero.                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for multiplying integers the schoolbook way.                     */
+void
+Naive_Big_Product(unsigned int *P_limbs,
+                  const unsigned int *A_limbs, size_t A_len,
+                  const unsigned int *B_limbs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, n;
+    unsigned long long a, t, carry;
+
+    for (n = (size_t)0; n < B_len; ++n)
+        P_limbs[n] = 0U;
+
+    /*  With B empty the loops below write nothing, so zero A's limbs too.    */
+    if (B_len == (size_t)0)
+    {
+        for (m = (size_t)0; m < A_len; ++m)
+            P_limbs[m] = 0U;
+
+        return;
+    }
+
+    for (m = (size_t)0; m < A_len; ++m)
+    {
+        a = A_limbs[m];
+        carry = 0ULL;
+
+        for (n = (size_t)0; n < B_len; ++n)
+        {
+            t = a * B_limbs[n] + P_limbs[m + n] + carry;
+            P_limbs[m + n] = (unsigned int)(t & 0xFFFFFFFFULL);
+            carry = t >> 32;
+        }
+
+        P_limbs[m + B_len] = (unsigned int)carry;
+    }
+}
+/*  End of Naive_Big_Product.                                                 */
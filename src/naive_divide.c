@@ -0,0 +1,145 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Division with remainder for polynomials with integer coefficients.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Divide                                                          *
+ *  Purpose:                                                                  *
+ *      Computes Q and R with A = Q*B + R and deg(R) < deg(B), by long        *
+ *      division.                                                             *
+ *  Arguments:                                                                *
+ *      Q_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *          Not used if A_len < B_len.                                        *
+ *      R_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least B_len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the dividend.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the divisor.                *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if the leading coefficient of B is not 1 or -1.  *
+ *  Called Functions:                                                         *
+ *      Naive_Short_Product (polynomial_multiplication.h):                    *
+ *          Computes the low part of Q*B for the remainder.                   *
+ *  Method:                                                                   *
+ *      With m = B_len and c = B[m - 1] = 1/c, the coefficients of Q are      *
+ *      found from the top down,                                              *
+ *                                                                            *
+ *          Q[i] = c (A[i + m - 1] - B[m - 2] Q[i + 1] - B[m - 3] Q[i + 2]    *
+ *                    - ... )                                                 *
+ *                                                                            *
+ *      since the coefficient of x^(i + m - 1) in A - Q*B must vanish. Then   *
+ *      R = A - Q*B mod x^(m - 1), with the short product of Q and B. No      *
+ *      copy of A is modified, so no scratch space is needed. This costs      *
+ *      about twice (A_len - B_len + 1) B_len products.                       *
+ *  Notes:                                                                    *
+ *      The quotient has integer coefficients for every A exactly when the    *
+ *      leading coefficient of B is 1 or -1. Otherwise, and for an empty B,   *
+ *      -1 is returned and Q and R are not touched. R must not overlap A.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing A = Q*B + R for integer polynomials.               */
+int
+Naive_Divide(int *Q_coeffs, int *R_coeffs,
+             const int *A_coeffs, size_t A_len,
+             const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, j, n, q_len, top;
+    const int *Q_tail;
+    int sum, c;
+
+    /*  Only leading coefficients 1 and -1 are invertible over the integers.  */
+    if (B_len == (size_t)0)
+        return -1;
+
+    c = B_coeffs[B_len - (size_t)1];
+
+    if (c != 1 && c != -1)
+        return -1;
+
+    /*  If A is shorter than B, the quotient is zero and the remainder is A.  */
+    if (A_len < B_len)
+    {
+        for (n = (size_t)0; n < A_len; ++n)
+            R_coeffs[n] = A_coeffs[n];
+
+        for (; n < B_len - (size_t)1; ++n)
+            R_coeffs[n] = 0;
+
+        return 0;
+    }
+
+    q_len = A_len - B_len + (size_t)1;
+
+    /*  Each coefficient of Q cancels the top remaining term of A.            */
+    for (i = q_len; i > (size_t)0; --i)
+    {
+        /*  Q[i - 1 + j] B[m - 1 - j] for 1 <= j < m, with Q[k] = 0 past Q.   */
+        top = q_len - i;
+
+        if (top > B_len - (size_t)1)
+            top = B_len - (size_t)1;
+
+        sum = A_coeffs[i + B_len - (size_t)2];
+        Q_tail = Q_coeffs + (i - (size_t)1);
+
+        for (j = (size_t)1; j <= top; ++j)
+            sum -= B_coeffs[B_len - (size_t)1 - j] * Q_tail[j];
+
+        Q_coeffs[i - (size_t)1] = c * sum;
+    }
+
+    /*  R = A - Q*B, of which only the bottom B_len - 1 terms are nonzero.    */
+    Naive_Short_Product(
+        R_coeffs, Q_coeffs, q_len, B_coeffs, B_len, B_len - (size_t)1
+    );
+
+    for (n = (size_t)0; n < B_len - (size_t)1; ++n)
+        R_coeffs[n] = A_coeffs[n] - R_coeffs[n];
+
+    return 0;
+}
+/*  End of Naive_Divide.                                                      */
@@ -0,0 +1,215 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Selects the fastest row kernel for the naive multiplication method.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel                                                          *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += (A0[m] + A1[m]) * B[n] for all m and n, using    *
+ *      the fastest version supported by the CPU.                             *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A0_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A1_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial, or NULL.      *
+ *      A_len (size_t):                                                       *
+ *          The length of the A0 and A1 polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel_Portable (polynomial_multiplication.h):                  *
+ *          Used if no SIMD version is available.                             *
+ *      Naive_Kernel_AVX2 (polynomial_multiplication.h):                      *
+ *          Used on x86 CPUs with AVX2.                                       *
+ *      Naive_Kernel_AVX512 (polynomial_multiplication.h):                    *
+ *          Used on x86 CPUs with AVX-512F.                                   *
+ *      Naive_Kernel_NEON (polynomial_multiplication.h):                      *
+ *          Used on ARM CPUs with NEON.                                       *
+ *  Method:                                                                   *
+ *      If A is longer than B and A1 is NULL the operands are exchanged, as   *
+ *      the kernels vectorize along B. A B longer than NAIVE_SLICE_LENGTH is  *
+ *      cut into slices of that length, and each is passed to the kernel in   *
+ *      turn. A kernel sweeps all of B once for every few rows of A, and for  *
+ *      a long B this keeps the part of P being swept in cache.               *
+ *                                                                            *
+ *      The kernel is called through a function pointer, set by               *
+ *      Naive_Kernel_Init. Poly_Kernel_Init calls it, and Poly_Pool_Create    *
+ *      calls that before starting any threads. Until then the pointer holds  *
+ *      a selector, which calls Naive_Kernel_Init and then the chosen kernel, *
+ *      so nothing needs to be initialized in a program with one thread.      *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order, and may be zero, in which   *
+ *      case P is not touched.                                                *
+ *                                                                            *
+ *      The selector stores the pointer without synchronization. Two threads  *
+ *      making their first calls at the same time is a data race, so a        *
+ *      program calling the library from threads of its own must call         *
+ *      Poly_Kernel_Init before starting them.                                *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Init                                                     *
+ *  Purpose:                                                                  *
+ *      Checks the CPU and stores the kernel used by Naive_Kernel.            *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      __builtin_cpu_supports (GCC built-in):                                *
+ *          Checks for AVX2 and AVX-512F on x86 CPUs.                         *
+ *      Poly_Kernel_Allows (polynomial_multiplication.h):                     *
+ *          Skips the kernels above the cap set by Poly_Set_Kernel_Level.     *
+ *  Notes:                                                                    *
+ *      Called by Poly_Kernel_Init. It must not run while other threads       *
+ *      are computing products.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function pointer type shared by all of the kernels.                       */
+typedef void
+(*naive_kernel_function)(int *P_coeffs,
+                         const int *A0_coeffs,
+                         const int *A1_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len);
+
+/*  Forward declaration, the selector is the initial value of the pointer.    */
+static void
+naive_kernel_select(int *P_coeffs,
+                    const int *A0_coeffs,
+                    const int *A1_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len);
+
+/*  The kernel in use. Set by Naive_Kernel_Init.                              */
+static naive_kernel_function naive_kernel_current = naive_kernel_select;
+
+/*  Function for checking the CPU and storing the best kernel.                */
+void Naive_Kernel_Init(void)
+{
+    naive_kernel_function kernel = Naive_Kernel_Portable;
+
+#if defined(POLY_HAS_X86_SIMD)
+    __builtin_cpu_init();
+
+    if (Poly_Kernel_Allows(POLY_KERNEL_AVX512) &&
+        __builtin_cpu_supports("avx512f"))
+        kernel = Naive_Kernel_AVX512;
+    else if (Poly_Kernel_Allows(POLY_KERNEL_AVX2) &&
+             __builtin_cpu_supports("avx2"))
+        kernel = Naive_Kernel_AVX2;
+#elif defined(POLY_HAS_NEON)
+    if (Poly_Kernel_Allows(POLY_KERNEL_NEON))
+        kernel = Naive_Kernel_NEON;
+#endif
+
+    naive_kernel_current = kernel;
+}
+/*  End of Naive_Kernel_Init.                                                 */
+
+/*  Chooses the kernel on the first call, and then calls it.                  */
+static void
+naive_kernel_select(int *P_coeffs,
+                    const int *A0_coeffs,
+                    const int *A1_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len)
+{
+    Naive_Kernel_Init();
+
+    naive_kernel_current(
+        P_coeffs, A0_coeffs, A1_coeffs, A_len, B_coeffs, B_len
+    );
+}
+/*  End of naive_kernel_select.                                               */
+
+/*  Function for computing P[m + n] += (A0[m] + A1[m]) * B[n].                */
+void
+Naive_Kernel(int *P_coeffs,
+             const int *A0_coeffs,
+             const int *A1_coeffs, size_t A_len,
+             const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const int *swap;
+    size_t n, len;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t slice = (size_t)NAIVE_SLICE_LENGTH;
+
+    /*  An empty operand contributes nothing.                                 */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    /*  The kernels sweep along B, so it should be the longer operand. With   *
+     *  two rows A0 and A1 the operands can not be exchanged.                 */
+    if (!A1_coeffs && A_len > B_len)
+    {
+        swap = A0_coeffs;
+        A0_coeffs = B_coeffs;
+        B_coeffs = swap;
+
+        len = A_len;
+        A_len = B_len;
+        B_len = len;
+    }
+
+    if (B_len <= slice)
+    {
+        naive_kernel_current(
+            P_coeffs, A0_coeffs, A1_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    /*  A long B is fed to the kernel a slice at a time, so the window of P   *
+     *  being added to stays in cache for every row of A.                     */
+    for (n = (size_t)0; n < B_len; n += slice)
+    {
+        len = (B_len - n < slice ? B_len - n : slice);
+
+        naive_kernel_current(
+            P_coeffs + n, A0_coeffs, A1_coeffs, A_len, B_coeffs + n, len
+        );
+    }
+}
+/*  End of Naive_Kernel.                                                      */
@@ -0,0 +1,193 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      AVX2 row kernel for the naive multiplication method.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_AVX2                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += (A0[m] + A1[m]) * B[n] for all m and n.          *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A0_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A1_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial, or NULL.      *
+ *      A_len (size_t):                                                       *
+ *          The length of the A0 and A1 polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      A tile of four rows of A is held in registers, broadcast across the   *
+ *      vector, and the outputs are swept 8 at a time, computing              *
+ *                                                                            *
+ *          P[m + k + j] += a0 B[k + j] + a1 B[k + j - 1] +                   *
+ *                          a2 B[k + j - 2] + a3 B[k + j - 3]                 *
+ *                                                                            *
+ *      Each output is loaded and stored once per tile. B is loaded once per  *
+ *      step, and the shifted copies B[k + j - r] are built in registers from *
+ *      the current and previous vectors of B with vperm2i128 and vpalignr.   *
+ *      Before the start of B the previous vector is zero, and past the end   *
+ *      the loads and stores are masked, so the ends of the band need no      *
+ *      scalar code. If fewer than four rows remain, the missing rows are     *
+ *      zero.                                                                 *
+ *  Notes:                                                                    *
+ *      Only compiled for x86 with GCC compatible compilers. The function is  *
+ *      built for AVX2 with a target attribute, so the rest of the library    *
+ *      does not need -mavx2. Only call this if the CPU supports AVX2.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) immintrin.h:                                                          *
+ *          Header file providing the AVX2 intrinsics.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The x86 intrinsics are only available with GCC compatible compilers.      */
+#ifdef POLY_HAS_X86_SIMD
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  AVX2 intrinsics found here.                                               */
+#include <immintrin.h>
+
+/*  Function for computing P[m + n] += (A0[m] + A1[m]) * B[n].                */
+__attribute__((target("avx2")))
+void
+Naive_Kernel_AVX2(int *P_coeffs,
+                  const int *A0_coeffs,
+                  const int *A1_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r, rows, len;
+    int a[4];
+    int *row;
+    int full;
+    __m256i a0, a1, a2, a3, acc, cur, prev, mid, mask;
+
+    /*  Used for the coefficients of B before the start and past the end.     */
+    const __m256i zero = _mm256_setzero_si256();
+
+    /*  Lane indices, used to build the masks for the partial vectors.        */
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (m = (size_t)0; m < A_len; m += (size_t)4)
+    {
+        /*  The tile of rows, padded with zeros if fewer than four remain.    */
+        rows = (A_len - m < (size_t)4 ? A_len - m : (size_t)4);
+
+        for (r = (size_t)0; r < (size_t)4; ++r)
+        {
+            if (r >= rows)
+                a[r] = 0;
+            else if (A1_coeffs)
+                a[r] = A0_coeffs[m + r] + A1_coeffs[m + r];
+            else
+                a[r] = A0_coeffs[m + r];
+        }
+
+        /*  The outputs touched by this tile are P[m], ..., P[m + len - 1].   */
+        row = P_coeffs + m;
+        len = B_len + rows - (size_t)1;
+
+        a0 = _mm256_set1_epi32(a[0]);
+        a1 = _mm256_set1_epi32(a[1]);
+        a2 = _mm256_set1_epi32(a[2]);
+        a3 = _mm256_set1_epi32(a[3]);
+        prev = zero;
+
+        for (k = (size_t)0; k < len; k += (size_t)8)
+        {
+            /*  B[k], ..., B[k + 7], with zeros past the end of B.            */
+            if (k + (size_t)8 <= B_len)
+                cur = _mm256_loadu_si256((const __m256i *)(B_coeffs + k));
+            else if (k < B_len)
+                cur = _mm256_maskload_epi32(
+                    B_coeffs + k,
+                    _mm256_cmpgt_epi32(
+                        _mm256_set1_epi32((int)(B_len - k)), lanes
+                    )
+                );
+            else
+                cur = zero;
+
+            /*  The outputs, masked if the band ends within this vector.      */
+            full = (k + (size_t)8 <= len);
+
+            if (full)
+                acc = _mm256_loadu_si256((const __m256i *)(row + k));
+            else
+            {
+                mask = _mm256_cmpgt_epi32(
+                    _mm256_set1_epi32((int)(len - k)), lanes
+                );
+
+                acc = _mm256_maskload_epi32(row + k, mask);
+            }
+
+            /*  mid is B[k - 4], ..., B[k + 3]. Within each 128-bit lane,     *
+             *  alignr(cur, mid, 16 - 4r) is then B[k - r + j].               */
+            mid = _mm256_permute2x128_si256(prev, cur, 0x21);
+
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(a0, cur));
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(
+                a1, _mm256_alignr_epi8(cur, mid, 12)
+            ));
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(
+                a2, _mm256_alignr_epi8(cur, mid, 8)
+            ));
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(
+                a3, _mm256_alignr_epi8(cur, mid, 4)
+            ));
+
+            /*  Masked stores are slow on some CPUs, so only use them here.   */
+            if (full)
+                _mm256_storeu_si256((__m256i *)(row + k), acc);
+            else
+                _mm256_maskstore_epi32(row + k, mask, acc);
+
+            prev = cur;
+        }
+    }
+}
+/*  End of Naive_Kernel_AVX2.                                                 */
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
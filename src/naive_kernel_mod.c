@@ -0,0 +1,158 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Accumulating kernel for the naive method modulo p.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Mod                                                      *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += A[m] * B[n] mod p for all m and n.               *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array, at least A_len + B_len - 1 wide, of        *
+ *          residues in [0, p).                                               *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The reduction is lazy. The output is cut into tiles of at most        *
+ *      NAIVE_MOD_COLUMNS coefficients, held in 64-bit accumulators. The      *
+ *      rows of A that meet a tile are taken mod->lazy at a time, each row    *
+ *      adding a scaled copy of B to the accumulators with no reduction at    *
+ *      all. The partial sums are then less than p 2^32, and one Montgomery   *
+ *      reduction per coefficient brings them back to [0, p).                 *
+ *                                                                            *
+ *      Montgomery reduction divides by R = 2^32, so each row of A is first   *
+ *      put in Montgomery form, a R mod p, with one multiplication per row.   *
+ *      The reduced sums are then ordinary residues. The inner loop is a      *
+ *      32 by 32 to 64-bit multiply-add with unit stride, which compilers     *
+ *      vectorize.                                                            *
+ *  Notes:                                                                    *
+ *      The coefficients of A, B, and P must lie in [0, p), and A and B may   *
+ *      be given in either order. For p below 2^16, thousands of rows are     *
+ *      summed per reduction. Near POLY_MODULUS_MAX, it is two.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Computes t / 2^32 mod p for t < p 2^32, the result in [0, p).             */
+static unsigned int
+naive_kernel_mod_redc(unsigned long long t, const Poly_Modulus *mod)
+{
+    const unsigned int m = (unsigned int)t * mod->p_inv;
+    const unsigned int u = (unsigned int)(
+        (t + (unsigned long long)m * mod->p) >> 32
+    );
+
+    return (u >= mod->p ? u - mod->p : u);
+}
+/*  End of naive_kernel_mod_redc.                                             */
+
+/*  Function for computing P[m + n] += A[m] * B[n] mod p.                     */
+void
+Naive_Kernel_Mod(unsigned int *P_coeffs,
+                 const unsigned int *A_coeffs, size_t A_len,
+                 const unsigned int *B_coeffs, size_t B_len,
+                 const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long long acc[NAIVE_MOD_COLUMNS];
+    size_t n0, width, m, m_lo, m_hi, m_end, t, t_lo, t_hi;
+    unsigned int a, u;
+    const unsigned int *B;
+
+    /*  The number of coefficients in the product.                            */
+    const size_t P_len = A_len + B_len - (size_t)1;
+
+    for (n0 = (size_t)0; n0 < P_len; n0 += (size_t)NAIVE_MOD_COLUMNS)
+    {
+        width = P_len - n0;
+
+        if (width > (size_t)NAIVE_MOD_COLUMNS)
+            width = (size_t)NAIVE_MOD_COLUMNS;
+
+        /*  The rows of A that contribute to outputs n0 to n0 + width - 1.    */
+        m_lo = (n0 >= B_len ? n0 - B_len + (size_t)1 : (size_t)0);
+        m_hi = (n0 + width < A_len ? n0 + width : A_len);
+
+        for (m = m_lo; m < m_hi; m = m_end)
+        {
+            m_end = (m_hi - m > mod->lazy ? m + mod->lazy : m_hi);
+
+            for (t = (size_t)0; t < width; ++t)
+                acc[t] = 0ULL;
+
+            for (; m < m_end; ++m)
+            {
+                /*  A[m] R mod p, so the reduction gives ordinary residues.   */
+                a = naive_kernel_mod_redc(
+                    (unsigned long long)A_coeffs[m] * mod->r2, mod
+                );
+
+                /*  Output n0 + t uses B[n0 + t - m], where it exists.        */
+                t_lo = (m > n0 ? m - n0 : (size_t)0);
+                t_hi = m + B_len - n0;
+
+                if (t_hi > width)
+                    t_hi = width;
+
+                B = B_coeffs + (n0 + t_lo - m);
+
+                for (t = t_lo; t < t_hi; ++t)
+                    acc[t] += (unsigned long long)a * B[t - t_lo];
+            }
+
+            /*  One reduction per coefficient for up to mod->lazy rows.       */
+            for (t = (size_t)0; t < width; ++t)
+            {
+                u = naive_kernel_mod_redc(acc[t], mod) + P_coeffs[n0 + t];
+                P_coeffs[n0 + t] = (u >= mod->p ? u - mod->p : u);
+            }
+        }
+    }
+}
+/*  End of Naive_Kernel_Mod.                                                  */
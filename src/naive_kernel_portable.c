@@ -0,0 +1,143 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Portable row kernel for the naive multiplication method.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Portable                                                 *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += (A0[m] + A1[m]) * B[n] for all m and n.          *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A0_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A1_coeffs (const int *):                                              *
+ *          A pointer to the coefficient array of a polynomial, or NULL.      *
+ *      A_len (size_t):                                                       *
+ *          The length of the A0 and A1 polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      For each coefficient of A, add the scaled copy of B to P. Four rows   *
+ *      of A are combined per pass over P, computing                          *
+ *                                                                            *
+ *          P[m + k] += a0 B[k] + a1 B[k - 1] + a2 B[k - 2] + a3 B[k - 3]     *
+ *                                                                            *
+ *      The inner loop walks B and P forwards with unit stride, so compilers  *
+ *      readily vectorize it, unlike the backwards stride of the Cauchy       *
+ *      product.                                                              *
+ *  Notes:                                                                    *
+ *      If A1 is NULL it is treated as zero. P must not overlap A0, A1, or B. *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Output k of a band of four rows, where not all rows overlap B.            */
+static void
+naive_kernel_portable_edge(int *row, const int *a,
+                           const int *B_coeffs, size_t B_len, size_t k)
+{
+    /*  Index for the four rows of A.                                         */
+    size_t r;
+
+    for (r = (size_t)0; r < (size_t)4 && r <= k; ++r)
+        if (k - r < B_len)
+            row[k] += a[r] * B_coeffs[k - r];
+}
+/*  End of naive_kernel_portable_edge.                                        */
+
+/*  Function for computing P[m + n] += (A0[m] + A1[m]) * B[n].                */
+void
+Naive_Kernel_Portable(int *P_coeffs,
+                      const int *A0_coeffs,
+                      const int *A1_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r;
+    int a[4];
+    int *row;
+
+    /*  Four rows of A at a time, so each output is loaded and stored once    *
+     *  per four rows rather than once per row.                               */
+    for (m = (size_t)0; m + (size_t)4 <= A_len; m += (size_t)4)
+    {
+        for (r = (size_t)0; r < (size_t)4; ++r)
+        {
+            a[r] = A0_coeffs[m + r];
+
+            if (A1_coeffs)
+                a[r] += A1_coeffs[m + r];
+        }
+
+        row = P_coeffs + m;
+
+        /*  The leading edge, where B[k - r] does not exist for all r.        */
+        for (k = (size_t)0; k < (size_t)3; ++k)
+            naive_kernel_portable_edge(row, a, B_coeffs, B_len, k);
+
+        /*  The body of the band, where all four rows overlap B.              */
+        for (k = (size_t)3; k < B_len; ++k)
+            row[k] += a[0] * B_coeffs[k] + a[1] * B_coeffs[k - 1] +
+                      a[2] * B_coeffs[k - 2] + a[3] * B_coeffs[k - 3];
+
+        /*  The trailing edge.                                                */
+        for (; k < B_len + (size_t)3; ++k)
+            naive_kernel_portable_edge(row, a, B_coeffs, B_len, k);
+    }
+
+    /*  The remaining rows of A, one at a time.                               */
+    for (; m < A_len; ++m)
+    {
+        a[0] = A0_coeffs[m];
+
+        if (A1_coeffs)
+            a[0] += A1_coeffs[m];
+
+        row = P_coeffs + m;
+
+        for (k = (size_t)0; k < B_len; ++k)
+            row[k] += a[0] * B_coeffs[k];
+    }
+}
+/*  End of Naive_Kernel_Portable.                                             */
@@ -0,0 +1,158 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Selects the fastest wide row kernel for the naive method.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Wide                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += A[m] * B[n] for all m and n in 64-bit            *
+ *      arithmetic, using the fastest version supported by the CPU.           *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel_Wide_Portable (polynomial_multiplication.h):             *
+ *          Used if no SIMD version is available.                             *
+ *      Naive_Kernel_Wide_AVX2 (polynomial_multiplication.h):                 *
+ *          Used on x86 CPUs with AVX2.                                       *
+ *      Naive_Kernel_Wide_AVX512 (polynomial_multiplication.h):               *
+ *          Used on x86 CPUs with AVX-512F.                                   *
+ *      Naive_Kernel_Wide_NEON (polynomial_multiplication.h):                 *
+ *          Used on ARM CPUs with NEON.                                       *
+ *  Method:                                                                   *
+ *      The kernel is called through a function pointer, set by               *
+ *      Naive_Kernel_Wide_Init. Poly_Kernel_Init calls it, and                *
+ *      Poly_Pool_Create calls that before starting any threads. Until then   *
+ *      the pointer holds a selector, which calls Naive_Kernel_Wide_Init and  *
+ *      then the chosen kernel, so nothing needs to be initialized in a       *
+ *      program with one thread.                                              *
+ *  Notes:                                                                    *
+ *      The selector stores the pointer without synchronization. Two threads  *
+ *      making their first calls at the same time is a data race, so a        *
+ *      program calling the library from threads of its own must call         *
+ *      Poly_Kernel_Init before starting them.                                *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Wide_Init                                                *
+ *  Purpose:                                                                  *
+ *      Checks the CPU and stores the kernel used by Naive_Kernel_Wide.       *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      __builtin_cpu_supports (GCC built-in):                                *
+ *          Checks for AVX2 and AVX-512F on x86 CPUs.                         *
+ *      Poly_Kernel_Allows (polynomial_multiplication.h):                     *
+ *          Skips the kernels above the cap set by Poly_Set_Kernel_Level.     *
+ *  Notes:                                                                    *
+ *      Called by Poly_Kernel_Init. It must not run while other threads       *
+ *      are computing products.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function pointer type shared by all of the kernels.                       */
+typedef void
+(*naive_kernel_wide_function)(long long *P_coeffs,
+                              const int *A_coeffs, size_t A_len,
+                              const int *B_coeffs, size_t B_len);
+
+/*  Forward declaration, the selector is the initial value of the pointer.    */
+static void
+naive_kernel_wide_select(long long *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len);
+
+/*  The kernel in use. Set by Naive_Kernel_Wide_Init.                         */
+static naive_kernel_wide_function
+naive_kernel_wide_current = naive_kernel_wide_select;
+
+/*  Function for checking the CPU and storing the best kernel.                */
+void Naive_Kernel_Wide_Init(void)
+{
+    naive_kernel_wide_function kernel = Naive_Kernel_Wide_Portable;
+
+#if defined(POLY_HAS_X86_SIMD)
+    __builtin_cpu_init();
+
+    if (Poly_Kernel_Allows(POLY_KERNEL_AVX512) &&
+        __builtin_cpu_supports("avx512f"))
+        kernel = Naive_Kernel_Wide_AVX512;
+    else if (Poly_Kernel_Allows(POLY_KERNEL_AVX2) &&
+             __builtin_cpu_supports("avx2"))
+        kernel = Naive_Kernel_Wide_AVX2;
+#elif defined(POLY_HAS_NEON)
+    if (Poly_Kernel_Allows(POLY_KERNEL_NEON))
+        kernel = Naive_Kernel_Wide_NEON;
+#endif
+
+    naive_kernel_wide_current = kernel;
+}
+/*  End of Naive_Kernel_Wide_Init.                                            */
+
+/*  Chooses the kernel on the first call, and then calls it.                  */
+static void
+naive_kernel_wide_select(long long *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len)
+{
+    Naive_Kernel_Wide_Init();
+    naive_kernel_wide_current(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+}
+/*  End of naive_kernel_wide_select.                                          */
+
+/*  Function for computing P[m + n] += A[m] * B[n] in 64 bits.                */
+void
+Naive_Kernel_Wide(long long *P_coeffs,
+                  const int *A_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len)
+{
+    naive_kernel_wide_current(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+}
+/*  End of Naive_Kernel_Wide.                                                 */
@@ -0,0 +1,184 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      AVX2 wide row kernel for the naive multiplication method.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Wide_AVX2                                                *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += A[m] * B[n] for all m and n in 64-bit            *
+ *      arithmetic.                                                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      As Naive_Kernel_AVX2, with the outputs swept 4 at a time in 64-bit    *
+ *      lanes. Four coefficients of B are sign extended to 64 bits as they    *
+ *      are loaded, and vpmuldq multiplies the low 32 bits of each lane to a  *
+ *      full 64-bit product, so no product can overflow. The shifted copies   *
+ *      B[k + j - r] are built with vperm2i128 and vpalignr, and the ends of  *
+ *      the band use masked loads and stores.                                 *
+ *  Notes:                                                                    *
+ *      Only compiled for x86 with GCC compatible compilers. The function is  *
+ *      built for AVX2 with a target attribute, so the rest of the library    *
+ *      does not need -mavx2. Only call this if the CPU supports AVX2.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) immintrin.h:                                                          *
+ *          Header file providing the AVX2 intrinsics.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The x86 intrinsics are only available with GCC compatible compilers.      */
+#ifdef POLY_HAS_X86_SIMD
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  AVX2 intrinsics found here.                                               */
+#include <immintrin.h>
+
+/*  Function for computing P[m + n] += A[m] * B[n] in 64 bits.                */
+__attribute__((target("avx2")))
+void
+Naive_Kernel_Wide_AVX2(long long *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r, rows, len;
+    long long a[4];
+    long long *row;
+    int full;
+    __m128i half;
+    __m256i a0, a1, a2, a3, acc, cur, prev, mid, mask;
+
+    /*  Used for the coefficients of B before the start and past the end.     */
+    const __m256i zero = _mm256_setzero_si256();
+
+    /*  Lane indices, used to build the masks for the partial vectors.        */
+    const __m128i lanes32 = _mm_setr_epi32(0, 1, 2, 3);
+    const __m256i lanes64 = _mm256_setr_epi64x(0, 1, 2, 3);
+
+    for (m = (size_t)0; m < A_len; m += (size_t)4)
+    {
+        /*  The tile of rows, padded with zeros if fewer than four remain.    */
+        rows = (A_len - m < (size_t)4 ? A_len - m : (size_t)4);
+
+        for (r = (size_t)0; r < (size_t)4; ++r)
+            a[r] = (r < rows ? (long long)A_coeffs[m + r] : 0);
+
+        /*  The outputs touched by this tile are P[m], ..., P[m + len - 1].   */
+        row = P_coeffs + m;
+        len = B_len + rows - (size_t)1;
+
+        a0 = _mm256_set1_epi64x(a[0]);
+        a1 = _mm256_set1_epi64x(a[1]);
+        a2 = _mm256_set1_epi64x(a[2]);
+        a3 = _mm256_set1_epi64x(a[3]);
+        prev = zero;
+
+        for (k = (size_t)0; k < len; k += (size_t)4)
+        {
+            /*  B[k], ..., B[k + 3] sign extended, with zeros past the end.   */
+            if (k + (size_t)4 <= B_len)
+            {
+                half = _mm_loadu_si128((const __m128i *)(B_coeffs + k));
+                cur = _mm256_cvtepi32_epi64(half);
+            }
+            else if (k < B_len)
+            {
+                half = _mm_maskload_epi32(
+                    B_coeffs + k,
+                    _mm_cmpgt_epi32(_mm_set1_epi32((int)(B_len - k)), lanes32)
+                );
+
+                cur = _mm256_cvtepi32_epi64(half);
+            }
+            else
+                cur = zero;
+
+            /*  The outputs, masked if the band ends within this vector.      */
+            full = (k + (size_t)4 <= len);
+
+            if (full)
+                acc = _mm256_loadu_si256((const __m256i *)(row + k));
+            else
+            {
+                mask = _mm256_cmpgt_epi64(
+                    _mm256_set1_epi64x((long long)(len - k)), lanes64
+                );
+
+                acc = _mm256_maskload_epi64(row + k, mask);
+            }
+
+            /*  mid is B[k - 2], ..., B[k + 1]. Within each 128-bit lane,     *
+             *  alignr(cur, mid, 8) is B[k - 1 + j], and alignr(mid, prev, 8) *
+             *  is B[k - 3 + j].                                              */
+            mid = _mm256_permute2x128_si256(prev, cur, 0x21);
+
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(a0, cur));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(
+                a1, _mm256_alignr_epi8(cur, mid, 8)
+            ));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(a2, mid));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(
+                a3, _mm256_alignr_epi8(mid, prev, 8)
+            ));
+
+            /*  Masked stores are slow on some CPUs, so only use them here.   */
+            if (full)
+                _mm256_storeu_si256((__m256i *)(row + k), acc);
+            else
+                _mm256_maskstore_epi64(row + k, mask, acc);
+
+            prev = cur;
+        }
+    }
+}
+/*  End of Naive_Kernel_Wide_AVX2.                                            */
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
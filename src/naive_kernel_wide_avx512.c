@@ -0,0 +1,174 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      AVX-512 wide row kernel for the naive multiplication method.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Wide_AVX512                                              *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += A[m] * B[n] for all m and n in 64-bit            *
+ *      arithmetic.                                                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      As Naive_Kernel_AVX512, with the outputs swept 8 at a time in 64-bit  *
+ *      lanes. Eight coefficients of B are sign extended to 64 bits as they   *
+ *      are loaded, and vpmuldq multiplies the low 32 bits of each lane to a  *
+ *      full 64-bit product, so no product can overflow. The shifted copies   *
+ *      B[k + j - r] are built with valignq, and the ends of the band use     *
+ *      masked loads and stores.                                              *
+ *  Notes:                                                                    *
+ *      Only compiled for x86 with GCC compatible compilers. The function is  *
+ *      built for AVX-512F with a target attribute, so the rest of the library*
+ *      does not need -mavx512f. Only call this if the CPU supports AVX-512F. *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) immintrin.h:                                                          *
+ *          Header file providing the AVX-512 intrinsics.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The x86 intrinsics are only available with GCC compatible compilers.      */
+#ifdef POLY_HAS_X86_SIMD
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  AVX-512 intrinsics found here.                                            */
+#include <immintrin.h>
+
+/*  Returns a mask with the lowest n bits set, for 0 <= n < 8.                */
+static __mmask8 naive_kernel_wide_avx512_mask(size_t n)
+{
+    return (__mmask8)((1U << n) - 1U);
+}
+/*  End of naive_kernel_wide_avx512_mask.                                     */
+
+/*  Function for computing P[m + n] += A[m] * B[n] in 64 bits.                */
+__attribute__((target("avx512f")))
+void
+Naive_Kernel_Wide_AVX512(long long *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r, rows, len;
+    long long a[4];
+    long long *row;
+    __m512i a0, a1, a2, a3, acc, cur, prev;
+    __mmask8 mask;
+
+    /*  Used for the coefficients of B before the start and past the end.     */
+    const __m512i zero = _mm512_setzero_si512();
+
+    for (m = (size_t)0; m < A_len; m += (size_t)4)
+    {
+        /*  The tile of rows, padded with zeros if fewer than four remain.    */
+        rows = (A_len - m < (size_t)4 ? A_len - m : (size_t)4);
+
+        for (r = (size_t)0; r < (size_t)4; ++r)
+            a[r] = (r < rows ? (long long)A_coeffs[m + r] : 0);
+
+        /*  The outputs touched by this tile are P[m], ..., P[m + len - 1].   */
+        row = P_coeffs + m;
+        len = B_len + rows - (size_t)1;
+
+        a0 = _mm512_set1_epi64(a[0]);
+        a1 = _mm512_set1_epi64(a[1]);
+        a2 = _mm512_set1_epi64(a[2]);
+        a3 = _mm512_set1_epi64(a[3]);
+        prev = zero;
+
+        for (k = (size_t)0; k < len; k += (size_t)8)
+        {
+            /*  B[k], ..., B[k + 7] sign extended, with zeros past the end.   */
+            if (k + (size_t)8 <= B_len)
+                cur = _mm512_cvtepi32_epi64(
+                    _mm256_loadu_si256((const __m256i *)(B_coeffs + k))
+                );
+            else if (k < B_len)
+                cur = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(
+                    _mm512_maskz_loadu_epi32(
+                        (__mmask16)naive_kernel_wide_avx512_mask(B_len - k),
+                        B_coeffs + k
+                    )
+                ));
+            else
+                cur = zero;
+
+            /*  The outputs, masked if the band ends within this vector.      */
+            if (k + (size_t)8 <= len)
+            {
+                mask = (__mmask8)0xFFU;
+                acc = _mm512_loadu_si512((const void *)(row + k));
+            }
+            else
+            {
+                mask = naive_kernel_wide_avx512_mask(len - k);
+                acc = _mm512_maskz_loadu_epi64(mask, row + k);
+            }
+
+            /*  alignr(cur, prev, 8 - r) is B[k - r], ..., B[k - r + 7].      */
+            acc = _mm512_add_epi64(acc, _mm512_mul_epi32(a0, cur));
+            acc = _mm512_add_epi64(acc, _mm512_mul_epi32(
+                a1, _mm512_alignr_epi64(cur, prev, 7)
+            ));
+            acc = _mm512_add_epi64(acc, _mm512_mul_epi32(
+                a2, _mm512_alignr_epi64(cur, prev, 6)
+            ));
+            acc = _mm512_add_epi64(acc, _mm512_mul_epi32(
+                a3, _mm512_alignr_epi64(cur, prev, 5)
+            ));
+
+            _mm512_mask_storeu_epi64(row + k, mask, acc);
+            prev = cur;
+        }
+    }
+}
+/*  End of Naive_Kernel_Wide_AVX512.                                          */
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
@@ -0,0 +1,177 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      NEON wide row kernel for the naive multiplication method.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Wide_NEON                                                *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += A[m] * B[n] for all m and n in 64-bit            *
+ *      arithmetic.                                                           *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      As Naive_Kernel_NEON. B is loaded and shifted with vext in 32-bit     *
+ *      lanes, four coefficients at a time, and vmlal multiplies each half    *
+ *      of the vector into a pair of 64-bit accumulators, so no product can   *
+ *      overflow.                                                             *
+ *  Notes:                                                                    *
+ *      Only compiled for ARM targets with NEON enabled, which includes all   *
+ *      AArch64 targets. NEON has no masked loads, so the partial vectors at  *
+ *      the end of the band go through small buffers on the stack.            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) arm_neon.h:                                                           *
+ *          Header file providing the NEON intrinsics.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  The NEON intrinsics are only available on ARM.                            */
+#ifdef POLY_HAS_NEON
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  NEON intrinsics found here.                                               */
+#include <arm_neon.h>
+
+/*  Function for computing P[m + n] += A[m] * B[n] in 64 bits.                */
+void
+Naive_Kernel_Wide_NEON(long long *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r, j, rows, len;
+    int a[4], B_tail[4];
+    long long P_tail[4];
+    long long *row;
+    int32x4_t cur, prev, shift;
+    int64x2_t lo, hi;
+
+    /*  Used for the coefficients of B before the start and past the end.     */
+    const int32x4_t zero = vdupq_n_s32(0);
+
+    for (m = (size_t)0; m < A_len; m += (size_t)4)
+    {
+        /*  The tile of rows, padded with zeros if fewer than four remain.    */
+        rows = (A_len - m < (size_t)4 ? A_len - m : (size_t)4);
+
+        for (r = (size_t)0; r < (size_t)4; ++r)
+            a[r] = (r < rows ? A_coeffs[m + r] : 0);
+
+        /*  The outputs touched by this tile are P[m], ..., P[m + len - 1].   */
+        row = P_coeffs + m;
+        len = B_len + rows - (size_t)1;
+
+        prev = zero;
+
+        for (k = (size_t)0; k < len; k += (size_t)4)
+        {
+            /*  B[k], ..., B[k + 3], with zeros past the end of B.            */
+            if (k + (size_t)4 <= B_len)
+                cur = vld1q_s32(B_coeffs + k);
+            else
+            {
+                for (j = (size_t)0; j < (size_t)4; ++j)
+                    B_tail[j] = (k + j < B_len ? B_coeffs[k + j] : 0);
+
+                cur = vld1q_s32(B_tail);
+            }
+
+            /*  The outputs, copied out if the band ends within this vector.  */
+            if (k + (size_t)4 <= len)
+            {
+                lo = vld1q_s64((const int64_t *)(row + k));
+                hi = vld1q_s64((const int64_t *)(row + k + 2));
+            }
+            else
+            {
+                for (j = (size_t)0; j < (size_t)4; ++j)
+                    P_tail[j] = (k + j < len ? row[k + j] : 0);
+
+                lo = vld1q_s64((const int64_t *)P_tail);
+                hi = vld1q_s64((const int64_t *)(P_tail + 2));
+            }
+
+            /*  vext(prev, cur, 4 - r) is B[k - r], ..., B[k - r + 3].        */
+            lo = vmlal_n_s32(lo, vget_low_s32(cur), a[0]);
+            hi = vmlal_n_s32(hi, vget_high_s32(cur), a[0]);
+
+            shift = vextq_s32(prev, cur, 3);
+            lo = vmlal_n_s32(lo, vget_low_s32(shift), a[1]);
+            hi = vmlal_n_s32(hi, vget_high_s32(shift), a[1]);
+
+            shift = vextq_s32(prev, cur, 2);
+            lo = vmlal_n_s32(lo, vget_low_s32(shift), a[2]);
+            hi = vmlal_n_s32(hi, vget_high_s32(shift), a[2]);
+
+            shift = vextq_s32(prev, cur, 1);
+            lo = vmlal_n_s32(lo, vget_low_s32(shift), a[3]);
+            hi = vmlal_n_s32(hi, vget_high_s32(shift), a[3]);
+
+            if (k + (size_t)4 <= len)
+            {
+                vst1q_s64((int64_t *)(row + k), lo);
+                vst1q_s64((int64_t *)(row + k + 2), hi);
+            }
+            else
+            {
+                vst1q_s64((int64_t *)P_tail, lo);
+                vst1q_s64((int64_t *)(P_tail + 2), hi);
+
+                for (j = (size_t)0; k + j < len; ++j)
+                    row[k + j] = P_tail[j];
+            }
+
+            prev = cur;
+        }
+    }
+}
+/*  End of Naive_Kernel_Wide_NEON.                                            */
+
+#endif
+/*  End of #ifdef POLY_HAS_NEON.                                              */
@@ -0,0 +1,135 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the middle coefficients of A*B for integer polynomials.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Middle_Product                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the coefficients of x^(B_len - 1), ..., x^(A_len - 1) in     *
+ *      A*B the naive way.                                                    *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial. At most A_len.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      With L = A_len - B_len + 1, the output is                             *
+ *                                                                            *
+ *          P[t] = sum A[t + B_len - 1 - j] B[j],  0 <= j < B_len             *
+ *                                                                            *
+ *      for 0 <= t < L. These are exactly the coefficients of A*B that every  *
+ *      coefficient of B contributes to. B is cut into bands of               *
+ *      NAIVE_MIDDLE_ROWS coefficients. Row r of a band starting at B[j]      *
+ *      adds B[j + r] times A[B_len - 1 - j - r + t] to each P[t], so all of  *
+ *      the rows agree on the window of A for r <= t < L - rows + 1 + r,      *
+ *      which is passed to Naive_Kernel as a rectangle. The two small         *
+ *      triangles at the ends of the rows are added term by term.             *
+ *  Notes:                                                                    *
+ *      This is the transpose of the product, and is used for Newton          *
+ *      iteration, where the low and high parts of A*B are already known.     *
+ *      It forms L B_len products, rather than the A_len B_len of the full    *
+ *      product. Requires 1 <= B_len <= A_len.                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Function for computing the middle product of integer polynomials.         */
+void
+Naive_Middle_Product(int *P_coeffs,
+                     const int *A_coeffs, size_t A_len,
+                     const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t t, j, r, rows, width, low_end, high_start;
+    const int *window;
+    int b;
+
+    /*  The number of coefficients in the middle product.                     */
+    const size_t L = A_len - B_len + (size_t)1;
+
+    /*  The kernel accumulates, so start from the zero polynomial.            */
+    for (t = (size_t)0; t < L; ++t)
+        P_coeffs[t] = 0;
+
+    for (j = (size_t)0; j < B_len; j += rows)
+    {
+        rows = B_len - j;
+
+        if (rows > (size_t)NAIVE_MIDDLE_ROWS)
+            rows = (size_t)NAIVE_MIDDLE_ROWS;
+
+        /*  Row r adds B[j + r] window[t - r] to P[t].                        */
+        window = A_coeffs + (B_len - (size_t)1 - j);
+
+        /*  The rectangle shared by the rows, if the output is long enough.   */
+        if (L >= rows)
+        {
+            width = L - rows + (size_t)1;
+            Naive_Kernel(P_coeffs, B_coeffs + j, NULL, rows, window, width);
+        }
+        else
+            width = (size_t)0;
+
+        /*  The triangles, t < r and t >= r + width, for each row.            */
+        for (r = (size_t)0; r < rows; ++r)
+        {
+            b = B_coeffs[j + r];
+
+            low_end = (width == (size_t)0 ? L : r);
+            high_start = (width == (size_t)0 ? L : r + width);
+
+            for (t = (size_t)0; t < low_end; ++t)
+                P_coeffs[t] += b * A_coeffs[(B_len - (size_t)1 - j - r) + t];
+
+            for (t = high_start; t < L; ++t)
+                P_coeffs[t] += b * A_coeffs[(B_len - (size_t)1 - j - r) + t];
+        }
+    }
+}
+/*  End of Naive_Middle_Product.                                              */
@@ -41,9 +41,17 @@
  *  Output:                                                                   *
  *      None (void).                                                          *
  *  Called Functions:                                                         *
- *      None.                                                                 *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
  *  Method:                                                                   *
- *      Perform polynomial multiplication using a Cauchy product.             *
+ *      Perform polynomial multiplication using a Cauchy product. Rather      *
+ *      than a dot product per coefficient of P, which walks B backwards,     *
+ *      a scaled copy of B is added to P for each coefficient of A. This      *
+ *      gives contiguous loads that vectorize well.                           *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. If either is zero, P is     *
+ *      not touched.                                                          *
  ******************************************************************************
  *                                DEPENDENCIES                                *
  ******************************************************************************
@@ -69,72 +77,24 @@ Naive_Product(int *P_coeffs,
               const int *B_coeffs, size_t B_len)
 {
     /*  Declare necessary variables. C89 requires this at the top.            */
-    size_t m, n;
+    size_t n;
 
-    /*  Useful constants cast to type "size_t".                               */
+    /*  Zero cast to type "size_t" for the for-loop.                          */
     const size_t zero = (size_t)0;
-    const size_t one = (size_t)1;
 
-    /*  The degrees of the polynomials, given by the lengths of the arrays.   */
-    const size_t A_deg = A_len - one;
-    const size_t B_deg = B_len - one;
+    /*  The number of coefficients in the product.                            */
+    size_t P_len;
 
-    /*  First part of the Cauchy product.                                     *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 |   |   |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    1 | x |   |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    0 | x | x |   |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = zero; n <= A_deg; ++n)
-    {
-        P_coeffs[n] = A_coeffs[0] * B_coeffs[n];
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
 
-        for (m = one; m <= n; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-    }
+    P_len = A_len + B_len - (size_t)1;
 
-    /*  Second part of the Cauchy product.                                    *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 | x | x | x |   |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    1 |   | x | x | x |   |   |                                         *
-     *      |-----------------------|                                         *
-     *    0 |   |   | x | x | x |   |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = A_deg + one; n <= B_deg; ++n)
-    {
-        P_coeffs[n] = A_coeffs[0] * B_coeffs[n];
+    /*  The kernel accumulates, so start from the zero polynomial.            */
+    for (n = zero; n < P_len; ++n)
+        P_coeffs[n] = 0;
 
-        for (m = one; m <= A_deg; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-    }
-
-    /*  Third part of the Cauchy product.                                     *
-     *                                                                        *
-     *      |-----------------------|                                         *
-     *    2 |   |   |   | x | x | x |                                         *
-     *      |-----------------------|                                         *
-     *    1 |   |   |   |   | x | x |                                         *
-     *      |-----------------------|                                         *
-     *    0 |   |   |   |   |   | x |                                         *
-     *      |-----------------------|                                         *
-     *        0   1   2   3   4   5                                           *
-     *                                                                        */
-    for (n = B_deg + one; n <= A_deg + B_deg; ++n)
-    {
-        m = n - B_deg;
-        P_coeffs[n] = A_coeffs[m] * B_coeffs[B_deg];
-
-        for (m = m + one; m <= A_deg; ++m)
-            P_coeffs[n] += A_coeffs[m] * B_coeffs[n - m];
-    }
+    Naive_Kernel(P_coeffs, A_coeffs, NULL, A_len, B_coeffs, B_len);
 }
 /*  End of Naive_Product.                                                     */
@@ -0,0 +1,95 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with coefficients modulo p.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Product_Mod                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod p the naive way.                                 *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array, at least A_len + B_len - 1 wide.           *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel_Mod (polynomial_multiplication.h):                       *
+ *          Accumulates the products of the coefficients, reducing lazily.    *
+ *  Method:                                                                   *
+ *      Zero P and add the products with Naive_Kernel_Mod.                    *
+ *  Notes:                                                                    *
+ *      The coefficients of A and B must lie in [0, p), and those of P do     *
+ *      too. The operands may be given in either order.                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing P = A*B mod p.                                     */
+void
+Naive_Product_Mod(unsigned int *P_coeffs,
+                  const unsigned int *A_coeffs, size_t A_len,
+                  const unsigned int *B_coeffs, size_t B_len,
+                  const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  The number of coefficients in the product.                            */
+    size_t P_len;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    P_len = A_len + B_len - (size_t)1;
+
+    /*  The kernel adds to P, so start from zero.                             */
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0U;
+
+    Naive_Kernel_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+}
+/*  End of Naive_Product_Mod.                                                 */
@@ -0,0 +1,204 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Naive products for output arrays that may overlap the operands.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Product_Overlap                                                 *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B the naive way, where P may overlap A or B.           *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      Cut A, B, and P into blocks of W = NAIVE_OVERLAP_BLOCK coefficients.  *
+ *      The product of block a of A with block b of B only touches blocks     *
+ *      a + b and a + b + 1 of P. The pairs of blocks are visited in order    *
+ *      of decreasing d = a + b, accumulating into a buffer of two blocks on  *
+ *      the stack. Once the pairs for d are done, block d + 1 of P is final   *
+ *      and is written out. Every pair visited from then on only reads A[m]   *
+ *      and B[n] for m, n < (d + 1) W, and since P does not start before A    *
+ *      or B, those are stored below the part of P written so far.            *
+ *  Notes:                                                                    *
+ *      If P overlaps A it may not start before it, and likewise for B. This  *
+ *      allows P = A, P = B, and squaring in place with P = A = B. The        *
+ *      lengths may be given in either order. If either is zero, P is not     *
+ *      touched.                                                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_AddTo_Product_Overlap                                           *
+ *  Purpose:                                                                  *
+ *      Computes P += A*B the naive way, where P may overlap A or B.          *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      As Naive_Product_Overlap, with each block of the buffer starting from *
+ *      the values already in P rather than from zero. These have not been    *
+ *      overwritten yet either.                                               *
+ *  Notes:                                                                    *
+ *      The rules for overlapping are those of Naive_Product_Overlap. The A   *
+ *      and B read are the ones from before the call, so with P = A this      *
+ *      computes A + A*B. All A_len + B_len - 1 coefficients of P are added   *
+ *      to.                                                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Computes P = A*B, or P += A*B if accumulate is non-zero, from the top.    */
+static void
+naive_product_overlap(int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len,
+                      int accumulate)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int T_coeffs[2*NAIVE_OVERLAP_BLOCK];
+    size_t d, a, k, m, n, rows, cols, a_first, a_last, upper, lower;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+    const size_t W = (size_t)NAIVE_OVERLAP_BLOCK;
+
+    /*  The number of coefficients in the product, and the number of blocks.  */
+    const size_t P_len = A_len + B_len - one;
+    const size_t A_blocks = (A_len + W - one) / W;
+    const size_t B_blocks = (B_len + W - one) / W;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == zero || B_len == zero)
+        return;
+
+    /*  The upper half of the buffer holds block d + 1 of P, and the lower    *
+     *  half block d. No pair of blocks has a + b = A_blocks + B_blocks - 1,  *
+     *  so the top block starts out as P, or zero.                            */
+    d = A_blocks + B_blocks - one;
+    upper = (P_len > d*W ? P_len - d*W : zero);
+
+    for (k = zero; k < upper; ++k)
+        T_coeffs[W + k] = (accumulate ? P_coeffs[d*W + k] : 0);
+
+    while (d > zero)
+    {
+        --d;
+
+        /*  Block d starts from zero, or from P, which is not yet written.    */
+        lower = (P_len - d*W < W ? P_len - d*W : W);
+
+        for (k = zero; k < lower; ++k)
+            T_coeffs[k] = (accumulate ? P_coeffs[d*W + k] : 0);
+
+        /*  The blocks of A paired with an existing block b = d - a of B.     */
+        a_first = (d >= B_blocks ? d - B_blocks + one : zero);
+        a_last = (d < A_blocks ? d + one : A_blocks);
+
+        for (a = a_first; a < a_last; ++a)
+        {
+            m = a * W;
+            n = (d - a) * W;
+            rows = (A_len - m < W ? A_len - m : W);
+            cols = (B_len - n < W ? B_len - n : W);
+
+            Naive_Kernel(
+                T_coeffs, A_coeffs + m, NULL, rows, B_coeffs + n, cols
+            );
+        }
+
+        /*  Block d + 1 is complete. The kernels above only read A[m] and     *
+         *  B[n] for m, n < (d + 1) W, which are stored below it in memory.   */
+        for (k = zero; k < upper; ++k)
+            P_coeffs[(d + one)*W + k] = T_coeffs[W + k];
+
+        for (k = zero; k < lower; ++k)
+            T_coeffs[W + k] = T_coeffs[k];
+
+        upper = lower;
+    }
+
+    /*  Block 0 is now complete as well.                                      */
+    for (k = zero; k < upper; ++k)
+        P_coeffs[k] = T_coeffs[W + k];
+}
+/*  End of naive_product_overlap.                                             */
+
+/*  Function for computing P = A*B where P may overlap A or B.                */
+void
+Naive_Product_Overlap(int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len)
+{
+    naive_product_overlap(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, 0);
+}
+/*  End of Naive_Product_Overlap.                                             */
+
+/*  Function for computing P += A*B where P may overlap A or B.               */
+void
+Naive_AddTo_Product_Overlap(int *P_coeffs,
+                            const int *A_coeffs, size_t A_len,
+                            const int *B_coeffs, size_t B_len)
+{
+    naive_product_overlap(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, 1);
+}
+/*  End of Naive_AddTo_Product_Overlap.                                       */
@@ -0,0 +1,187 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients, with 64-bit       *
+ *      outputs.                                                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Product_Wide                                                    *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B the naive way, with the coefficients of P            *
+ *      accumulated in long longs so that long products do not overflow.      *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates a tile of the product in ints.                        *
+ *      Naive_Kernel_Wide (polynomial_multiplication.h):                      *
+ *          Accumulates the product in long longs.                            *
+ *  Method:                                                                   *
+ *      Let a and b be the largest magnitudes of the coefficients of A and B. *
+ *      A sum of K products of coefficients is at most K a b in magnitude, so *
+ *      it fits in an int if K a b <= INT_MAX. If this holds for at least     *
+ *      NAIVE_WIDE_MIN_ROWS rows, the widening is deferred: the product is    *
+ *      cut into tiles of K rows of A by NAIVE_WIDE_COLUMNS coefficients of   *
+ *      B, K <= NAIVE_WIDE_ROWS, and each tile is computed in an int buffer   *
+ *      with the 32-bit kernel, then widened and added to P. The hot loop is  *
+ *      then the same as Naive_Product, and the widening costs two passes     *
+ *      over the buffer per tile.                                             *
+ *                                                                            *
+ *      If the coefficients are too large for this, the 64-bit kernel is used *
+ *      for the whole product, multiplying 32-bit inputs to 64-bit products.  *
+ *  Notes:                                                                    *
+ *      The result is exact whenever the coefficients of A*B fit in a long    *
+ *      long. long long is C99, but is available as an extension on every C89 *
+ *      compiler we support.                                                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) limits.h:                                                             *
+ *          Header file providing INT_MAX.                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  INT_MAX found here.                                                       */
+#include <limits.h>
+
+/*  Largest magnitude of the coefficients, computed without overflow.         */
+static unsigned int
+naive_product_wide_max_abs(const int *coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned int magnitude;
+    unsigned int max = 0U;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        /*  Negation is done unsigned, which is well defined for INT_MIN.     */
+        if (coeffs[n] < 0)
+            magnitude = 0U - (unsigned int)coeffs[n];
+        else
+            magnitude = (unsigned int)coeffs[n];
+
+        if (magnitude > max)
+            max = magnitude;
+    }
+
+    return max;
+}
+/*  End of naive_product_wide_max_abs.                                        */
+
+/*  Function for computing P = A*B with 64-bit outputs.                       */
+void
+Naive_Product_Wide(long long *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, m, k, rows, columns, tile_len, K;
+    unsigned long long bound;
+
+    /*  A tile of the product, accumulated in ints.                           */
+    int tile[NAIVE_WIDE_ROWS + NAIVE_WIDE_COLUMNS - 1];
+
+    /*  The number of coefficients in the product.                            */
+    size_t P_len;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    P_len = A_len + B_len - (size_t)1;
+
+    /*  The kernels accumulate, so start from the zero polynomial.            */
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    bound = (unsigned long long)naive_product_wide_max_abs(A_coeffs, A_len) *
+            naive_product_wide_max_abs(B_coeffs, B_len);
+
+    /*  The product is zero.                                                  */
+    if (bound == 0ULL)
+        return;
+
+    /*  The number of rows whose products may be summed in an int.            */
+    if (bound > (unsigned long long)INT_MAX / NAIVE_WIDE_MIN_ROWS)
+    {
+        Naive_Kernel_Wide(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    K = (size_t)((unsigned long long)INT_MAX / bound);
+
+    /*  The kernels work on four rows at a time, so avoid a partial tile.     */
+    if (K > (size_t)NAIVE_WIDE_ROWS)
+        K = (size_t)NAIVE_WIDE_ROWS;
+    else
+        K &= ~(size_t)3;
+
+    for (m = (size_t)0; m < A_len; m += K)
+    {
+        rows = (A_len - m < K ? A_len - m : K);
+
+        for (k = (size_t)0; k < B_len; k += (size_t)NAIVE_WIDE_COLUMNS)
+        {
+            columns = B_len - k;
+
+            if (columns > (size_t)NAIVE_WIDE_COLUMNS)
+                columns = (size_t)NAIVE_WIDE_COLUMNS;
+
+            tile_len = rows + columns - (size_t)1;
+
+            for (n = (size_t)0; n < tile_len; ++n)
+                tile[n] = 0;
+
+            Naive_Kernel(tile, A_coeffs + m, NULL, rows, B_coeffs + k, columns);
+
+            /*  Widen the tile and add it to P.                               */
+            for (n = (size_t)0; n < tile_len; ++n)
+                P_coeffs[m + k + n] += tile[n];
+        }
+    }
+}
+/*  End of Naive_Product_Wide.                                                */
@@ -0,0 +1,232 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with long long coefficients, with 128-bit    *
+ *      outputs.                                                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Product_Wide128                                                 *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B the naive way, with the coefficients of P            *
+ *      accumulated in 128-bit integers.                                      *
+ *  Arguments:                                                                *
+ *      P_coeffs (Poly_Int128 *):                                             *
+ *          A pointer to an array of Poly_Int128s, at least A_len + B_len - 1 *
+ *          wide.                                                             *
+ *      A_coeffs (const long long *):                                         *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const long long *):                                         *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel_Wide (polynomial_multiplication.h):                      *
+ *          Accumulates a tile of the product in long longs.                  *
+ *  Method:                                                                   *
+ *      As Naive_Product_Wide, one level up. Let a and b be the largest       *
+ *      magnitudes of the coefficients of A and B, and K the number of        *
+ *      products that may be summed in a long long, K a b <= LLONG_MAX. The   *
+ *      product is cut into tiles of K rows of A by NAIVE_WIDE_COLUMNS        *
+ *      coefficients of B, K <= NAIVE_WIDE_ROWS, each tile is computed in a   *
+ *      long long buffer, then widened and added to P. If the coefficients    *
+ *      fit in an int, the tiles are narrowed to ints and computed with the   *
+ *      SIMD kernel Naive_Kernel_Wide, otherwise with scalar 64-bit           *
+ *      multiplies. If K < 2 the products are formed and summed in 128 bits.  *
+ *  Notes:                                                                    *
+ *      The result is exact whenever the coefficients of A*B fit in a         *
+ *      Poly_Int128. Only compiled if the compiler provides a 128-bit         *
+ *      integer. Neither AVX2 nor NEON has a 64 x 64-bit multiply, so only    *
+ *      operands that fit in an int are vectorized.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) limits.h:                                                             *
+ *          Header file providing INT_MAX.                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  Poly_Int128 is only available with GCC compatible compilers.              */
+#ifdef POLY_HAS_INT128
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  INT_MAX found here.                                                       */
+#include <limits.h>
+
+/*  Largest magnitude of the coefficients, computed without overflow.         */
+static unsigned long long
+naive_product_wide128_max_abs(const long long *coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long long magnitude;
+    unsigned long long max = 0ULL;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        /*  Negation is done unsigned, which is well defined for LLONG_MIN.   */
+        if (coeffs[n] < 0)
+            magnitude = 0ULL - (unsigned long long)coeffs[n];
+        else
+            magnitude = (unsigned long long)coeffs[n];
+
+        if (magnitude > max)
+            max = magnitude;
+    }
+
+    return max;
+}
+/*  End of naive_product_wide128_max_abs.                                     */
+
+/*  Function for computing P = A*B with 128-bit outputs.                      */
+void
+Naive_Product_Wide128(Poly_Int128 *P_coeffs,
+                      const long long *A_coeffs, size_t A_len,
+                      const long long *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, m, k, r, rows, columns, tile_len;
+    unsigned long long A_max, B_max, bound;
+    long long a;
+    Poly_Int128 wide;
+    int narrow;
+
+    /*  The number of rows per tile, zero if products do not fit in 64 bits.  */
+    size_t K = (size_t)0;
+
+    /*  A tile of the product, and the operands narrowed to ints.             */
+    long long tile[NAIVE_WIDE_ROWS + NAIVE_WIDE_COLUMNS - 1];
+    int A_tile[NAIVE_WIDE_ROWS], B_tile[NAIVE_WIDE_COLUMNS];
+
+    /*  LLONG_MAX is C99, compute it with unsigned arithmetic.                */
+    const unsigned long long llong_max = ~0ULL >> 1;
+
+    /*  The number of coefficients in the product.                            */
+    size_t P_len;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    P_len = A_len + B_len - (size_t)1;
+
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    A_max = naive_product_wide128_max_abs(A_coeffs, A_len);
+    B_max = naive_product_wide128_max_abs(B_coeffs, B_len);
+
+    /*  The product is zero.                                                  */
+    if (A_max == 0ULL || B_max == 0ULL)
+        return;
+
+    /*  The number of products that may be summed in a long long.             */
+    if (A_max <= llong_max / B_max)
+    {
+        bound = A_max * B_max;
+
+        if (bound <= llong_max / NAIVE_WIDE_ROWS)
+            K = (size_t)NAIVE_WIDE_ROWS;
+        else
+            K = (size_t)(llong_max / bound);
+    }
+
+    /*  The coefficients are too large to defer the widening.                 */
+    if (K < (size_t)2)
+    {
+        for (m = (size_t)0; m < A_len; ++m)
+        {
+            wide = (Poly_Int128)A_coeffs[m];
+
+            for (n = (size_t)0; n < B_len; ++n)
+                P_coeffs[m + n] += wide * B_coeffs[n];
+        }
+
+        return;
+    }
+
+    /*  Coefficients that fit in an int can use the SIMD kernel.              */
+    narrow = (A_max <= (unsigned long long)INT_MAX) &&
+             (B_max <= (unsigned long long)INT_MAX);
+
+    for (m = (size_t)0; m < A_len; m += K)
+    {
+        rows = (A_len - m < K ? A_len - m : K);
+
+        if (narrow)
+            for (r = (size_t)0; r < rows; ++r)
+                A_tile[r] = (int)A_coeffs[m + r];
+
+        for (k = (size_t)0; k < B_len; k += (size_t)NAIVE_WIDE_COLUMNS)
+        {
+            columns = B_len - k;
+
+            if (columns > (size_t)NAIVE_WIDE_COLUMNS)
+                columns = (size_t)NAIVE_WIDE_COLUMNS;
+
+            tile_len = rows + columns - (size_t)1;
+
+            for (n = (size_t)0; n < tile_len; ++n)
+                tile[n] = 0;
+
+            if (narrow)
+            {
+                for (n = (size_t)0; n < columns; ++n)
+                    B_tile[n] = (int)B_coeffs[k + n];
+
+                Naive_Kernel_Wide(tile, A_tile, rows, B_tile, columns);
+            }
+            else
+            {
+                for (r = (size_t)0; r < rows; ++r)
+                {
+                    a = A_coeffs[m + r];
+
+                    for (n = (size_t)0; n < columns; ++n)
+                        tile[r + n] += a * B_coeffs[k + n];
+                }
+            }
+
+            /*  Widen the tile and add it to P.                               */
+            for (n = (size_t)0; n < tile_len; ++n)
+                P_coeffs[m + k + n] += tile[n];
+        }
+    }
+}
+/*  End of Naive_Product_Wide128.                                             */
+
+#endif
+/*  End of #ifdef POLY_HAS_INT128.                                            */
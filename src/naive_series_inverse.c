@@ -0,0 +1,110 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the inverse of a power series with integer coefficients.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Series_Inverse                                                  *
+ *  Purpose:                                                                  *
+ *      Computes I = 1/B mod x^len, the first len coefficients of the power   *
+ *      series inverse of B, the naive way.                                   *
+ *  Arguments:                                                                *
+ *      I_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the inverse to compute.             *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if B[0] is not 1 or -1.                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Comparing coefficients in B*I = 1 gives I[0] = 1/B[0] and             *
+ *                                                                            *
+ *          I[n] = -(B[1] I[n - 1] + ... + B[n] I[0]) / B[0]                  *
+ *                                                                            *
+ *      for n > 0, with B[j] = 0 past the end of B. This costs about          *
+ *      len min(len, B_len) products.                                         *
+ *  Notes:                                                                    *
+ *      The inverse has integer coefficients exactly when B[0] is 1 or -1,    *
+ *      and then 1/B[0] = B[0]. Otherwise, and for an empty B, -1 is returned *
+ *      and I is not touched. The coefficients of the inverse usually grow    *
+ *      quickly, and as for the products the output is only correct if the    *
+ *      sums do not overflow.                                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing I = 1/B mod x^len for integer polynomials.         */
+int
+Naive_Series_Inverse(int *I_coeffs,
+                     const int *B_coeffs, size_t B_len,
+                     size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, j, top;
+    int sum, b0;
+
+    /*  Only B[0] = 1 and B[0] = -1 have an inverse with integer entries.     */
+    if (B_len == (size_t)0 || (B_coeffs[0] != 1 && B_coeffs[0] != -1))
+        return -1;
+
+    b0 = B_coeffs[0];
+
+    if (len == (size_t)0)
+        return 0;
+
+    I_coeffs[0] = b0;
+
+    for (n = (size_t)1; n < len; ++n)
+    {
+        /*  B[j] is zero for j >= B_len.                                      */
+        top = (n < B_len - (size_t)1 ? n : B_len - (size_t)1);
+        sum = 0;
+
+        for (j = (size_t)1; j <= top; ++j)
+            sum += B_coeffs[j] * I_coeffs[n - j];
+
+        I_coeffs[n] = -b0 * sum;
+    }
+
+    return 0;
+}
+/*  End of Naive_Series_Inverse.                                              */
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the low coefficients of A*B for integer polynomials.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Short_Product                                                   *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod x^len, the first len coefficients of the         *
+ *      product, the naive way.                                               *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      Only the products A[m] B[n] with m + n < len are needed, a triangle   *
+ *      rather than a rectangle. A is cut into bands of NAIVE_SHORT_ROWS      *
+ *      coefficients. In a band starting at A[m], every row needs B[n] for    *
+ *                                                                            *
+ *          n < len - m - rows + 1                                            *
+ *                                                                            *
+ *      which is passed to Naive_Kernel as a rectangle. The remaining small   *
+ *      triangle at the end of each row of the band is added term by term.    *
+ *      For len at most NAIVE_SHORT_CUTOFF the scalar triangles cost more     *
+ *      than they save, and the whole product is formed on the stack.         *
+ *  Notes:                                                                    *
+ *      A and B may have any lengths, and only their first len coefficients   *
+ *      are used. If len is more than A_len + B_len - 1, the rest of P is     *
+ *      zero. For A_len = B_len = len this forms about half the products of   *
+ *      Naive_Product.                                                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Function for computing P = A*B mod x^len for integer polynomials.         */
+void
+Naive_Short_Product(int *P_coeffs,
+                    const int *A_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len,
+                    size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int T_coeffs[2*NAIVE_SHORT_CUTOFF];
+    size_t n, m, r, rows, cols, end;
+    int a;
+
+    /*  The kernel accumulates, so start from the zero polynomial.            */
+    for (n = (size_t)0; n < len; ++n)
+        P_coeffs[n] = 0;
+
+    /*  Coefficients past x^(len - 1) never contribute.                       */
+    if (A_len > len)
+        A_len = len;
+
+    if (B_len > len)
+        B_len = len;
+
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    /*  Short products are faster as a whole product, with the top discarded. */
+    if (len <= (size_t)NAIVE_SHORT_CUTOFF)
+    {
+        end = A_len + B_len - (size_t)1;
+
+        for (n = (size_t)0; n < end; ++n)
+            T_coeffs[n] = 0;
+
+        Naive_Kernel(T_coeffs, A_coeffs, NULL, A_len, B_coeffs, B_len);
+
+        if (end > len)
+            end = len;
+
+        for (n = (size_t)0; n < end; ++n)
+            P_coeffs[n] = T_coeffs[n];
+
+        return;
+    }
+
+    for (m = (size_t)0; m < A_len; m += rows)
+    {
+        rows = A_len - m;
+
+        if (rows > (size_t)NAIVE_SHORT_ROWS)
+            rows = (size_t)NAIVE_SHORT_ROWS;
+
+        /*  The part of B that every row of the band needs in full. This is   *
+         *  at least one, since m + rows <= A_len <= len.                     */
+        cols = len - m - rows + (size_t)1;
+
+        if (cols > B_len)
+            cols = B_len;
+
+        Naive_Kernel(P_coeffs + m, A_coeffs + m, NULL, rows, B_coeffs, cols);
+
+        /*  Row r also needs B[n] for cols <= n < len - m - r.                */
+        for (r = (size_t)0; r < rows; ++r)
+        {
+            end = len - m - r;
+
+            if (end > B_len)
+                end = B_len;
+
+            a = A_coeffs[m + r];
+
+            for (n = cols; n < end; ++n)
+                P_coeffs[m + r + n] += a * B_coeffs[n];
+        }
+    }
+}
+/*  End of Naive_Short_Product.                                               */
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Square a polynomial with integer coefficients.                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Square                                                          *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A the naive way, with about half the multiplications   *
+ *      of Naive_Product.                                                     *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel (polynomial_multiplication.h):                           *
+ *          Accumulates the products of the coefficients, using SIMD if the   *
+ *          CPU supports it.                                                  *
+ *  Method:                                                                   *
+ *      The coefficient of x^k in A*A is the sum of A[i] A[j] over i + j = k, *
+ *      and each term with i != j appears twice. A is cut into bands of       *
+ *      NAIVE_SQUARE_ROWS coefficients. Each band B_m = A[m], ..., A[m+r-1]   *
+ *      contributes                                                           *
+ *                                                                            *
+ *          x^{2m} B_m*B_m + 2 x^{2m+r} B_m*(A[m+r] + A[m+r+1] x + ...)       *
+ *                                                                            *
+ *      The small square is an ordinary product of the band with itself, and  *
+ *      the rectangle is found by Naive_Kernel with the band passed as both   *
+ *      of its A operands, so that their sum doubles it at no cost.           *
+ *  Notes:                                                                    *
+ *      About len^2 / 2 products are formed rather than len^2, all of them    *
+ *      in the row kernel. For a short A the kernel's cost is dominated by    *
+ *      the edges of the bands, so at or below NAIVE_SQUARE_CUTOFF the whole  *
+ *      product A*A is formed instead.                                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  Function for computing P = A*A for integer polynomials.                   */
+void Naive_Square(int *P_coeffs, const int *A_coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, m, rows, P_len;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    /*  The number of coefficients in the square.                             */
+    P_len = (size_t)2*len - (size_t)1;
+
+    /*  The kernel accumulates, so start from the zero polynomial.            */
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    /*  Short squares are faster as an ordinary product.                      */
+    if (len <= (size_t)NAIVE_SQUARE_CUTOFF)
+    {
+        Naive_Kernel(P_coeffs, A_coeffs, NULL, len, A_coeffs, len);
+        return;
+    }
+
+    for (m = (size_t)0; m < len; m += rows)
+    {
+        rows = len - m;
+
+        if (rows > (size_t)NAIVE_SQUARE_ROWS)
+            rows = (size_t)NAIVE_SQUARE_ROWS;
+
+        /*  The products of the band with itself, each pair in both orders.   */
+        Naive_Kernel(
+            P_coeffs + 2*m, A_coeffs + m, NULL, rows, A_coeffs + m, rows
+        );
+
+        /*  Twice the products of the band with the terms that follow it.     */
+        if (m + rows < len)
+            Naive_Kernel(
+                P_coeffs + 2*m + rows, A_coeffs + m, A_coeffs + m, rows,
+                A_coeffs + m + rows, len - m - rows
+            );
+    }
+}
+/*  End of Naive_Square.                                                      */
@@ -0,0 +1,120 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials modulo p using the number theoretic          *
+ *      transform.                                                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Product_Mod                                                       *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod p using a number theoretic transform mod p.      *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array, at least A_len + B_len - 1 wide.           *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Product_Mod (polynomial_multiplication.h):                      *
+ *          Computes P = A*B mod p if the transform can not be used.          *
+ *      NTT_Scratch_Size_Mod (polynomial_multiplication.h):                   *
+ *          Computes the amount of scratch space needed.                      *
+ *      NTT_Product_Mod_With_Scratch (polynomial_multiplication.h):           *
+ *          Performs the transforms with the allocated scratch.               *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space used by the transforms.               *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call NTT_Product_Mod_With_Scratch.     *
+ *  Notes:                                                                    *
+ *      If p does not support a transform of the needed length, or the        *
+ *      scratch space can not be allocated, this falls back to the naive      *
+ *      method. The output is still correct, but slower.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*B mod p.                                     */
+void
+NTT_Product_Mod(unsigned int *P_coeffs,
+                const unsigned int *A_coeffs, size_t A_len,
+                const unsigned int *B_coeffs, size_t B_len,
+                const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int *work;
+
+    /*  The amount of scratch space needed for the transforms.                */
+    const size_t size = NTT_Scratch_Size_Mod(A_len, B_len, mod);
+
+    /*  Zero means p does not allow a transform this long.                    */
+    if (size == (size_t)0)
+    {
+        Naive_Product_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Product_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+        return;
+    }
+
+    NTT_Product_Mod_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work, mod
+    );
+
+    free(work);
+}
+/*  End of NTT_Product_Mod.                                                   */
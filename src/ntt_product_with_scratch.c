@@ -0,0 +1,1060 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Number theoretic transform multiplication with caller supplied        *
+ *      scratch space, with int or long long outputs, or modulo p, from       *
+ *      precomputed transforms, for sums of products, and for middle          *
+ *      products.                                                             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Product_With_Scratch                                              *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B exactly using number theoretic transforms over       *
+ *      three primes and the Chinese remainder theorem.                       *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least NTT_Scratch_Size(A_len, B_len) wide.      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *      Toom3_Product_With_Scratch (polynomial_multiplication.h):             *
+ *          Used if the product is longer than NTT_MAX_LENGTH.                *
+ *  Method:                                                                   *
+ *      Let N be the smallest power of two with N >= A_len + B_len - 1. For   *
+ *      each of the primes                                                    *
+ *                                                                            *
+ *          p0 = 15 * 2^27 + 1 = 2013265921                                   *
+ *          p1 =  7 * 2^26 + 1 =  469762049                                   *
+ *          p2 =  5 * 2^25 + 1 =  167772161                                   *
+ *                                                                            *
+ *      reduce A and B mod p, compute their length N transforms, multiply     *
+ *      point-wise, and invert the transform. This gives A*B mod p. The       *
+ *      residues are combined with Garner's algorithm, giving A*B modulo      *
+ *      M = p0 p1 p2, roughly 2^87, and the symmetric residue is reduced mod  *
+ *      2^32. Arithmetic mod p is done in Montgomery form with R = 2^32.      *
+ *  Notes:                                                                    *
+ *      If the true coefficients lie in (-M/2, M/2), which holds whenever     *
+ *      the naive method does not overflow, the output is bit-for-bit equal   *
+ *      to Naive_Product. Past that it matches two's complement wrap-around.  *
+ *                                                                            *
+ *      If A and B are the same array of the same length, only one forward    *
+ *      transform per prime is computed, and it is squared point-wise.        *
+ *                                                                            *
+ *      The scratch array is used as unsigned ints, which is allowed since    *
+ *      int and unsigned int may alias one another. The 64-bit products need  *
+ *      unsigned long long, which is C99, but is available as an extension on *
+ *      every C89 compiler we support.                                        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Square_With_Scratch                                               *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A as NTT_Product_With_Scratch, with one forward        *
+ *      transform per prime rather than two.                                  *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least NTT_Scratch_Size(len, len) wide.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      NTT_Product_With_Scratch (polynomial_multiplication.h):               *
+ *          Computes the product of A with itself.                            *
+ *  Method:                                                                   *
+ *      Transform A modulo each prime, square the transform point-wise, and   *
+ *      invert it, then combine the residues as for a product. This is two    *
+ *      transforms per prime rather than three.                               *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Product_Wide_With_Scratch                                         *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B exactly as NTT_Product_With_Scratch, with 64-bit     *
+ *      outputs.                                                              *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least NTT_Scratch_Size(A_len, B_len) wide.      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Product_Wide (polynomial_multiplication.h):                     *
+ *          Used if the product is longer than NTT_MAX_LENGTH.                *
+ *  Method:                                                                   *
+ *      The same transforms and Garner step as NTT_Product_With_Scratch,      *
+ *      with the symmetric residue reduced mod 2^64 rather than 2^32.         *
+ *  Notes:                                                                    *
+ *      M is roughly 2^87, so the output is exact whenever the coefficients   *
+ *      of A*B fit in a long long.                                            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Product_Mod_With_Scratch                                          *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod p with a single number theoretic transform.      *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array, at least A_len + B_len - 1 wide.           *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (unsigned int *):                                                *
+ *          Scratch space, at least NTT_Scratch_Size_Mod(A_len, B_len, mod)   *
+ *          wide.                                                             *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Product_Mod (polynomial_multiplication.h):                      *
+ *          Used if there is no N-th root of unity mod p.                     *
+ *  Method:                                                                   *
+ *      The transform, point-wise product, and inverse used for each prime    *
+ *      of NTT_Product_With_Scratch, with the caller's modulus. The inputs    *
+ *      are already residues, so they only need converting to Montgomery      *
+ *      form, and no Chinese remainder step is needed.                        *
+ *  Notes:                                                                    *
+ *      The coefficients of A and B must lie in [0, p). The transform needs   *
+ *      p prime with N dividing p - 1, as p = c 2^k + 1 with N <= 2^k.        *
+ *      Otherwise the naive method is used and work is not touched. If A and  *
+ *      B are the same array, one forward transform is saved as above.        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Roots                                                             *
+ *  Purpose:                                                                  *
+ *      Computes the roots of unity for transforms of length N modulo the     *
+ *      three primes of NTT_Product_With_Scratch.                             *
+ *  Arguments:                                                                *
+ *      roots (unsigned int *):                                               *
+ *          The output, 3 N / 2 wide.                                         *
+ *      N (size_t):                                                           *
+ *          The length of the transforms, a power of two from 2 to            *
+ *          NTT_MAX_LENGTH.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *  Method:                                                                   *
+ *      For each prime in turn, the N / 2 powers of a primitive N-th root of  *
+ *      unity, in Montgomery form.                                            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Spectrum                                                          *
+ *  Purpose:                                                                  *
+ *      Computes the length N transforms of B modulo the three primes, for    *
+ *      reuse by NTT_Product_Spectra.                                         *
+ *  Arguments:                                                                *
+ *      S (unsigned int *):                                                   *
+ *          The output, 3 N wide.                                             *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most N.                        *
+ *      N (size_t):                                                           *
+ *          The length of the transforms.                                     *
+ *      roots (const unsigned int *):                                         *
+ *          The roots of unity computed by NTT_Roots for this N.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *  Method:                                                                   *
+ *      Reduce and zero pad B, and transform it, as for one operand of        *
+ *      NTT_Product_With_Scratch.                                             *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Product_Spectra                                                   *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B from the spectra of A and B.                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      len (size_t):                                                         *
+ *          The length of the product, A_len + B_len - 1. At most N.          *
+ *      SA (const unsigned int *):                                            *
+ *          The spectrum of A, computed by NTT_Spectrum.                      *
+ *      SB (const unsigned int *):                                            *
+ *          The spectrum of B, computed by NTT_Spectrum.                      *
+ *      N (size_t):                                                           *
+ *          The length of the transforms.                                     *
+ *      roots (const unsigned int *):                                         *
+ *          The roots of unity computed by NTT_Roots for this N.              *
+ *      work (int *):                                                         *
+ *          Scratch space, at least 3 len + N wide.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *  Method:                                                                   *
+ *      Multiply the spectra point-wise and invert the transform for each     *
+ *      prime, then combine the residues as NTT_Product_With_Scratch does.    *
+ *      This is one transform per prime, rather than three.                   *
+ *  Notes:                                                                    *
+ *      The result is the cyclic convolution of length N, which equals A*B    *
+ *      only if len <= N, so that nothing wraps around.                       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_AddTo_Sum_Of_Products_With_Scratch                                *
+ *  Purpose:                                                                  *
+ *      Computes P += A[0]*B[0] + ... + A[count-1]*B[count-1] exactly, with   *
+ *      one inverse transform per prime for the whole sum.                    *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of products in the sum.                                *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first factors, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second factors, each B_len long.    *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *      work (int *):                                                         *
+ *          Scratch space, at least NTT_Scratch_Size_Sum(A_len, B_len) wide.  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *      Toom3_Product_With_Scratch (polynomial_multiplication.h):             *
+ *          Used if the product is longer than NTT_MAX_LENGTH.                *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds the sum to P.                                                *
+ *  Method:                                                                   *
+ *      The transform is linear, so the transform of the sum is the sum of    *
+ *      the point-wise products of the transforms of A[i] and B[i]. For each  *
+ *      prime, these are accumulated in one array, which is inverted once.    *
+ *      The residues are combined as NTT_Product_With_Scratch does, and the   *
+ *      result is added to P. A sum of count products costs 2 count + 1       *
+ *      transforms per prime rather than 3 count, one Garner step rather than *
+ *      count, and P is only read and written once.                           *
+ *  Notes:                                                                    *
+ *      As for NTT_Product_With_Scratch, the output matches the naive method  *
+ *      whenever it does not overflow. Terms with A[i] and B[i] the same      *
+ *      array are squared with one forward transform. All A_len + B_len - 1   *
+ *      coefficients of P are added to.                                       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Middle_Product_With_Scratch                                       *
+ *  Purpose:                                                                  *
+ *      Computes the coefficients of x^(B_len - 1), ..., x^(A_len - 1) of A*B *
+ *      exactly, with transforms of about half the length of the product.     *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most A_len.                    *
+ *      work (int *):                                                         *
+ *          Scratch space, at least NTT_Scratch_Size_Middle(A_len, B_len)     *
+ *          wide.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the Montgomery constants for each prime.                  *
+ *      Karatsuba_Middle_Product_With_Scratch (polynomial_multiplication.h):  *
+ *          Used if A is longer than NTT_MAX_LENGTH.                          *
+ *  Method:                                                                   *
+ *      Let N be the smallest power of two with N >= A_len, rather than       *
+ *      A_len + B_len - 1. The cyclic convolution of length N folds the       *
+ *      coefficients of x^N and above back onto x^0, x^1, and so on, but the  *
+ *      product has degree A_len + B_len - 2, so only coefficients below      *
+ *      x^(B_len - 1) are touched. The middle coefficients are therefore      *
+ *      exact, and are read straight out of the inverse transforms. This is   *
+ *      the transpose of the product of B with a polynomial of length         *
+ *      A_len - B_len + 1, and costs the same.                                *
+ *  Notes:                                                                    *
+ *      As for NTT_Product_With_Scratch, the output matches the naive method  *
+ *      whenever it does not overflow.                                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) limits.h:                                                             *
+ *          Header file providing UINT_MAX and INT_MAX.                       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  UINT_MAX and INT_MAX found here.                                          */
+#include <limits.h>
+
+/*  Montgomery arithmetic below uses R = 2^32 and requires 32-bit ints.       */
+#if UINT_MAX != 0xFFFFFFFFU
+#error "NTT_Product_With_Scratch requires 32-bit unsigned int."
+#endif
+
+/*  Computes a b / 2^32 mod p for a, b in [0, p).                             */
+static unsigned int
+ntt_mont_mul(unsigned int a, unsigned int b, const Poly_Modulus *q)
+{
+    const unsigned long long t = (unsigned long long)a * b;
+    const unsigned int m = (unsigned int)t * q->p_inv;
+    const unsigned int u = (unsigned int)(
+        (t + (unsigned long long)m * q->p) >> 32
+    );
+
+    return (u >= q->p ? u - q->p : u);
+}
+/*  End of ntt_mont_mul.                                                      */
+
+/*  Computes b^e mod p with ordinary (not Montgomery) arithmetic.             */
+static unsigned int
+ntt_pow(unsigned int b, unsigned long e, unsigned int p)
+{
+    unsigned long long result = 1ULL;
+    unsigned long long base = b % p;
+
+    while (e)
+    {
+        if (e & 1UL)
+            result = (result * base) % p;
+
+        base = (base * base) % p;
+        e >>= 1;
+    }
+
+    return (unsigned int)result;
+}
+/*  End of ntt_pow.                                                           */
+
+/*  In-place forward transform of length N, in Montgomery form. roots holds   *
+ *  w^j for 0 <= j < N/2, where w is a primitive N-th root of unity.          */
+static void
+ntt_transform(unsigned int *a, size_t N,
+              const unsigned int *roots, const Poly_Modulus *q)
+{
+    size_t i, j, k, len, half, step;
+    unsigned int u, v, tmp;
+    const unsigned int p = q->p;
+
+    /*  Bit reversal permutation.                                             */
+    for (i = 1, j = 0; i < N; ++i)
+    {
+        k = N >> 1;
+
+        while (j & k)
+        {
+            j ^= k;
+            k >>= 1;
+        }
+
+        j |= k;
+
+        if (i < j)
+        {
+            tmp = a[i];
+            a[i] = a[j];
+            a[j] = tmp;
+        }
+    }
+
+    /*  Cooley-Tukey butterflies.                                             */
+    for (len = 2; len <= N; len <<= 1)
+    {
+        half = len >> 1;
+        step = N / len;
+
+        for (i = 0; i < N; i += len)
+        {
+            for (j = 0; j < half; ++j)
+            {
+                u = a[i + j];
+                v = ntt_mont_mul(a[i + j + half], roots[j * step], q);
+                a[i + j] = (u + v >= p ? u + v - p : u + v);
+                a[i + j + half] = (u >= v ? u - v : u + p - v);
+            }
+        }
+    }
+}
+/*  End of ntt_transform.                                                     */
+
+/*  Converts a coefficient into Montgomery form mod p.                        */
+static unsigned int ntt_reduce(int a, const Poly_Modulus *q)
+{
+    long long t = (long long)a % (long long)q->p;
+
+    if (t < 0)
+        t += q->p;
+
+    return ntt_mont_mul((unsigned int)t, q->r2, q);
+}
+/*  End of ntt_reduce.                                                        */
+
+/*  Powers w^j for 0 <= j < N/2 of a primitive N-th root of unity w mod p,    *
+ *  in Montgomery form.                                                       */
+static void ntt_roots(unsigned int *roots, size_t N, const Poly_Modulus *q)
+{
+    size_t n;
+    const size_t half = N >> 1;
+    const unsigned int w = ntt_mont_mul(
+        ntt_pow(q->g, (q->p - 1U) / N, q->p), q->r2, q
+    );
+
+    roots[0] = ntt_mont_mul(1U, q->r2, q);
+
+    for (n = 1; n < half; ++n)
+        roots[n] = ntt_mont_mul(roots[n - 1], w, q);
+}
+/*  End of ntt_roots.                                                         */
+
+/*  Inverts the transform fa of length N, in place, and stores the len        *
+ *  coefficients starting at x^first in R as ordinary residues.               */
+static void
+ntt_inverse(unsigned int *R, size_t first, size_t len, unsigned int *fa,
+            size_t N, const unsigned int *roots, const Poly_Modulus *q)
+{
+    size_t n;
+    unsigned int scale;
+
+    /*  The inverse transform is the forward transform followed by reversing  *
+     *  the entries 1 through N - 1, then scaling by 1/N.                     */
+    ntt_transform(fa, N, roots, q);
+
+    /*  Multiplying by N^-1 in ordinary form also leaves Montgomery form.     */
+    scale = ntt_pow((unsigned int)(N % q->p), q->p - 2U, q->p);
+
+    for (n = 0; n < len; ++n)
+    {
+        if (first + n == 0)
+            R[n] = ntt_mont_mul(fa[0], scale, q);
+        else
+            R[n] = ntt_mont_mul(fa[N - first - n], scale, q);
+    }
+}
+/*  End of ntt_inverse.                                                       */
+
+/*  Computes the cyclic convolution of length N of fa and fb, which are the   *
+ *  first 2N entries of work in Montgomery form, storing the len              *
+ *  coefficients starting at x^first in R as ordinary residues. work also     *
+ *  holds the roots. If square is set, fb is not used and fa is convolved     *
+ *  with itself.                                                              */
+static void
+ntt_convolve(unsigned int *R, size_t first, size_t len, size_t N,
+             unsigned int *work, const Poly_Modulus *q, int square)
+{
+    size_t n;
+    unsigned int *fa = work;
+    unsigned int *fb = fa + N;
+    unsigned int *roots = fb + N;
+
+    ntt_roots(roots, N, q);
+    ntt_transform(fa, N, roots, q);
+
+    /*  A square needs one forward transform rather than two.                 */
+    if (square)
+        for (n = 0; n < N; ++n)
+            fa[n] = ntt_mont_mul(fa[n], fa[n], q);
+
+    else
+    {
+        ntt_transform(fb, N, roots, q);
+
+        for (n = 0; n < N; ++n)
+            fa[n] = ntt_mont_mul(fa[n], fb[n], q);
+    }
+
+    ntt_inverse(R, first, len, fa, N, roots, q);
+}
+/*  End of ntt_convolve.                                                      */
+
+/*  Computes the len coefficients of A*B mod p starting at x^first, storing   *
+ *  the ordinary residues in R. If A and B are the same array, the product is *
+ *  computed as a square.                                                     */
+static void
+ntt_residues(unsigned int *R, size_t first, size_t len,
+             const int *A_coeffs, size_t A_len,
+             const int *B_coeffs, size_t B_len,
+             size_t N, unsigned int *work, const Poly_Modulus *q)
+{
+    size_t n;
+    unsigned int *fa = work;
+    unsigned int *fb = fa + N;
+
+    /*  A*A, given as the same array twice, is computed as a square.          */
+    const int square = (A_coeffs == B_coeffs && A_len == B_len);
+
+    /*  Reduce and zero pad the inputs.                                       */
+    for (n = 0; n < A_len; ++n)
+        fa[n] = ntt_reduce(A_coeffs[n], q);
+
+    for (n = A_len; n < N; ++n)
+        fa[n] = 0U;
+
+    if (!square)
+    {
+        for (n = 0; n < B_len; ++n)
+            fb[n] = ntt_reduce(B_coeffs[n], q);
+
+        for (n = B_len; n < N; ++n)
+            fb[n] = 0U;
+    }
+
+    ntt_convolve(R, first, len, N, work, q, square);
+}
+/*  End of ntt_residues.                                                      */
+
+/*  Sets up the three primes p0, p1, and p2.                                  */
+static void ntt_primes(Poly_Modulus *q)
+{
+    /*  Poly_Modulus_Init finds the primitive roots 31, 3, and 3.             */
+    Poly_Modulus_Init(q, 2013265921U);
+    Poly_Modulus_Init(q + 1, 469762049U);
+    Poly_Modulus_Init(q + 2, 167772161U);
+}
+/*  End of ntt_primes.                                                        */
+
+/*  Replaces the residues R0, R1, and R2 of each coefficient modulo p0, p1,   *
+ *  and p2, stored one after the other in work, with its value modulo         *
+ *  M = p0 p1 p2 in mixed radix form, R0 + p0 R1 + p0 p1 R2, with R1 in       *
+ *  [0, p1) and R2 in [0, p2).                                                */
+static void ntt_garner(unsigned int *work, size_t len, const Poly_Modulus *q)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned int p0_inv_p1, p0_inv_p2, p1_inv_p2;
+    unsigned long long v1, v2, t;
+    unsigned int * const R0 = work;
+    unsigned int * const R1 = R0 + len;
+    unsigned int * const R2 = R1 + len;
+
+    /*  Constants for Garner's algorithm.                                     */
+    p0_inv_p1 = ntt_pow(q[0].p % q[1].p, q[1].p - 2U, q[1].p);
+    p0_inv_p2 = ntt_pow(q[0].p % q[2].p, q[2].p - 2U, q[2].p);
+    p1_inv_p2 = ntt_pow(q[1].p % q[2].p, q[2].p - 2U, q[2].p);
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        v1 = (R1[n] + (unsigned long long)q[1].p - R0[n] % q[1].p) % q[1].p;
+        v1 = (v1 * p0_inv_p1) % q[1].p;
+
+        t = (R0[n] + (unsigned long long)q[0].p % q[2].p * v1) % q[2].p;
+        v2 = (R2[n] + (unsigned long long)q[2].p - t) % q[2].p;
+        v2 = (((v2 * p0_inv_p2) % q[2].p) * p1_inv_p2) % q[2].p;
+
+        R1[n] = (unsigned int)v1;
+        R2[n] = (unsigned int)v2;
+    }
+}
+/*  End of ntt_garner.                                                        */
+
+/*  Computes A*B modulo p0, p1, and p2, and writes each coefficient of the    *
+ *  product modulo M = p0 p1 p2 in mixed radix form, as ntt_garner. Requires  *
+ *  len <= NTT_MAX_LENGTH.                                                    */
+static void
+ntt_digits(unsigned int *work,
+           const int *A_coeffs, size_t A_len,
+           const int *B_coeffs, size_t B_len,
+           Poly_Modulus *q)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t N;
+    unsigned int *R0, *R1, *R2, *rest;
+
+    /*  The length of the output.                                             */
+    const size_t len = A_len + B_len - (size_t)1;
+
+    /*  The transform size, the smallest power of two at least len.           */
+    N = (size_t)2;
+
+    while (N < len)
+        N <<= 1;
+
+    ntt_primes(q);
+
+    /*  Carve up the scratch space. The residues come first.                  */
+    R0 = work;
+    R1 = R0 + len;
+    R2 = R1 + len;
+    rest = R2 + len;
+
+    ntt_residues(R0, 0, len, A_coeffs, A_len, B_coeffs, B_len, N, rest, q);
+    ntt_residues(R1, 0, len, A_coeffs, A_len, B_coeffs, B_len, N, rest, q + 1);
+    ntt_residues(R2, 0, len, A_coeffs, A_len, B_coeffs, B_len, N, rest, q + 2);
+    ntt_garner(work, len, q);
+}
+/*  End of ntt_digits.                                                        */
+
+/*  Converts the mixed radix digits written by ntt_garner to ints, reducing   *
+ *  the symmetric residue mod 2^32.                                           */
+static void
+ntt_to_int(int *P_coeffs, const unsigned int *work,
+           size_t len, const Poly_Modulus *q)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned int x;
+    const unsigned int * const R0 = work;
+    const unsigned int * const R1 = R0 + len;
+    const unsigned int * const R2 = R1 + len;
+
+    /*  p0 p1 and M = p0 p1 p2 modulo 2^32, for the final reduction.          */
+    const unsigned int p01_low = q[0].p * q[1].p;
+    const unsigned int M_low = p01_low * q[2].p;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        /*  The value mod 2^32. Unsigned arithmetic wraps around.             */
+        x = R0[n] + q[0].p * R1[n] + p01_low * R2[n];
+
+        /*  Residues in the upper half correspond to negative values.         */
+        if (R2[n] > (q[2].p >> 1))
+            x -= M_low;
+
+        /*  Convert to int without relying on implementation defined casts.   */
+        if (x <= (unsigned int)INT_MAX)
+            P_coeffs[n] = (int)x;
+        else
+            P_coeffs[n] = -(int)(0xFFFFFFFFU - x) - 1;
+    }
+}
+/*  End of ntt_to_int.                                                        */
+
+/*  Function for computing P = A*B for integer polynomials.                   */
+void
+NTT_Product_With_Scratch(int *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len,
+                         int *work)
+{
+    /*  The primes, set up by ntt_digits.                                     */
+    Poly_Modulus q[3];
+
+    /*  The length of the output.                                             */
+    size_t len;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    len = A_len + B_len - (size_t)1;
+
+    /*  Products not supported by the primes are done with Toom-Cook.         */
+    if (len > NTT_MAX_LENGTH)
+    {
+        Toom3_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    ntt_digits((unsigned int *)work, A_coeffs, A_len, B_coeffs, B_len, q);
+    ntt_to_int(P_coeffs, (unsigned int *)work, len, q);
+}
+/*  End of NTT_Product_With_Scratch.                                          */
+
+/*  Function for computing P = A*A for integer polynomials.                   */
+void
+NTT_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                        int *work)
+{
+    /*  The same array as both operands selects the square in ntt_residues.   */
+    NTT_Product_With_Scratch(P_coeffs, A_coeffs, len, A_coeffs, len, work);
+}
+/*  End of NTT_Square_With_Scratch.                                           */
+
+/*  Function for computing P = A*B with 64-bit outputs.                       */
+void
+NTT_Product_Wide_With_Scratch(long long *P_coeffs,
+                              const int *A_coeffs, size_t A_len,
+                              const int *B_coeffs, size_t B_len,
+                              int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    Poly_Modulus q[3];
+    unsigned int *R0, *R1, *R2;
+    unsigned long long M_low, p01, x;
+
+    /*  LLONG_MAX is C99, compute it with unsigned arithmetic.                */
+    const unsigned long long llong_max = ~0ULL >> 1;
+
+    /*  The length of the output.                                             */
+    const size_t len = A_len + B_len - (size_t)1;
+
+    /*  Products not supported by the primes are done the naive way.          */
+    if (len > NTT_MAX_LENGTH)
+    {
+        Naive_Product_Wide(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    ntt_digits((unsigned int *)work, A_coeffs, A_len, B_coeffs, B_len, q);
+    R0 = (unsigned int *)work;
+    R1 = R0 + len;
+    R2 = R1 + len;
+
+    /*  p0 p1, exactly, and M = p0 p1 p2 modulo 2^64.                         */
+    p01 = (unsigned long long)q[0].p * q[1].p;
+    M_low = p01 * q[2].p;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        /*  The value mod 2^64. Unsigned arithmetic wraps around.             */
+        x = R0[n] + (unsigned long long)q[0].p * R1[n] + p01 * R2[n];
+
+        /*  Residues in the upper half correspond to negative values.         */
+        if (R2[n] > (q[2].p >> 1))
+            x -= M_low;
+
+        /*  Convert to long long without implementation defined casts.        */
+        if (x <= llong_max)
+            P_coeffs[n] = (long long)x;
+        else
+            P_coeffs[n] = -(long long)(~0ULL - x) - 1;
+    }
+}
+/*  End of NTT_Product_Wide_With_Scratch.                                     */
+
+/*  Function for computing P = A*B mod p.                                     */
+void
+NTT_Product_Mod_With_Scratch(unsigned int *P_coeffs,
+                             const unsigned int *A_coeffs, size_t A_len,
+                             const unsigned int *B_coeffs, size_t B_len,
+                             unsigned int *work, const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, N;
+    unsigned int *fa, *fb;
+
+    /*  The length of the output.                                             */
+    const size_t len = A_len + B_len - (size_t)1;
+
+    /*  A*A, given as the same array twice, is computed as a square.          */
+    const int square = (A_coeffs == B_coeffs && A_len == B_len);
+
+    /*  The transform size, the smallest power of two at least len.           */
+    N = (size_t)2;
+
+    while (N < len)
+        N <<= 1;
+
+    /*  An N-th root of unity mod p exists only if N divides p - 1.           */
+    if (mod->two_adicity == 0U || N > ((size_t)1 << mod->two_adicity))
+    {
+        Naive_Product_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+        return;
+    }
+
+    fa = work;
+    fb = fa + N;
+
+    /*  Convert to Montgomery form and zero pad the inputs.                   */
+    for (n = (size_t)0; n < A_len; ++n)
+        fa[n] = ntt_mont_mul(A_coeffs[n], mod->r2, mod);
+
+    for (n = A_len; n < N; ++n)
+        fa[n] = 0U;
+
+    if (!square)
+    {
+        for (n = (size_t)0; n < B_len; ++n)
+            fb[n] = ntt_mont_mul(B_coeffs[n], mod->r2, mod);
+
+        for (n = B_len; n < N; ++n)
+            fb[n] = 0U;
+    }
+
+    ntt_convolve(P_coeffs, 0, len, N, work, mod, square);
+}
+/*  End of NTT_Product_Mod_With_Scratch.                                      */
+
+/*  Function for computing the roots of unity used by NTT_Spectrum.           */
+void NTT_Roots(unsigned int *roots, size_t N)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Modulus q[3];
+    int k;
+
+    ntt_primes(q);
+
+    for (k = 0; k < 3; ++k)
+        ntt_roots(roots + (size_t)k*(N >> 1), N, q + k);
+}
+/*  End of NTT_Roots.                                                         */
+
+/*  Function for computing the transforms of B modulo the three primes.       */
+void
+NTT_Spectrum(unsigned int *S, const int *B_coeffs, size_t B_len,
+             size_t N, const unsigned int *roots)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Modulus q[3];
+    unsigned int *f;
+    size_t n;
+    int k;
+
+    ntt_primes(q);
+
+    for (k = 0; k < 3; ++k)
+    {
+        f = S + (size_t)k*N;
+
+        for (n = (size_t)0; n < B_len; ++n)
+            f[n] = ntt_reduce(B_coeffs[n], q + k);
+
+        for (n = B_len; n < N; ++n)
+            f[n] = 0U;
+
+        ntt_transform(f, N, roots + (size_t)k*(N >> 1), q + k);
+    }
+}
+/*  End of NTT_Spectrum.                                                      */
+
+/*  Function for computing a product from the spectra of its factors.         */
+void
+NTT_Product_Spectra(int *P_coeffs, size_t len,
+                    const unsigned int *SA, const unsigned int *SB,
+                    size_t N, const unsigned int *roots, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Modulus q[3];
+    unsigned int *fa;
+    const unsigned int *a, *b;
+    size_t n;
+    int k;
+
+    /*  The residues come first, followed by the transform being inverted.    */
+    unsigned int * const R = (unsigned int *)work;
+    fa = R + (size_t)3*len;
+
+    ntt_primes(q);
+
+    for (k = 0; k < 3; ++k)
+    {
+        a = SA + (size_t)k*N;
+        b = SB + (size_t)k*N;
+
+        for (n = (size_t)0; n < N; ++n)
+            fa[n] = ntt_mont_mul(a[n], b[n], q + k);
+
+        ntt_inverse(
+            R + (size_t)k*len, 0, len, fa, N, roots + (size_t)k*(N >> 1), q + k
+        );
+    }
+
+    ntt_garner(R, len, q);
+    ntt_to_int(P_coeffs, R, len, q);
+}
+/*  End of NTT_Product_Spectra.                                               */
+
+/*  Function for computing P += A[0]*B[0] + ... + A[count-1]*B[count-1].      */
+void
+NTT_AddTo_Sum_Of_Products_With_Scratch(int *P_coeffs, size_t count,
+                                       const int * const *A_coeffs,
+                                       size_t A_len,
+                                       const int * const *B_coeffs,
+                                       size_t B_len,
+                                       int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Modulus q[3];
+    unsigned int *R, *sum, *fa, *fb, *roots;
+    unsigned int x;
+    size_t N, n, i;
+    int k, square;
+
+    /*  The length of the output.                                             */
+    const size_t len = A_len + B_len - (size_t)1;
+
+    /*  Products not supported by the primes are done one at a time.          */
+    if (len > NTT_MAX_LENGTH)
+    {
+        for (i = (size_t)0; i < count; ++i)
+        {
+            Toom3_Product_With_Scratch(
+                work, A_coeffs[i], A_len, B_coeffs[i], B_len, work + len
+            );
+
+            Scaled_AddTo(P_coeffs, work, len, 1);
+        }
+
+        return;
+    }
+
+    /*  The transform size, the smallest power of two at least len.           */
+    N = (size_t)2;
+
+    while (N < len)
+        N <<= 1;
+
+    ntt_primes(q);
+
+    /*  Carve up the scratch space. The residues come first.                  */
+    R = (unsigned int *)work;
+    sum = R + (size_t)3*len;
+    fa = sum + N;
+    fb = fa + N;
+    roots = fb + N;
+
+    for (k = 0; k < 3; ++k)
+    {
+        ntt_roots(roots, N, q + k);
+
+        for (n = (size_t)0; n < N; ++n)
+            sum[n] = 0U;
+
+        for (i = (size_t)0; i < count; ++i)
+        {
+            square = (A_coeffs[i] == B_coeffs[i] && A_len == B_len);
+
+            for (n = (size_t)0; n < A_len; ++n)
+                fa[n] = ntt_reduce(A_coeffs[i][n], q + k);
+
+            for (n = A_len; n < N; ++n)
+                fa[n] = 0U;
+
+            ntt_transform(fa, N, roots, q + k);
+
+            /*  A square needs one forward transform rather than two.         */
+            if (square)
+                fb = fa;
+
+            else
+            {
+                fb = fa + N;
+
+                for (n = (size_t)0; n < B_len; ++n)
+                    fb[n] = ntt_reduce(B_coeffs[i][n], q + k);
+
+                for (n = B_len; n < N; ++n)
+                    fb[n] = 0U;
+
+                ntt_transform(fb, N, roots, q + k);
+            }
+
+            /*  Accumulate the point-wise product, reduced to [0, p).         */
+            for (n = (size_t)0; n < N; ++n)
+            {
+                x = sum[n] + ntt_mont_mul(fa[n], fb[n], q + k);
+                sum[n] = (x >= q[k].p ? x - q[k].p : x);
+            }
+        }
+
+        ntt_inverse(R + (size_t)k*len, 0, len, sum, N, roots, q + k);
+    }
+
+    /*  The sum is no longer needed, so the result is written over it.        */
+    ntt_garner(R, len, q);
+    ntt_to_int((int *)sum, R, len, q);
+    Scaled_AddTo(P_coeffs, (int *)sum, len, 1);
+}
+/*  End of NTT_AddTo_Sum_Of_Products_With_Scratch.                            */
+
+/*  Function for computing the middle product of integer polynomials.         */
+void
+NTT_Middle_Product_With_Scratch(int *P_coeffs,
+                                const int *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len,
+                                int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Modulus q[3];
+    unsigned int *R, *rest;
+    size_t N, k;
+
+    /*  The number of coefficients computed, and the first of them.           */
+    const size_t len = A_len - B_len + (size_t)1;
+    const size_t first = B_len - (size_t)1;
+
+    /*  Inputs not supported by the primes are done with Karatsuba.           */
+    if (A_len > NTT_MAX_LENGTH)
+    {
+        Karatsuba_Middle_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    /*  Wrapping around modulo x^N only disturbs the low B_len - 1 terms.     */
+    N = (size_t)2;
+
+    while (N < A_len)
+        N <<= 1;
+
+    ntt_primes(q);
+
+    R = (unsigned int *)work;
+    rest = R + (size_t)3*len;
+
+    for (k = (size_t)0; k < (size_t)3; ++k)
+        ntt_residues(
+            R + k*len, first, len, A_coeffs, A_len, B_coeffs, B_len,
+            N, rest, q + k
+        );
+
+    ntt_garner(R, len, q);
+    ntt_to_int(P_coeffs, R, len, q);
+}
+/*  End of NTT_Middle_Product_With_Scratch.                                   */
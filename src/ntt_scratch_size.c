@@ -0,0 +1,208 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the scratch space needed by NTT_Product_With_Scratch,        *
+ *      NTT_Product_Mod_With_Scratch,                                         *
+ *      NTT_AddTo_Sum_Of_Products_With_Scratch, and                           *
+ *      NTT_Middle_Product_With_Scratch.                                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Scratch_Size                                                      *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      NTT_Product_With_Scratch needs to compute A*B.                        *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Toom3_Scratch_Size (polynomial_multiplication.h):                     *
+ *          Scratch space for products longer than NTT_MAX_LENGTH.            *
+ *  Method:                                                                   *
+ *      With len = A_len + B_len - 1 and N the smallest power of two with     *
+ *      N >= len, the residues mod the three primes take 3 len entries, the   *
+ *      two transforms take 2N, and the table of roots of unity takes N / 2.  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Scratch_Size_Mod                                                  *
+ *  Purpose:                                                                  *
+ *      Returns the number of unsigned ints of scratch space that             *
+ *      NTT_Product_Mod_With_Scratch needs to compute A*B mod p.              *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of unsigned ints the scratch array must hold.          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      There is one modulus, and the result is written straight to P, so     *
+ *      only the two transforms and the roots are needed, 2N + N / 2. This    *
+ *      is zero if the product is too long for p, as the naive method is      *
+ *      used instead.                                                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Scratch_Size_Sum                                                  *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      NTT_AddTo_Sum_Of_Products_With_Scratch needs for a sum of products    *
+ *      of A_len by B_len.                                                    *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Toom3_Scratch_Size (polynomial_multiplication.h):                     *
+ *          Scratch space for products longer than NTT_MAX_LENGTH.            *
+ *  Method:                                                                   *
+ *      As NTT_Scratch_Size, plus N for the running sum of the point-wise     *
+ *      products. Past NTT_MAX_LENGTH, one product of len coefficients and    *
+ *      the scratch for Toom3_Product_With_Scratch.                           *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Scratch_Size_Middle                                               *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      NTT_Middle_Product_With_Scratch needs for A_len by B_len.             *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most A_len.                    *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Middle_Scratch_Size (polynomial_multiplication.h):          *
+ *          Scratch space for A longer than NTT_MAX_LENGTH.                   *
+ *  Method:                                                                   *
+ *      As NTT_Scratch_Size, with residues for the A_len - B_len + 1 middle   *
+ *      coefficients only, and N the smallest power of two at least A_len.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Number of ints of scratch space needed to multiply A and B.               */
+size_t NTT_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  The length of the output, and the size of the transforms.             */
+    size_t len;
+    size_t N = (size_t)2;
+
+    /*  Empty products are not computed, no scratch space needed.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return (size_t)0;
+
+    len = A_len + B_len - (size_t)1;
+
+    /*  Products not supported by the primes are done with Toom-Cook.         */
+    if (len > NTT_MAX_LENGTH)
+        return Toom3_Scratch_Size(A_len, B_len);
+
+    while (N < len)
+        N <<= 1;
+
+    return (size_t)3*len + (size_t)2*N + (N >> 1);
+}
+/*  End of NTT_Scratch_Size.                                                  */
+
+/*  Number of unsigned ints of scratch space needed to multiply A and B.      */
+size_t
+NTT_Scratch_Size_Mod(size_t A_len, size_t B_len, const Poly_Modulus *mod)
+{
+    /*  The length of the output, and the size of the transforms.             */
+    const size_t len = A_len + B_len - (size_t)1;
+    size_t N = (size_t)2;
+
+    while (N < len)
+        N <<= 1;
+
+    /*  Products with no N-th root of unity mod p are done the naive way.     */
+    if (mod->two_adicity == 0U || N > ((size_t)1 << mod->two_adicity))
+        return (size_t)0;
+
+    return (size_t)2*N + (N >> 1);
+}
+/*  End of NTT_Scratch_Size_Mod.                                              */
+
+/*  Number of ints of scratch space needed for a sum of products A*B.         */
+size_t NTT_Scratch_Size_Sum(size_t A_len, size_t B_len)
+{
+    /*  The length of the output, and the size of the transforms.             */
+    const size_t len = A_len + B_len - (size_t)1;
+    size_t N = (size_t)2;
+
+    /*  Products not supported by the primes are done with Toom-Cook.         */
+    if (len > NTT_MAX_LENGTH)
+        return len + Toom3_Scratch_Size(A_len, B_len);
+
+    while (N < len)
+        N <<= 1;
+
+    return (size_t)3*len + (size_t)3*N + (N >> 1);
+}
+/*  End of NTT_Scratch_Size_Sum.                                              */
+
+/*  Number of ints of scratch space needed for a middle product of A and B.   */
+size_t NTT_Scratch_Size_Middle(size_t A_len, size_t B_len)
+{
+    /*  The length of the output, and the size of the transforms.             */
+    const size_t len = A_len - B_len + (size_t)1;
+    size_t N = (size_t)2;
+
+    /*  Inputs not supported by the primes are done with Karatsuba.           */
+    if (A_len > NTT_MAX_LENGTH)
+        return Karatsuba_Middle_Scratch_Size(A_len, B_len);
+
+    while (N < A_len)
+        N <<= 1;
+
+    return (size_t)3*len + (size_t)2*N + (N >> 1);
+}
+/*  End of NTT_Scratch_Size_Middle.                                           */
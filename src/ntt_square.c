@@ -0,0 +1,103 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Square a polynomial with integer coefficients using the number        *
+ *      theoretic transform.                                                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      NTT_Square                                                            *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A exactly using number theoretic transforms.           *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Square (polynomial_multiplication.h):                           *
+ *          Computes P = A*A if the scratch space can not be allocated.       *
+ *      NTT_Scratch_Size (polynomial_multiplication.h):                       *
+ *          Computes the amount of scratch space needed.                      *
+ *      NTT_Square_With_Scratch (polynomial_multiplication.h):                *
+ *          Performs the transforms with the allocated scratch.               *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space used by the transforms.               *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call NTT_Square_With_Scratch, which    *
+ *      transforms A once per prime and squares the transform point-wise.     *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower. Use            *
+ *      NTT_Square_With_Scratch to avoid the allocation entirely.             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*A for integer polynomials.                   */
+void NTT_Square(int *P_coeffs, const int *A_coeffs, size_t len)
+{
+    /*  The amount of scratch space needed for the transforms.                */
+    const size_t size = NTT_Scratch_Size(len, len);
+    int *work;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Square(P_coeffs, A_coeffs, len);
+        return;
+    }
+
+    NTT_Square_With_Scratch(P_coeffs, A_coeffs, len, work);
+    free(work);
+}
+/*  End of NTT_Square.                                                        */
@@ -0,0 +1,266 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Products of a linear combination, P += (c[0] A[0] + ... )*B, with the *
+ *      fastest available algorithm.                                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Combination_Product_Scratch_Size                                 *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_AddTo_Combination_Product_With_Scratch.                          *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for the product of the combination with B.          *
+ *  Method:                                                                   *
+ *      Room for the combination, its product with B, and the scratch for     *
+ *      computing that product. The naive method needs none of this.          *
+ *  Notes:                                                                    *
+ *      Unlike the other scratch sizes, the lengths are not interchangeable.  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_AddTo_Combination_Product_With_Scratch                           *
+ *  Purpose:                                                                  *
+ *      Computes P += (c[0] A[0] + ... + c[count-1] A[count-1])*B, choosing   *
+ *      the algorithm from the lengths, with caller supplied scratch space.   *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of terms in the linear combination.                    *
+ *      scalars (const int *):                                                *
+ *          The coefficients c[0], ..., c[count-1] of the combination.        *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the A polynomials, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least                                           *
+ *          Poly_Combination_Product_Scratch_Size(A_len, B_len) wide.         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Naive_AddTo_Combination_Product (polynomial_multiplication.h):        *
+ *          Used for short operands.                                          *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Multiplies the combination by B.                                  *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds the product to P.                                            *
+ *  Method:                                                                   *
+ *      The combination is a single polynomial, so the whole sum is one       *
+ *      product. For short operands, Naive_AddTo_Combination_Product forms    *
+ *      it a few rows at a time and accumulates straight into P. Otherwise    *
+ *      the combination is formed in the scratch space in one sweep over the  *
+ *      A polynomials, multiplied by B, and the product is added to P once.   *
+ *  Notes:                                                                    *
+ *      All A_len + B_len - 1 coefficients of P are added to. If count or     *
+ *      either length is zero, P is not touched. The tunables must not change *
+ *      between sizing the scratch array and calling this function.           *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_AddTo_Combination_Product                                        *
+ *  Purpose:                                                                  *
+ *      Computes P += (c[0] A[0] + ... + c[count-1] A[count-1])*B with the    *
+ *      fastest available algorithm.                                          *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of terms in the linear combination.                    *
+ *      scalars (const int *):                                                *
+ *          The coefficients c[0], ..., c[count-1] of the combination.        *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the A polynomials, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Combination_Product_Scratch_Size (polynomial_multiplication.h):  *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_AddTo_Combination_Product_With_Scratch                           *
+ *      (polynomial_multiplication.h):                                        *
+ *          Computes the product with the allocated scratch.                  *
+ *      Naive_AddTo_Combination_Product (polynomial_multiplication.h):        *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_AddTo_Combination_Product_With_Scratch.                          *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing the scratch space used by combination products.    */
+size_t Poly_Combination_Product_Scratch_Size(size_t A_len, size_t B_len)
+{
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return (size_t)0;
+
+    if (Poly_Select_Algorithm(A_len, B_len) == POLY_ALGORITHM_NAIVE)
+        return (size_t)0;
+
+    /*  The combination, its product with B, and the scratch for that.        */
+    return (size_t)2*A_len + B_len - (size_t)1 +
+           Poly_Scratch_Size(A_len, B_len);
+}
+/*  End of Poly_Combination_Product_Scratch_Size.                             */
+
+/*  Function for computing P += (c[0] A[0] + ...)*B with caller scratch.      */
+void
+Poly_AddTo_Combination_Product_With_Scratch(int *P_coeffs, size_t count,
+                                            const int *scalars,
+                                            const int * const *A_coeffs,
+                                            size_t A_len,
+                                            const int *B_coeffs,
+                                            size_t B_len,
+                                            int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *S_coeffs, *T_coeffs;
+    const int *A;
+    size_t i, n, len;
+    int c;
+
+    /*  An empty combination, or an empty product, adds nothing.              */
+    if (count == (size_t)0 || A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    if (Poly_Select_Algorithm(A_len, B_len) == POLY_ALGORITHM_NAIVE)
+    {
+        Naive_AddTo_Combination_Product(
+            P_coeffs, count, scalars, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    /*  The combination, followed by its product with B.                      */
+    len = A_len + B_len - (size_t)1;
+    S_coeffs = work;
+    T_coeffs = S_coeffs + A_len;
+
+    for (n = (size_t)0; n < A_len; ++n)
+        S_coeffs[n] = 0;
+
+    for (i = (size_t)0; i < count; ++i)
+    {
+        A = A_coeffs[i];
+        c = scalars[i];
+
+        for (n = (size_t)0; n < A_len; ++n)
+            S_coeffs[n] += c * A[n];
+    }
+
+    Poly_Multiply_With_Scratch(
+        T_coeffs, S_coeffs, A_len, B_coeffs, B_len, T_coeffs + len
+    );
+
+    Scaled_AddTo(P_coeffs, T_coeffs, len, 1);
+}
+/*  End of Poly_AddTo_Combination_Product_With_Scratch.                       */
+
+/*  Function for computing P += (c[0] A[0] + ...)*B with the fastest method.  */
+void
+Poly_AddTo_Combination_Product(int *P_coeffs, size_t count,
+                               const int *scalars,
+                               const int * const *A_coeffs, size_t A_len,
+                               const int *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    const size_t size = Poly_Combination_Product_Scratch_Size(A_len, B_len);
+    int *work;
+
+    /*  The naive method, and empty products, need no scratch space.          */
+    if (size == (size_t)0)
+    {
+        Poly_AddTo_Combination_Product_With_Scratch(
+            P_coeffs, count, scalars, A_coeffs, A_len, B_coeffs, B_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_AddTo_Combination_Product(
+            P_coeffs, count, scalars, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    Poly_AddTo_Combination_Product_With_Scratch(
+        P_coeffs, count, scalars, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_AddTo_Combination_Product.                                    */
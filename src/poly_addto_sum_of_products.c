@@ -0,0 +1,310 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sums of products, P += A[0]*B[0] + ... + A[count-1]*B[count-1], with  *
+ *      the fastest available algorithm.                                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Sum_Of_Products_Scratch_Size                                     *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_AddTo_Sum_Of_Products_With_Scratch.                              *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      NTT_Scratch_Size_Sum (polynomial_multiplication.h):                   *
+ *          Scratch space for the fused transforms.                           *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for one product at a time.                          *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_AddTo_Sum_Of_Products_With_Scratch.   *
+ *      When the products are formed one at a time, room is needed for one    *
+ *      product plus the scratch for computing it.                            *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. The naive method needs no   *
+ *      scratch space, so zero may be returned.                               *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_AddTo_Sum_Of_Products_With_Scratch                               *
+ *  Purpose:                                                                  *
+ *      Computes P += A[0]*B[0] + ... + A[count-1]*B[count-1], choosing the   *
+ *      algorithm from the lengths, with caller supplied scratch space.       *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of products in the sum.                                *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first factors, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second factors, each B_len long.    *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *      work (int *):                                                         *
+ *          Scratch space, at least                                           *
+ *          Poly_Sum_Of_Products_Scratch_Size(A_len, B_len) wide.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Naive_AddTo_Sum_Of_Products (polynomial_multiplication.h):            *
+ *          Accumulates every term in one sweep over P.                       *
+ *      NTT_AddTo_Sum_Of_Products_With_Scratch (polynomial_multiplication.h): *
+ *          Accumulates every term before a single inverse transform.         *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Computes the terms one at a time for Karatsuba and Toom-3.        *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds each of these terms to P.                                    *
+ *  Method:                                                                   *
+ *      Swap the roles of A and B so that A is the shorter, and dispatch on   *
+ *      the result of Poly_Select_Algorithm. The naive method and the NTT     *
+ *      sum every term as it goes, so the sum is added to P once. The NTT     *
+ *      also shares the inverse transforms and the Chinese remainder step     *
+ *      between all of the terms. Karatsuba and Toom-3 have no such sharing,  *
+ *      so each product is formed in the scratch space and added to P, which  *
+ *      costs little next to the product itself. The same is done if B is     *
+ *      so much longer than A that Poly_Multiply would slice it.              *
+ *  Notes:                                                                    *
+ *      All A_len + B_len - 1 coefficients of P are added to. If count or     *
+ *      either length is zero, P is not touched. The tunables must not change *
+ *      between sizing the scratch array and calling this function.           *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_AddTo_Sum_Of_Products                                            *
+ *  Purpose:                                                                  *
+ *      Computes P += A[0]*B[0] + ... + A[count-1]*B[count-1] with the        *
+ *      fastest available algorithm.                                          *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      count (size_t):                                                       *
+ *          The number of products in the sum.                                *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first factors, each A_len long.     *
+ *      A_len (size_t):                                                       *
+ *          The length of each of the A polynomials.                          *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second factors, each B_len long.    *
+ *      B_len (size_t):                                                       *
+ *          The length of each of the B polynomials.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Sum_Of_Products_Scratch_Size (polynomial_multiplication.h):      *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_AddTo_Sum_Of_Products_With_Scratch                               *
+ *      (polynomial_multiplication.h):                                        *
+ *          Computes the sum with the allocated scratch.                      *
+ *      Naive_AddTo_Sum_Of_Products (polynomial_multiplication.h):            *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_AddTo_Sum_Of_Products_With_Scratch.                              *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Whether the terms of a sum of products of A_len by B_len, with            *
+ *  A_len <= B_len, are accumulated in the transforms of the NTT.             */
+static int poly_sum_of_products_fused_ntt(size_t A_len, size_t B_len)
+{
+    /*  The ratio at which Poly_Multiply splits B into several transforms.    */
+    const size_t ratio = Poly_Get_Tunables()->unbalanced_ratio;
+
+    if (Poly_Select_Algorithm(A_len, B_len) != POLY_ALGORITHM_NTT)
+        return 0;
+
+    /*  Equivalent to B_len <= ratio*A_len, but without overflow.             */
+    return ((B_len - (size_t)1) / ratio < A_len);
+}
+/*  End of poly_sum_of_products_fused_ntt.                                    */
+
+/*  Function for computing the scratch space used by sums of products.        */
+size_t Poly_Sum_Of_Products_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t a, b;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len <= B_len)
+    {
+        a = A_len;
+        b = B_len;
+    }
+    else
+    {
+        a = B_len;
+        b = A_len;
+    }
+
+    if (a == (size_t)0)
+        return (size_t)0;
+
+    if (Poly_Select_Algorithm(a, b) == POLY_ALGORITHM_NAIVE)
+        return (size_t)0;
+
+    if (poly_sum_of_products_fused_ntt(a, b))
+        return NTT_Scratch_Size_Sum(a, b);
+
+    /*  One product at a time, plus the scratch for computing it.             */
+    return (a + b - (size_t)1) + Poly_Scratch_Size(a, b);
+}
+/*  End of Poly_Sum_Of_Products_Scratch_Size.                                 */
+
+/*  Function for computing P += A[0]*B[0] + ... with caller supplied scratch. */
+void
+Poly_AddTo_Sum_Of_Products_With_Scratch(int *P_coeffs, size_t count,
+                                        const int * const *A_coeffs,
+                                        size_t A_len,
+                                        const int * const *B_coeffs,
+                                        size_t B_len,
+                                        int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const int * const *tmp_coeffs;
+    size_t tmp_len, i;
+
+    /*  The length of the output.                                             */
+    const size_t len = A_len + B_len - (size_t)1;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    /*  An empty sum, or one of empty products, adds nothing.                 */
+    if (count == (size_t)0 || A_len == (size_t)0)
+        return;
+
+    if (Poly_Select_Algorithm(A_len, B_len) == POLY_ALGORITHM_NAIVE)
+    {
+        Naive_AddTo_Sum_Of_Products(
+            P_coeffs, count, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    if (poly_sum_of_products_fused_ntt(A_len, B_len))
+    {
+        NTT_AddTo_Sum_Of_Products_With_Scratch(
+            P_coeffs, count, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    /*  Karatsuba and Toom-3 form each product in the scratch space.          */
+    for (i = (size_t)0; i < count; ++i)
+    {
+        Poly_Multiply_With_Scratch(
+            work, A_coeffs[i], A_len, B_coeffs[i], B_len, work + len
+        );
+
+        Scaled_AddTo(P_coeffs, work, len, 1);
+    }
+}
+/*  End of Poly_AddTo_Sum_Of_Products_With_Scratch.                           */
+
+/*  Function for computing P += A[0]*B[0] + ... with the fastest algorithm.   */
+void
+Poly_AddTo_Sum_Of_Products(int *P_coeffs, size_t count,
+                           const int * const *A_coeffs, size_t A_len,
+                           const int * const *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    const size_t size = Poly_Sum_Of_Products_Scratch_Size(A_len, B_len);
+    int *work;
+
+    /*  The naive method, and empty products, need no scratch space.          */
+    if (size == (size_t)0)
+    {
+        Poly_AddTo_Sum_Of_Products_With_Scratch(
+            P_coeffs, count, A_coeffs, A_len, B_coeffs, B_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_AddTo_Sum_Of_Products(
+            P_coeffs, count, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    Poly_AddTo_Sum_Of_Products_With_Scratch(
+        P_coeffs, count, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_AddTo_Sum_Of_Products.                                        */
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Division with remainder, A = Q*B + R, in about the time of a product, *
+ *      using a power series inverse of the reversed divisor.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divide_Scratch_Size                                              *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Divide_With_Scratch.                                             *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the dividend.                                       *
+ *      B_len (size_t):                                                       *
+ *          The length of the divisor.                                        *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Series_Inverse_Scratch_Size (polynomial_multiplication.h):       *
+ *          Scratch space for the inverse of the reversed divisor.            *
+ *      Poly_Short_Scratch_Size (polynomial_multiplication.h):                *
+ *          Scratch space for the two short products.                         *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Divide_With_Scratch.                  *
+ *  Notes:                                                                    *
+ *      The lengths are not interchangeable. Zero may be returned.            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divide_With_Scratch                                              *
+ *  Purpose:                                                                  *
+ *      Computes Q and R with A = Q*B + R and deg(R) < deg(B), with caller    *
+ *      supplied scratch space.                                               *
+ *  Arguments:                                                                *
+ *      Q_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *          Not used if A_len < B_len.                                        *
+ *      R_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least B_len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the dividend.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the divisor.                *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Divide_Scratch_Size(A_len, B_len)    *
+ *          wide.                                                             *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if the leading coefficient of B is not 1 or -1.  *
+ *  Called Functions:                                                         *
+ *      Naive_Divide (polynomial_multiplication.h):                           *
+ *          Used if the quotient or the divisor is short.                     *
+ *      Poly_Series_Inverse_With_Scratch (polynomial_multiplication.h):       *
+ *          Inverts the reversed divisor.                                     *
+ *      Poly_Short_Product_With_Scratch (polynomial_multiplication.h):        *
+ *          Computes the quotient and the remainder.                          *
+ *  Method:                                                                   *
+ *      Write rev_k(P) = x^(k - 1) P(1/x) for the coefficients of P in        *
+ *      reverse order. With m = B_len and q = A_len - m + 1, A = Q*B + R      *
+ *      reverses to                                                           *
+ *                                                                            *
+ *          rev(A) = rev(Q) rev(B) + x^q rev(R)                               *
+ *                                                                            *
+ *      so rev(Q) = rev(A) / rev(B) mod x^q. The constant term of rev(B) is   *
+ *      the leading coefficient of B, so it has a power series inverse, and   *
+ *      Q costs one inverse of length q and one short product. Then           *
+ *      R = A - Q*B mod x^(m - 1), another short product. If q or m is at     *
+ *      most POLY_DIVIDE_CUTOFF, long division is faster, and is used.        *
+ *  Notes:                                                                    *
+ *      As for Naive_Divide, the leading coefficient of B must be 1 or -1. R  *
+ *      must not overlap A. The tunables must not change between sizing the   *
+ *      scratch array and calling this function.                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divide                                                           *
+ *  Purpose:                                                                  *
+ *      Computes Q and R with A = Q*B + R and deg(R) < deg(B) with the        *
+ *      fastest available algorithm.                                          *
+ *  Arguments:                                                                *
+ *      Q_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *          Not used if A_len < B_len.                                        *
+ *      R_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least B_len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the dividend.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the divisor.                *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if the leading coefficient of B is not 1 or -1.  *
+ *  Called Functions:                                                         *
+ *      Poly_Divide_Scratch_Size (polynomial_multiplication.h):               *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Divide_With_Scratch (polynomial_multiplication.h):               *
+ *          Computes the quotient and remainder with the allocated scratch.   *
+ *      Naive_Divide (polynomial_multiplication.h):                           *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call Poly_Divide_With_Scratch.         *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Returns true if long division should be used for A_len by B_len.          */
+static int poly_divide_is_naive(size_t A_len, size_t B_len)
+{
+    if (B_len == (size_t)0 || A_len < B_len)
+        return 1;
+
+    /*  Short divisors, and short quotients, cost little by long division.    */
+    if (B_len <= (size_t)POLY_DIVIDE_CUTOFF)
+        return 1;
+
+    return A_len - B_len + (size_t)1 <= (size_t)POLY_DIVIDE_CUTOFF;
+}
+/*  End of poly_divide_is_naive.                                              */
+
+/*  Function for computing the scratch space used by Poly_Divide.             */
+size_t Poly_Divide_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t q, r, size, most;
+
+    if (poly_divide_is_naive(A_len, B_len))
+        return (size_t)0;
+
+    q = A_len - B_len + (size_t)1;
+    r = (B_len < q ? B_len : q);
+
+    /*  The scratch for the inverse and for each of the short products.       */
+    most = Poly_Series_Inverse_Scratch_Size(r, q);
+    size = Poly_Short_Scratch_Size(q, q, q);
+
+    if (size > most)
+        most = size;
+
+    size = Poly_Short_Scratch_Size(q, B_len, B_len - (size_t)1);
+
+    if (size > most)
+        most = size;
+
+    /*  rev(A) and rev(B), cut to q terms, and the inverse of rev(B).         */
+    return (size_t)2*q + r + most;
+}
+/*  End of Poly_Divide_Scratch_Size.                                          */
+
+/*  Function for computing A = Q*B + R with caller scratch.                   */
+int
+Poly_Divide_With_Scratch(int *Q_coeffs, int *R_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len,
+                         int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, q, r;
+    int *A_rev, *B_rev, *inverse, *rest;
+    int tmp;
+
+    /*  Checks the divisor, and handles A shorter than B, as well.            */
+    if (poly_divide_is_naive(A_len, B_len))
+        return Naive_Divide(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+    if (B_coeffs[B_len - (size_t)1] != 1 && B_coeffs[B_len - (size_t)1] != -1)
+        return -1;
+
+    q = A_len - B_len + (size_t)1;
+    r = (B_len < q ? B_len : q);
+
+    A_rev = work;
+    inverse = A_rev + q;
+    B_rev = inverse + q;
+    rest = B_rev + r;
+
+    /*  The top q terms of A and the top r terms of B, reversed. The rest     *
+     *  can not affect rev(Q) mod x^q.                                        */
+    for (n = (size_t)0; n < q; ++n)
+        A_rev[n] = A_coeffs[A_len - (size_t)1 - n];
+
+    for (n = (size_t)0; n < r; ++n)
+        B_rev[n] = B_coeffs[B_len - (size_t)1 - n];
+
+    Poly_Series_Inverse_With_Scratch(inverse, B_rev, r, q, rest);
+
+    /*  rev(Q) = rev(A) / rev(B) mod x^q, then put Q the right way round.     */
+    Poly_Short_Product_With_Scratch(
+        Q_coeffs, A_rev, q, inverse, q, q, rest
+    );
+
+    for (n = (size_t)0; n < q >> 1; ++n)
+    {
+        tmp = Q_coeffs[n];
+        Q_coeffs[n] = Q_coeffs[q - (size_t)1 - n];
+        Q_coeffs[q - (size_t)1 - n] = tmp;
+    }
+
+    /*  R = A - Q*B, of which only the bottom B_len - 1 terms are nonzero.    */
+    Poly_Short_Product_With_Scratch(
+        R_coeffs, Q_coeffs, q, B_coeffs, B_len, B_len - (size_t)1, rest
+    );
+
+    for (n = (size_t)0; n < B_len - (size_t)1; ++n)
+        R_coeffs[n] = A_coeffs[n] - R_coeffs[n];
+
+    return 0;
+}
+/*  End of Poly_Divide_With_Scratch.                                          */
+
+/*  Function for computing A = Q*B + R with the fastest method.               */
+int
+Poly_Divide(int *Q_coeffs, int *R_coeffs,
+            const int *A_coeffs, size_t A_len,
+            const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *work;
+    int status;
+
+    /*  The amount of scratch space needed by the chosen method.              */
+    const size_t size = Poly_Divide_Scratch_Size(A_len, B_len);
+
+    /*  Long division needs no scratch space.                                 */
+    if (size == (size_t)0)
+        return Naive_Divide(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+        return Naive_Divide(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+    status = Poly_Divide_With_Scratch(
+        Q_coeffs, R_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+    return status;
+}
+/*  End of Poly_Divide.                                                       */
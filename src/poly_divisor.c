@@ -0,0 +1,455 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Plans for many divisions by the same polynomial B, storing the        *
+ *      inverse of the reversed divisor and plans for products against it.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divisor_Prepare                                                  *
+ *  Purpose:                                                                  *
+ *      Builds a plan for divisions of polynomials about A_len long by B.     *
+ *  Arguments:                                                                *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the divisor.                *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      A_len (size_t):                                                       *
+ *          The length of the dividends the plan is for.                      *
+ *  Output:                                                                   *
+ *      plan (Poly_Divisor *):                                                *
+ *          The plan, or NULL if the leading coefficient of B is not 1 or -1, *
+ *          or memory could not be allocated.                                 *
+ *  Called Functions:                                                         *
+ *      Poly_Divide_Scratch_Size (polynomial_multiplication.h):               *
+ *          Zero if long division will be used, and no tables are needed.     *
+ *      Poly_Series_Inverse (polynomial_multiplication.h):                    *
+ *          Inverts the reversed divisor.                                     *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Decides if the product with the inverse is worth a plan.          *
+ *      Poly_Prepare (polynomial_multiplication.h):                           *
+ *          Builds the plans for the products against the inverse and B.      *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the plan and its tables.                                *
+ *  Method:                                                                   *
+ *      Copy B, and with q = A_len - B_len + 1, store 1/rev(B) mod x^q and    *
+ *      plans for the products of length q pieces with it and with B. A       *
+ *      division then costs two products and no inverse. Only the bottom of   *
+ *      the product with the inverse is wanted, and its top may overflow.     *
+ *      The NTT forms the whole product regardless, so below NTT_CUTOFF no    *
+ *      plan is made for the inverse and a short product, which skips the     *
+ *      top, is used instead.                                                 *
+ *  Notes:                                                                    *
+ *      The plan may be used for dividends of any length. Longer ones than    *
+ *      A_len are divided as by Poly_Divide.                                  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divisor_Destroy                                                  *
+ *  Purpose:                                                                  *
+ *      Frees a plan made by Poly_Divisor_Prepare.                            *
+ *  Arguments:                                                                *
+ *      plan (Poly_Divisor *):                                                *
+ *          The plan to free. NULL is ignored.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Plan_Destroy (polynomial_multiplication.h):                      *
+ *          Frees the plans for the products.                                 *
+ *      free (stdlib.h):                                                      *
+ *          Releases the tables and the plan.                                 *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divisor_Scratch_Size                                             *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Divide_Prepared_With_Scratch for a dividend of length A_len.     *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Divisor *):                                          *
+ *          A plan made by Poly_Divisor_Prepare.                              *
+ *      A_len (size_t):                                                       *
+ *          The length of the dividend.                                       *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Divide_Scratch_Size (polynomial_multiplication.h):               *
+ *          Scratch for long division, or for dividends longer than planned.  *
+ *      Poly_Plan_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Scratch for the prepared products.                                *
+ *      Poly_Short_Scratch_Size (polynomial_multiplication.h):                *
+ *          Scratch for the product with an inverse that has no plan.         *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Divide_Prepared_With_Scratch.         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divide_Prepared_With_Scratch                                     *
+ *  Purpose:                                                                  *
+ *      Computes Q and R with A = Q*B + R for the B of a plan, with caller    *
+ *      supplied scratch space.                                               *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Divisor *):                                          *
+ *          A plan made by Poly_Divisor_Prepare.                              *
+ *      Q_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      R_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least B_len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the dividend.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Divisor_Scratch_Size(plan, A_len)    *
+ *          wide.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Divide (polynomial_multiplication.h):                           *
+ *          Used if the quotient or the divisor is short.                     *
+ *      Poly_Divide_With_Scratch (polynomial_multiplication.h):               *
+ *          Used for dividends longer than the plan is for.                   *
+ *      Poly_Multiply_Prepared_With_Scratch (polynomial_multiplication.h):    *
+ *          Computes the products against the inverse and B.                  *
+ *      Poly_Short_Product_With_Scratch (polynomial_multiplication.h):        *
+ *          Computes rev(A)/rev(B) if the inverse has no plan.                *
+ *  Method:                                                                   *
+ *      As Poly_Divide_With_Scratch, with the inverse read from the plan,     *
+ *      and the products done with the stored plans.                          *
+ *  Notes:                                                                    *
+ *      A plan may be shared by several threads.                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Divide_Prepared                                                  *
+ *  Purpose:                                                                  *
+ *      Computes Q and R with A = Q*B + R for the B of a plan.                *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Divisor *):                                          *
+ *          A plan made by Poly_Divisor_Prepare.                              *
+ *      Q_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      R_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least B_len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the dividend.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Divisor_Scratch_Size (polynomial_multiplication.h):              *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Divide_Prepared_With_Scratch (polynomial_multiplication.h):      *
+ *          Computes the quotient and remainder with the allocated scratch.   *
+ *      Naive_Divide (polynomial_multiplication.h):                           *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_Divide_Prepared_With_Scratch.                                    *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  The precomputed data for divisions by B.                                  */
+struct Poly_Divisor_Def {
+
+    /*  A copy of B.                                                          */
+    int *B_coeffs;
+    size_t B_len;
+
+    /*  The length of the quotients the plan is for, 1/rev(B) mod x^Q_len,    *
+     *  and plans for products against it and against B. These are NULL if    *
+     *  long division is used for quotients of this length.                   */
+    size_t Q_len;
+    int *inverse;
+    Poly_Plan *inverse_plan;
+    Poly_Plan *B_plan;
+};
+
+/*  Function for building a plan for divisions by B.                          */
+Poly_Divisor *
+Poly_Divisor_Prepare(const int *B_coeffs, size_t B_len, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Divisor *plan;
+    int *B_rev;
+    size_t n, r;
+    int status;
+
+    /*  Only leading coefficients 1 and -1 are invertible over the integers.  */
+    if (B_len == (size_t)0)
+        return NULL;
+
+    if (B_coeffs[B_len - (size_t)1] != 1 && B_coeffs[B_len - (size_t)1] != -1)
+        return NULL;
+
+    plan = malloc(sizeof(*plan));
+
+    if (!plan)
+        return NULL;
+
+    plan->B_len = B_len;
+    plan->Q_len = (size_t)0;
+    plan->inverse = NULL;
+    plan->inverse_plan = NULL;
+    plan->B_plan = NULL;
+    plan->B_coeffs = malloc(sizeof(*plan->B_coeffs) * B_len);
+
+    if (!plan->B_coeffs)
+    {
+        free(plan);
+        return NULL;
+    }
+
+    for (n = (size_t)0; n < B_len; ++n)
+        plan->B_coeffs[n] = B_coeffs[n];
+
+    /*  Long division needs no tables.                                        */
+    if (Poly_Divide_Scratch_Size(A_len, B_len) == (size_t)0)
+        return plan;
+
+    plan->Q_len = A_len - B_len + (size_t)1;
+    r = (B_len < plan->Q_len ? B_len : plan->Q_len);
+
+    plan->inverse = malloc(sizeof(*plan->inverse) * plan->Q_len);
+    B_rev = malloc(sizeof(*B_rev) * r);
+
+    if (!plan->inverse || !B_rev)
+    {
+        free(B_rev);
+        Poly_Divisor_Destroy(plan);
+        return NULL;
+    }
+
+    for (n = (size_t)0; n < r; ++n)
+        B_rev[n] = B_coeffs[B_len - (size_t)1 - n];
+
+    status = Poly_Series_Inverse(plan->inverse, B_rev, r, plan->Q_len);
+    free(B_rev);
+
+    /*  Below the NTT range, short products skip the top of the product,      *
+     *  which is thrown away. The NTT saves little by doing so.               */
+    if (Poly_Select_Algorithm(plan->Q_len, plan->Q_len) == POLY_ALGORITHM_NTT)
+    {
+        plan->inverse_plan = Poly_Prepare(
+            plan->inverse, plan->Q_len, plan->Q_len
+        );
+
+        if (!plan->inverse_plan)
+            status = -1;
+    }
+
+    plan->B_plan = Poly_Prepare(B_coeffs, B_len, plan->Q_len);
+
+    if (status != 0 || !plan->B_plan)
+    {
+        Poly_Divisor_Destroy(plan);
+        return NULL;
+    }
+
+    return plan;
+}
+/*  End of Poly_Divisor_Prepare.                                              */
+
+/*  Function for freeing a plan for divisions.                                */
+void Poly_Divisor_Destroy(Poly_Divisor *plan)
+{
+    if (!plan)
+        return;
+
+    Poly_Plan_Destroy(plan->inverse_plan);
+    Poly_Plan_Destroy(plan->B_plan);
+    free(plan->inverse);
+    free(plan->B_coeffs);
+    free(plan);
+}
+/*  End of Poly_Divisor_Destroy.                                              */
+
+/*  Function for computing the scratch space used by prepared divisions.      */
+size_t Poly_Divisor_Scratch_Size(const Poly_Divisor *plan, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t q, size, most;
+
+    /*  The scratch for an unprepared division, zero for long division.       */
+    const size_t plain = Poly_Divide_Scratch_Size(A_len, plan->B_len);
+
+    if (plain == (size_t)0)
+        return (size_t)0;
+
+    q = A_len - plan->B_len + (size_t)1;
+
+    if (!plan->inverse || q > plan->Q_len)
+        return plain;
+
+    /*  The product with the inverse, and then with B, after rev(A).          */
+    if (plan->inverse_plan)
+        most = q + plan->Q_len - (size_t)1 +
+               Poly_Plan_Scratch_Size(plan->inverse_plan, q);
+    else
+        most = q + Poly_Short_Scratch_Size(q, q, q);
+
+    size = q + plan->B_len - (size_t)1 +
+           Poly_Plan_Scratch_Size(plan->B_plan, q);
+
+    if (size > most)
+        most = size;
+
+    return q + most;
+}
+/*  End of Poly_Divisor_Scratch_Size.                                         */
+
+/*  Function for computing A = Q*B + R with a plan and caller scratch.        */
+void
+Poly_Divide_Prepared_With_Scratch(const Poly_Divisor *plan,
+                                  int *Q_coeffs, int *R_coeffs,
+                                  const int *A_coeffs, size_t A_len,
+                                  int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, q;
+    int *A_rev, *T_coeffs, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t one = (size_t)1;
+    const size_t B_len = plan->B_len;
+
+    /*  Short quotients and short divisors use long division.                 */
+    if (Poly_Divide_Scratch_Size(A_len, B_len) == (size_t)0)
+    {
+        Naive_Divide(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, plan->B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    q = A_len - B_len + one;
+
+    /*  Dividends longer than planned for are divided from scratch.           */
+    if (!plan->inverse || q > plan->Q_len)
+    {
+        Poly_Divide_With_Scratch(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, plan->B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    A_rev = work;
+    T_coeffs = A_rev + q;
+
+    /*  rev(Q) = rev(A) / rev(B) mod x^q, read backwards into Q.              */
+    for (n = (size_t)0; n < q; ++n)
+        A_rev[n] = A_coeffs[A_len - one - n];
+
+    if (plan->inverse_plan)
+    {
+        rest = T_coeffs + (q + plan->Q_len - one);
+
+        Poly_Multiply_Prepared_With_Scratch(
+            plan->inverse_plan, T_coeffs, A_rev, q, rest
+        );
+    }
+    else
+        Poly_Short_Product_With_Scratch(
+            T_coeffs, A_rev, q, plan->inverse, q, q, T_coeffs + q
+        );
+
+    for (n = (size_t)0; n < q; ++n)
+        Q_coeffs[n] = T_coeffs[q - one - n];
+
+    /*  R = A - Q*B, of which only the bottom B_len - 1 terms are nonzero.    */
+    rest = T_coeffs + (q + B_len - one);
+
+    Poly_Multiply_Prepared_With_Scratch(
+        plan->B_plan, T_coeffs, Q_coeffs, q, rest
+    );
+
+    for (n = (size_t)0; n < B_len - one; ++n)
+        R_coeffs[n] = A_coeffs[n] - T_coeffs[n];
+}
+/*  End of Poly_Divide_Prepared_With_Scratch.                                 */
+
+/*  Function for computing A = Q*B + R with a plan.                           */
+void
+Poly_Divide_Prepared(const Poly_Divisor *plan,
+                     int *Q_coeffs, int *R_coeffs,
+                     const int *A_coeffs, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *work;
+
+    /*  The amount of scratch space needed for this division.                 */
+    const size_t size = Poly_Divisor_Scratch_Size(plan, A_len);
+
+    if (size == (size_t)0)
+    {
+        Poly_Divide_Prepared_With_Scratch(
+            plan, Q_coeffs, R_coeffs, A_coeffs, A_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to long division.                          */
+    if (!work)
+    {
+        Naive_Divide(
+            Q_coeffs, R_coeffs, A_coeffs, A_len, plan->B_coeffs, plan->B_len
+        );
+
+        return;
+    }
+
+    Poly_Divide_Prepared_With_Scratch(
+        plan, Q_coeffs, R_coeffs, A_coeffs, A_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Divide_Prepared.                                              */
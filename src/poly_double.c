@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplication of polynomials with double precision coefficients.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Double                                                   *
+ *      Naive_Product_Double                                                  *
+ *      Naive_AddTo_Product_Double                                            *
+ *      Naive_AddTo_Sum_Product_Double                                        *
+ *      Scaled_AddTo_Double                                                   *
+ *      Karatsuba_Scratch_Size_Double                                         *
+ *      Karatsuba_Product_With_Scratch_Double                                 *
+ *      Karatsuba_Product_Double                                              *
+ *      Poly_Multiply_Double                                                  *
+ *  Purpose:                                                                  *
+ *      As the int functions of the same names, for double coefficients.      *
+ *  Method:                                                                   *
+ *      Instantiate poly_template.h with POLY_TYPE set to double.             *
+ *  Notes:                                                                    *
+ *      The naive method is used at or below the karatsuba_cutoff_double      *
+ *      tunable. Above it, the rounding error of Karatsuba grows slowly with  *
+ *      the depth of the recursion.                                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) poly_template.h:                                                      *
+ *          The code shared by all coefficient types.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The coefficient type, and the names of the functions for it.              */
+#define POLY_TYPE double
+#define POLY_SUFFIX Double
+#define POLY_CUTOFF karatsuba_cutoff_double
+
+/*  The functions are defined here.                                           */
+#include "poly_template.h"
@@ -0,0 +1,704 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Polynomials stored in memory mapped files, so that they can be        *
+ *      multiplied without being read into, or written out of, buffers.       *
+ ******************************************************************************
+ *                                FILE FORMAT                                 *
+ ******************************************************************************
+ *  A file is a 64 byte header followed, at the data offset, by the           *
+ *  coefficients in increasing order of degree, packed and little endian. The *
+ *  integers of the header are unsigned and little endian.                    *
+ *                                                                            *
+ *      Bytes  0 -  7:  The magic number, the characters "POLYFILE".          *
+ *      Bytes  8 - 11:  The version of the format, 1.                         *
+ *      Bytes 12 - 15:  The coefficient type, a Poly_File_Type.               *
+ *      Bytes 16 - 19:  The size of one coefficient, in bytes.                *
+ *      Bytes 20 - 23:  The alignment of the coefficients, in bytes.          *
+ *      Bytes 24 - 31:  The number of coefficients.                           *
+ *      Bytes 32 - 39:  The data offset, from the start of the file.          *
+ *      Bytes 40 - 63:  Reserved, zero.                                       *
+ *                                                                            *
+ *  The alignment is a power of two, and the data offset a multiple of it,    *
+ *  at least 64. Files written here use POLY_FILE_ALIGNMENT for both.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_File_Open                                                        *
+ *  Purpose:                                                                  *
+ *      Maps a polynomial file for reading.                                   *
+ *  Arguments:                                                                *
+ *      path (const char *):                                                  *
+ *          The name of the file.                                             *
+ *  Output:                                                                   *
+ *      file (Poly_File *):                                                   *
+ *          The mapped file, or NULL on failure.                              *
+ *  Called Functions:                                                         *
+ *      open, close, fstat, mmap, munmap (POSIX):                             *
+ *          Used to map the file.                                             *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the handle.                                              *
+ *  Method:                                                                   *
+ *      Map the whole file read only and check the header: the magic number,  *
+ *      version, type and size, that the alignment is a power of two and the  *
+ *      offset a multiple of it, and that the coefficients fit in the file.   *
+ *      The map starts on a page, so the coefficients are aligned if the      *
+ *      alignment is at most the page size, which is also required.           *
+ *  Notes:                                                                    *
+ *      NULL is returned for a malformed file, for a coefficient size that    *
+ *      does not match the C type on this machine, for big endian machines,   *
+ *      and where memory mapped files are not supported.                      *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_File_Create                                                      *
+ *  Purpose:                                                                  *
+ *      Creates a polynomial file, mapped for writing.                        *
+ *  Arguments:                                                                *
+ *      path (const char *):                                                  *
+ *          The name of the file. An existing file is replaced.               *
+ *      type (Poly_File_Type):                                                *
+ *          The coefficient type.                                             *
+ *      len (size_t):                                                         *
+ *          The number of coefficients.                                       *
+ *  Output:                                                                   *
+ *      file (Poly_File *):                                                   *
+ *          The mapped file, or NULL on failure, with errno set.              *
+ *  Called Functions:                                                         *
+ *      open, close, posix_fallocate, ftruncate, fstat, mmap (POSIX):         *
+ *          Used to create and map the file.                                  *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the handle.                                              *
+ *  Method:                                                                   *
+ *      Allocate the file for the header and len coefficients with            *
+ *      posix_fallocate, so that running out of space is an error here, and   *
+ *      not a SIGBUS when the coefficients are written. Where the file system *
+ *      does not support it, size the file with ftruncate instead. Then map   *
+ *      it shared and writable, and fill in the header. The coefficients      *
+ *      start as zeros.                                                       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_File_Close                                                       *
+ *  Purpose:                                                                  *
+ *      Unmaps a polynomial file.                                             *
+ *  Arguments:                                                                *
+ *      file (Poly_File *):                                                   *
+ *          The file. NULL is ignored.                                        *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, and -1 if the coefficients could not be written to  *
+ *          the file or the map could not be removed.                         *
+ *  Called Functions:                                                         *
+ *      msync, munmap (POSIX):                                                *
+ *          Write the coefficients to the file and remove the map.            *
+ *      free (stdlib.h):                                                      *
+ *          Frees the handle.                                                 *
+ *  Method:                                                                   *
+ *      For a file from Poly_File_Create, write the map to the file with      *
+ *      msync and MS_SYNC, so that a failed write is reported. Then unmap the *
+ *      file and free the handle.                                             *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_File_Coeffs, Poly_File_Data, Poly_File_Length,                   *
+ *      Poly_File_Get_Type                                                    *
+ *  Purpose:                                                                  *
+ *      Return the coefficients, the writable coefficients, the number of     *
+ *      coefficients, and the type of a mapped file.                          *
+ *  Arguments:                                                                *
+ *      file (Poly_File *):                                                   *
+ *          The file.                                                         *
+ *  Output:                                                                   *
+ *      The requested field. Poly_File_Data returns NULL for files opened by  *
+ *      Poly_File_Open.                                                       *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Read the field from the handle.                                       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_File_Multiply                                                    *
+ *  Purpose:                                                                  *
+ *      Multiplies the polynomials in two files, writing the product to a     *
+ *      third.                                                                *
+ *  Arguments:                                                                *
+ *      P_path (const char *):                                                *
+ *          The name of the file for the product. It is replaced.             *
+ *      A_path (const char *):                                                *
+ *          The name of the file holding A.                                   *
+ *      B_path (const char *):                                                *
+ *          The name of the file holding B.                                   *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, and -1 on failure.                                  *
+ *  Called Functions:                                                         *
+ *      Poly_File_Open, Poly_File_Create, Poly_File_Close:                    *
+ *          Map the three files.                                              *
+ *      Poly_Multiply, Poly_Multiply_Int16, Poly_Multiply_Int64,              *
+ *      Poly_Multiply_Float, Poly_Multiply_Double                             *
+ *      (polynomial_multiplication.h):                                        *
+ *          Compute the product for the type of the files.                    *
+ *      stat (POSIX):                                                         *
+ *          Tells whether P_path names the file of A or of B.                 *
+ *      remove (stdio.h):                                                     *
+ *          Deletes the product file if the product fails.                    *
+ *  Method:                                                                   *
+ *      Map A and B, create P of the same type and of length                  *
+ *      A_len + B_len - 1, and multiply straight from the maps of A and B     *
+ *      into the map of P.                                                    *
+ *  Notes:                                                                    *
+ *      A and B must have the same type. If either is empty, so is P. It is   *
+ *      an error for P_path to name the file of A or of B, by any path or     *
+ *      link, found by comparing the device and inode numbers, as creating P  *
+ *      would truncate it while it is mapped.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ *  4.) stdio.h:                                                              *
+ *          Header file providing remove.                                     *
+ *  5.) errno.h:                                                              *
+ *          Header file providing errno.                                      *
+ *  6.) fcntl.h, sys/mman.h, sys/stat.h, unistd.h:                            *
+ *          POSIX header files providing open, posix_fallocate, mmap, msync,  *
+ *          stat, fstat, and ftruncate.                                       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  ftruncate, posix_fallocate, and sysconf are only declared for POSIX       *
+ *  sources.                                                                  */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  remove provided here.                                                     */
+#include <stdio.h>
+
+/*  errno and its values provided here.                                       */
+#include <errno.h>
+
+#ifdef POLY_HAS_MMAP
+
+/*  open, its flags, and posix_fallocate provided here.                       */
+#include <fcntl.h>
+
+/*  mmap, msync, and munmap provided here.                                    */
+#include <sys/mman.h>
+
+/*  stat and fstat provided here.                                             */
+#include <sys/stat.h>
+
+/*  close, ftruncate, and sysconf provided here.                              */
+#include <unistd.h>
+
+#endif
+/*  End of #ifdef POLY_HAS_MMAP.                                              */
+
+/*  Size of the header, and the version of the format written here.           */
+#define POLY_FILE_HEADER_SIZE 64
+#define POLY_FILE_VERSION 1
+
+/*  A mapped polynomial file.                                                 */
+struct Poly_File_Def {
+
+    /*  The map, covering the whole file, and its length in bytes.            */
+    unsigned char *map;
+    size_t map_len;
+
+    /*  The coefficients, inside the map, and the number of them.             */
+    unsigned char *coeffs;
+    size_t len;
+
+    /*  The coefficient type, and whether the map may be written.             */
+    Poly_File_Type type;
+    int writable;
+
+#ifdef POLY_HAS_MMAP
+    /*  The device and inode of the file, which identify it.                  */
+    dev_t dev;
+    ino_t ino;
+#endif
+};
+
+#ifdef POLY_HAS_MMAP
+
+/*  The size of a coefficient of the given type, or zero if it is not known.  */
+static size_t poly_file_type_size(unsigned long type)
+{
+    switch (type)
+    {
+        case POLY_FILE_INT16:
+            return sizeof(short);
+
+        case POLY_FILE_INT32:
+            return sizeof(int);
+
+        case POLY_FILE_INT64:
+            return sizeof(long long);
+
+        case POLY_FILE_FLOAT:
+            return sizeof(float);
+
+        case POLY_FILE_DOUBLE:
+            return sizeof(double);
+
+        default:
+            return (size_t)0;
+    }
+}
+/*  End of poly_file_type_size.                                               */
+
+/*  The magic number at the start of every file.                              */
+static const char poly_file_magic[8] = {'P', 'O', 'L', 'Y', 'F', 'I', 'L', 'E'};
+
+/*  Returns 1 if this machine is little endian, and 0 otherwise.              */
+static int poly_file_is_little_endian(void)
+{
+    const unsigned int one = 1U;
+    return *(const unsigned char *)&one == 1U;
+}
+/*  End of poly_file_is_little_endian.                                        */
+
+/*  Writes value to bytes little endian bytes starting at ptr.                */
+static void
+poly_file_put(unsigned char *ptr, size_t value, unsigned int bytes)
+{
+    unsigned int n;
+
+    for (n = 0U; n < bytes; ++n)
+    {
+        ptr[n] = (unsigned char)(value & 0xFFU);
+
+        /*  Shift in two steps, a shift by the full width of size_t is        *
+         *  undefined.                                                        */
+        value >>= 4;
+        value >>= 4;
+    }
+}
+/*  End of poly_file_put.                                                     */
+
+/*  Reads bytes little endian bytes starting at ptr. Returns -1 if the value  *
+ *  does not fit in a size_t, and 0 otherwise.                                */
+static int
+poly_file_get(const unsigned char *ptr, unsigned int bytes, size_t *value)
+{
+    const size_t max = (size_t)-1;
+    unsigned int n = bytes;
+
+    *value = (size_t)0;
+
+    while (n > 0U)
+    {
+        --n;
+
+        if (*value > (max >> 8))
+            return -1;
+
+        *value = (*value << 8) | (size_t)ptr[n];
+    }
+
+    return 0;
+}
+/*  End of poly_file_get.                                                     */
+
+/*  Sets the fields of a handle from the header of its map. Returns -1 if the *
+ *  header is malformed or does not fit this machine, and 0 otherwise.        */
+static int poly_file_parse(Poly_File *file)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, version, type, size, align, len, offset;
+    const unsigned char * const header = file->map;
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+    if (file->map_len < (size_t)POLY_FILE_HEADER_SIZE)
+        return -1;
+
+    for (n = (size_t)0; n < sizeof(poly_file_magic); ++n)
+        if (header[n] != (unsigned char)poly_file_magic[n])
+            return -1;
+
+    if (poly_file_get(header + 8, 4U, &version) != 0 ||
+        poly_file_get(header + 12, 4U, &type) != 0 ||
+        poly_file_get(header + 16, 4U, &size) != 0 ||
+        poly_file_get(header + 20, 4U, &align) != 0 ||
+        poly_file_get(header + 24, 8U, &len) != 0 ||
+        poly_file_get(header + 32, 8U, &offset) != 0)
+        return -1;
+
+    if (version != (size_t)POLY_FILE_VERSION)
+        return -1;
+
+    /*  The coefficients are used in place, so they must be the C type.       */
+    if (size == (size_t)0 || size != poly_file_type_size((unsigned long)type))
+        return -1;
+
+    /*  The map is page aligned, so offset aligns the coefficients.           */
+    if (align == (size_t)0 || (align & (align - (size_t)1)) != (size_t)0)
+        return -1;
+
+    if (align > page || offset % align != (size_t)0)
+        return -1;
+
+    if (offset < (size_t)POLY_FILE_HEADER_SIZE || offset > file->map_len)
+        return -1;
+
+    if (len > (file->map_len - offset) / size)
+        return -1;
+
+    file->coeffs = file->map + offset;
+    file->len = len;
+    file->type = (Poly_File_Type)type;
+    return 0;
+}
+/*  End of poly_file_parse.                                                   */
+
+/*  Returns 1 if path names the file mapped by file, and 0 otherwise or if    *
+ *  there is no file at path.                                                 */
+static int poly_file_is(const char *path, const Poly_File *file)
+{
+    struct stat info;
+
+    if (stat(path, &info) != 0)
+        return 0;
+
+    return (info.st_dev == file->dev && info.st_ino == file->ino);
+}
+/*  End of poly_file_is.                                                      */
+
+#endif
+/*  End of #ifdef POLY_HAS_MMAP.                                              */
+
+/*  Function for mapping a polynomial file for reading.                       */
+Poly_File *Poly_File_Open(const char *path)
+{
+#ifdef POLY_HAS_MMAP
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_File *file;
+    struct stat info;
+    void *map;
+    int fd;
+
+    /*  The coefficients are little endian and used in place.                 */
+    if (!poly_file_is_little_endian())
+        return NULL;
+
+    fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &info) != 0 ||
+        info.st_size < (off_t)POLY_FILE_HEADER_SIZE ||
+        (off_t)(size_t)info.st_size != info.st_size)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    map = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    /*  The map keeps the file open, so the descriptor is no longer needed.   */
+    close(fd);
+
+    if (map == MAP_FAILED)
+        return NULL;
+
+    file = malloc(sizeof(*file));
+
+    if (!file)
+    {
+        munmap(map, (size_t)info.st_size);
+        return NULL;
+    }
+
+    file->map = map;
+    file->map_len = (size_t)info.st_size;
+    file->writable = 0;
+    file->dev = info.st_dev;
+    file->ino = info.st_ino;
+
+    if (poly_file_parse(file) != 0)
+    {
+        Poly_File_Close(file);
+        return NULL;
+    }
+
+    return file;
+#else
+    (void)path;
+    return NULL;
+#endif
+}
+/*  End of Poly_File_Open.                                                    */
+
+/*  Function for creating a polynomial file, mapped for writing.              */
+Poly_File *Poly_File_Create(const char *path, Poly_File_Type type, size_t len)
+{
+#ifdef POLY_HAS_MMAP
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_File *file;
+    struct stat info;
+    void *map;
+    size_t map_len, n;
+    int fd, error;
+
+    /*  The size of one coefficient, zero for an unknown type.                */
+    const size_t size = poly_file_type_size((unsigned long)type);
+    const size_t offset = (size_t)POLY_FILE_ALIGNMENT;
+
+    if (size == (size_t)0 || !poly_file_is_little_endian())
+        return NULL;
+
+    if (len > ((size_t)-1 - offset) / size)
+        return NULL;
+
+    map_len = offset + len*size;
+
+    /*  The length must survive the conversion to off_t.                      */
+    if ((size_t)(off_t)map_len != map_len || (off_t)map_len < (off_t)0)
+        return NULL;
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+
+    if (fd < 0)
+        return NULL;
+
+    /*  Allocate the blocks now, so that a full disk fails here and not with  *
+     *  SIGBUS when the map is written. File systems that can not do this get *
+     *  a sparse file from ftruncate.                                         */
+    error = posix_fallocate(fd, (off_t)0, (off_t)map_len);
+
+    if (error == EINVAL || error == EOPNOTSUPP)
+        error = (ftruncate(fd, (off_t)map_len) != 0 ? errno : 0);
+
+    if (error == 0 && fstat(fd, &info) != 0)
+        error = errno;
+
+    if (error != 0)
+    {
+        close(fd);
+        errno = error;
+        return NULL;
+    }
+
+    map = mmap(NULL, map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    error = errno;
+    close(fd);
+
+    if (map == MAP_FAILED)
+    {
+        errno = error;
+        return NULL;
+    }
+
+    file = malloc(sizeof(*file));
+
+    if (!file)
+    {
+        munmap(map, map_len);
+        return NULL;
+    }
+
+    file->map = map;
+    file->map_len = map_len;
+    file->coeffs = file->map + offset;
+    file->len = len;
+    file->type = type;
+    file->writable = 1;
+    file->dev = info.st_dev;
+    file->ino = info.st_ino;
+
+    /*  The new file reads as zeros, so only the set fields remain.           */
+    for (n = (size_t)0; n < sizeof(poly_file_magic); ++n)
+        file->map[n] = (unsigned char)poly_file_magic[n];
+
+    poly_file_put(file->map + 8, (size_t)POLY_FILE_VERSION, 4U);
+    poly_file_put(file->map + 12, (size_t)type, 4U);
+    poly_file_put(file->map + 16, size, 4U);
+    poly_file_put(file->map + 20, (size_t)POLY_FILE_ALIGNMENT, 4U);
+    poly_file_put(file->map + 24, len, 8U);
+    poly_file_put(file->map + 32, offset, 8U);
+    return file;
+#else
+    (void)path;
+    (void)type;
+    (void)len;
+    return NULL;
+#endif
+}
+/*  End of Poly_File_Create.                                                  */
+
+/*  Function for unmapping a polynomial file.                                 */
+int Poly_File_Close(Poly_File *file)
+{
+    int status = 0;
+
+    if (!file)
+        return status;
+
+#ifdef POLY_HAS_MMAP
+    /*  Write the coefficients out before unmapping, so that an error in      *
+     *  doing so is returned rather than lost.                                */
+    if (file->writable && msync(file->map, file->map_len, MS_SYNC) != 0)
+        status = -1;
+
+    if (munmap(file->map, file->map_len) != 0)
+        status = -1;
+#endif
+
+    free(file);
+    return status;
+}
+/*  End of Poly_File_Close.                                                   */
+
+/*  Function for the coefficients of a mapped file.                           */
+const void *Poly_File_Coeffs(const Poly_File *file)
+{
+    return file->coeffs;
+}
+/*  End of Poly_File_Coeffs.                                                  */
+
+/*  Function for the writable coefficients of a mapped file.                  */
+void *Poly_File_Data(Poly_File *file)
+{
+    return file->writable ? file->coeffs : NULL;
+}
+/*  End of Poly_File_Data.                                                    */
+
+/*  Function for the number of coefficients of a mapped file.                 */
+size_t Poly_File_Length(const Poly_File *file)
+{
+    return file->len;
+}
+/*  End of Poly_File_Length.                                                  */
+
+/*  Function for the coefficient type of a mapped file.                       */
+Poly_File_Type Poly_File_Get_Type(const Poly_File *file)
+{
+    return file->type;
+}
+/*  End of Poly_File_Get_Type.                                                */
+
+/*  Function for multiplying the polynomials in two files.                    */
+int
+Poly_File_Multiply(const char *P_path, const char *A_path, const char *B_path)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_File *A, *B, *P;
+    size_t A_len, B_len, P_len;
+    Poly_File_Type type;
+    int status = 0;
+    void *out;
+    const void *a, *b;
+
+    A = Poly_File_Open(A_path);
+    B = Poly_File_Open(B_path);
+
+    if (!A || !B || A->type != B->type)
+    {
+        Poly_File_Close(A);
+        Poly_File_Close(B);
+        return -1;
+    }
+
+#ifdef POLY_HAS_MMAP
+    /*  Creating P truncates it, which would empty A or B under their maps.   */
+    if (poly_file_is(P_path, A) || poly_file_is(P_path, B))
+    {
+        Poly_File_Close(A);
+        Poly_File_Close(B);
+        return -1;
+    }
+#endif
+
+    A_len = A->len;
+    B_len = B->len;
+    type = A->type;
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        P_len = (size_t)0;
+
+    else
+        P_len = A_len + B_len - (size_t)1;
+
+    P = Poly_File_Create(P_path, type, P_len);
+
+    if (!P)
+    {
+        Poly_File_Close(A);
+        Poly_File_Close(B);
+        return -1;
+    }
+
+    a = A->coeffs;
+    b = B->coeffs;
+    out = P->coeffs;
+
+    switch (type)
+    {
+        case POLY_FILE_INT16:
+            Poly_Multiply_Int16(out, a, A_len, b, B_len);
+            break;
+
+        case POLY_FILE_INT32:
+            Poly_Multiply(out, a, A_len, b, B_len);
+            break;
+
+        case POLY_FILE_INT64:
+            Poly_Multiply_Int64(out, a, A_len, b, B_len);
+            break;
+
+        case POLY_FILE_FLOAT:
+            Poly_Multiply_Float(out, a, A_len, b, B_len);
+            break;
+
+        case POLY_FILE_DOUBLE:
+            Poly_Multiply_Double(out, a, A_len, b, B_len);
+            break;
+    }
+
+    if (Poly_File_Close(P) != 0)
+        status = -1;
+
+    Poly_File_Close(A);
+    Poly_File_Close(B);
+
+    if (status != 0)
+        remove(P_path);
+
+    return status;
+}
+/*  End of Poly_File_Multiply.                                                */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplication of polynomials with 16-bit integer coefficients.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Int16                                                    *
+ *      Naive_Product_Int16                                                   *
+ *      Naive_AddTo_Product_Int16                                             *
+ *      Naive_AddTo_Sum_Product_Int16                                         *
+ *      Scaled_AddTo_Int16                                                    *
+ *      Karatsuba_Scratch_Size_Int16                                          *
+ *      Karatsuba_Product_With_Scratch_Int16                                  *
+ *      Karatsuba_Product_Int16                                               *
+ *      Poly_Multiply_Int16                                                   *
+ *  Purpose:                                                                  *
+ *      As the int functions of the same names, for short coefficients.       *
+ *  Method:                                                                   *
+ *      Instantiate poly_template.h with POLY_TYPE set to short.              *
+ *  Notes:                                                                    *
+ *      The products are computed modulo 2^16. The naive method is used at or *
+ *      below the karatsuba_cutoff_int16 tunable.                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Header file providing SHRT_MAX.                                   *
+ *  2.) poly_template.h:                                                      *
+ *          The code shared by all coefficient types.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  SHRT_MAX provided here.                                                   */
+#include <limits.h>
+
+/*  The vector kernels assume short is 16 bits wide.                          */
+#if SHRT_MAX != 32767
+#error "poly_int16.c requires a 16-bit short."
+#endif
+
+/*  The coefficient type, and the names of the functions for it.              */
+#define POLY_TYPE short
+#define POLY_SUFFIX Int16
+#define POLY_CUTOFF karatsuba_cutoff_int16
+
+/*  The arithmetic is unsigned, so that it wraps around. short is promoted to *
+ *  int, so the products are computed in unsigned int.                        */
+#define POLY_ARITH unsigned int
+#define POLY_LANE unsigned short
+
+/*  With 32 lanes, the AVX-512 kernel leaves up to 31 outputs per band to the *
+ *  scalar loop. It is slower than AVX2 at the lengths the naive method is    *
+ *  used for.                                                                 */
+#define POLY_NO_AVX512
+
+/*  The functions are defined here.                                           */
+#include "poly_template.h"
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplication of polynomials with 64-bit integer coefficients.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Int64                                                    *
+ *      Naive_Product_Int64                                                   *
+ *      Naive_AddTo_Product_Int64                                             *
+ *      Naive_AddTo_Sum_Product_Int64                                         *
+ *      Scaled_AddTo_Int64                                                    *
+ *      Karatsuba_Scratch_Size_Int64                                          *
+ *      Karatsuba_Product_With_Scratch_Int64                                  *
+ *      Karatsuba_Product_Int64                                               *
+ *      Poly_Multiply_Int64                                                   *
+ *  Purpose:                                                                  *
+ *      As the int functions of the same names, for long long coefficients.   *
+ *  Method:                                                                   *
+ *      Instantiate poly_template.h with POLY_TYPE set to long long.          *
+ *  Notes:                                                                    *
+ *      long long is C99, but is available as an extension on every C89       *
+ *      compiler we support. The products are computed modulo 2^64. The naive *
+ *      method is used at or below the karatsuba_cutoff_int64 tunable.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) poly_template.h:                                                      *
+ *          The code shared by all coefficient types.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The coefficient type, and the names of the functions for it.              */
+#define POLY_TYPE long long
+#define POLY_SUFFIX Int64
+#define POLY_CUTOFF karatsuba_cutoff_int64
+
+/*  The arithmetic is unsigned, so that it wraps around.                      */
+#define POLY_ARITH unsigned long long
+
+/*  AVX-512 multiplies 64-bit lanes with vpmullq, which is slow enough that   *
+ *  the kernel is no faster than scalar code. AVX2 is slightly faster.        */
+#define POLY_NO_AVX512
+
+/*  The functions are defined here.                                           */
+#include "poly_template.h"
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Chooses the SIMD kernels for the CPU before any threads are started,  *
+ *      and caps them at a given instruction set for testing.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Kernel_Init                                                      *
+ *  Purpose:                                                                  *
+ *      Sets the kernel pointer of every dispatching row kernel.              *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Naive_Kernel_Init (polynomial_multiplication.h):                      *
+ *      Naive_Batch_Kernel_Init (polynomial_multiplication.h):                *
+ *      Naive_Kernel_Wide_Init (polynomial_multiplication.h):                 *
+ *      Naive_Kernel_Init_Int16, _Int64, _Float, _Double:                     *
+ *          Check the CPU and store the kernel each dispatches to.            *
+ *  Method:                                                                   *
+ *      Each row kernel is called through a pointer that is set on its first  *
+ *      call. The store is not synchronized, so first calls made on several   *
+ *      threads at once race on it. Setting every pointer here, on one        *
+ *      thread, means the threads started afterwards only ever read them.     *
+ *  Notes:                                                                    *
+ *      Poly_Pool_Create calls this. Calling it again is harmless, provided   *
+ *      no other thread is computing products at the time.                    *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Set_Kernel_Level                                                 *
+ *  Purpose:                                                                  *
+ *      Caps the kernels at an instruction set, and chooses them again.       *
+ *  Arguments:                                                                *
+ *      level (Poly_Kernel_Level):                                            *
+ *          The highest level of kernel to use, or POLY_KERNEL_BEST.          *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if the CPU or the build lacks the level.         *
+ *  Called Functions:                                                         *
+ *      __builtin_cpu_supports (GCC built-in):                                *
+ *          Checks for AVX2 and AVX-512F on x86 CPUs.                         *
+ *      Poly_Kernel_Init (polynomial_multiplication.h):                       *
+ *          Chooses the kernels within the new cap.                           *
+ *  Method:                                                                   *
+ *      The cap is kept in a static variable that every kernel selector       *
+ *      reads through Poly_Kernel_Allows. Each selector still checks the CPU  *
+ *      for the instruction sets below the cap, so capping at AVX-512 on a    *
+ *      CPU with AVX-512F but not AVX-512BW gives the int16 routines AVX2,    *
+ *      as it would without the cap.                                          *
+ *  Notes:                                                                    *
+ *      This is for testing the slower kernels on a machine that has faster   *
+ *      ones, as poly_bench -check does. As with Poly_Kernel_Init, no other   *
+ *      thread may be computing products during the call.                     *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Kernel_Allows                                                    *
+ *  Purpose:                                                                  *
+ *      Tells the kernel selectors whether a level is within the cap.         *
+ *  Arguments:                                                                *
+ *      level (Poly_Kernel_Level):                                            *
+ *          The level of a kernel.                                            *
+ *  Output:                                                                   *
+ *      allowed (int):                                                        *
+ *          1 if the level is at or below the cap, and 0 otherwise.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  The highest level of kernel the selectors may choose.                     */
+static Poly_Kernel_Level poly_kernel_cap = POLY_KERNEL_BEST;
+
+/*  Function for choosing all of the kernels up front.                        */
+void Poly_Kernel_Init(void)
+{
+    Naive_Kernel_Init();
+    Naive_Batch_Kernel_Init();
+    Naive_Kernel_Wide_Init();
+
+    Naive_Kernel_Init_Int16();
+    Naive_Kernel_Init_Int64();
+    Naive_Kernel_Init_Float();
+    Naive_Kernel_Init_Double();
+}
+/*  End of Poly_Kernel_Init.                                                  */
+
+/*  Function for capping the kernels at an instruction set.                   */
+int Poly_Set_Kernel_Level(Poly_Kernel_Level level)
+{
+    switch (level)
+    {
+        case POLY_KERNEL_PORTABLE:
+        case POLY_KERNEL_BEST:
+            break;
+
+#if defined(POLY_HAS_X86_SIMD)
+        case POLY_KERNEL_AVX2:
+            __builtin_cpu_init();
+
+            if (!__builtin_cpu_supports("avx2"))
+                return -1;
+
+            break;
+
+        case POLY_KERNEL_AVX512:
+            __builtin_cpu_init();
+
+            if (!__builtin_cpu_supports("avx512f"))
+                return -1;
+
+            break;
+#elif defined(POLY_HAS_NEON)
+        case POLY_KERNEL_NEON:
+            break;
+#endif
+
+        default:
+            return -1;
+    }
+
+    poly_kernel_cap = level;
+    Poly_Kernel_Init();
+    return 0;
+}
+/*  End of Poly_Set_Kernel_Level.                                             */
+
+/*  Function for checking a level against the cap.                            */
+int Poly_Kernel_Allows(Poly_Kernel_Level level)
+{
+    return (level <= poly_kernel_cap);
+}
+/*  End of Poly_Kernel_Allows.                                                */
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Reads the crossover points between the algorithms from a file.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Load_Tunables                                                    *
+ *  Purpose:                                                                  *
+ *      Reads tunables from a configuration file and makes them current.      *
+ *  Arguments:                                                                *
+ *      filename (const char *):                                              *
+ *          The path to the configuration file.                               *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 on failure.                                      *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the starting values.                                     *
+ *      Poly_Set_Tunables (polynomial_multiplication.h):                      *
+ *          Validates and installs the new values.                            *
+ *      fopen, fgets, fclose (stdio.h):                                       *
+ *          Used for reading the file.                                        *
+ *      sscanf (stdio.h):                                                     *
+ *          Used for parsing each line.                                       *
+ *      strcmp (string.h):                                                    *
+ *          Used for matching the names of the tunables.                      *
+ *  Method:                                                                   *
+ *      The file consists of lines of the form                                *
+ *                                                                            *
+ *          karatsuba_cutoff = 32                                             *
+ *          ntt_cutoff = 3000                                                 *
+ *          unbalanced_ratio = 8                                              *
+ *          parallel_grain = 4096                                             *
+ *          wide_ntt_cutoff = 1000                                            *
+ *          karatsuba_cutoff_int16 = 64                                       *
+ *          karatsuba_cutoff_int64 = 32                                       *
+ *          karatsuba_cutoff_float = 64                                       *
+ *          karatsuba_cutoff_double = 64                                      *
+ *          mod_ntt_cutoff = 64                                               *
+ *          karatsuba_square_cutoff = 96                                      *
+ *                                                                            *
+ *      Blank lines and lines starting with '#' are ignored. Names that are   *
+ *      not given keep their current value.                                   *
+ *  Notes:                                                                    *
+ *      If the file can not be read, contains an unknown name or a malformed  *
+ *      line, or gives invalid values, nothing is changed.                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdio.h:                                                              *
+ *          Header file providing FILE, fopen, fgets, and sscanf.             *
+ *  4.) string.h:                                                             *
+ *          Header file providing strcmp.                                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  FILE, fopen, fgets, fclose, and sscanf found here.                        */
+#include <stdio.h>
+
+/*  strcmp found here.                                                        */
+#include <string.h>
+
+/*  Function for reading the tunables from a file.                            */
+int Poly_Load_Tunables(const char *filename)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    char line[256], name[64], tail[2];
+    unsigned long value;
+    Poly_Tunables tunables;
+    FILE *fp;
+    int status = 0;
+
+    if (!filename)
+        return -1;
+
+    fp = fopen(filename, "r");
+
+    if (!fp)
+        return -1;
+
+    /*  Names not present in the file keep their current value.               */
+    tunables = *Poly_Get_Tunables();
+
+    while (fgets(line, (int)sizeof(line), fp))
+    {
+        /*  Skip blank lines and comments.                                    */
+        if (sscanf(line, " %1s", tail) != 1 || tail[0] == '#')
+            continue;
+
+        if (sscanf(line, " %63[a-z0-9_] = %lu %1s", name, &value, tail) != 2)
+        {
+            status = -1;
+            break;
+        }
+
+        if (strcmp(name, "karatsuba_cutoff") == 0)
+            tunables.karatsuba_cutoff = (size_t)value;
+
+        else if (strcmp(name, "ntt_cutoff") == 0)
+            tunables.ntt_cutoff = (size_t)value;
+
+        else if (strcmp(name, "unbalanced_ratio") == 0)
+            tunables.unbalanced_ratio = (size_t)value;
+
+        else if (strcmp(name, "parallel_grain") == 0)
+            tunables.parallel_grain = (size_t)value;
+
+        else if (strcmp(name, "wide_ntt_cutoff") == 0)
+            tunables.wide_ntt_cutoff = (size_t)value;
+
+        else if (strcmp(name, "karatsuba_cutoff_int16") == 0)
+            tunables.karatsuba_cutoff_int16 = (size_t)value;
+
+        else if (strcmp(name, "karatsuba_cutoff_int64") == 0)
+            tunables.karatsuba_cutoff_int64 = (size_t)value;
+
+        else if (strcmp(name, "karatsuba_cutoff_float") == 0)
+            tunables.karatsuba_cutoff_float = (size_t)value;
+
+        else if (strcmp(name, "karatsuba_cutoff_double") == 0)
+            tunables.karatsuba_cutoff_double = (size_t)value;
+
+        else if (strcmp(name, "mod_ntt_cutoff") == 0)
+            tunables.mod_ntt_cutoff = (size_t)value;
+
+        else if (strcmp(name, "karatsuba_square_cutoff") == 0)
+            tunables.karatsuba_square_cutoff = (size_t)value;
+
+        else
+        {
+            status = -1;
+            break;
+        }
+    }
+
+    fclose(fp);
+
+    if (status != 0)
+        return status;
+
+    return Poly_Set_Tunables(&tunables);
+}
+/*  End of Poly_Load_Tunables.                                                */
@@ -0,0 +1,242 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Middle products, the coefficients of x^(B_len - 1) through            *
+ *      x^(A_len - 1) of A*B, with the fastest available algorithm.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Middle_Scratch_Size                                              *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Middle_Product_With_Scratch.                                     *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most A_len.                    *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Karatsuba_Middle_Scratch_Size (polynomial_multiplication.h):          *
+ *          Scratch space for the Karatsuba middle product.                   *
+ *      NTT_Scratch_Size_Middle (polynomial_multiplication.h):                *
+ *          Scratch space for the NTT middle product.                         *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Middle_Product_With_Scratch.          *
+ *  Notes:                                                                    *
+ *      Unlike Poly_Scratch_Size, the lengths are not interchangeable.        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Middle_Product_With_Scratch                                      *
+ *  Purpose:                                                                  *
+ *      Computes the middle product of A and B, choosing the algorithm from   *
+ *      the lengths, with caller supplied scratch space.                      *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most A_len.                    *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Middle_Scratch_Size(A_len, B_len)    *
+ *          wide.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Naive_Middle_Product (polynomial_multiplication.h):                   *
+ *          Used for short operands.                                          *
+ *      Karatsuba_Middle_Product_With_Scratch (polynomial_multiplication.h):  *
+ *          Used in the Karatsuba and Toom-3 ranges.                          *
+ *      NTT_Middle_Product_With_Scratch (polynomial_multiplication.h):        *
+ *          Used for long operands.                                           *
+ *  Method:                                                                   *
+ *      The middle product of A_len by B_len costs about as much as a         *
+ *      product of A_len - B_len + 1 by B_len, so the algorithm is selected   *
+ *      for those lengths. There is no transposed Toom-3, and the Karatsuba   *
+ *      middle product is used in its range instead. It is still faster than  *
+ *      forming the whole of A*B, which costs about twice as much.            *
+ *  Notes:                                                                    *
+ *      Requires 1 <= B_len <= A_len. The tunables must not change between    *
+ *      sizing the scratch array and calling this function.                   *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Middle_Product                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the middle product of A and B with the fastest available     *
+ *      algorithm.                                                            *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len - B_len + 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial, at most A_len.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Middle_Scratch_Size (polynomial_multiplication.h):               *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Middle_Product_With_Scratch (polynomial_multiplication.h):       *
+ *          Computes the product with the allocated scratch.                  *
+ *      Naive_Middle_Product (polynomial_multiplication.h):                   *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call Poly_Middle_Product_With_Scratch. *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Chooses the algorithm for a middle product of A_len by B_len.             */
+static Poly_Algorithm
+poly_middle_select(size_t A_len, size_t B_len)
+{
+    /*  The number of coefficients in the middle product.                     */
+    const size_t L = A_len - B_len + (size_t)1;
+
+    if (L <= B_len)
+        return Poly_Select_Algorithm(L, B_len);
+
+    return Poly_Select_Algorithm(B_len, L);
+}
+/*  End of poly_middle_select.                                                */
+
+/*  Function for computing the scratch space used by middle products.         */
+size_t Poly_Middle_Scratch_Size(size_t A_len, size_t B_len)
+{
+    switch (poly_middle_select(A_len, B_len))
+    {
+        case POLY_ALGORITHM_NAIVE:
+            return (size_t)0;
+
+        case POLY_ALGORITHM_NTT:
+            return NTT_Scratch_Size_Middle(A_len, B_len);
+
+        default:
+            return Karatsuba_Middle_Scratch_Size(A_len, B_len);
+    }
+}
+/*  End of Poly_Middle_Scratch_Size.                                          */
+
+/*  Function for computing the middle product with caller scratch.            */
+void
+Poly_Middle_Product_With_Scratch(int *P_coeffs,
+                                 const int *A_coeffs, size_t A_len,
+                                 const int *B_coeffs, size_t B_len,
+                                 int *work)
+{
+    switch (poly_middle_select(A_len, B_len))
+    {
+        case POLY_ALGORITHM_NAIVE:
+            Naive_Middle_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            NTT_Middle_Product_With_Scratch(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+            );
+
+            break;
+
+        /*  There is no transposed Toom-3, Karatsuba covers its range too.    */
+        default:
+            Karatsuba_Middle_Product_With_Scratch(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+            );
+
+            break;
+    }
+}
+/*  End of Poly_Middle_Product_With_Scratch.                                  */
+
+/*  Function for computing the middle product with the fastest method.        */
+void
+Poly_Middle_Product(int *P_coeffs,
+                    const int *A_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    const size_t size = Poly_Middle_Scratch_Size(A_len, B_len);
+    int *work;
+
+    /*  The naive method needs no scratch space.                              */
+    if (size == (size_t)0)
+    {
+        Naive_Middle_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Middle_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    Poly_Middle_Product_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Middle_Product.                                               */
@@ -0,0 +1,227 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Precomputes the constants for arithmetic modulo p.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Modulus_Init                                                     *
+ *  Purpose:                                                                  *
+ *      Fills in a Poly_Modulus for the odd modulus p, for use with the mod p *
+ *      routines and the mod p NTT.                                           *
+ *  Arguments:                                                                *
+ *      mod (Poly_Modulus *):                                                 *
+ *          The context to initialize.                                        *
+ *      p (unsigned int):                                                     *
+ *          The modulus. Must be odd, with 3 <= p <= POLY_MODULUS_MAX.        *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if p is not a supported modulus.                 *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The Montgomery constants are -p^-1 mod 2^32, found by Newton's        *
+ *      method, and 2^64 mod p. A sum of K products of residues is less than  *
+ *      K p^2, and Montgomery reduction needs its input below p 2^32, so up   *
+ *      to K = floor((2^32 - 1) / p) products may be summed before reducing.  *
+ *                                                                            *
+ *      If p is prime, which is decided with the Miller-Rabin test for the    *
+ *      bases 2, 7, and 61 (exact below 4759123141), p - 1 is factored by     *
+ *      trial division and the smallest primitive root g is found, the least  *
+ *      g with g^((p - 1)/f) != 1 for every prime factor f of p - 1. The      *
+ *      largest power of two dividing p - 1 bounds the length of the NTT.     *
+ *  Notes:                                                                    *
+ *      Composite moduli are allowed. The naive routines work for any odd p,  *
+ *      but g and two_adicity are zero and the NTT is not used.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) limits.h:                                                             *
+ *          Header file providing UINT_MAX.                                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  UINT_MAX found here.                                                      */
+#include <limits.h>
+
+/*  Montgomery arithmetic uses R = 2^32 and requires 32-bit ints.             */
+#if UINT_MAX != 0xFFFFFFFFU
+#error "Poly_Modulus_Init requires 32-bit unsigned int."
+#endif
+
+/*  Computes b^e mod p. Since p < 2^31 the products fit in 64 bits.           */
+static unsigned int
+poly_modulus_pow(unsigned int b, unsigned int e, unsigned int p)
+{
+    unsigned long long result = 1ULL;
+    unsigned long long base = b % p;
+
+    while (e)
+    {
+        if (e & 1U)
+            result = (result * base) % p;
+
+        base = (base * base) % p;
+        e >>= 1;
+    }
+
+    return (unsigned int)result;
+}
+/*  End of poly_modulus_pow.                                                  */
+
+/*  Returns 1 if the odd number p is prime, and 0 otherwise.                  */
+static int poly_modulus_is_prime(unsigned int p)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int d, x;
+    int s, r, k;
+
+    /*  These bases give the right answer for every p below 4759123141.       */
+    static const unsigned int bases[3] = {2U, 7U, 61U};
+
+    /*  Write p - 1 = 2^s d with d odd.                                       */
+    d = p - 1U;
+    s = 0;
+
+    while (!(d & 1U))
+    {
+        d >>= 1;
+        ++s;
+    }
+
+    for (k = 0; k < 3; ++k)
+    {
+        /*  The base is a multiple of p only for the primes 7 and 61.         */
+        if (bases[k] % p == 0U)
+            continue;
+
+        x = poly_modulus_pow(bases[k], d, p);
+
+        if (x == 1U || x == p - 1U)
+            continue;
+
+        for (r = 1; r < s; ++r)
+        {
+            x = (unsigned int)(((unsigned long long)x * x) % p);
+
+            if (x == p - 1U)
+                break;
+        }
+
+        if (r == s)
+            return 0;
+    }
+
+    return 1;
+}
+/*  End of poly_modulus_is_prime.                                             */
+
+/*  Function for setting up arithmetic modulo p.                              */
+int Poly_Modulus_Init(Poly_Modulus *mod, unsigned int p)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int inv, c, f, g;
+    unsigned int factors[32];
+    unsigned long long r;
+    size_t count, k;
+    int n;
+
+    if (!mod || p < 3U || p > POLY_MODULUS_MAX || !(p & 1U))
+        return -1;
+
+    mod->p = p;
+
+    /*  Newton's method for p^-1 mod 2^32. Each step doubles the number of    *
+     *  correct bits, and p*p = 1 mod 8 gives three to start with.            */
+    inv = p;
+
+    for (n = 0; n < 4; ++n)
+        inv *= 2U - p * inv;
+
+    mod->p_inv = 0U - inv;
+
+    /*  2^64 mod p is (2^32 mod p)^2 mod p.                                   */
+    r = (1ULL << 32) % p;
+    mod->r2 = (unsigned int)((r * r) % p);
+
+    /*  Products that may be summed before a reduction. At least 2.           */
+    mod->lazy = (size_t)(0xFFFFFFFFU / p);
+
+    mod->g = 0U;
+    mod->two_adicity = 0U;
+
+    if (!poly_modulus_is_prime(p))
+        return 0;
+
+    /*  Factor p - 1 = 2^k c, collecting the distinct prime factors.          */
+    c = p - 1U;
+    count = (size_t)0;
+
+    while (!(c & 1U))
+    {
+        c >>= 1;
+        ++mod->two_adicity;
+    }
+
+    factors[count++] = 2U;
+
+    for (f = 3U; f <= c / f; f += 2U)
+    {
+        if (c % f != 0U)
+            continue;
+
+        factors[count++] = f;
+
+        while (c % f == 0U)
+            c /= f;
+    }
+
+    if (c > 1U)
+        factors[count++] = c;
+
+    /*  The smallest primitive root. One is found quickly, as a positive      *
+     *  fraction of the residues are primitive roots.                         */
+    for (g = 2U; g < p; ++g)
+    {
+        for (k = (size_t)0; k < count; ++k)
+            if (poly_modulus_pow(g, (p - 1U) / factors[k], p) == 1U)
+                break;
+
+        if (k == count)
+            break;
+    }
+
+    mod->g = g;
+    return 0;
+}
+/*  End of Poly_Modulus_Init.                                                 */
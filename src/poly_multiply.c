@@ -0,0 +1,132 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials with the fastest available algorithm.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply                                                         *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B, choosing the algorithm from the lengths.            *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Offload_Multiply (polynomial_multiplication.h):                  *
+ *          Hands the product to the registered accelerator, if any.          *
+ *      Naive_Product (polynomial_multiplication.h):                          *
+ *          Computes P = A*B if the scratch space can not be allocated.       *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Selects the algorithm and computes the product.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Offer the product to the backend set by Poly_Set_Offload. If there is *
+ *      none, or it is below its threshold or declines, allocate the scratch  *
+ *      space and call Poly_Multiply_With_Scratch.                            *
+ *  Notes:                                                                    *
+ *      The operands may be given in either order. If the scratch space can   *
+ *      not be allocated, this falls back to the naive method. Nothing is     *
+ *      allocated for products computed with the naive method.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing P = A*B with the fastest algorithm.                */
+void
+Poly_Multiply(int *P_coeffs,
+              const int *A_coeffs, size_t A_len,
+              const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t size;
+    int *work;
+
+    /*  Large products may be handed to an accelerator.                       */
+    if (Poly_Offload_Multiply(P_coeffs, A_coeffs, A_len, B_coeffs, B_len) == 0)
+        return;
+
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    size = Poly_Scratch_Size(A_len, B_len);
+
+    /*  The naive method, and empty products, need no scratch space.          */
+    if (size == (size_t)0)
+    {
+        Poly_Multiply_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        if (A_len <= B_len)
+            Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        else
+            Naive_Product(P_coeffs, B_coeffs, B_len, A_coeffs, A_len);
+
+        return;
+    }
+
+    Poly_Multiply_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Multiply.                                                     */
@@ -0,0 +1,389 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies many independent pairs of short polynomials.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Batch                                                   *
+ *  Purpose:                                                                  *
+ *      Computes P[i] = A[i] * B[i] for each product in a batch.              *
+ *  Arguments:                                                                *
+ *      pool (Poly_Pool *):                                                   *
+ *          The pool of worker threads. May be NULL.                          *
+ *      count (size_t):                                                       *
+ *          The number of products.                                           *
+ *      P_coeffs (int * const *):                                             *
+ *          The output arrays. P[i] is at least A_len[i] + B_len[i] - 1 wide. *
+ *      A_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the first operands.                     *
+ *      A_len (const size_t *):                                               *
+ *          The lengths of the first operands.                                *
+ *      B_coeffs (const int * const *):                                       *
+ *          The coefficient arrays of the second operands.                    *
+ *      B_len (const size_t *):                                               *
+ *          The lengths of the second operands.                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Offload_Batch (polynomial_multiplication.h):                     *
+ *          Hands the batch to the registered accelerator, if any.            *
+ *      Naive_Batch_Kernel (polynomial_multiplication.h):                     *
+ *          Computes NAIVE_BATCH_LANES short products at once.                *
+ *      Poly_Multiply (polynomial_multiplication.h):                          *
+ *          Computes the products that are too long for the batch kernel.     *
+ *      Poly_Pool_Run, Poly_Worker_Spawn, Poly_Worker_Join                    *
+ *      (polynomial_multiplication.h):                                        *
+ *          Share the batch between the workers of the pool.                  *
+ *  Method:                                                                   *
+ *      The batch is first offered to the backend set by Poly_Set_Offload,    *
+ *      which can overlap the transfers of some products with the work on     *
+ *      others. If there is none, or the batch is too small for it, or it     *
+ *      declines, the batch is computed here.                                 *
+ *                                                                            *
+ *      Calling Naive_Product once per product wastes most of each vector on  *
+ *      such short rows, and pays the call overhead every time. Instead the   *
+ *      products are taken NAIVE_BATCH_LANES at a time and passed together    *
+ *      to Naive_Batch_Kernel, which interleaves them so that each SIMD lane  *
+ *      computes one product. Shorter products in a group are padded with     *
+ *      zeros to the longest.                                                 *
+ *                                                                            *
+ *      With a pool, the batch is cut into ranges of consecutive products,    *
+ *      about eight per thread, which the workers share by halving.           *
+ *  Notes:                                                                    *
+ *      Products with an empty operand are skipped. Grouping products of      *
+ *      similar lengths together wastes fewer lanes on padding.               *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Batch_Strided                                           *
+ *  Purpose:                                                                  *
+ *      Computes a batch of products of the same lengths, stored at fixed     *
+ *      strides.                                                              *
+ *  Arguments:                                                                *
+ *      pool (Poly_Pool *):                                                   *
+ *          The pool of worker threads. May be NULL.                          *
+ *      count (size_t):                                                       *
+ *          The number of products.                                           *
+ *      P_coeffs (int *):                                                     *
+ *          The first output. Output i starts at P_coeffs + i*P_stride.       *
+ *      P_stride (size_t):                                                    *
+ *          The distance between outputs, at least A_len + B_len - 1.         *
+ *      A_coeffs (const int *):                                               *
+ *          The first of the A operands.                                      *
+ *      A_len (size_t):                                                       *
+ *          The length of every A operand.                                    *
+ *      A_stride (size_t):                                                    *
+ *          The distance between the A operands.                              *
+ *      B_coeffs (const int *):                                               *
+ *          The first of the B operands.                                      *
+ *      B_len (size_t):                                                       *
+ *          The length of every B operand.                                    *
+ *      B_stride (size_t):                                                    *
+ *          The distance between the B operands.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      The same as Poly_Multiply_Batch, with Poly_Offload_Batch_Strided in   *
+ *      place of Poly_Offload_Batch.                                          *
+ *  Method:                                                                   *
+ *      The same as Poly_Multiply_Batch, without the pointer arrays.          *
+ *  Notes:                                                                    *
+ *      A stride of zero reuses the same operand for every product.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  A batch of products, given either by pointer arrays or by strides.        */
+typedef struct poly_batch_def {
+
+    /*  The pointer arrays. P_array is NULL for the strided layout.           */
+    int * const *P_array;
+    const int * const *A_array;
+    const size_t *A_lens;
+    const int * const *B_array;
+    const size_t *B_lens;
+
+    /*  The strided layout.                                                   */
+    int *P_coeffs;
+    size_t P_stride;
+    const int *A_coeffs;
+    size_t A_len;
+    size_t A_stride;
+    const int *B_coeffs;
+    size_t B_len;
+    size_t B_stride;
+
+    /*  Ranges of at most this many products are not split between tasks.     */
+    size_t grain;
+} poly_batch;
+
+/*  The arguments of a task computing a range of the batch.                   */
+typedef struct poly_batch_range_def {
+    const poly_batch *batch;
+    size_t first;
+    size_t count;
+} poly_batch_range;
+
+/*  One group of products for Naive_Batch_Kernel.                             */
+typedef struct poly_batch_group_def {
+    int *P_coeffs[NAIVE_BATCH_LANES];
+    const int *A_coeffs[NAIVE_BATCH_LANES];
+    const int *B_coeffs[NAIVE_BATCH_LANES];
+    size_t A_len[NAIVE_BATCH_LANES];
+    size_t B_len[NAIVE_BATCH_LANES];
+
+    /*  The number of lanes in use.                                           */
+    size_t used;
+} poly_batch_group;
+
+/*  Computes the products in a group and empties it.                          */
+static void poly_batch_flush(poly_batch_group *group)
+{
+    if (group->used == (size_t)0)
+        return;
+
+    Naive_Batch_Kernel(
+        group->P_coeffs,
+        group->A_coeffs, group->A_len,
+        group->B_coeffs, group->B_len,
+        group->used
+    );
+
+    group->used = (size_t)0;
+}
+/*  End of poly_batch_flush.                                                  */
+
+/*  Computes the products first, ..., first + count - 1 on this thread.       */
+static void
+poly_batch_compute(const poly_batch *batch, size_t first, size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_batch_group group;
+    const int *A_coeffs, *B_coeffs;
+    size_t i, A_len, B_len;
+    int *P_coeffs;
+
+    group.used = (size_t)0;
+
+    for (i = first; i < first + count; ++i)
+    {
+        if (batch->P_array)
+        {
+            P_coeffs = batch->P_array[i];
+            A_coeffs = batch->A_array[i];
+            A_len = batch->A_lens[i];
+            B_coeffs = batch->B_array[i];
+            B_len = batch->B_lens[i];
+        }
+        else
+        {
+            P_coeffs = batch->P_coeffs + i*batch->P_stride;
+            A_coeffs = batch->A_coeffs + i*batch->A_stride;
+            A_len = batch->A_len;
+            B_coeffs = batch->B_coeffs + i*batch->B_stride;
+            B_len = batch->B_len;
+        }
+
+        /*  The product with an empty polynomial is empty.                    */
+        if (A_len == (size_t)0 || B_len == (size_t)0)
+            continue;
+
+        /*  Long products do not fit in the buffers, and are better done with *
+         *  the faster algorithms anyway.                                     */
+        if (A_len > (size_t)NAIVE_BATCH_MAX_LENGTH ||
+            B_len > (size_t)NAIVE_BATCH_MAX_LENGTH)
+        {
+            Poly_Multiply(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+            continue;
+        }
+
+        group.P_coeffs[group.used] = P_coeffs;
+        group.A_coeffs[group.used] = A_coeffs;
+        group.A_len[group.used] = A_len;
+        group.B_coeffs[group.used] = B_coeffs;
+        group.B_len[group.used] = B_len;
+        ++group.used;
+
+        if (group.used == (size_t)NAIVE_BATCH_LANES)
+            poly_batch_flush(&group);
+    }
+
+    poly_batch_flush(&group);
+}
+/*  End of poly_batch_compute.                                                */
+
+/*  Task function computing a range of the batch, halving it between tasks    *
+ *  until it is at most the grain long.                                       */
+static void poly_batch_task(Poly_Worker *worker, void *data)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const poly_batch_range * const range = data;
+    poly_batch_range lower, upper;
+    Poly_Task task;
+    size_t half;
+    size_t pending = (size_t)0;
+
+    if (range->count <= range->batch->grain)
+    {
+        poly_batch_compute(range->batch, range->first, range->count);
+        return;
+    }
+
+    /*  Spawn the upper half of the range, and do the lower half here.        */
+    half = range->count >> 1;
+
+    lower.batch = range->batch;
+    lower.first = range->first;
+    lower.count = half;
+
+    upper.batch = range->batch;
+    upper.first = range->first + half;
+    upper.count = range->count - half;
+
+    task.func = poly_batch_task;
+    task.data = &upper;
+
+    Poly_Worker_Spawn(worker, &task, &pending);
+    poly_batch_task(worker, &lower);
+    Poly_Worker_Join(worker, &pending);
+}
+/*  End of poly_batch_task.                                                   */
+
+/*  Computes a batch, on the pool if there is enough work for it.             */
+static void poly_batch_run(Poly_Pool *pool, poly_batch *batch, size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_batch_range range;
+
+    /*  The number of worker threads available.                               */
+    const size_t threads = Poly_Pool_Threads(pool);
+
+    /*  Fewer products than this are not worth a task. Sixteen groups of      *
+     *  short products take a few microseconds.                               */
+    const size_t min_grain = (size_t)16 * (size_t)NAIVE_BATCH_LANES;
+
+    if (threads < (size_t)2 || count <= min_grain)
+    {
+        poly_batch_compute(batch, (size_t)0, count);
+        return;
+    }
+
+    /*  About eight ranges per thread, so that the load balances.             */
+    batch->grain = count / ((size_t)8 * threads);
+
+    if (batch->grain < min_grain)
+        batch->grain = min_grain;
+
+    range.batch = batch;
+    range.first = (size_t)0;
+    range.count = count;
+
+    Poly_Pool_Run(pool, poly_batch_task, &range);
+}
+/*  End of poly_batch_run.                                                    */
+
+/*  Function for computing a batch of products given by pointer arrays.       */
+void
+Poly_Multiply_Batch(Poly_Pool *pool, size_t count,
+                    int * const *P_coeffs,
+                    const int * const *A_coeffs, const size_t *A_len,
+                    const int * const *B_coeffs, const size_t *B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_batch batch;
+
+    if (count == (size_t)0)
+        return;
+
+    /*  Large batches may be handed to an accelerator.                        */
+    if (Poly_Offload_Batch(count, P_coeffs, A_coeffs, A_len,
+                           B_coeffs, B_len) == 0)
+        return;
+
+    batch.P_array = P_coeffs;
+    batch.A_array = A_coeffs;
+    batch.A_lens = A_len;
+    batch.B_array = B_coeffs;
+    batch.B_lens = B_len;
+
+    batch.P_coeffs = NULL;
+    batch.P_stride = (size_t)0;
+    batch.A_coeffs = NULL;
+    batch.A_len = (size_t)0;
+    batch.A_stride = (size_t)0;
+    batch.B_coeffs = NULL;
+    batch.B_len = (size_t)0;
+    batch.B_stride = (size_t)0;
+
+    poly_batch_run(pool, &batch, count);
+}
+/*  End of Poly_Multiply_Batch.                                               */
+
+/*  Function for computing a batch of products stored at fixed strides.       */
+void
+Poly_Multiply_Batch_Strided(Poly_Pool *pool, size_t count,
+                            int *P_coeffs, size_t P_stride,
+                            const int *A_coeffs, size_t A_len, size_t A_stride,
+                            const int *B_coeffs, size_t B_len, size_t B_stride)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_batch batch;
+
+    if (count == (size_t)0)
+        return;
+
+    if (Poly_Offload_Batch_Strided(count, P_coeffs, P_stride,
+                                   A_coeffs, A_len, A_stride,
+                                   B_coeffs, B_len, B_stride) == 0)
+        return;
+
+    batch.P_array = NULL;
+    batch.A_array = NULL;
+    batch.A_lens = NULL;
+    batch.B_array = NULL;
+    batch.B_lens = NULL;
+
+    batch.P_coeffs = P_coeffs;
+    batch.P_stride = P_stride;
+    batch.A_coeffs = A_coeffs;
+    batch.A_len = A_len;
+    batch.A_stride = A_stride;
+    batch.B_coeffs = B_coeffs;
+    batch.B_len = B_len;
+    batch.B_stride = B_stride;
+
+    poly_batch_run(pool, &batch, count);
+}
+/*  End of Poly_Multiply_Batch_Strided.                                       */
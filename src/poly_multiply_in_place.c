@@ -0,0 +1,227 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies a polynomial by another in place, A = A*B, with the        *
+ *      fastest available algorithm.                                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_In_Place_Scratch_Size                                            *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Multiply_In_Place_With_Scratch.                                  *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for the product.                                    *
+ *  Method:                                                                   *
+ *      Room for a copy of A and the scratch for the product. The naive       *
+ *      method needs neither.                                                 *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_In_Place_With_Scratch                                   *
+ *  Purpose:                                                                  *
+ *      Computes A = A*B, choosing the algorithm from the lengths, with       *
+ *      caller supplied scratch space.                                        *
+ *  Arguments:                                                                *
+ *      A_coeffs (int *):                                                     *
+ *          A pointer to the coefficient array of a polynomial, at least      *
+ *          A_len + B_len - 1 wide. The product is written here.              *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_In_Place_Scratch_Size(A_len, B_len)  *
+ *          wide.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Naive_Product_Overlap (polynomial_multiplication.h):                  *
+ *          Computes short products in place with no scratch.                 *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Multiplies the copy of A by B.                                    *
+ *  Method:                                                                   *
+ *      For short operands, Naive_Product_Overlap writes the product over A   *
+ *      from the top down. Otherwise A is copied into the scratch space and   *
+ *      the product of the copy with B is written over A. This needs A_len    *
+ *      ints beyond the scratch of the product, rather than an output array   *
+ *      of A_len + B_len - 1.                                                 *
+ *  Notes:                                                                    *
+ *      B may be A itself, which squares it, but must not otherwise overlap   *
+ *      the array of A. If either length is zero, A is not touched. The       *
+ *      tunables must not change between sizing the scratch array and         *
+ *      calling this function.                                                *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_In_Place                                                *
+ *  Purpose:                                                                  *
+ *      Computes A = A*B with the fastest available algorithm.                *
+ *  Arguments:                                                                *
+ *      A_coeffs (int *):                                                     *
+ *          A pointer to the coefficient array of a polynomial, at least      *
+ *          A_len + B_len - 1 wide. The product is written here.              *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_In_Place_Scratch_Size (polynomial_multiplication.h):             *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Multiply_In_Place_With_Scratch (polynomial_multiplication.h):    *
+ *          Computes the product with the allocated scratch.                  *
+ *      Naive_Product_Overlap (polynomial_multiplication.h):                  *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_Multiply_In_Place_With_Scratch.                                  *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing the scratch space used by in place products.       */
+size_t Poly_In_Place_Scratch_Size(size_t A_len, size_t B_len)
+{
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return (size_t)0;
+
+    if (Poly_Select_Algorithm(A_len < B_len ? A_len : B_len,
+                              A_len < B_len ? B_len : A_len)
+        == POLY_ALGORITHM_NAIVE)
+        return (size_t)0;
+
+    /*  The copy of A, and the scratch for the product.                       */
+    return A_len + Poly_Scratch_Size(A_len, B_len);
+}
+/*  End of Poly_In_Place_Scratch_Size.                                        */
+
+/*  Function for computing A = A*B with caller scratch.                       */
+void
+Poly_Multiply_In_Place_With_Scratch(int *A_coeffs, size_t A_len,
+                                    const int *B_coeffs, size_t B_len,
+                                    int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    if (Poly_Select_Algorithm(A_len < B_len ? A_len : B_len,
+                              A_len < B_len ? B_len : A_len)
+        == POLY_ALGORITHM_NAIVE)
+    {
+        Naive_Product_Overlap(A_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    for (n = (size_t)0; n < A_len; ++n)
+        work[n] = A_coeffs[n];
+
+    /*  If B is A, the copy is used for both, squaring the original A.        */
+    if (B_coeffs == A_coeffs)
+        B_coeffs = work;
+
+    Poly_Multiply_With_Scratch(
+        A_coeffs, work, A_len, B_coeffs, B_len, work + A_len
+    );
+}
+/*  End of Poly_Multiply_In_Place_With_Scratch.                               */
+
+/*  Function for computing A = A*B with the fastest method.                   */
+void
+Poly_Multiply_In_Place(int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    const size_t size = Poly_In_Place_Scratch_Size(A_len, B_len);
+    int *work;
+
+    /*  The naive method, and empty products, need no scratch space.          */
+    if (size == (size_t)0)
+    {
+        Poly_Multiply_In_Place_With_Scratch(
+            A_coeffs, A_len, B_coeffs, B_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Product_Overlap(A_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    Poly_Multiply_In_Place_With_Scratch(
+        A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Multiply_In_Place.                                            */
@@ -0,0 +1,110 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials with coefficients modulo p.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Mod                                                     *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod p, choosing the algorithm from the lengths.      *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array, at least A_len + B_len - 1 wide.           *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the crossover point mod_ntt_cutoff.                      *
+ *      Naive_Product_Mod (polynomial_multiplication.h):                      *
+ *          Used if the shorter operand is at most mod_ntt_cutoff long.       *
+ *      NTT_Product_Mod (polynomial_multiplication.h):                        *
+ *          Used for longer operands.                                         *
+ *  Method:                                                                   *
+ *      Swap the operands so that A is the shorter one, and compare its       *
+ *      length with mod_ntt_cutoff. There is no Karatsuba step, since the     *
+ *      lazy reduction makes the naive method cheap up to the lengths where   *
+ *      a single transform mod p takes over.                                  *
+ *  Notes:                                                                    *
+ *      The operands may be given in either order. If either is empty then    *
+ *      nothing is written to P. For moduli without an NTT, such as           *
+ *      composites, the naive method is used at every length.                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing P = A*B mod p.                                     */
+void
+Poly_Multiply_Mod(unsigned int *P_coeffs,
+                  const unsigned int *A_coeffs, size_t A_len,
+                  const unsigned int *B_coeffs, size_t B_len,
+                  const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const unsigned int *tmp_coeffs;
+    size_t tmp_len;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0)
+        return;
+
+    if (A_len <= Poly_Get_Tunables()->mod_ntt_cutoff)
+        Naive_Product_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+    else
+        NTT_Product_Mod(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, mod);
+}
+/*  End of Poly_Multiply_Mod.                                                 */
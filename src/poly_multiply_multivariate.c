@@ -0,0 +1,358 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials in several variables by Kronecker              *
+ *      substitution, turning the product into one univariate product.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multivariate_Scratch_Size                                        *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Multiply_Multivariate_With_Scratch.                              *
+ *  Arguments:                                                                *
+ *      A_dims (const size_t *):                                              *
+ *          The lengths of A in each of the variables.                        *
+ *      B_dims (const size_t *):                                              *
+ *          The lengths of B in each of the variables.                        *
+ *      vars (size_t):                                                        *
+ *          The number of variables.                                          *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for the univariate product.                         *
+ *  Method:                                                                   *
+ *      Room for A and B substituted into one variable, and the scratch for   *
+ *      their product.                                                        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Multivariate_With_Scratch                               *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for polynomials in several variables, with caller    *
+ *      supplied scratch space.                                               *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints. P has length A_dims[k] +           *
+ *          B_dims[k] - 1 in variable k, and the product of these in total.   *
+ *      A_coeffs (const int *):                                               *
+ *          The coefficients of A, stored with the last variable varying      *
+ *          fastest, so x_0^i x_1^j of a polynomial in two variables is at    *
+ *          index i*A_dims[1] + j.                                            *
+ *      A_dims (const size_t *):                                              *
+ *          The lengths of A in each of the variables.                        *
+ *      B_coeffs (const int *):                                               *
+ *          The coefficients of B, stored in the same way.                    *
+ *      B_dims (const size_t *):                                              *
+ *          The lengths of B in each of the variables.                        *
+ *      vars (size_t):                                                        *
+ *          The number of variables.                                          *
+ *      work (int *):                                                         *
+ *          Scratch space, at least                                           *
+ *          Poly_Multivariate_Scratch_Size(A_dims, B_dims, vars) wide.        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Computes the univariate product.                                  *
+ *  Method:                                                                   *
+ *      Write the lengths of P as n_k = A_dims[k] + B_dims[k] - 1, and        *
+ *      substitute x_k = x^s_k, with s_k the product of n_j over j > k. A     *
+ *      term x_0^i_0 ... of A becomes x^(i_0 s_0 + ...), and since each i_k   *
+ *      of the product is less than n_k, no two terms of P land on the same   *
+ *      power of x. The substituted A and B are zero between their rows, and  *
+ *      their univariate product is P with exactly the layout of the output,  *
+ *      so it is written straight into P by a single call of the dispatcher.  *
+ *  Notes:                                                                    *
+ *      If A and B are the same array with the same lengths it is only        *
+ *      substituted once, and the product is computed as a square. If any of  *
+ *      the lengths is zero, P is not touched. With no variables A, B, and P  *
+ *      are constants.                                                        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Multivariate                                            *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for polynomials in several variables.                *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, as for                             *
+ *          Poly_Multiply_Multivariate_With_Scratch.                          *
+ *      A_coeffs (const int *):                                               *
+ *          The coefficients of A, with the last variable varying fastest.    *
+ *      A_dims (const size_t *):                                              *
+ *          The lengths of A in each of the variables.                        *
+ *      B_coeffs (const int *):                                               *
+ *          The coefficients of B, stored in the same way.                    *
+ *      B_dims (const size_t *):                                              *
+ *          The lengths of B in each of the variables.                        *
+ *      vars (size_t):                                                        *
+ *          The number of variables.                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Multivariate_Scratch_Size (polynomial_multiplication.h):         *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Multiply_Multivariate_With_Scratch                               *
+ *      (polynomial_multiplication.h):                                        *
+ *          Computes the product with the allocated scratch.                  *
+ *      Naive_AddTo_Product (polynomial_multiplication.h):                    *
+ *          Used row by row if the scratch space can not be allocated.        *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_Multiply_Multivariate_With_Scratch.                              *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to adding  *
+ *      the product of each row of A with each row of B into P. The output is *
+ *      still correct, but slower.                                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Returns the number of coefficients of an array with the given lengths.    */
+static size_t poly_multivariate_count(const size_t *dims, size_t vars)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    size_t count = (size_t)1;
+
+    for (k = (size_t)0; k < vars; ++k)
+        count *= dims[k];
+
+    return count;
+}
+/*  End of poly_multivariate_count.                                           */
+
+/*  Returns the power of x that coefficient index of an array with lengths    *
+ *  dims is sent to, the strides being those of the product of A and B.       */
+static size_t
+poly_multivariate_offset(size_t index, const size_t *dims,
+                         const size_t *A_dims, const size_t *B_dims,
+                         size_t vars)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    size_t offset = (size_t)0;
+    size_t stride = (size_t)1;
+
+    /*  Peel the indices off from the last variable, the fastest varying.     */
+    for (k = vars; k > (size_t)0; --k)
+    {
+        offset += (index % dims[k - 1]) * stride;
+        index /= dims[k - 1];
+        stride *= A_dims[k - 1] + B_dims[k - 1] - (size_t)1;
+    }
+
+    return offset;
+}
+/*  End of poly_multivariate_offset.                                          */
+
+/*  Writes the substitution of an array with lengths dims into X, which has   *
+ *  room for the offset of its last coefficient plus one.                     */
+static void
+poly_multivariate_pack(int *X_coeffs, const int *coeffs, const size_t *dims,
+                       const size_t *A_dims, const size_t *B_dims,
+                       size_t vars)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, n, offset;
+
+    /*  The last variable is contiguous in both arrays, so copy it by rows.   */
+    const size_t count = poly_multivariate_count(dims, vars);
+    const size_t row = (vars > (size_t)0 ? dims[vars - 1] : (size_t)1);
+    const size_t len = poly_multivariate_offset(
+        count - (size_t)1, dims, A_dims, B_dims, vars
+    ) + (size_t)1;
+
+    for (k = (size_t)0; k < len; ++k)
+        X_coeffs[k] = 0;
+
+    for (n = (size_t)0; n < count; n += row)
+    {
+        offset = poly_multivariate_offset(n, dims, A_dims, B_dims, vars);
+
+        for (k = (size_t)0; k < row; ++k)
+            X_coeffs[offset + k] = coeffs[n + k];
+    }
+}
+/*  End of poly_multivariate_pack.                                            */
+
+/*  Returns the length of the substitution of an array with lengths dims.     */
+static size_t
+poly_multivariate_length(const size_t *dims,
+                         const size_t *A_dims, const size_t *B_dims,
+                         size_t vars)
+{
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    /*  The index of the last coefficient, the one sent to the highest power. */
+    const size_t last = poly_multivariate_count(dims, vars) - one;
+
+    return poly_multivariate_offset(last, dims, A_dims, B_dims, vars) + one;
+}
+/*  End of poly_multivariate_length.                                          */
+
+/*  Function for computing the scratch space used by multivariate products.   */
+size_t
+Poly_Multivariate_Scratch_Size(const size_t *A_dims, const size_t *B_dims,
+                               size_t vars)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_len, B_len;
+
+    if (poly_multivariate_count(A_dims, vars) == (size_t)0 ||
+        poly_multivariate_count(B_dims, vars) == (size_t)0)
+        return (size_t)0;
+
+    A_len = poly_multivariate_length(A_dims, A_dims, B_dims, vars);
+    B_len = poly_multivariate_length(B_dims, A_dims, B_dims, vars);
+
+    /*  The substituted A and B, and the scratch for their product.           */
+    return A_len + B_len + Poly_Scratch_Size(A_len, B_len);
+}
+/*  End of Poly_Multivariate_Scratch_Size.                                    */
+
+/*  Function for computing P = A*B in several variables with caller scratch.  */
+void
+Poly_Multiply_Multivariate_With_Scratch(int *P_coeffs,
+                                        const int *A_coeffs,
+                                        const size_t *A_dims,
+                                        const int *B_coeffs,
+                                        const size_t *B_dims,
+                                        size_t vars, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, A_len, B_len;
+    int *X_coeffs, *Y_coeffs;
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (poly_multivariate_count(A_dims, vars) == (size_t)0 ||
+        poly_multivariate_count(B_dims, vars) == (size_t)0)
+        return;
+
+    A_len = poly_multivariate_length(A_dims, A_dims, B_dims, vars);
+    B_len = poly_multivariate_length(B_dims, A_dims, B_dims, vars);
+
+    X_coeffs = work;
+    poly_multivariate_pack(X_coeffs, A_coeffs, A_dims, A_dims, B_dims, vars);
+
+    /*  A square only needs substituting once, and is then computed as one.   */
+    for (k = (size_t)0; k < vars; ++k)
+        if (A_dims[k] != B_dims[k])
+            break;
+
+    if (A_coeffs == B_coeffs && k == vars)
+        Y_coeffs = X_coeffs;
+
+    else
+    {
+        Y_coeffs = X_coeffs + A_len;
+        poly_multivariate_pack(
+            Y_coeffs, B_coeffs, B_dims, A_dims, B_dims, vars
+        );
+    }
+
+    /*  The univariate product is P, already in the layout of the output.     */
+    Poly_Multiply_With_Scratch(
+        P_coeffs, X_coeffs, A_len, Y_coeffs, B_len, work + A_len + B_len
+    );
+}
+/*  End of Poly_Multiply_Multivariate_With_Scratch.                           */
+
+/*  Function for computing P = A*B in several variables.                      */
+void
+Poly_Multiply_Multivariate(int *P_coeffs,
+                           const int *A_coeffs, const size_t *A_dims,
+                           const int *B_coeffs, const size_t *B_dims,
+                           size_t vars)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, n, A_count, B_count, A_row, B_row, P_len, offset;
+    int *work;
+
+    /*  The amount of scratch space needed.                                   */
+    const size_t size = Poly_Multivariate_Scratch_Size(A_dims, B_dims, vars);
+
+    /*  Only empty products need no scratch space.                            */
+    if (size == (size_t)0)
+        return;
+
+    work = malloc(sizeof(*work) * size);
+
+    if (work)
+    {
+        Poly_Multiply_Multivariate_With_Scratch(
+            P_coeffs, A_coeffs, A_dims, B_coeffs, B_dims, vars, work
+        );
+
+        free(work);
+        return;
+    }
+
+    /*  If malloc fails, add up the products of the rows of A and B. Each     *
+     *  lands at the sum of the offsets of the two rows.                      */
+    A_count = poly_multivariate_count(A_dims, vars);
+    B_count = poly_multivariate_count(B_dims, vars);
+    A_row = (vars > (size_t)0 ? A_dims[vars - 1] : (size_t)1);
+    B_row = (vars > (size_t)0 ? B_dims[vars - 1] : (size_t)1);
+    P_len = poly_multivariate_length(A_dims, A_dims, B_dims, vars) +
+            poly_multivariate_length(B_dims, A_dims, B_dims, vars) - (size_t)1;
+
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    for (m = (size_t)0; m < A_count; m += A_row)
+    {
+        offset = poly_multivariate_offset(m, A_dims, A_dims, B_dims, vars);
+
+        for (n = (size_t)0; n < B_count; n += B_row)
+            Naive_AddTo_Product(
+                P_coeffs + offset +
+                poly_multivariate_offset(n, B_dims, A_dims, B_dims, vars),
+                A_coeffs + m, A_row, B_coeffs + n, B_row
+            );
+    }
+}
+/*  End of Poly_Multiply_Multivariate.                                        */
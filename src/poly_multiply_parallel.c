@@ -0,0 +1,623 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials using every worker of a thread pool.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Parallel                                                *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B, splitting the work into tasks for a Poly_Pool.      *
+ *  Arguments:                                                                *
+ *      pool (Poly_Pool *):                                                   *
+ *          The pool of worker threads. May be NULL.                          *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Pool_Run (polynomial_multiplication.h):                          *
+ *          Runs the top level task on the pool.                              *
+ *      Poly_Worker_Spawn, Poly_Worker_Join (polynomial_multiplication.h):    *
+ *          Used for computing the sub-products in parallel.                  *
+ *      Poly_Worker_Scratch, Poly_Worker_Release                              *
+ *      (polynomial_multiplication.h):                                        *
+ *          Provide the scratch space of each task.                           *
+ *      Poly_Multiply, Poly_Multiply_With_Scratch                             *
+ *      (polynomial_multiplication.h):                                        *
+ *          Compute the products that are not split.                          *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Combines the pieces of the Karatsuba splits and of the chunks.    *
+ *      POLY_STATS_BEGIN, POLY_STATS_END, POLY_STATS_NEST, POLY_STATS_UNNEST  *
+ *      (polynomial_multiplication.h):                                        *
+ *          Record the product once, with POLY_INSTRUMENT.                    *
+ *  Method:                                                                   *
+ *      The three sub-products of a Karatsuba step are independent. A product *
+ *      of length n that Poly_Multiply would give to Karatsuba is split the   *
+ *      same way Karatsuba_Product would, and the sub-products are spawned as *
+ *      tasks. The splitting stops at the parallel_grain tunable, below which *
+ *      the task is computed by Poly_Multiply_With_Scratch on a single        *
+ *      worker, using the arena of the worker for scratch space.              *
+ *                                                                            *
+ *      Products that Poly_Multiply would give to the NTT are split with      *
+ *      Karatsuba steps too, which costs more work than the serial algorithm, *
+ *      so this is only done until there is one task per thread.              *
+ *                                                                            *
+ *      If A_len < B_len, B is cut into about four parts per thread, each a   *
+ *      whole number of chunks of length A_len. The products of the parts     *
+ *      are computed in parallel. The first A_len - 1 terms of each product   *
+ *      overlap the previous one, so they are kept aside and added in at the  *
+ *      end, and the rest is written straight into P.                         *
+ *  Notes:                                                                    *
+ *      The operands may be given in either order. If either is empty then    *
+ *      nothing is written to P. If the pool has fewer than two threads, or   *
+ *      the product is short, this is the same as Poly_Multiply. Every split  *
+ *      is exact modulo 2^32, so the result is identical to that of           *
+ *      Poly_Multiply.                                                        *
+ *                                                                            *
+ *      With POLY_INSTRUMENT the product is recorded once, on the calling     *
+ *      thread, for the algorithm Poly_Multiply would use, and the pieces     *
+ *      computed by the tasks are not recorded on their own.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  The arguments of a task computing P = A*B.                                */
+typedef struct poly_parallel_args_def {
+    int *P_coeffs;
+    const int *A_coeffs;
+    size_t A_len;
+    const int *B_coeffs;
+    size_t B_len;
+
+    /*  The number of threads the task, and its sub-tasks, should occupy.     */
+    size_t budget;
+} poly_parallel_args;
+
+/*  The cutting of B into parts, shared by the tasks computing them.          */
+typedef struct poly_parallel_parts_def {
+    int *P_coeffs;
+    const int *A_coeffs;
+    size_t A_len;
+    const int *B_coeffs;
+    size_t B_len;
+
+    /*  Every part except perhaps the last has this length.                   */
+    size_t part_len;
+
+    /*  The first A_len - 1 terms of the product of each part after the       *
+     *  first, stored one after another.                                      */
+    int *O_coeffs;
+    size_t budget;
+} poly_parallel_parts;
+
+/*  The arguments of a task computing a range of the parts.                   */
+typedef struct poly_parallel_range_def {
+    const poly_parallel_parts *parts;
+    size_t first;
+    size_t count;
+} poly_parallel_range;
+
+static void
+poly_parallel_product(Poly_Worker *worker,
+                      int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len,
+                      size_t budget);
+
+/*  Task function for poly_parallel_product.                                  */
+static void poly_parallel_task(Poly_Worker *worker, void *data)
+{
+    /*  The arguments of the product.                                         */
+    const poly_parallel_args * const args = data;
+
+    poly_parallel_product(
+        worker, args->P_coeffs, args->A_coeffs, args->A_len,
+        args->B_coeffs, args->B_len, args->budget
+    );
+}
+/*  End of poly_parallel_task.                                                */
+
+/*  Computes P = A*B, A_len <= B_len, on the current worker.                  */
+static void
+poly_parallel_leaf(Poly_Worker *worker,
+                   int *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len)
+{
+    /*  Scratch space for the product, taken from the arena of the worker.    */
+    int * const work = Poly_Worker_Scratch(
+        worker, Poly_Scratch_Size(A_len, B_len)
+    );
+
+    /*  Out of memory. The naive method needs no scratch space.               */
+    if (!work)
+    {
+        Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    /*  The pieces are part of the product recorded by the caller.            */
+    POLY_STATS_NEST();
+
+    Poly_Multiply_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    POLY_STATS_UNNEST();
+    Poly_Worker_Release(worker, work);
+}
+/*  End of poly_parallel_leaf.                                                */
+
+/*  Computes P = A*B for two polynomials of length n with one Karatsuba step, *
+ *  spawning the three sub-products.                                          */
+static void
+poly_parallel_karatsuba(Poly_Worker *worker,
+                        int *P_coeffs,
+                        const int *A_coeffs,
+                        const int *B_coeffs,
+                        size_t n,
+                        size_t budget)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l;
+    int *A_sum, *B_sum, *Z1;
+    poly_parallel_args args[3];
+    Poly_Task tasks[2];
+    size_t pending = (size_t)0;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  A0 and B0 have length h, A1 and B1 have length l. Note l <= h.        */
+    h = (n + one) >> 1;
+    l = n - h;
+
+    A_sum = Poly_Worker_Scratch(worker, 4*h - one);
+
+    if (!A_sum)
+    {
+        poly_parallel_leaf(worker, P_coeffs, A_coeffs, n, B_coeffs, n);
+        return;
+    }
+
+    B_sum = A_sum + h;
+    Z1 = B_sum + h;
+
+    /*  A0 + A1 and B0 + B1. A1 and B1 may be one shorter than A0 and B0.     */
+    for (k = zero; k < l; ++k)
+    {
+        A_sum[k] = A_coeffs[k] + A_coeffs[h + k];
+        B_sum[k] = B_coeffs[k] + B_coeffs[h + k];
+    }
+
+    if (l < h)
+    {
+        A_sum[l] = A_coeffs[l];
+        B_sum[l] = B_coeffs[l];
+    }
+
+    /*  A0*B0 goes into the lower 2h - 1 coefficients of P, A1*B1 into the    *
+     *  upper 2l - 1, and (A0 + A1)*(B0 + B1) into Z1.                        */
+    for (k = zero; k < (size_t)3; ++k)
+        args[k].budget = (budget + (size_t)2) / (size_t)3;
+
+    args[0].P_coeffs = P_coeffs;
+    args[0].A_coeffs = A_coeffs;
+    args[0].A_len = h;
+    args[0].B_coeffs = B_coeffs;
+    args[0].B_len = h;
+
+    args[1].P_coeffs = P_coeffs + 2*h;
+    args[1].A_coeffs = A_coeffs + h;
+    args[1].A_len = l;
+    args[1].B_coeffs = B_coeffs + h;
+    args[1].B_len = l;
+
+    args[2].P_coeffs = Z1;
+    args[2].A_coeffs = A_sum;
+    args[2].A_len = h;
+    args[2].B_coeffs = B_sum;
+    args[2].B_len = h;
+
+    /*  Spawn the first two, and compute the last on this worker.             */
+    for (k = zero; k < (size_t)2; ++k)
+    {
+        tasks[k].func = poly_parallel_task;
+        tasks[k].data = args + k;
+        Poly_Worker_Spawn(worker, tasks + k, &pending);
+    }
+
+    poly_parallel_task(worker, args + 2);
+    Poly_Worker_Join(worker, &pending);
+
+    /*  The middle term is Z1 - A0*B0 - A1*B1, shifted by h.                  */
+    P_coeffs[2*h - one] = 0;
+    Scaled_AddTo(Z1, P_coeffs, 2*h - one, -1);
+    Scaled_AddTo(Z1, P_coeffs + 2*h, 2*l - one, -1);
+    Scaled_AddTo(P_coeffs + h, Z1, 2*h - one, 1);
+
+    Poly_Worker_Release(worker, A_sum);
+}
+/*  End of poly_parallel_karatsuba.                                           */
+
+/*  Writes the product of A and a part of B without any scratch space. Terms  *
+ *  below A_len - 1 go to O, and the rest to P. Used if memory runs out.      */
+static void
+poly_parallel_scatter_naive(int *P_coeffs, int *O_coeffs,
+                            const int *A_coeffs, size_t A_len,
+                            const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t j, m, first, last;
+    int sum;
+
+    for (j = (size_t)0; j < A_len + B_len - (size_t)1; ++j)
+    {
+        first = (j < B_len ? (size_t)0 : j - B_len + (size_t)1);
+        last = (j < A_len ? j : A_len - (size_t)1);
+        sum = 0;
+
+        for (m = first; m <= last; ++m)
+            sum += A_coeffs[m] * B_coeffs[j - m];
+
+        if (j + (size_t)1 < A_len)
+            O_coeffs[j] = sum;
+        else
+            P_coeffs[j] = sum;
+    }
+}
+/*  End of poly_parallel_scatter_naive.                                       */
+
+/*  Computes the product of A with one part of B.                             */
+static void
+poly_parallel_part(Poly_Worker *worker,
+                   const poly_parallel_parts *parts,
+                   size_t index)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const size_t A_len = parts->A_len;
+    const size_t shift = index * parts->part_len;
+    const int * const B_coeffs = parts->B_coeffs + shift;
+    int * const P_coeffs = parts->P_coeffs + shift;
+    size_t k, len, head;
+    int *O_coeffs, *T_coeffs;
+
+    /*  The last part may be shorter than the others.                         */
+    len = parts->B_len - shift;
+
+    if (len > parts->part_len)
+        len = parts->part_len;
+
+    /*  Nothing overlaps the start of the first part.                         */
+    if (index == (size_t)0)
+    {
+        poly_parallel_product(
+            worker, P_coeffs, parts->A_coeffs, A_len,
+            B_coeffs, len, parts->budget
+        );
+
+        return;
+    }
+
+    head = A_len - (size_t)1;
+    O_coeffs = parts->O_coeffs + (index - (size_t)1) * head;
+    T_coeffs = Poly_Worker_Scratch(worker, A_len + len - (size_t)1);
+
+    if (!T_coeffs)
+    {
+        poly_parallel_scatter_naive(
+            P_coeffs, O_coeffs, parts->A_coeffs, A_len, B_coeffs, len
+        );
+
+        return;
+    }
+
+    poly_parallel_product(
+        worker, T_coeffs, parts->A_coeffs, A_len,
+        B_coeffs, len, parts->budget
+    );
+
+    /*  The first terms overlap the previous part and are kept aside. No      *
+     *  other part writes to the rest, which goes straight into P.            */
+    for (k = (size_t)0; k < head; ++k)
+        O_coeffs[k] = T_coeffs[k];
+
+    for (k = head; k < head + len; ++k)
+        P_coeffs[k] = T_coeffs[k];
+
+    Poly_Worker_Release(worker, T_coeffs);
+}
+/*  End of poly_parallel_part.                                                */
+
+static void
+poly_parallel_range_task(Poly_Worker *worker, void *data);
+
+/*  Computes the parts first, ..., first + count - 1 by halving the range.    */
+static void
+poly_parallel_range_parts(Poly_Worker *worker,
+                          const poly_parallel_parts *parts,
+                          size_t first,
+                          size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_parallel_range upper;
+    Poly_Task task;
+    size_t half;
+    size_t pending = (size_t)0;
+
+    if (count == (size_t)1)
+    {
+        poly_parallel_part(worker, parts, first);
+        return;
+    }
+
+    /*  Spawn the upper half of the range, and do the lower half here.        */
+    half = count >> 1;
+    upper.parts = parts;
+    upper.first = first + half;
+    upper.count = count - half;
+
+    task.func = poly_parallel_range_task;
+    task.data = &upper;
+
+    Poly_Worker_Spawn(worker, &task, &pending);
+    poly_parallel_range_parts(worker, parts, first, half);
+    Poly_Worker_Join(worker, &pending);
+}
+/*  End of poly_parallel_range_parts.                                         */
+
+/*  Task function for poly_parallel_range_parts.                              */
+static void
+poly_parallel_range_task(Poly_Worker *worker, void *data)
+{
+    /*  The range of parts to compute.                                        */
+    const poly_parallel_range * const range = data;
+
+    poly_parallel_range_parts(worker, range->parts, range->first, range->count);
+}
+/*  End of poly_parallel_range_task.                                          */
+
+/*  Computes P = A*B, A_len < B_len, by cutting B into parts.                 */
+static void
+poly_parallel_chunks(Poly_Worker *worker,
+                     int *P_coeffs,
+                     const int *A_coeffs, size_t A_len,
+                     const int *B_coeffs, size_t B_len,
+                     size_t budget)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_parallel_parts parts;
+    size_t k, chunks, count, head;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    /*  The length below which a part is not worth a task of its own.         */
+    const size_t grain = Poly_Get_Tunables()->parallel_grain;
+
+    /*  There is enough parallelism higher up the tree.                       */
+    if (budget <= one)
+    {
+        poly_parallel_leaf(
+            worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    /*  Aim for four parts per thread, each a whole number of chunks of       *
+     *  length A_len, and at least parallel_grain long.                       */
+    chunks = (B_len - one) / A_len + one;
+    count = (chunks < 4*budget ? chunks : 4*budget);
+    parts.part_len = A_len * ((chunks - one) / count + one);
+
+    if (parts.part_len < grain)
+        parts.part_len = A_len * ((grain - one) / A_len + one);
+
+    count = (B_len - one) / parts.part_len + one;
+    head = A_len - one;
+
+    if (count == one)
+    {
+        poly_parallel_leaf(
+            worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    parts.O_coeffs = Poly_Worker_Scratch(worker, (count - one) * head);
+
+    if (!parts.O_coeffs)
+    {
+        poly_parallel_leaf(
+            worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    parts.P_coeffs = P_coeffs;
+    parts.A_coeffs = A_coeffs;
+    parts.A_len = A_len;
+    parts.B_coeffs = B_coeffs;
+    parts.B_len = B_len;
+    parts.budget = (budget + count - one) / count;
+
+    poly_parallel_range_parts(worker, &parts, (size_t)0, count);
+
+    /*  Add in the terms of each product that overlap the previous one.       */
+    for (k = one; k < count; ++k)
+        Scaled_AddTo(
+            P_coeffs + k*parts.part_len,
+            parts.O_coeffs + (k - one)*head, head, 1
+        );
+
+    Poly_Worker_Release(worker, parts.O_coeffs);
+}
+/*  End of poly_parallel_chunks.                                              */
+
+/*  Computes P = A*B for operands in either order, splitting it into tasks.   */
+static void
+poly_parallel_product(Poly_Worker *worker,
+                      int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len,
+                      size_t budget)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const int *tmp_coeffs;
+    size_t tmp_len;
+
+    /*  The length at or below which products are not split.                  */
+    const size_t grain = Poly_Get_Tunables()->parallel_grain;
+
+    /*  The splits all expect the shorter operand first.                      */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    if (A_len < B_len)
+    {
+        poly_parallel_chunks(
+            worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len, budget
+        );
+
+        return;
+    }
+
+    if (A_len <= grain)
+    {
+        poly_parallel_leaf(
+            worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+        );
+
+        return;
+    }
+
+    switch (Poly_Select_Algorithm(A_len, B_len))
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            poly_parallel_karatsuba(
+                worker, P_coeffs, A_coeffs, B_coeffs, A_len, budget
+            );
+
+            break;
+
+        /*  The NTT does less work than Karatsuba, so a Karatsuba split of    *
+         *  its products is only used while the extra threads make up for     *
+         *  it. The sub-products then use the serial algorithms.              */
+        case POLY_ALGORITHM_NTT:
+            if (budget > (size_t)1)
+            {
+                poly_parallel_karatsuba(
+                    worker, P_coeffs, A_coeffs, B_coeffs, A_len, budget
+                );
+
+                break;
+            }
+
+            poly_parallel_leaf(
+                worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+            );
+
+            break;
+
+        default:
+            poly_parallel_leaf(
+                worker, P_coeffs, A_coeffs, A_len, B_coeffs, B_len
+            );
+
+            break;
+    }
+}
+/*  End of poly_parallel_product.                                             */
+
+/*  Function for computing P = A*B on a pool of threads.                      */
+void
+Poly_Multiply_Parallel(Poly_Pool *pool,
+                       int *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_parallel_args args;
+
+    /*  The number of worker threads available.                               */
+    const size_t threads = Poly_Pool_Threads(pool);
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    /*  With one thread, or a short product, tasks only add overhead.         */
+    if (threads < (size_t)2 ||
+        (A_len <= Poly_Get_Tunables()->parallel_grain &&
+         B_len <= Poly_Get_Tunables()->parallel_grain))
+    {
+        Poly_Multiply(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    args.P_coeffs = P_coeffs;
+    args.A_coeffs = A_coeffs;
+    args.A_len = A_len;
+    args.B_coeffs = B_coeffs;
+    args.B_len = B_len;
+    args.budget = threads;
+
+    /*  Record the product once, here, rather than each piece on its worker.  */
+    POLY_STATS_BEGIN(Poly_Select_Algorithm(A_len, B_len), A_len, B_len);
+    Poly_Pool_Run(pool, poly_parallel_task, &args);
+    POLY_STATS_END();
+}
+/*  End of Poly_Multiply_Parallel.                                            */
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials with 64-bit outputs.                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Wide                                                    *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B with the coefficients of P stored as long longs,     *
+ *      choosing the algorithm from the lengths.                              *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least A_len + B_len - 1   *
+ *          wide.                                                             *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the crossover point wide_ntt_cutoff.                     *
+ *      Naive_Product_Wide (polynomial_multiplication.h):                     *
+ *          Used if the shorter operand is at most wide_ntt_cutoff long.      *
+ *      NTT_Product_Wide (polynomial_multiplication.h):                       *
+ *          Used for longer operands.                                         *
+ *  Method:                                                                   *
+ *      Swap the operands so that A is the shorter one, and compare its       *
+ *      length with wide_ntt_cutoff. Karatsuba and Toom-3 are not offered,    *
+ *      since their evaluations grow the coefficients and the int kernels     *
+ *      they bottom out in would overflow first. The NTT is exact whenever    *
+ *      the output fits.                                                      *
+ *  Notes:                                                                    *
+ *      The operands may be given in either order. If either is empty then    *
+ *      nothing is written to P.                                              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing P = A*B with 64-bit outputs.                       */
+void
+Poly_Multiply_Wide(long long *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const int *tmp_coeffs;
+    size_t tmp_len;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0)
+        return;
+
+    if (A_len <= Poly_Get_Tunables()->wide_ntt_cutoff)
+        Naive_Product_Wide(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+    else
+        NTT_Product_Wide(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+}
+/*  End of Poly_Multiply_Wide.                                                */
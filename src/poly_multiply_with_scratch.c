@@ -0,0 +1,307 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials with the fastest available algorithm using     *
+ *      caller supplied scratch space.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_With_Scratch                                            *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B without allocating any memory, choosing the          *
+ *      algorithm from the lengths of A and B.                                *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Scratch_Size(A_len, B_len) wide.     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm.                                            *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the ratio at which lopsided products are sliced.         *
+ *      Naive_Product (polynomial_multiplication.h):                          *
+ *          Used for short operands.                                          *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *          Used for medium length operands.                                  *
+ *      NTT_Product_With_Scratch (polynomial_multiplication.h):               *
+ *          Used for very long operands.                                      *
+ *      Poly_Square_With_Scratch (polynomial_multiplication.h):               *
+ *          Used if A and B are the same array.                               *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Combines the slices of a lopsided NTT product, and adds the       *
+ *          shifted copies of a sparse product.                               *
+ *  Method:                                                                   *
+ *      Swap the operands so that A is the shorter one, and dispatch on the   *
+ *      result of Poly_Select_Algorithm. If A and B are the same array of the *
+ *      same length, the product is a square, and is passed on to the         *
+ *      squaring routines, which do less work.                                *
+ *                                                                            *
+ *      Before that, the non-zero coefficients of A, then of B, are counted,  *
+ *      stopping once there are too many. Skipping the zeros of an operand X  *
+ *      costs one shifted add of the other per non-zero term, while the       *
+ *      dense product costs about 2 X_len / sqrt(A_len) such adds, for all of *
+ *      the algorithms up to a million coefficients. Short adds that overlap  *
+ *      are slower, and for short A the break even is nearer X_len / 30. If X *
+ *      has at most X_len / sqrt(max(A_len, 1024)) terms, P is zeroed and     *
+ *      built from the shifted adds instead. Dense operands are only read     *
+ *      until the count is over. The constants are SPARSE_MIN_LENGTH and      *
+ *      SPARSE_ROOT_LENGTH.                                                   *
+ *                                                                            *
+ *      The cost of the NTT depends on the combined length, so if B is more   *
+ *      than unbalanced_ratio times longer than A it is split into slices of  *
+ *      length unbalanced_ratio * A_len. Each slice is transformed on its     *
+ *      own and the overlapping parts of consecutive products are added.      *
+ *  Notes:                                                                    *
+ *      The operands may be given in either order. If either is empty then    *
+ *      nothing is written to P. The tunables must not change between sizing  *
+ *      the scratch array and calling this function.                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Returns the largest r with r*r <= n, by Newton's method.                  */
+static size_t poly_multiply_isqrt(size_t n)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t r, s;
+
+    if (n < (size_t)2)
+        return n;
+
+    /*  The iterates decrease to the root from above, starting at ceil(n/2).  */
+    r = n;
+    s = (n >> 1) + (n & (size_t)1);
+
+    while (s < r)
+    {
+        r = s;
+        s = (r + n / r) >> 1;
+    }
+
+    return r;
+}
+/*  End of poly_multiply_isqrt.                                               */
+
+/*  Returns whether X has at most limit non-zero coefficients. They are       *
+ *  counted without branches, 256 at a time, so that dense operands are only  *
+ *  read until the count is over the limit.                                   */
+static int
+poly_multiply_is_sparse(const int *X_coeffs, size_t len, size_t limit)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k, block;
+    size_t count = (size_t)0;
+
+    for (n = (size_t)0; n < len; n += block)
+    {
+        block = (len - n < (size_t)256 ? len - n : (size_t)256);
+
+        for (k = (size_t)0; k < block; ++k)
+            count += (size_t)(X_coeffs[n + k] != 0);
+
+        if (count > limit)
+            return 0;
+    }
+
+    return 1;
+}
+/*  End of poly_multiply_is_sparse.                                           */
+
+/*  Computes P = X*Y by adding a shifted multiple of Y for each non-zero      *
+ *  coefficient of X.                                                         */
+static void
+poly_multiply_sparse(int *P_coeffs,
+                     const int *X_coeffs, size_t X_len,
+                     const int *Y_coeffs, size_t Y_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    for (n = (size_t)0; n < X_len + Y_len - (size_t)1; ++n)
+        P_coeffs[n] = 0;
+
+    for (n = (size_t)0; n < X_len; ++n)
+        if (X_coeffs[n] != 0)
+            Scaled_AddTo(P_coeffs + n, Y_coeffs, Y_len, X_coeffs[n]);
+}
+/*  End of poly_multiply_sparse.                                              */
+
+/*  Computes P = A*B with the NTT, slicing B if it is much longer than A.     */
+static void
+poly_ntt_sliced(int *P_coeffs,
+                const int *A_coeffs, size_t A_len,
+                const int *B_coeffs, size_t B_len,
+                int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, shift, slice, len;
+    int *T_coeffs, *rest;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t one = (size_t)1;
+
+    /*  The ratio at which B is split into several transforms.                */
+    const size_t ratio = Poly_Get_Tunables()->unbalanced_ratio;
+
+    /*  Equivalent to B_len > ratio*A_len, but without overflow.              */
+    if ((B_len - one) / ratio < A_len)
+    {
+        NTT_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    slice = ratio * A_len;
+
+    /*  The first slice of B is multiplied directly into P.                   */
+    NTT_Product_With_Scratch(P_coeffs, A_coeffs, A_len, B_coeffs, slice, work);
+
+    /*  Later slices overlap the previous product in A_len - 1 terms.         */
+    T_coeffs = work;
+    rest = work + (A_len + slice - one);
+
+    for (shift = slice; shift < B_len; shift += len)
+    {
+        len = (B_len - shift < slice ? B_len - shift : slice);
+
+        NTT_Product_With_Scratch(
+            T_coeffs, A_coeffs, A_len, B_coeffs + shift, len, rest
+        );
+
+        Scaled_AddTo(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+        for (k = A_len - one; k < A_len + len - one; ++k)
+            P_coeffs[shift + k] = T_coeffs[k];
+    }
+}
+/*  End of poly_ntt_sliced.                                                   */
+
+/*  Function for computing P = A*B with the fastest algorithm.                */
+void
+Poly_Multiply_With_Scratch(int *P_coeffs,
+                           const int *A_coeffs, size_t A_len,
+                           const int *B_coeffs, size_t B_len,
+                           int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const int *tmp_coeffs;
+    size_t tmp_len, root;
+    Poly_Algorithm algorithm;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0)
+        return;
+
+    /*  Operands that are mostly zeros are cheaper a term at a time.          */
+    if (A_len >= (size_t)SPARSE_MIN_LENGTH)
+    {
+        if (A_len < (size_t)SPARSE_ROOT_LENGTH)
+            root = poly_multiply_isqrt((size_t)SPARSE_ROOT_LENGTH);
+        else
+            root = poly_multiply_isqrt(A_len);
+
+        if (poly_multiply_is_sparse(A_coeffs, A_len, A_len / root))
+        {
+            POLY_STATS_BEGIN(POLY_ALGORITHM_SPARSE, A_len, B_len);
+            poly_multiply_sparse(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+            POLY_STATS_END();
+            return;
+        }
+
+        if (poly_multiply_is_sparse(B_coeffs, B_len, B_len / root))
+        {
+            POLY_STATS_BEGIN(POLY_ALGORITHM_SPARSE, A_len, B_len);
+            poly_multiply_sparse(P_coeffs, B_coeffs, B_len, A_coeffs, A_len);
+            POLY_STATS_END();
+            return;
+        }
+    }
+
+    /*  Squares are cheaper than general products.                            */
+    if (A_coeffs == B_coeffs && A_len == B_len)
+    {
+        Poly_Square_With_Scratch(P_coeffs, A_coeffs, A_len, work);
+        return;
+    }
+
+    algorithm = Poly_Select_Algorithm(A_len, B_len);
+    POLY_STATS_BEGIN(algorithm, A_len, B_len);
+
+    switch (algorithm)
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            Karatsuba_Product_With_Scratch(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+            );
+
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            poly_ntt_sliced(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work);
+            break;
+
+        default:
+            Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+            break;
+    }
+
+    POLY_STATS_END();
+}
+/*  End of Poly_Multiply_With_Scratch.                                        */
@@ -0,0 +1,199 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Hands large products and batches to an accelerator, such as a GPU,    *
+ *      registered at run time.                                               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Set_Offload                                                      *
+ *  Purpose:                                                                  *
+ *      Registers the backend that products may be offloaded to.              *
+ *  Arguments:                                                                *
+ *      offload (const Poly_Offload *):                                       *
+ *          The backend, which is copied, or NULL to remove the current one.  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Copy the backend into static storage.                                 *
+ *  Notes:                                                                    *
+ *      Not thread safe. Set it at start up, as with Poly_Set_Tunables.       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Get_Offload                                                      *
+ *  Purpose:                                                                  *
+ *      Returns the registered backend.                                       *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      offload (const Poly_Offload *):                                       *
+ *          The backend, or NULL if there is none.                            *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Return the static copy if one was set.                                *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Offload_Multiply                                                 *
+ *  Purpose:                                                                  *
+ *      Offers P = A*B to the backend.                                        *
+ *  Arguments:                                                                *
+ *      As Poly_Multiply.                                                     *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 if the backend computed the product, and -1 otherwise.          *
+ *  Called Functions:                                                         *
+ *      The multiply function of the backend.                                 *
+ *  Method:                                                                   *
+ *      Put the shorter operand first, and call the backend if it has a       *
+ *      multiply function and the shorter operand has at least min_length     *
+ *      coefficients.                                                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Offload_Batch, Poly_Offload_Batch_Strided                        *
+ *  Purpose:                                                                  *
+ *      Offer a batch of products to the backend.                             *
+ *  Arguments:                                                                *
+ *      As Poly_Multiply_Batch and Poly_Multiply_Batch_Strided, without the   *
+ *      pool.                                                                 *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 if the backend computed every product, and -1 otherwise.        *
+ *  Called Functions:                                                         *
+ *      The batch and batch_strided functions of the backend.                 *
+ *  Method:                                                                   *
+ *      Call the backend if it has the function and the batch has at least    *
+ *      min_batch products.                                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  The registered backend, and whether there is one.                         */
+static Poly_Offload poly_offload;
+static int poly_offload_set = 0;
+
+/*  Function for registering the backend for offloaded products.              */
+void Poly_Set_Offload(const Poly_Offload *offload)
+{
+    if (!offload)
+    {
+        poly_offload_set = 0;
+        return;
+    }
+
+    poly_offload = *offload;
+    poly_offload_set = 1;
+}
+/*  End of Poly_Set_Offload.                                                  */
+
+/*  Function for retrieving the backend for offloaded products.               */
+const Poly_Offload *Poly_Get_Offload(void)
+{
+    return poly_offload_set ? &poly_offload : NULL;
+}
+/*  End of Poly_Get_Offload.                                                  */
+
+/*  Function for offering a product to the backend.                           */
+int
+Poly_Offload_Multiply(int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len)
+{
+    if (!poly_offload_set || !poly_offload.multiply)
+        return -1;
+
+    /*  The backend is given the shorter operand first.                       */
+    if (A_len > B_len)
+        return Poly_Offload_Multiply(
+            P_coeffs, B_coeffs, B_len, A_coeffs, A_len
+        );
+
+    if (A_len == (size_t)0 || A_len < poly_offload.min_length)
+        return -1;
+
+    if (poly_offload.multiply(P_coeffs, A_coeffs, A_len,
+                              B_coeffs, B_len, poly_offload.data) != 0)
+        return -1;
+
+    return 0;
+}
+/*  End of Poly_Offload_Multiply.                                             */
+
+/*  Function for offering a batch of products to the backend.                 */
+int
+Poly_Offload_Batch(size_t count,
+                   int * const *P_coeffs,
+                   const int * const *A_coeffs, const size_t *A_len,
+                   const int * const *B_coeffs, const size_t *B_len)
+{
+    if (!poly_offload_set || !poly_offload.batch)
+        return -1;
+
+    if (count < poly_offload.min_batch)
+        return -1;
+
+    if (poly_offload.batch(count, P_coeffs, A_coeffs, A_len,
+                           B_coeffs, B_len, poly_offload.data) != 0)
+        return -1;
+
+    return 0;
+}
+/*  End of Poly_Offload_Batch.                                                */
+
+/*  Function for offering a batch of products at fixed strides to the         *
+ *  backend.                                                                  */
+int
+Poly_Offload_Batch_Strided(size_t count,
+                           int *P_coeffs, size_t P_stride,
+                           const int *A_coeffs, size_t A_len, size_t A_stride,
+                           const int *B_coeffs, size_t B_len, size_t B_stride)
+{
+    if (!poly_offload_set || !poly_offload.batch_strided)
+        return -1;
+
+    if (count < poly_offload.min_batch)
+        return -1;
+
+    if (poly_offload.batch_strided(count, P_coeffs, P_stride,
+                                   A_coeffs, A_len, A_stride,
+                                   B_coeffs, B_len, B_stride,
+                                   poly_offload.data) != 0)
+        return -1;
+
+    return 0;
+}
+/*  End of Poly_Offload_Batch_Strided.                                        */
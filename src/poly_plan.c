@@ -0,0 +1,837 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Products against a fixed polynomial B, with the work that depends     *
+ *      only on B done once, up front.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Prepare                                                          *
+ *  Purpose:                                                                  *
+ *      Builds a plan for computing A*B for many A of about the same length.  *
+ *  Arguments:                                                                *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the fixed polynomial.       *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      A_len (size_t):                                                       *
+ *          The expected length of the A polynomials. The plan is correct     *
+ *          for any length, but is built for the algorithm used at this one.  *
+ *  Output:                                                                   *
+ *      plan (Poly_Plan *):                                                   *
+ *          The new plan, or NULL on failure.                                 *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for A_len and B_len.                        *
+ *      NTT_Roots, NTT_Spectrum (polynomial_multiplication.h):                *
+ *          Used for the transforms of B.                                     *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the plan and its tables.                                 *
+ *  Method:                                                                   *
+ *      A copy of B is always kept. What else is stored depends on the        *
+ *      algorithm Poly_Multiply would use for A_len and B_len.                *
+ *                                                                            *
+ *      NTT:                                                                  *
+ *          The transforms of B modulo the three primes, and the roots of     *
+ *          unity. If B is sliced, as Poly_Multiply does when one operand is  *
+ *          more than unbalanced_ratio times longer, each slice has its own   *
+ *          transforms. A product then needs a forward transform of A and an  *
+ *          inverse for each prime, two transforms rather than three.         *
+ *      Karatsuba:                                                            *
+ *          B is cut into chunks of length n = min(A_len, B_len), and for     *
+ *          each chunk the sums B0 + B1 of every level of the recursion are   *
+ *          stored, so only the A side is summed per product.                 *
+ *      Naive:                                                                *
+ *          Only the copy of B. The naive kernels already read B with unit    *
+ *          stride, adding a scaled copy of it for each coefficient of A, so  *
+ *          there is nothing to gain from reversing it.                       *
+ *  Notes:                                                                    *
+ *      The karatsuba_cutoff and unbalanced_ratio tunables are read here, so  *
+ *      later changes to them do not affect the plan.                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Plan_Destroy                                                     *
+ *  Purpose:                                                                  *
+ *      Frees a plan.                                                         *
+ *  Arguments:                                                                *
+ *      plan (Poly_Plan *):                                                   *
+ *          The plan. NULL is ignored.                                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      free (stdlib.h):                                                      *
+ *          Frees the tables and the plan.                                    *
+ *  Method:                                                                   *
+ *      Free every table, then the plan itself.                               *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Plan_Scratch_Size                                                *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Multiply_Prepared_With_Scratch for an A of length A_len.         *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Plan *):                                             *
+ *          The plan.                                                         *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Scratch space for the chunks that are not prepared.               *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for products done without the tables.               *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Multiply_Prepared_With_Scratch.       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Prepared_With_Scratch                                   *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for the B of a plan, with caller supplied scratch.   *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Plan *):                                             *
+ *          The plan.                                                         *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Plan_Scratch_Size(plan, A_len) wide. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for A_len and B_len.                        *
+ *      NTT_Spectrum, NTT_Product_Spectra (polynomial_multiplication.h):      *
+ *          Used for the prepared NTT products.                               *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *          Used for chunks shorter than the prepared ones.                   *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Used when the plan has no tables for the algorithm chosen.        *
+ *  Method:                                                                   *
+ *      If Poly_Multiply would use the algorithm the plan was built for, A    *
+ *      is cut into pieces that fit the tables of the plan and each piece is  *
+ *      multiplied by each chunk or slice of B, adding the results into P.    *
+ *      For the NTT the pieces of A are as long as the transform allows, and  *
+ *      the transform of each piece is shared by all of the slices of B.      *
+ *      Otherwise the product is computed by Poly_Multiply_With_Scratch.      *
+ *  Notes:                                                                    *
+ *      The plan is not changed, so one plan may be used by several threads   *
+ *      at once, each with its own scratch space. If either operand is empty  *
+ *      then nothing is written to P.                                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_Prepared                                                *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for the B of a plan.                                 *
+ *  Arguments:                                                                *
+ *      plan (const Poly_Plan *):                                             *
+ *          The plan.                                                         *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Plan_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Multiply_Prepared_With_Scratch (polynomial_multiplication.h):    *
+ *          Computes the product with the allocated scratch.                  *
+ *      Poly_Multiply (polynomial_multiplication.h):                          *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_Multiply_Prepared_With_Scratch.                                  *
+ *  Notes:                                                                    *
+ *      For many products, allocate the scratch once and use                  *
+ *      Poly_Multiply_Prepared_With_Scratch instead.                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  The precomputed data for products against B.                              */
+struct Poly_Plan_Def {
+
+    /*  A copy of B.                                                          */
+    int *B_coeffs;
+    size_t B_len;
+
+    /*  For Karatsuba, the chunk length n, the cutoff used when the tables    *
+     *  were built, and the B_len / n tables of sums, tree_len ints each.     *
+     *  trees is NULL if the plan is not for Karatsuba.                       */
+    size_t chunk;
+    size_t cutoff;
+    size_t tree_len;
+    int *trees;
+
+    /*  For the NTT, the transform length, the length of the slices of B,     *
+     *  the roots of unity, and the transforms of each slice, 3 N apiece.     *
+     *  spectra is NULL if the plan is not for the NTT.                       */
+    size_t N;
+    size_t slice;
+    unsigned int *roots;
+    unsigned int *spectra;
+};
+
+/*  Number of ints of sums stored for a length n chunk of B.                  */
+static size_t poly_plan_tree_size(size_t n, size_t cutoff)
+{
+    /*  The lengths of the lower and upper halves of the split.               */
+    size_t h, l;
+
+    if (n <= cutoff)
+        return (size_t)0;
+
+    h = (n + (size_t)1) >> 1;
+    l = n - h;
+
+    /*  B0 + B1, then the tables for B0, B1, and B0 + B1.                     */
+    return h + (size_t)2*poly_plan_tree_size(h, cutoff) +
+           poly_plan_tree_size(l, cutoff);
+}
+/*  End of poly_plan_tree_size.                                               */
+
+/*  Stores the sums of every level of the Karatsuba recursion for B in T.     */
+static void
+poly_plan_tree(int *T, const int *B_coeffs, size_t n, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l, size_h;
+
+    if (n <= cutoff)
+        return;
+
+    h = (n + (size_t)1) >> 1;
+    l = n - h;
+    size_h = poly_plan_tree_size(h, cutoff);
+
+    /*  B1 may be one shorter than B0.                                        */
+    for (k = (size_t)0; k < l; ++k)
+        T[k] = B_coeffs[k] + B_coeffs[h + k];
+
+    if (l < h)
+        T[l] = B_coeffs[l];
+
+    poly_plan_tree(T + h, B_coeffs, h, cutoff);
+    poly_plan_tree(T + h + size_h, B_coeffs + h, l, cutoff);
+    poly_plan_tree(
+        T + h + size_h + poly_plan_tree_size(l, cutoff), T, h, cutoff
+    );
+}
+/*  End of poly_plan_tree.                                                    */
+
+/*  Number of ints of scratch space used by poly_plan_karatsuba.              */
+static size_t poly_plan_karatsuba_scratch(size_t n, size_t cutoff)
+{
+    /*  The length of the lower half of the split.                            */
+    size_t h;
+
+    if (n <= cutoff)
+        return (size_t)0;
+
+    h = (n + (size_t)1) >> 1;
+
+    /*  Storage for A0 + A1 and Z1, plus the recursive calls.                 */
+    return (size_t)3*h - (size_t)1 + poly_plan_karatsuba_scratch(h, cutoff);
+}
+/*  End of poly_plan_karatsuba_scratch.                                       */
+
+/*  Computes P = A*B for two polynomials of length n, as karatsuba_balanced   *
+ *  in karatsuba_product_with_scratch.c, with the sums for B read from T.     */
+static void
+poly_plan_karatsuba(int *P_coeffs,
+                    const int *A_coeffs,
+                    const int *B_coeffs,
+                    const int *T,
+                    size_t n,
+                    int *work,
+                    size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l, size_h, size_l;
+    int *A_sum, *Z1, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  B0 + B1 is the first part of the table.                               */
+    const int * const B_sum = T;
+
+    /*  Small products are faster with the naive method.                      */
+    if (n <= cutoff)
+    {
+        Naive_Product(P_coeffs, A_coeffs, n, B_coeffs, n);
+        return;
+    }
+
+    h = (n + one) >> 1;
+    l = n - h;
+    size_h = poly_plan_tree_size(h, cutoff);
+    size_l = poly_plan_tree_size(l, cutoff);
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_sum = work;
+    Z1 = A_sum + h;
+    rest = Z1 + (2*h - one);
+
+    /*  A0*B0 and A1*B1, with the coefficient between them zero.              */
+    poly_plan_karatsuba(
+        P_coeffs, A_coeffs, B_coeffs, T + h, h, rest, cutoff
+    );
+
+    poly_plan_karatsuba(
+        P_coeffs + 2*h, A_coeffs + h, B_coeffs + h,
+        T + h + size_h, l, rest, cutoff
+    );
+
+    P_coeffs[2*h - one] = 0;
+
+    /*  At the last level A0 + A1 is not stored, as in karatsuba_balanced.    */
+    if (h <= cutoff)
+    {
+        for (k = zero; k + one < 2*h; ++k)
+            Z1[k] = 0;
+
+        Naive_AddTo_Sum_Product(Z1, A_coeffs, A_coeffs + h, l, B_sum, h);
+
+        if (l < h)
+            Scaled_AddTo(Z1 + l, B_sum, h, A_coeffs[l]);
+    }
+
+    else
+    {
+        for (k = zero; k < l; ++k)
+            A_sum[k] = A_coeffs[k] + A_coeffs[h + k];
+
+        if (l < h)
+            A_sum[l] = A_coeffs[l];
+
+        poly_plan_karatsuba(
+            Z1, A_sum, B_sum, T + h + size_h + size_l, h, rest, cutoff
+        );
+    }
+
+    /*  The middle term is Z1 - A0*B0 - A1*B1, shifted by h.                  */
+    Scaled_AddTo(Z1, P_coeffs, 2*h - one, -1);
+    Scaled_AddTo(Z1, P_coeffs + 2*h, 2*l - one, -1);
+    Scaled_AddTo(P_coeffs + h, Z1, 2*h - one, 1);
+}
+/*  End of poly_plan_karatsuba.                                               */
+
+/*  Builds the Karatsuba tables of a plan. Returns 0 on success.              */
+static int poly_plan_prepare_karatsuba(Poly_Plan *plan, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, count;
+
+    plan->chunk = (A_len < plan->B_len ? A_len : plan->B_len);
+    plan->cutoff = Poly_Get_Tunables()->karatsuba_cutoff;
+    plan->tree_len = poly_plan_tree_size(plan->chunk, plan->cutoff);
+
+    /*  Only the full chunks of B are prepared.                               */
+    count = plan->B_len / plan->chunk;
+    plan->trees = malloc(sizeof(*plan->trees) * (count * plan->tree_len));
+
+    if (!plan->trees)
+        return -1;
+
+    for (k = (size_t)0; k < count; ++k)
+        poly_plan_tree(
+            plan->trees + k*plan->tree_len,
+            plan->B_coeffs + k*plan->chunk, plan->chunk, plan->cutoff
+        );
+
+    return 0;
+}
+/*  End of poly_plan_prepare_karatsuba.                                       */
+
+/*  Builds the NTT tables of a plan. Returns 0 on success.                    */
+static int poly_plan_prepare_ntt(Poly_Plan *plan, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, count, piece, len;
+
+    /*  The slices used by Poly_Multiply, in whichever operand is longer.     */
+    const size_t ratio = Poly_Get_Tunables()->unbalanced_ratio;
+    const size_t B_len = plan->B_len;
+
+    /*  Equivalent to B_len > ratio*A_len, but without overflow.              */
+    plan->slice = ((B_len - 1) / ratio < A_len ? B_len : ratio * A_len);
+    piece = ((A_len - 1) / ratio < B_len ? A_len : ratio * B_len);
+
+    plan->N = (size_t)2;
+
+    while (plan->N < piece + plan->slice - (size_t)1)
+        plan->N <<= 1;
+
+    /*  Such long products are done without the tables.                       */
+    if (plan->N > NTT_MAX_LENGTH)
+        return 0;
+
+    count = (B_len + plan->slice - (size_t)1) / plan->slice;
+    plan->roots = malloc(sizeof(*plan->roots) * ((size_t)3*plan->N / 2));
+    plan->spectra = malloc(sizeof(*plan->spectra) * (count*3*plan->N));
+
+    if (!plan->roots || !plan->spectra)
+        return -1;
+
+    NTT_Roots(plan->roots, plan->N);
+
+    for (k = (size_t)0; k < count; ++k)
+    {
+        len = B_len - k*plan->slice;
+
+        if (len > plan->slice)
+            len = plan->slice;
+
+        NTT_Spectrum(
+            plan->spectra + k*3*plan->N, plan->B_coeffs + k*plan->slice,
+            len, plan->N, plan->roots
+        );
+    }
+
+    return 0;
+}
+/*  End of poly_plan_prepare_ntt.                                             */
+
+/*  Function for building a plan for products against B.                      */
+Poly_Plan *Poly_Prepare(const int *B_coeffs, size_t B_len, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Plan *plan;
+    size_t n;
+    int status = 0;
+
+    plan = malloc(sizeof(*plan));
+
+    if (!plan)
+        return NULL;
+
+    plan->B_len = B_len;
+    plan->chunk = plan->cutoff = plan->tree_len = (size_t)0;
+    plan->N = plan->slice = (size_t)0;
+    plan->trees = NULL;
+    plan->roots = NULL;
+    plan->spectra = NULL;
+
+    /*  malloc(0) may return NULL, so allocate at least one int.              */
+    plan->B_coeffs = malloc(sizeof(*plan->B_coeffs) *
+                            (B_len ? B_len : (size_t)1));
+
+    if (!plan->B_coeffs)
+    {
+        free(plan);
+        return NULL;
+    }
+
+    for (n = (size_t)0; n < B_len; ++n)
+        plan->B_coeffs[n] = B_coeffs[n];
+
+    /*  Products with an empty polynomial need no tables.                     */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return plan;
+
+    switch (Poly_Select_Algorithm(A_len, B_len))
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            status = poly_plan_prepare_karatsuba(plan, A_len);
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            status = poly_plan_prepare_ntt(plan, A_len);
+            break;
+
+        default:
+            break;
+    }
+
+    if (status != 0)
+    {
+        Poly_Plan_Destroy(plan);
+        return NULL;
+    }
+
+    return plan;
+}
+/*  End of Poly_Prepare.                                                      */
+
+/*  Function for freeing a plan.                                              */
+void Poly_Plan_Destroy(Poly_Plan *plan)
+{
+    if (!plan)
+        return;
+
+    free(plan->B_coeffs);
+    free(plan->trees);
+    free(plan->roots);
+    free(plan->spectra);
+    free(plan);
+}
+/*  End of Poly_Plan_Destroy.                                                 */
+
+/*  Scratch space for one piece of A times one chunk of B, for Karatsuba.     */
+static size_t
+poly_plan_pair_scratch(const Poly_Plan *plan, size_t A_len, size_t B_len)
+{
+    if (A_len == plan->chunk && B_len == plan->chunk)
+        return poly_plan_karatsuba_scratch(plan->chunk, plan->cutoff);
+
+    if (A_len <= B_len)
+        return Karatsuba_Scratch_Size(A_len, B_len);
+
+    return Karatsuba_Scratch_Size(B_len, A_len);
+}
+/*  End of poly_plan_pair_scratch.                                            */
+
+/*  Function for computing the scratch space used with a plan.                */
+size_t Poly_Plan_Scratch_Size(const Poly_Plan *plan, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t piece, len, size, most, k, j;
+    size_t A_pieces[2], B_pieces[2];
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+    const size_t n = plan->chunk;
+    const size_t B_len = plan->B_len;
+
+    if (A_len == zero || B_len == zero)
+        return zero;
+
+    switch (Poly_Select_Algorithm(A_len, B_len))
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            if (!plan->trees)
+                break;
+
+            /*  The lengths the pieces of A and B may have, zero if absent.   */
+            A_pieces[0] = (A_len >= n ? n : zero);
+            A_pieces[1] = A_len % n;
+            B_pieces[0] = n;
+            B_pieces[1] = B_len % n;
+            most = zero;
+
+            for (k = zero; k < (size_t)2; ++k)
+            {
+                for (j = zero; j < (size_t)2; ++j)
+                {
+                    if (A_pieces[k] == zero || B_pieces[j] == zero)
+                        continue;
+
+                    size = poly_plan_pair_scratch(
+                        plan, A_pieces[k], B_pieces[j]
+                    );
+
+                    if (size > most)
+                        most = size;
+                }
+            }
+
+            /*  The product of one pair, followed by its scratch space.       */
+            return (size_t)2*n - one + most;
+
+        case POLY_ALGORITHM_NTT:
+            if (!plan->spectra)
+                break;
+
+            /*  The longest piece of A that fits the transforms.              */
+            piece = plan->N - plan->slice + one;
+
+            if (piece > A_len)
+                piece = A_len;
+
+            len = piece + (B_len < plan->slice ? B_len : plan->slice) - one;
+
+            /*  The transform of the piece, one product, and its scratch.     */
+            return (size_t)3*plan->N + len + (size_t)3*len + plan->N;
+
+        default:
+            break;
+    }
+
+    return Poly_Scratch_Size(A_len, B_len);
+}
+/*  End of Poly_Plan_Scratch_Size.                                            */
+
+/*  Adds the product T of length len into P at shift. P[0] to P[*top - 1] are *
+ *  written so far, and shift <= *top. The rest of T is copied.               */
+static void
+poly_plan_add(int *P_coeffs, size_t *top,
+              size_t shift, const int *T_coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+
+    /*  The part of T that overlaps what has been written already.            */
+    size_t overlap = *top - shift;
+
+    if (overlap > len)
+        overlap = len;
+
+    Scaled_AddTo(P_coeffs + shift, T_coeffs, overlap, 1);
+
+    for (k = overlap; k < len; ++k)
+        P_coeffs[shift + k] = T_coeffs[k];
+
+    if (shift + len > *top)
+        *top = shift + len;
+}
+/*  End of poly_plan_add.                                                     */
+
+/*  Computes P = A*B with the Karatsuba tables of the plan.                   */
+static void
+poly_plan_multiply_karatsuba(const Poly_Plan *plan, int *P_coeffs,
+                             const int *A_coeffs, size_t A_len, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t shift, A_piece, B_shift, B_piece, index;
+    size_t top = (size_t)0;
+    int *T_coeffs;
+
+    /*  The products after the first are computed in work, then added to P.   */
+    int * const rest = work + ((size_t)2*plan->chunk - (size_t)1);
+    const int * const B_coeffs = plan->B_coeffs;
+    const size_t B_len = plan->B_len;
+
+    for (shift = (size_t)0; shift < A_len; shift += A_piece)
+    {
+        A_piece = A_len - shift;
+
+        if (A_piece > plan->chunk)
+            A_piece = plan->chunk;
+
+        for (B_shift = index = (size_t)0; B_shift < B_len; ++index)
+        {
+            B_piece = B_len - B_shift;
+
+            if (B_piece > plan->chunk)
+                B_piece = plan->chunk;
+
+            /*  Nothing has been written past top, so a product starting      *
+             *  there can go straight into P, as the first one always does.   */
+            T_coeffs = (shift + B_shift == top ? P_coeffs + top : work);
+
+            if (A_piece == plan->chunk && B_piece == plan->chunk)
+                poly_plan_karatsuba(
+                    T_coeffs, A_coeffs + shift, B_coeffs + B_shift,
+                    plan->trees + index*plan->tree_len,
+                    plan->chunk, rest, plan->cutoff
+                );
+
+            /*  The short piece at the end of A or B is not prepared.         */
+            else if (A_piece <= B_piece)
+                Karatsuba_Product_With_Scratch(
+                    T_coeffs, A_coeffs + shift, A_piece,
+                    B_coeffs + B_shift, B_piece, rest
+                );
+            else
+                Karatsuba_Product_With_Scratch(
+                    T_coeffs, B_coeffs + B_shift, B_piece,
+                    A_coeffs + shift, A_piece, rest
+                );
+
+            if (T_coeffs == work)
+                poly_plan_add(
+                    P_coeffs, &top, shift + B_shift, T_coeffs,
+                    A_piece + B_piece - (size_t)1
+                );
+            else
+                top += A_piece + B_piece - (size_t)1;
+
+            B_shift += B_piece;
+        }
+    }
+}
+/*  End of poly_plan_multiply_karatsuba.                                      */
+
+/*  Computes P = A*B with the NTT tables of the plan.                         */
+static void
+poly_plan_multiply_ntt(const Poly_Plan *plan, int *P_coeffs,
+                       const int *A_coeffs, size_t A_len, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t shift, A_piece, B_shift, B_piece, len, index, most;
+    size_t top = (size_t)0;
+    int *T_coeffs, *T_work, *rest;
+
+    /*  The transform of the current piece of A comes first.                  */
+    unsigned int * const SA = (unsigned int *)work;
+    const size_t N = plan->N;
+    const size_t B_len = plan->B_len;
+
+    /*  The longest piece of A that fits the transforms.                      */
+    const size_t piece = N - plan->slice + (size_t)1;
+
+    most = (A_len < piece ? A_len : piece);
+    most += (B_len < plan->slice ? B_len : plan->slice) - (size_t)1;
+    T_work = work + (size_t)3*N;
+    rest = T_work + most;
+
+    for (shift = (size_t)0; shift < A_len; shift += A_piece)
+    {
+        A_piece = A_len - shift;
+
+        if (A_piece > piece)
+            A_piece = piece;
+
+        /*  One forward transform of A per piece, shared by every slice.      */
+        NTT_Spectrum(SA, A_coeffs + shift, A_piece, N, plan->roots);
+
+        for (B_shift = index = (size_t)0; B_shift < B_len; ++index)
+        {
+            B_piece = B_len - B_shift;
+
+            if (B_piece > plan->slice)
+                B_piece = plan->slice;
+
+            len = A_piece + B_piece - (size_t)1;
+
+            /*  As for Karatsuba, the first product is written straight to P. */
+            T_coeffs = (shift + B_shift == top ? P_coeffs + top : T_work);
+
+            NTT_Product_Spectra(
+                T_coeffs, len, SA, plan->spectra + index*3*N,
+                N, plan->roots, rest
+            );
+
+            if (T_coeffs == T_work)
+                poly_plan_add(P_coeffs, &top, shift + B_shift, T_coeffs, len);
+            else
+                top += len;
+
+            B_shift += B_piece;
+        }
+    }
+}
+/*  End of poly_plan_multiply_ntt.                                            */
+
+/*  Function for computing P = A*B with a plan and caller supplied scratch.   */
+void
+Poly_Multiply_Prepared_With_Scratch(const Poly_Plan *plan, int *P_coeffs,
+                                    const int *A_coeffs, size_t A_len,
+                                    int *work)
+{
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0 || plan->B_len == (size_t)0)
+        return;
+
+    switch (Poly_Select_Algorithm(A_len, plan->B_len))
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            if (!plan->trees)
+                break;
+
+            POLY_STATS_BEGIN(POLY_ALGORITHM_KARATSUBA, A_len, plan->B_len);
+
+            poly_plan_multiply_karatsuba(
+                plan, P_coeffs, A_coeffs, A_len, work
+            );
+
+            POLY_STATS_END();
+            return;
+
+        case POLY_ALGORITHM_NTT:
+            if (!plan->spectra)
+                break;
+
+            POLY_STATS_BEGIN(POLY_ALGORITHM_NTT, A_len, plan->B_len);
+            poly_plan_multiply_ntt(plan, P_coeffs, A_coeffs, A_len, work);
+            POLY_STATS_END();
+            return;
+
+        default:
+            break;
+    }
+
+    Poly_Multiply_With_Scratch(
+        P_coeffs, A_coeffs, A_len, plan->B_coeffs, plan->B_len, work
+    );
+}
+/*  End of Poly_Multiply_Prepared_With_Scratch.                               */
+
+/*  Function for computing P = A*B with a plan.                               */
+void
+Poly_Multiply_Prepared(const Poly_Plan *plan, int *P_coeffs,
+                       const int *A_coeffs, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *work;
+
+    /*  The amount of scratch space needed for this product.                  */
+    const size_t size = Poly_Plan_Scratch_Size(plan, A_len);
+
+    if (size == (size_t)0)
+    {
+        Poly_Multiply_Prepared_With_Scratch(
+            plan, P_coeffs, A_coeffs, A_len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the ordinary product.                   */
+    if (!work)
+    {
+        Poly_Multiply(
+            P_coeffs, A_coeffs, A_len, plan->B_coeffs, plan->B_len
+        );
+
+        return;
+    }
+
+    Poly_Multiply_Prepared_With_Scratch(
+        plan, P_coeffs, A_coeffs, A_len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Multiply_Prepared.                                            */
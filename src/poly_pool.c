@@ -0,0 +1,717 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      A reusable work-stealing pool of threads for the parallel products.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Pool_Create                                                      *
+ *  Purpose:                                                                  *
+ *      Starts the worker threads and allocates their scratch arenas.         *
+ *  Arguments:                                                                *
+ *      threads (size_t):                                                     *
+ *          The number of worker threads, or zero for one per processor.      *
+ *  Output:                                                                   *
+ *      pool (Poly_Pool *):                                                   *
+ *          The new pool, or NULL on failure.                                 *
+ *  Called Functions:                                                         *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the pool, the workers, and the arenas.                   *
+ *      pthread_create, pthread_join (pthread.h):                             *
+ *          Used for starting the threads.                                    *
+ *      sysconf (unistd.h):                                                   *
+ *          Used for counting the processors.                                 *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Gives the initial size of the arenas.                             *
+ *      Poly_Kernel_Init (polynomial_multiplication.h):                       *
+ *          Chooses the kernels before any worker can use them.               *
+ *  Method:                                                                   *
+ *      Each worker has a queue of tasks and an arena. The arena starts with  *
+ *      room for a product of length parallel_grain, and grows as needed.     *
+ *      The kernels are chosen first, so that the workers only ever read the  *
+ *      kernel pointers, and never race to set them.                          *
+ *  Notes:                                                                    *
+ *      Without POSIX threads no threads are started, and Poly_Pool_Run runs  *
+ *      the tasks on the calling thread.                                      *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Pool_Destroy                                                     *
+ *  Purpose:                                                                  *
+ *      Stops the worker threads and frees the pool.                          *
+ *  Arguments:                                                                *
+ *      pool (Poly_Pool *):                                                   *
+ *          The pool. NULL is ignored.                                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      pthread_join (pthread.h):                                             *
+ *          Waits for each worker to exit.                                    *
+ *      free (stdlib.h):                                                      *
+ *          Frees the arenas and the pool.                                    *
+ *  Method:                                                                   *
+ *      Set the stop flag, wake every worker, and join them.                  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Pool_Threads                                                     *
+ *  Purpose:                                                                  *
+ *      Returns the number of worker threads in the pool.                     *
+ *  Arguments:                                                                *
+ *      pool (const Poly_Pool *):                                             *
+ *          The pool. NULL has no threads.                                    *
+ *  Output:                                                                   *
+ *      threads (size_t):                                                     *
+ *          The number of threads.                                            *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Return the count stored at creation.                                  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Pool_Run                                                         *
+ *  Purpose:                                                                  *
+ *      Runs a function on a worker of the pool and waits for it.             *
+ *  Arguments:                                                                *
+ *      pool (Poly_Pool *):                                                   *
+ *          The pool.                                                         *
+ *      func (void (*)(Poly_Worker *, void *)):                               *
+ *          The function to run.                                              *
+ *      data (void *):                                                        *
+ *          The argument passed to func.                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      pthread_cond_wait (pthread.h):                                        *
+ *          Used for waiting for the task.                                    *
+ *  Method:                                                                   *
+ *      The task is placed in the queues round robin, at the end that is      *
+ *      stolen from, so that a busy worker does not delay it.                 *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Worker_Spawn                                                     *
+ *  Purpose:                                                                  *
+ *      Queues a task to be run by any of the workers.                        *
+ *  Arguments:                                                                *
+ *      worker (Poly_Worker *):                                               *
+ *          The worker running the calling task.                              *
+ *      task (Poly_Task *):                                                   *
+ *          The task, with func and data set. It must not be changed or freed *
+ *          until *pending has been joined.                                   *
+ *      pending (size_t *):                                                   *
+ *          The counter of unfinished tasks, incremented here.                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      pthread_cond_broadcast (pthread.h):                                   *
+ *          Wakes the idle workers.                                           *
+ *  Method:                                                                   *
+ *      Push the task onto the bottom of the queue of the worker.             *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Worker_Join                                                      *
+ *  Purpose:                                                                  *
+ *      Waits for the tasks counted by a pending counter.                     *
+ *  Arguments:                                                                *
+ *      worker (Poly_Worker *):                                               *
+ *          The worker running the calling task.                              *
+ *      pending (size_t *):                                                   *
+ *          The counter passed to Poly_Worker_Spawn.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      pthread_cond_wait (pthread.h):                                        *
+ *          Used once there is nothing left to run.                           *
+ *  Method:                                                                   *
+ *      Rather than block, the worker runs tasks while it waits. It takes the *
+ *      newest task from the bottom of its own queue, which is usually one of *
+ *      those being joined, and otherwise steals the oldest task from the top *
+ *      of another queue. Old tasks are near the root of the recursion, so a  *
+ *      thief takes the largest pieces of work, and few steals are needed.    *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Worker_Scratch                                                   *
+ *  Purpose:                                                                  *
+ *      Takes scratch space from the arena of a worker.                       *
+ *  Arguments:                                                                *
+ *      worker (Poly_Worker *):                                               *
+ *          The worker running the calling task.                              *
+ *      len (size_t):                                                         *
+ *          The number of ints needed.                                        *
+ *  Output:                                                                   *
+ *      scratch (int *):                                                      *
+ *          The scratch space, or NULL on failure.                            *
+ *  Called Functions:                                                         *
+ *      malloc (stdlib.h):                                                    *
+ *          Used if the arena is full.                                        *
+ *  Method:                                                                   *
+ *      The arena is a stack. If it is too small the block comes from malloc  *
+ *      instead, and the arena is enlarged once it is empty again. After the  *
+ *      first few products no memory is allocated.                            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Worker_Release                                                   *
+ *  Purpose:                                                                  *
+ *      Returns scratch space to the arena of a worker.                       *
+ *  Arguments:                                                                *
+ *      worker (Poly_Worker *):                                               *
+ *          The worker running the calling task.                              *
+ *      scratch (int *):                                                      *
+ *          A block returned by Poly_Worker_Scratch.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for blocks outside the arena, and for enlarging it.          *
+ *  Method:                                                                   *
+ *      Pop the stack back to the block, or free it if it was malloc'd.       *
+ *  Notes:                                                                    *
+ *      A worker only runs other tasks from Poly_Worker_Join, and those are   *
+ *      finished before the join returns. Blocks are therefore always         *
+ *      released in the reverse order they were taken.                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ *  4.) pthread.h:                                                            *
+ *          Header file providing the POSIX threads, if available.            *
+ *  5.) unistd.h:                                                             *
+ *          Header file providing sysconf, if available.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+#ifdef POLY_HAS_PTHREADS
+
+/*  pthread_create, pthread_mutex_t, and pthread_cond_t provided here.        */
+#include <pthread.h>
+
+/*  sysconf provided here.                                                    */
+#include <unistd.h>
+
+#endif
+/*  End of #ifdef POLY_HAS_PTHREADS.                                          */
+
+/*  The state of one worker thread.                                           */
+struct Poly_Worker_Def {
+
+    /*  The pool the worker belongs to.                                       */
+    Poly_Pool *pool;
+
+    /*  The position of the worker in the pool, used for choosing victims.    */
+    size_t index;
+
+    /*  The queue of tasks. The owner works at the bottom, thieves take from  *
+     *  the top. Both are NULL when the queue is empty.                       */
+    Poly_Task *top;
+    Poly_Task *bottom;
+
+    /*  The scratch arena, its size and the number of ints in use.            */
+    int *arena;
+    size_t arena_size;
+    size_t arena_used;
+
+    /*  The largest amount of scratch space asked for. The arena is enlarged  *
+     *  to this size once it is empty.                                        */
+    size_t arena_wanted;
+
+#ifdef POLY_HAS_PTHREADS
+    pthread_t thread;
+#endif
+};
+
+/*  The pool. The queues and pending counters are protected by one lock. The  *
+ *  tasks are coarse, so the lock is taken rarely compared to the work done.  */
+struct Poly_Pool_Def {
+
+    /*  The workers. There is always at least one, which runs the tasks on    *
+     *  the calling thread if no threads were started.                        */
+    Poly_Worker *workers;
+    size_t count;
+
+    /*  The number of threads started.                                        */
+    size_t threads;
+
+    /*  The queue that the next task from Poly_Pool_Run is placed in.         */
+    size_t next;
+
+    /*  Set by Poly_Pool_Destroy to make the workers exit.                    */
+    int stop;
+
+#ifdef POLY_HAS_PTHREADS
+
+    /*  Every change to a queue or to a pending counter is signalled with     *
+     *  the condition variable.                                               */
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+#endif
+};
+
+/*  Takes the lock of the pool, if threads are in use.                        */
+static void poly_pool_lock(Poly_Pool *pool)
+{
+#ifdef POLY_HAS_PTHREADS
+    if (pool->threads)
+        pthread_mutex_lock(&pool->lock);
+#else
+    (void)pool;
+#endif
+}
+/*  End of poly_pool_lock.                                                    */
+
+/*  Releases the lock of the pool.                                            */
+static void poly_pool_unlock(Poly_Pool *pool)
+{
+#ifdef POLY_HAS_PTHREADS
+    if (pool->threads)
+        pthread_mutex_unlock(&pool->lock);
+#else
+    (void)pool;
+#endif
+}
+/*  End of poly_pool_unlock.                                                  */
+
+/*  Wakes every thread waiting on the pool. The lock must be held.            */
+static void poly_pool_signal(Poly_Pool *pool)
+{
+#ifdef POLY_HAS_PTHREADS
+    if (pool->threads)
+        pthread_cond_broadcast(&pool->changed);
+#else
+    (void)pool;
+#endif
+}
+/*  End of poly_pool_signal.                                                  */
+
+/*  Waits for a change to the queues or counters. The lock must be held.      */
+static void poly_pool_wait(Poly_Pool *pool)
+{
+#ifdef POLY_HAS_PTHREADS
+    pthread_cond_wait(&pool->changed, &pool->lock);
+#else
+    (void)pool;
+#endif
+}
+/*  End of poly_pool_wait.                                                    */
+
+/*  Finds a task for the worker to run, or returns NULL. The lock must be     *
+ *  held. The newest task of the worker comes first, then the oldest task of  *
+ *  each other worker in turn.                                                */
+static Poly_Task *poly_pool_take(Poly_Worker *worker)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Pool * const pool = worker->pool;
+    Poly_Worker *victim;
+    Poly_Task *task;
+    size_t k;
+
+    task = worker->bottom;
+
+    if (task)
+    {
+        worker->bottom = task->prev;
+
+        if (worker->bottom)
+            worker->bottom->next = NULL;
+        else
+            worker->top = NULL;
+
+        return task;
+    }
+
+    for (k = (size_t)1; k < pool->count; ++k)
+    {
+        victim = pool->workers + (worker->index + k) % pool->count;
+        task = victim->top;
+
+        if (!task)
+            continue;
+
+        victim->top = task->next;
+
+        if (victim->top)
+            victim->top->prev = NULL;
+        else
+            victim->bottom = NULL;
+
+        return task;
+    }
+
+    return NULL;
+}
+/*  End of poly_pool_take.                                                    */
+
+/*  Runs a task taken from a queue and marks it as finished. The lock must be *
+ *  held, and it is released while the task runs.                             */
+static void poly_pool_execute(Poly_Worker *worker, Poly_Task *task)
+{
+    poly_pool_unlock(worker->pool);
+    task->func(worker, task->data);
+    poly_pool_lock(worker->pool);
+
+    --*task->pending;
+    poly_pool_signal(worker->pool);
+}
+/*  End of poly_pool_execute.                                                 */
+
+#ifdef POLY_HAS_PTHREADS
+
+/*  The main loop of a worker thread.                                         */
+static void *poly_pool_thread(void *data)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Worker * const worker = data;
+    Poly_Pool * const pool = worker->pool;
+    Poly_Task *task;
+
+    poly_pool_lock(pool);
+
+    while (!pool->stop)
+    {
+        task = poly_pool_take(worker);
+
+        if (task)
+            poly_pool_execute(worker, task);
+        else
+            poly_pool_wait(pool);
+    }
+
+    poly_pool_unlock(pool);
+    return NULL;
+}
+/*  End of poly_pool_thread.                                                  */
+
+#endif
+/*  End of #ifdef POLY_HAS_PTHREADS.                                          */
+
+/*  Stops and joins the first "started" threads, and frees the pool.          */
+static void poly_pool_free(Poly_Pool *pool, size_t started)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+
+#ifdef POLY_HAS_PTHREADS
+    if (pool->threads)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->stop = 1;
+        pthread_cond_broadcast(&pool->changed);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (k = (size_t)0; k < started; ++k)
+            pthread_join(pool->workers[k].thread, NULL);
+
+        pthread_cond_destroy(&pool->changed);
+        pthread_mutex_destroy(&pool->lock);
+    }
+#else
+    (void)started;
+#endif
+
+    for (k = (size_t)0; k < pool->count; ++k)
+        free(pool->workers[k].arena);
+
+    free(pool->workers);
+    free(pool);
+}
+/*  End of poly_pool_free.                                                    */
+
+/*  Function for creating a pool of worker threads.                           */
+Poly_Pool *Poly_Pool_Create(size_t threads)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Pool *pool;
+    Poly_Worker *worker;
+    size_t k, arena_size;
+
+    /*  The arenas start with room for the largest product done by a single   *
+     *  worker without being split, which has length parallel_grain.          */
+    const size_t grain = Poly_Get_Tunables()->parallel_grain;
+
+#ifdef POLY_HAS_PTHREADS
+#ifdef _SC_NPROCESSORS_ONLN
+    long online;
+
+    if (threads == (size_t)0)
+    {
+        online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0L ? (size_t)online : (size_t)1);
+    }
+#else
+    if (threads == (size_t)0)
+        threads = (size_t)1;
+#endif
+#else
+
+    /*  Without threads every task runs on the calling thread.                */
+    threads = (size_t)0;
+#endif
+
+    /*  The workers read the kernel pointers, so they are set before any      *
+     *  thread is started.                                                    */
+    Poly_Kernel_Init();
+
+    pool = malloc(sizeof(*pool));
+
+    if (!pool)
+        return NULL;
+
+    pool->count = (threads ? threads : (size_t)1);
+    pool->threads = (size_t)0;
+    pool->next = (size_t)0;
+    pool->stop = 0;
+    pool->workers = malloc(sizeof(*pool->workers) * pool->count);
+
+    if (!pool->workers)
+    {
+        free(pool);
+        return NULL;
+    }
+
+    arena_size = Poly_Scratch_Size(grain, grain);
+
+    for (k = (size_t)0; k < pool->count; ++k)
+    {
+        worker = pool->workers + k;
+        worker->pool = pool;
+        worker->index = k;
+        worker->top = NULL;
+        worker->bottom = NULL;
+        worker->arena = malloc(sizeof(*worker->arena) * arena_size);
+        worker->arena_size = (worker->arena ? arena_size : (size_t)0);
+        worker->arena_used = (size_t)0;
+        worker->arena_wanted = (size_t)0;
+    }
+
+#ifdef POLY_HAS_PTHREADS
+    if (pthread_mutex_init(&pool->lock, NULL) != 0)
+    {
+        poly_pool_free(pool, (size_t)0);
+        return NULL;
+    }
+
+    if (pthread_cond_init(&pool->changed, NULL) != 0)
+    {
+        pthread_mutex_destroy(&pool->lock);
+        poly_pool_free(pool, (size_t)0);
+        return NULL;
+    }
+
+    /*  Set before the threads start, since they read it to decide whether    *
+     *  to lock. On failure the threads already started are stopped.          */
+    pool->threads = threads;
+
+    for (k = (size_t)0; k < threads; ++k)
+    {
+        worker = pool->workers + k;
+
+        if (pthread_create(&worker->thread, NULL, poly_pool_thread, worker))
+        {
+            poly_pool_free(pool, k);
+            return NULL;
+        }
+    }
+#endif
+
+    return pool;
+}
+/*  End of Poly_Pool_Create.                                                  */
+
+/*  Function for stopping the workers and freeing a pool.                     */
+void Poly_Pool_Destroy(Poly_Pool *pool)
+{
+    if (!pool)
+        return;
+
+    poly_pool_free(pool, pool->threads);
+}
+/*  End of Poly_Pool_Destroy.                                                 */
+
+/*  Function for getting the number of worker threads.                        */
+size_t Poly_Pool_Threads(const Poly_Pool *pool)
+{
+    if (!pool)
+        return (size_t)0;
+
+    return pool->threads;
+}
+/*  End of Poly_Pool_Threads.                                                 */
+
+/*  Function for running a task on the pool and waiting for it.               */
+void
+Poly_Pool_Run(Poly_Pool *pool,
+              void (*func)(Poly_Worker *worker, void *data),
+              void *data)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Worker *worker;
+    Poly_Task task;
+    size_t pending = (size_t)1;
+
+    /*  Without threads the caller does the work itself.                      */
+    if (!pool->threads)
+    {
+        func(pool->workers, data);
+        return;
+    }
+
+    task.func = func;
+    task.data = data;
+    task.pending = &pending;
+    task.prev = NULL;
+
+    poly_pool_lock(pool);
+
+    /*  Place the task at the top of the next queue.                          */
+    worker = pool->workers + pool->next;
+    pool->next = (pool->next + (size_t)1) % pool->count;
+
+    task.next = worker->top;
+
+    if (worker->top)
+        worker->top->prev = &task;
+    else
+        worker->bottom = &task;
+
+    worker->top = &task;
+    poly_pool_signal(pool);
+
+    while (pending)
+        poly_pool_wait(pool);
+
+    poly_pool_unlock(pool);
+}
+/*  End of Poly_Pool_Run.                                                     */
+
+/*  Function for queueing a task from within a task.                          */
+void Poly_Worker_Spawn(Poly_Worker *worker, Poly_Task *task, size_t *pending)
+{
+    /*  The pool containing the worker.                                       */
+    Poly_Pool * const pool = worker->pool;
+
+    task->pending = pending;
+    task->next = NULL;
+
+    poly_pool_lock(pool);
+
+    /*  Push the task onto the bottom of the queue.                           */
+    task->prev = worker->bottom;
+
+    if (worker->bottom)
+        worker->bottom->next = task;
+    else
+        worker->top = task;
+
+    worker->bottom = task;
+    ++*pending;
+
+    poly_pool_signal(pool);
+    poly_pool_unlock(pool);
+}
+/*  End of Poly_Worker_Spawn.                                                 */
+
+/*  Function for waiting on spawned tasks.                                    */
+void Poly_Worker_Join(Poly_Worker *worker, size_t *pending)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Pool * const pool = worker->pool;
+    Poly_Task *task;
+
+    poly_pool_lock(pool);
+
+    while (*pending)
+    {
+        task = poly_pool_take(worker);
+
+        /*  The tasks being joined are running on other workers, and there is *
+         *  nothing to steal. Wait for one of them to finish, or to spawn.    */
+        if (task)
+            poly_pool_execute(worker, task);
+        else
+            poly_pool_wait(pool);
+    }
+
+    poly_pool_unlock(pool);
+}
+/*  End of Poly_Worker_Join.                                                  */
+
+/*  Function for taking scratch space from the arena of a worker.             */
+int *Poly_Worker_Scratch(Poly_Worker *worker, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *scratch;
+
+    /*  Every block is non-empty, so that distinct blocks have distinct       *
+     *  addresses.                                                            */
+    if (len == (size_t)0)
+        len = (size_t)1;
+
+    if (worker->arena_size - worker->arena_used >= len)
+    {
+        scratch = worker->arena + worker->arena_used;
+        worker->arena_used += len;
+        return scratch;
+    }
+
+    /*  Remember how much was needed, so the arena can be enlarged later.     */
+    if (worker->arena_used + len > worker->arena_wanted)
+        worker->arena_wanted = worker->arena_used + len;
+
+    return malloc(sizeof(*scratch) * len);
+}
+/*  End of Poly_Worker_Scratch.                                               */
+
+/*  Function for returning scratch space to the arena of a worker.            */
+void Poly_Worker_Release(Poly_Worker *worker, int *scratch)
+{
+    /*  The arena, which is NULL if it could not be allocated.                */
+    int * const arena = worker->arena;
+
+    if (!scratch)
+        return;
+
+    if (arena && arena <= scratch && scratch < arena + worker->arena_size)
+        worker->arena_used = (size_t)(scratch - arena);
+    else
+        free(scratch);
+
+    /*  Once nothing is in use the arena can be replaced with a larger one.   */
+    if (worker->arena_used || worker->arena_wanted <= worker->arena_size)
+        return;
+
+    free(worker->arena);
+    worker->arena = malloc(sizeof(*worker->arena) * worker->arena_wanted);
+    worker->arena_size = (worker->arena ? worker->arena_wanted : (size_t)0);
+}
+/*  End of Poly_Worker_Release.                                               */
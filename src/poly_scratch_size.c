@@ -0,0 +1,116 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the scratch space needed by Poly_Multiply_With_Scratch.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Scratch_Size                                                     *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed to multiply        *
+ *      polynomials of the given lengths with Poly_Multiply_With_Scratch.     *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints needed.                                        *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Determines which algorithm will be used.                          *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the ratio at which lopsided products are sliced.         *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Scratch needed by the Karatsuba method.                           *
+ *      NTT_Scratch_Size (polynomial_multiplication.h):                       *
+ *          Scratch needed by the number theoretic transform.                 *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Multiply_With_Scratch. If the longer  *
+ *      operand is sliced, room is needed for one slice of the product plus   *
+ *      the scratch for the transform of one slice.                           *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. The naive method needs no   *
+ *      scratch space, so zero may be returned.                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing the scratch space used by Poly_Multiply.           */
+size_t Poly_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t a, b, ratio, slice;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len <= B_len)
+    {
+        a = A_len;
+        b = B_len;
+    }
+    else
+    {
+        a = B_len;
+        b = A_len;
+    }
+
+    if (a == zero)
+        return zero;
+
+    switch (Poly_Select_Algorithm(a, b))
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            return Karatsuba_Scratch_Size(a, b);
+
+        case POLY_ALGORITHM_NTT:
+            ratio = Poly_Get_Tunables()->unbalanced_ratio;
+
+            /*  Equivalent to b > ratio*a, but without overflow.              */
+            if ((b - one) / ratio < a)
+                return NTT_Scratch_Size(a, b);
+
+            slice = ratio * a;
+            return (a + slice - one) + NTT_Scratch_Size(a, slice);
+
+        default:
+            return zero;
+    }
+}
+/*  End of Poly_Scratch_Size.                                                 */
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Chooses the multiplication algorithm used by Poly_Multiply.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Select_Algorithm                                                 *
+ *  Purpose:                                                                  *
+ *      Returns the fastest algorithm for multiplying polynomials of the      *
+ *      given lengths, according to the current tunables.                     *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      algorithm (Poly_Algorithm):                                           *
+ *          The algorithm to use.                                             *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the crossover points.                                    *
+ *  Method:                                                                   *
+ *      Karatsuba and the naive method both split the longer operand into     *
+ *      chunks the length of the shorter one, so their cost is governed by    *
+ *      the shorter length. Compare it against the crossover points.          *
+ *      Lopsided products that reach the NTT are sliced by Poly_Multiply, see *
+ *      the unbalanced_ratio tunable.                                         *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. Toom-3 is not offered.      *
+ *      Toom3_Product is exact modulo 2^32 only because it recurses in 64-bit *
+ *      arithmetic, which makes it slower than Karatsuba up to the NTT        *
+ *      cutoff.                                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for choosing the multiplication algorithm.                       */
+Poly_Algorithm Poly_Select_Algorithm(size_t A_len, size_t B_len)
+{
+    /*  The crossover points currently in use.                                */
+    const Poly_Tunables * const tunables = Poly_Get_Tunables();
+
+    /*  The cost is governed by the shorter of the two operands.              */
+    const size_t len = (A_len < B_len ? A_len : B_len);
+
+    if (len <= tunables->karatsuba_cutoff)
+        return POLY_ALGORITHM_NAIVE;
+
+    /*  Toom-3 works in 64-bit arithmetic to stay exact, and is slower than   *
+     *  the int Karatsuba method at every length below the NTT cutoff.        */
+    if (len <= tunables->ntt_cutoff)
+        return POLY_ALGORITHM_KARATSUBA;
+
+    return POLY_ALGORITHM_NTT;
+}
+/*  End of Poly_Select_Algorithm.                                             */
@@ -0,0 +1,286 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Power series inverses, I = 1/B mod x^len, by Newton iteration on the  *
+ *      fast products.                                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Series_Inverse_Scratch_Size                                      *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Series_Inverse_With_Scratch.                                     *
+ *  Arguments:                                                                *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the inverse to compute.             *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Middle_Scratch_Size (polynomial_multiplication.h):               *
+ *          Scratch space for the middle product of each step.                *
+ *      Poly_Short_Scratch_Size (polynomial_multiplication.h):                *
+ *          Scratch space for the short product of each step.                 *
+ *  Method:                                                                   *
+ *      Room for B padded to len, one middle product, and the largest         *
+ *      scratch space needed by any step of the iteration.                    *
+ *  Notes:                                                                    *
+ *      Zero is returned if the naive method is used.                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Series_Inverse_With_Scratch                                      *
+ *  Purpose:                                                                  *
+ *      Computes I = 1/B mod x^len with caller supplied scratch space.        *
+ *  Arguments:                                                                *
+ *      I_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the inverse to compute.             *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Series_Inverse_Scratch_Size(B_len,   *
+ *          len) wide.                                                        *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if B[0] is not 1 or -1.                          *
+ *  Called Functions:                                                         *
+ *      Naive_Series_Inverse (polynomial_multiplication.h):                   *
+ *          Used for short inverses, and for the start of the iteration.      *
+ *      Poly_Middle_Product_With_Scratch (polynomial_multiplication.h):       *
+ *          Computes the error of each approximation.                         *
+ *      Poly_Short_Product_With_Scratch (polynomial_multiplication.h):        *
+ *          Computes the correction of each approximation.                    *
+ *  Method:                                                                   *
+ *      If I is 1/B mod x^k, then B*I = 1 + x^k E mod x^n, and                *
+ *                                                                            *
+ *          I - x^k (I*E mod x^(n - k))                                       *
+ *                                                                            *
+ *      is 1/B mod x^n for any n <= 2k. The lengths are halved, rounding up,  *
+ *      until they are at most POLY_INVERSE_CUTOFF, where the naive method    *
+ *      starts the iteration, and each step then doubles back up, so no       *
+ *      step computes more than is needed. E is the coefficients k through    *
+ *      n - 1 of (B mod x^n)*I, a middle product of n by k, and I*E is a      *
+ *      short product, so each step costs about two products of length n/2    *
+ *      and the whole inverse a small multiple of one product of length len.  *
+ *  Notes:                                                                    *
+ *      As for Naive_Series_Inverse, B[0] must be 1 or -1, and len may be     *
+ *      more or less than B_len. The tunables must not change between sizing  *
+ *      the scratch array and calling this function.                          *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Series_Inverse                                                   *
+ *  Purpose:                                                                  *
+ *      Computes I = 1/B mod x^len with the fastest available algorithm.      *
+ *  Arguments:                                                                *
+ *      I_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the inverse to compute.             *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if B[0] is not 1 or -1.                          *
+ *  Called Functions:                                                         *
+ *      Poly_Series_Inverse_Scratch_Size (polynomial_multiplication.h):       *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Series_Inverse_With_Scratch (polynomial_multiplication.h):       *
+ *          Computes the inverse with the allocated scratch.                  *
+ *      Naive_Series_Inverse (polynomial_multiplication.h):                   *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call                                   *
+ *      Poly_Series_Inverse_With_Scratch.                                     *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Largest scratch space needed by the products of the steps up to len.      */
+static size_t poly_series_inverse_scratch(size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, size, most;
+
+    if (len <= (size_t)POLY_INVERSE_CUTOFF)
+        return (size_t)0;
+
+    k = (len + (size_t)1) >> 1;
+    most = poly_series_inverse_scratch(k);
+
+    size = Poly_Middle_Scratch_Size(len, k);
+
+    if (size > most)
+        most = size;
+
+    size = Poly_Short_Scratch_Size(k, len - k, len - k);
+
+    if (size > most)
+        most = size;
+
+    return most;
+}
+/*  End of poly_series_inverse_scratch.                                       */
+
+/*  Computes I = 1/B mod x^len, with B padded with zeros to len terms. E has  *
+ *  room for len ints, and work for poly_series_inverse_scratch(len).         */
+static void
+poly_series_inverse(int *I_coeffs, const int *B_coeffs, size_t len,
+                    int *E_coeffs, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, n;
+
+    /*  Short inverses, and the start of the iteration, are done naively.     */
+    if (len <= (size_t)POLY_INVERSE_CUTOFF)
+    {
+        Naive_Series_Inverse(I_coeffs, B_coeffs, len, len);
+        return;
+    }
+
+    /*  The first k terms, to which the step below doubles the precision.     */
+    k = (len + (size_t)1) >> 1;
+    poly_series_inverse(I_coeffs, B_coeffs, k, E_coeffs, work);
+
+    /*  The terms x^(k - 1) through x^(len - 1) of B*I. The first is zero.    */
+    Poly_Middle_Product_With_Scratch(
+        E_coeffs, B_coeffs, len, I_coeffs, k, work
+    );
+
+    /*  The next terms of the inverse, -I*E mod x^(len - k).                  */
+    Poly_Short_Product_With_Scratch(
+        I_coeffs + k, I_coeffs, k, E_coeffs + 1, len - k, len - k, work
+    );
+
+    for (n = k; n < len; ++n)
+        I_coeffs[n] = -I_coeffs[n];
+}
+/*  End of poly_series_inverse.                                               */
+
+/*  Function for computing the scratch space used by series inverses.         */
+size_t Poly_Series_Inverse_Scratch_Size(size_t B_len, size_t len)
+{
+    /*  Only the length of the inverse matters, B is always padded to len.    */
+    (void)B_len;
+
+    if (len <= (size_t)POLY_INVERSE_CUTOFF)
+        return (size_t)0;
+
+    /*  The padded copy of B, the error term, and the products' scratch.      */
+    return (size_t)2*len + poly_series_inverse_scratch(len);
+}
+/*  End of Poly_Series_Inverse_Scratch_Size.                                  */
+
+/*  Function for computing I = 1/B mod x^len with caller scratch.             */
+int
+Poly_Series_Inverse_With_Scratch(int *I_coeffs,
+                                 const int *B_coeffs, size_t B_len,
+                                 size_t len, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *B_pad, *E_coeffs;
+    size_t n, top;
+
+    if (B_len == (size_t)0 || (B_coeffs[0] != 1 && B_coeffs[0] != -1))
+        return -1;
+
+    if (len <= (size_t)POLY_INVERSE_CUTOFF)
+        return Naive_Series_Inverse(I_coeffs, B_coeffs, B_len, len);
+
+    /*  The middle products read B out to len terms.                          */
+    B_pad = work;
+    E_coeffs = B_pad + len;
+    top = (B_len < len ? B_len : len);
+
+    for (n = (size_t)0; n < top; ++n)
+        B_pad[n] = B_coeffs[n];
+
+    for (; n < len; ++n)
+        B_pad[n] = 0;
+
+    poly_series_inverse(I_coeffs, B_pad, len, E_coeffs, E_coeffs + len);
+    return 0;
+}
+/*  End of Poly_Series_Inverse_With_Scratch.                                  */
+
+/*  Function for computing I = 1/B mod x^len with the fastest method.         */
+int
+Poly_Series_Inverse(int *I_coeffs,
+                    const int *B_coeffs, size_t B_len,
+                    size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int *work;
+    int status;
+
+    /*  The amount of scratch space needed by the iteration.                  */
+    const size_t size = Poly_Series_Inverse_Scratch_Size(B_len, len);
+
+    /*  The naive method needs no scratch space.                              */
+    if (size == (size_t)0)
+        return Naive_Series_Inverse(I_coeffs, B_coeffs, B_len, len);
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+        return Naive_Series_Inverse(I_coeffs, B_coeffs, B_len, len);
+
+    status = Poly_Series_Inverse_With_Scratch(
+        I_coeffs, B_coeffs, B_len, len, work
+    );
+
+    free(work);
+    return status;
+}
+/*  End of Poly_Series_Inverse.                                               */
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Short products, P = A*B mod x^len, with the fastest available         *
+ *      algorithm.                                                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Short_Scratch_Size                                               *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space needed by                 *
+ *      Poly_Short_Product_With_Scratch.                                      *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Poly_Scratch_Size (polynomial_multiplication.h):                      *
+ *          Scratch space for a whole product.                                *
+ *      Karatsuba_Short_Scratch_Size (polynomial_multiplication.h):           *
+ *          Scratch space for the Karatsuba short product.                    *
+ *  Method:                                                                   *
+ *      Mirror the choices made by Poly_Short_Product_With_Scratch.           *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. Zero may be returned.       *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Short_Product_With_Scratch                                       *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod x^len, choosing the algorithm from the lengths,  *
+ *      with caller supplied scratch space.                                   *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Short_Scratch_Size(A_len, B_len,     *
+ *          len) wide.                                                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for the given lengths.                      *
+ *      Naive_Short_Product (polynomial_multiplication.h):                    *
+ *          Used for short operands.                                          *
+ *      Karatsuba_Short_Product_With_Scratch (polynomial_multiplication.h):   *
+ *          Used for operands in the Karatsuba and Toom-3 ranges.             *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *          Used for whole products, and for longer operands.                 *
+ *  Method:                                                                   *
+ *      Only the first len coefficients of A and B can contribute, so both    *
+ *      are cut down to len first. If the product is then no longer than      *
+ *      len, it is computed whole. Otherwise, for short operands the naive    *
+ *      loops skip the products past x^(len - 1), and in the Karatsuba and    *
+ *      Toom-3 ranges the short product of Mulders does the same for the      *
+ *      recursion. For the NTT, a truncated product saves little over the     *
+ *      whole one, which is formed in the scratch space and then cut to len.  *
+ *  Notes:                                                                    *
+ *      The discarded top of the product may overflow, as it does in Newton   *
+ *      iteration, without affecting P.                                       *
+ *      If len is more than A_len + B_len - 1, the rest of P is zero. The     *
+ *      tunables must not change between sizing the scratch array and         *
+ *      calling this function.                                                *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Short_Product                                                    *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B mod x^len with the fastest available algorithm.      *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least len wide.                 *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      len (size_t):                                                         *
+ *          The number of coefficients of the product to compute.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Short_Scratch_Size (polynomial_multiplication.h):                *
+ *          Computes the amount of scratch space needed.                      *
+ *      Poly_Short_Product_With_Scratch (polynomial_multiplication.h):        *
+ *          Computes the product with the allocated scratch.                  *
+ *      Naive_Short_Product (polynomial_multiplication.h):                    *
+ *          Used if the scratch space can not be allocated.                   *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the scratch space.                                      *
+ *      free (stdlib.h):                                                      *
+ *          Releases the scratch space.                                       *
+ *  Method:                                                                   *
+ *      Allocate the scratch space and call Poly_Short_Product_With_Scratch.  *
+ *  Notes:                                                                    *
+ *      If the scratch space can not be allocated, this falls back to the     *
+ *      naive method. The output is still correct, but slower.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Function for computing the scratch space used by short products.          */
+size_t Poly_Short_Scratch_Size(size_t A_len, size_t B_len, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t a, b;
+
+    /*  Coefficients past x^(len - 1) never contribute.                       */
+    a = (A_len < len ? A_len : len);
+    b = (B_len < len ? B_len : len);
+
+    if (a == (size_t)0 || b == (size_t)0)
+        return (size_t)0;
+
+    /*  A product that is not cut off is computed whole, in place.            */
+    if (a + b - (size_t)1 <= len)
+        return Poly_Scratch_Size(a, b);
+
+    switch (Poly_Select_Algorithm(a < b ? a : b, a < b ? b : a))
+    {
+        case POLY_ALGORITHM_NAIVE:
+            return (size_t)0;
+
+        /*  The whole product, and the scratch for computing it.              */
+        case POLY_ALGORITHM_NTT:
+            return a + b - (size_t)1 + Poly_Scratch_Size(a, b);
+
+        default:
+            return Karatsuba_Short_Scratch_Size(a, b, len);
+    }
+}
+/*  End of Poly_Short_Scratch_Size.                                           */
+
+/*  Function for computing P = A*B mod x^len with caller scratch.             */
+void
+Poly_Short_Product_With_Scratch(int *P_coeffs,
+                                const int *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len,
+                                size_t len, int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, top;
+
+    /*  Coefficients past x^(len - 1) never contribute.                       */
+    if (A_len > len)
+        A_len = len;
+
+    if (B_len > len)
+        B_len = len;
+
+    /*  The product with an empty polynomial is zero.                         */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+    {
+        for (n = (size_t)0; n < len; ++n)
+            P_coeffs[n] = 0;
+
+        return;
+    }
+
+    top = A_len + B_len - (size_t)1;
+
+    /*  If nothing is cut off, this is an ordinary product.                   */
+    if (top <= len)
+    {
+        Poly_Multiply_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        for (n = top; n < len; ++n)
+            P_coeffs[n] = 0;
+
+        return;
+    }
+
+    switch (Poly_Select_Algorithm(A_len < B_len ? A_len : B_len,
+                                  A_len < B_len ? B_len : A_len))
+    {
+        case POLY_ALGORITHM_NAIVE:
+            Naive_Short_Product(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len
+            );
+
+            break;
+
+        /*  The NTT forms the whole product and keeps the bottom.             */
+        case POLY_ALGORITHM_NTT:
+            Poly_Multiply_With_Scratch(
+                work, A_coeffs, A_len, B_coeffs, B_len, work + top
+            );
+
+            for (n = (size_t)0; n < len; ++n)
+                P_coeffs[n] = work[n];
+
+            break;
+
+        /*  Karatsuba and Toom-3 use the short product of Mulders.            */
+        default:
+            Karatsuba_Short_Product_With_Scratch(
+                P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, work
+            );
+
+            break;
+    }
+}
+/*  End of Poly_Short_Product_With_Scratch.                                   */
+
+/*  Function for computing P = A*B mod x^len with the fastest method.         */
+void
+Poly_Short_Product(int *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len,
+                   size_t len)
+{
+    /*  The amount of scratch space needed by the chosen algorithm.           */
+    const size_t size = Poly_Short_Scratch_Size(A_len, B_len, len);
+    int *work;
+
+    /*  The naive method, and empty products, need no scratch space.          */
+    if (size == (size_t)0)
+    {
+        Poly_Short_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, NULL
+        );
+
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        Naive_Short_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len);
+        return;
+    }
+
+    Poly_Short_Product_With_Scratch(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, len, work
+    );
+
+    free(work);
+}
+/*  End of Poly_Short_Product.                                                */
@@ -0,0 +1,117 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Squares a polynomial with the fastest available algorithm using       *
+ *      caller supplied scratch space.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Square_With_Scratch                                              *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A without allocating any memory, choosing the          *
+ *      algorithm from the length of A.                                       *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Poly_Scratch_Size(len, len) wide.         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Get_Tunables (polynomial_multiplication.h):                      *
+ *          Provides the length at which squares switch from the naive        *
+ *          method to Karatsuba.                                              *
+ *      Poly_Select_Algorithm (polynomial_multiplication.h):                  *
+ *          Chooses the algorithm for longer operands.                        *
+ *      Naive_Square (polynomial_multiplication.h):                           *
+ *          Used for short operands.                                          *
+ *      Karatsuba_Square_With_Scratch (polynomial_multiplication.h):          *
+ *          Used for medium length operands.                                  *
+ *      NTT_Square_With_Scratch (polynomial_multiplication.h):                *
+ *          Used for very long operands.                                      *
+ *  Method:                                                                   *
+ *      At or below the karatsuba_square_cutoff tunable use Naive_Square.     *
+ *      Otherwise dispatch on the result of Poly_Select_Algorithm, calling    *
+ *      the squaring version of the chosen algorithm.                         *
+ *  Notes:                                                                    *
+ *      Poly_Multiply_With_Scratch calls this when both operands are the same *
+ *      array. If len is zero nothing is written to P. The tunables must not  *
+ *      change between sizing the scratch array and calling this function.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing P = A*A with the fastest algorithm.                */
+void
+Poly_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                         int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Algorithm algorithm;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    /*  The naive square stays faster than Karatsuba for longer.              */
+    if (len <= Poly_Get_Tunables()->karatsuba_square_cutoff)
+        algorithm = POLY_ALGORITHM_NAIVE;
+    else
+        algorithm = Poly_Select_Algorithm(len, len);
+
+    POLY_STATS_BEGIN(algorithm, len, len);
+
+    switch (algorithm)
+    {
+        case POLY_ALGORITHM_NAIVE:
+            Naive_Square(P_coeffs, A_coeffs, len);
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            NTT_Square_With_Scratch(P_coeffs, A_coeffs, len, work);
+            break;
+
+        default:
+            Karatsuba_Square_With_Scratch(P_coeffs, A_coeffs, len, work);
+            break;
+    }
+
+    POLY_STATS_END();
+}
+/*  End of Poly_Square_With_Scratch.                                          */
@@ -0,0 +1,595 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Optional counters and trace hooks for the products, enabled by        *
+ *      building the library with POLY_INSTRUMENT defined.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Cycles                                                           *
+ *  Purpose:                                                                  *
+ *      Reads the cycle counter of the CPU.                                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      cycles (unsigned long long):                                          *
+ *          The current value of the counter.                                 *
+ *  Called Functions:                                                         *
+ *      clock (time.h):                                                       *
+ *          Used if the CPU has no counter this can read.                     *
+ *  Method:                                                                   *
+ *      rdtsc on x86 and the virtual counter cntvct_el0 on ARM64, both with   *
+ *      GCC or clang. Otherwise the processor time from clock.                *
+ *  Notes:                                                                    *
+ *      The unit depends on the CPU. The time stamp counter of x86 ticks at a *
+ *      fixed rate near the nominal clock speed, and cntvct_el0 usually much  *
+ *      slower. Only differences on the same machine are meaningful.          *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_Snapshot                                                   *
+ *  Purpose:                                                                  *
+ *      Sums the counters of every thread.                                    *
+ *  Arguments:                                                                *
+ *      stats (Poly_Stats *):                                                 *
+ *          The totals are written here.                                      *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, and -1 if the library was built without             *
+ *          POLY_INSTRUMENT, in which case stats is zeroed.                   *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Each thread has its own counters, which are only ever written by that *
+ *      thread, on a list that is only ever pushed onto. The list is walked   *
+ *      and the counters added up without taking a lock. Counts, cycles, and  *
+ *      the histograms are summed, and the depths take the maximum.           *
+ *  Notes:                                                                    *
+ *      The counts of threads that have exited are kept. With POSIX threads   *
+ *      their counters are retired by a pthread key destructor, and the next  *
+ *      new thread takes them over and adds to them, so the list only grows   *
+ *      to the most threads counting at once. Products still running are not  *
+ *      counted, and counters read while being written may be a call behind.  *
+ *      Subtract two snapshots to measure an interval.                        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Set_Trace_Hooks                                                  *
+ *  Purpose:                                                                  *
+ *      Sets the functions called as each product begins and ends.            *
+ *  Arguments:                                                                *
+ *      begin (Poly_Trace_Hook):                                              *
+ *          Called before each product, or NULL.                              *
+ *      end (Poly_Trace_Hook):                                                *
+ *          Called after each product, or NULL.                               *
+ *      data (void *):                                                        *
+ *          Passed to both hooks.                                             *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, and -1 if the library was built without             *
+ *          POLY_INSTRUMENT, in which case the hooks are never called.        *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Store the hooks in file-scope variables.                              *
+ *  Notes:                                                                    *
+ *      The hooks are called on the thread computing the product, and must    *
+ *      be safe to call from several at once. As with Poly_Set_Tunables,      *
+ *      this is not thread safe, and should be done at start up.              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_Begin                                                      *
+ *  Purpose:                                                                  *
+ *      Marks the start of a product on the calling thread.                   *
+ *  Arguments:                                                                *
+ *      algorithm (Poly_Algorithm):                                           *
+ *          The algorithm selected for the product.                           *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Cycles (polynomial_multiplication.h):                            *
+ *          Reads the start time.                                             *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the counters of a thread on its first product.          *
+ *      pthread_once, pthread_key_create, pthread_setspecific (pthread.h):    *
+ *          Retire the counters of the thread when it exits.                  *
+ *  Method:                                                                   *
+ *      Call the begin hook and note the lengths, the recursion depth, and    *
+ *      the cycle counter. A new thread takes over retired counters if there  *
+ *      are any, claiming them with a compare and swap, and otherwise pushes  *
+ *      new ones onto the list with a compare and swap.                       *
+ *  Notes:                                                                    *
+ *      Only called through POLY_STATS_BEGIN. A product started while another *
+ *      is running on the same thread, or within POLY_STATS_NEST, is part of  *
+ *      the outer one, and is not counted or traced on its own. If the        *
+ *      counters can not be allocated, the products of the thread are not     *
+ *      counted.                                                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_End                                                        *
+ *  Purpose:                                                                  *
+ *      Marks the end of the product started by Poly_Stats_Begin.             *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Cycles (polynomial_multiplication.h):                            *
+ *          Reads the end time.                                               *
+ *  Method:                                                                   *
+ *      Add the call, its output coefficients, and its cycles to the counters *
+ *      of the algorithm, count the shorter length in its histogram, and call *
+ *      the end hook.                                                         *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_Descend                                                    *
+ *  Purpose:                                                                  *
+ *      Marks the start of a level of a recursion.                            *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Increment the depth of the thread, and raise the deepest level seen   *
+ *      by the current product if needed.                                     *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_Ascend                                                     *
+ *  Purpose:                                                                  *
+ *      Marks the end of a level of a recursion.                              *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Decrement the depth of the thread.                                    *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stats_Nest, Poly_Stats_Unnest                                    *
+ *  Purpose:                                                                  *
+ *      Mark the start and end of work, on the calling thread, for a product  *
+ *      recorded on another thread.                                           *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Increment and decrement a count of the thread. While it is nonzero,   *
+ *      Poly_Stats_Begin and Poly_Stats_End do nothing.                       *
+ *  Notes:                                                                    *
+ *      Only called through POLY_STATS_NEST and POLY_STATS_UNNEST, by the     *
+ *      tasks of Poly_Multiply_Parallel, whose product is recorded once on    *
+ *      the calling thread. The recursion depth of the product only counts    *
+ *      the levels entered on that thread.                                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc.                                     *
+ *  4.) time.h:                                                               *
+ *          Header file providing clock.                                      *
+ *  5.) pthread.h:                                                            *
+ *          Header file providing pthread_key_create, with POSIX threads.     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc found here.                                                        */
+#include <stdlib.h>
+
+/*  clock provided here.                                                      */
+#include <time.h>
+
+#if defined(POLY_INSTRUMENT) && defined(__GNUC__) && defined(POLY_HAS_PTHREADS)
+
+/*  pthread_key_create and pthread_once provided here.                        */
+#include <pthread.h>
+
+/*  The counters of a thread are handed on once it exits.                     */
+#define POLY_STATS_RETIRE
+
+#endif
+
+/*  Function for reading the cycle counter.                                   */
+unsigned long long Poly_Cycles(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return (unsigned long long)__builtin_ia32_rdtsc();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    unsigned long long cycles;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (cycles));
+    return cycles;
+#else
+    return (unsigned long long)clock();
+#endif
+}
+/*  End of Poly_Cycles.                                                       */
+
+#ifdef POLY_INSTRUMENT
+
+/*  GCC and clang provide thread local variables and atomic compare and swap. *
+ *  Without them every thread shares one set of counters, which is only       *
+ *  correct if products are computed on one thread at a time.                 */
+#if defined(__GNUC__)
+#define POLY_STATS_THREAD __thread
+#define POLY_STATS_CAS(ptr, old, new)                                          \
+    __sync_bool_compare_and_swap(ptr, old, new)
+#define POLY_STATS_SYNC() __sync_synchronize()
+#else
+#define POLY_STATS_THREAD
+#define POLY_STATS_CAS(ptr, old, new) (*(ptr) = (new), 1)
+#define POLY_STATS_SYNC() ((void)0)
+#endif
+
+/*  The counters and the product in progress for one thread.                  */
+typedef struct poly_stats_thread_def {
+
+    /*  The totals for the products of this thread.                           */
+    Poly_Stats stats;
+
+    /*  The number of levels of recursion currently entered.                  */
+    size_t depth;
+
+    /*  The number of products started and not yet ended. Only the outermost  *
+     *  is recorded, in event, along with its start time and starting depth.  */
+    size_t running;
+    Poly_Trace_Event event;
+    unsigned long long start;
+    size_t base;
+
+    /*  Set once the thread has exited, after which another thread may take   *
+     *  the counters over, adding to them.                                    */
+    volatile int retired;
+
+    /*  The next thread on the list.                                          */
+    struct poly_stats_thread_def *next;
+} poly_stats_thread;
+
+/*  The counters of every thread that has computed a product.                 */
+static poly_stats_thread * volatile poly_stats_list = NULL;
+
+/*  The counters of the calling thread, allocated on its first product.       */
+static POLY_STATS_THREAD poly_stats_thread *poly_stats_self = NULL;
+
+/*  The number of POLY_STATS_NEST not yet undone on the calling thread. The   *
+ *  products it computes meanwhile are part of one recorded elsewhere.        */
+static POLY_STATS_THREAD size_t poly_stats_nested = (size_t)0;
+
+#ifdef POLY_STATS_RETIRE
+
+/*  The key whose destructor retires the counters of an exiting thread.       */
+static pthread_key_t poly_stats_key;
+static pthread_once_t poly_stats_once = PTHREAD_ONCE_INIT;
+static int poly_stats_key_ok = 0;
+
+/*  Marks the counters of an exiting thread as free to be taken over. The     *
+ *  counts are kept, and the thread that takes them adds to them.             */
+static void poly_stats_retire(void *data)
+{
+    poly_stats_thread * const self = data;
+
+    /*  Make the last counts visible before another thread may own them.      */
+    POLY_STATS_SYNC();
+    self->retired = 1;
+}
+/*  End of poly_stats_retire.                                                 */
+
+/*  Creates the key, once.                                                    */
+static void poly_stats_key_init(void)
+{
+    poly_stats_key_ok =
+        (pthread_key_create(&poly_stats_key, poly_stats_retire) == 0);
+}
+/*  End of poly_stats_key_init.                                               */
+
+#endif
+/*  End of #ifdef POLY_STATS_RETIRE.                                          */
+
+/*  The trace hooks, see Poly_Set_Trace_Hooks.                                */
+static Poly_Trace_Hook poly_stats_begin_hook = NULL;
+static Poly_Trace_Hook poly_stats_end_hook = NULL;
+static void *poly_stats_hook_data = NULL;
+
+/*  Returns the counters of the calling thread, or NULL if malloc fails.      */
+static poly_stats_thread *poly_stats_get_self(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_stats_thread *self = poly_stats_self;
+    poly_stats_thread *head;
+    unsigned char *bytes;
+    size_t k;
+
+    if (self)
+        return self;
+
+    /*  Take over the counters of a thread that has exited, if there is one.  */
+    for (self = poly_stats_list; self; self = self->next)
+        if (self->retired && POLY_STATS_CAS(&self->retired, 1, 0))
+            break;
+
+    if (self)
+    {
+        self->depth = (size_t)0;
+        self->running = (size_t)0;
+    }
+
+    else
+    {
+        self = malloc(sizeof(*self));
+
+        if (!self)
+            return NULL;
+
+        /*  Zero everything, including the histograms.                        */
+        bytes = (unsigned char *)self;
+
+        for (k = (size_t)0; k < sizeof(*self); ++k)
+            bytes[k] = 0U;
+
+        /*  Push onto the list. Only the owner writes the counters from now   *
+         *  on.                                                               */
+        do {
+            head = poly_stats_list;
+            self->next = head;
+        } while (!POLY_STATS_CAS(&poly_stats_list, head, self));
+    }
+
+#ifdef POLY_STATS_RETIRE
+    /*  Retire the counters when the thread exits, so that they are reused.   */
+    pthread_once(&poly_stats_once, poly_stats_key_init);
+
+    if (poly_stats_key_ok)
+        pthread_setspecific(poly_stats_key, self);
+#endif
+
+    poly_stats_self = self;
+    return self;
+}
+/*  End of poly_stats_get_self.                                               */
+
+/*  Returns the histogram bucket of a length, floor(log2(len)).               */
+static size_t poly_stats_bucket(size_t len)
+{
+    size_t bucket = (size_t)0;
+
+    while (len > (size_t)1 && bucket + (size_t)1 < (size_t)POLY_STATS_BUCKETS)
+    {
+        len >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+/*  End of poly_stats_bucket.                                                 */
+
+/*  Function for summing the counters of every thread.                        */
+int Poly_Stats_Snapshot(Poly_Stats *stats)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const poly_stats_thread *thread;
+    const Poly_Algorithm_Stats *in;
+    Poly_Algorithm_Stats *out;
+    size_t n, k;
+
+    for (n = (size_t)0; n < (size_t)POLY_ALGORITHM_COUNT; ++n)
+    {
+        out = &stats->algorithm[n];
+        out->calls = out->coeffs = out->cycles = 0ULL;
+        out->max_depth = (size_t)0;
+
+        for (k = (size_t)0; k < (size_t)POLY_STATS_BUCKETS; ++k)
+            out->lengths[k] = 0ULL;
+    }
+
+    /*  Make sure the counters of threads on the list are visible.            */
+    POLY_STATS_SYNC();
+
+    for (thread = poly_stats_list; thread; thread = thread->next)
+    {
+        for (n = (size_t)0; n < (size_t)POLY_ALGORITHM_COUNT; ++n)
+        {
+            in = &thread->stats.algorithm[n];
+            out = &stats->algorithm[n];
+
+            out->calls += in->calls;
+            out->coeffs += in->coeffs;
+            out->cycles += in->cycles;
+
+            if (in->max_depth > out->max_depth)
+                out->max_depth = in->max_depth;
+
+            for (k = (size_t)0; k < (size_t)POLY_STATS_BUCKETS; ++k)
+                out->lengths[k] += in->lengths[k];
+        }
+    }
+
+    return 0;
+}
+/*  End of Poly_Stats_Snapshot.                                               */
+
+/*  Function for setting the trace hooks.                                     */
+int Poly_Set_Trace_Hooks(Poly_Trace_Hook begin, Poly_Trace_Hook end,
+                         void *data)
+{
+    poly_stats_begin_hook = begin;
+    poly_stats_end_hook = end;
+    poly_stats_hook_data = data;
+    return 0;
+}
+/*  End of Poly_Set_Trace_Hooks.                                              */
+
+/*  Function for marking the start of a product.                              */
+void Poly_Stats_Begin(Poly_Algorithm algorithm, size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    poly_stats_thread *self;
+
+    /*  The product is part of one recorded on another thread.                */
+    if (poly_stats_nested)
+        return;
+
+    self = poly_stats_get_self();
+
+    if (!self)
+        return;
+
+    /*  Products computed inside another are part of the outer one.           */
+    if (self->running++ != (size_t)0)
+        return;
+
+    self->event.algorithm = algorithm;
+    self->event.A_len = A_len;
+    self->event.B_len = B_len;
+    self->event.depth = (size_t)0;
+    self->event.cycles = 0ULL;
+    self->base = self->depth;
+
+    if (poly_stats_begin_hook)
+        poly_stats_begin_hook(&self->event, poly_stats_hook_data);
+
+    /*  Read the counter last, so the time of the hook is not included.       */
+    self->start = Poly_Cycles();
+}
+/*  End of Poly_Stats_Begin.                                                  */
+
+/*  Function for marking the end of a product.                                */
+void Poly_Stats_End(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const unsigned long long end = Poly_Cycles();
+    poly_stats_thread * const self = poly_stats_self;
+    Poly_Algorithm_Stats *stats;
+    size_t len;
+
+    /*  The begin may have failed to allocate the counters, or been nested.   */
+    if (poly_stats_nested || !self || self->running == (size_t)0)
+        return;
+
+    if (--self->running != (size_t)0)
+        return;
+
+    self->event.cycles = end - self->start;
+    stats = &self->stats.algorithm[self->event.algorithm];
+    len = (self->event.A_len < self->event.B_len ?
+           self->event.A_len : self->event.B_len);
+
+    stats->calls += 1ULL;
+    stats->coeffs += self->event.A_len + self->event.B_len - (size_t)1;
+    stats->cycles += self->event.cycles;
+    stats->lengths[poly_stats_bucket(len)] += 1ULL;
+
+    if (self->event.depth > stats->max_depth)
+        stats->max_depth = self->event.depth;
+
+    if (poly_stats_end_hook)
+        poly_stats_end_hook(&self->event, poly_stats_hook_data);
+}
+/*  End of Poly_Stats_End.                                                    */
+
+/*  Function for marking the start of a level of recursion.                   */
+void Poly_Stats_Descend(void)
+{
+    poly_stats_thread * const self = poly_stats_self;
+
+    if (!self)
+        return;
+
+    ++self->depth;
+
+    if (self->running && self->depth - self->base > self->event.depth)
+        self->event.depth = self->depth - self->base;
+}
+/*  End of Poly_Stats_Descend.                                                */
+
+/*  Function for marking the end of a level of recursion.                     */
+void Poly_Stats_Ascend(void)
+{
+    poly_stats_thread * const self = poly_stats_self;
+
+    if (self && self->depth)
+        --self->depth;
+}
+/*  End of Poly_Stats_Ascend.                                                 */
+
+/*  Function for marking the start of work for a product recorded elsewhere.  */
+void Poly_Stats_Nest(void)
+{
+    ++poly_stats_nested;
+}
+/*  End of Poly_Stats_Nest.                                                   */
+
+/*  Function for marking the end of work for a product recorded elsewhere.    */
+void Poly_Stats_Unnest(void)
+{
+    if (poly_stats_nested)
+        --poly_stats_nested;
+}
+/*  End of Poly_Stats_Unnest.                                                 */
+
+#else
+/*  Else for #ifdef POLY_INSTRUMENT.                                          */
+
+/*  Without POLY_INSTRUMENT nothing is recorded.                              */
+int Poly_Stats_Snapshot(Poly_Stats *stats)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned char * const bytes = (unsigned char *)stats;
+    size_t k;
+
+    for (k = (size_t)0; k < sizeof(*stats); ++k)
+        bytes[k] = 0U;
+
+    return -1;
+}
+/*  End of Poly_Stats_Snapshot.                                               */
+
+/*  Without POLY_INSTRUMENT the hooks are never called.                       */
+int Poly_Set_Trace_Hooks(Poly_Trace_Hook begin, Poly_Trace_Hook end,
+                         void *data)
+{
+    (void)begin;
+    (void)end;
+    (void)data;
+    return -1;
+}
+/*  End of Poly_Set_Trace_Hooks.                                              */
+
+#endif
+/*  End of #ifdef POLY_INSTRUMENT.                                            */
@@ -0,0 +1,373 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Products of a fixed polynomial B with a polynomial A that arrives a   *
+ *      piece at a time, by overlap-add.                                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stream_Create                                                    *
+ *  Purpose:                                                                  *
+ *      Starts a stream computing A*B for the given B.                        *
+ *  Arguments:                                                                *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of the fixed polynomial.       *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      block (size_t):                                                       *
+ *          The number of coefficients of A multiplied at a time. If zero,    *
+ *          the larger of B_len and POLY_STREAM_BLOCK is used.                *
+ *  Output:                                                                   *
+ *      stream (Poly_Stream *):                                               *
+ *          The new stream, or NULL on failure.                               *
+ *  Called Functions:                                                         *
+ *      Poly_Prepare (polynomial_multiplication.h):                           *
+ *          Builds the plan for the products of the blocks with B.            *
+ *      Poly_Plan_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Computes the scratch space needed for one block.                  *
+ *      Poly_Plan_Destroy (polynomial_multiplication.h):                      *
+ *          Frees the plan if the buffers can not be allocated.               *
+ *      malloc, free (stdlib.h):                                              *
+ *          Used for the stream and its buffers.                              *
+ *  Method:                                                                   *
+ *      Prepare B for products with A of length block, and allocate one       *
+ *      buffer for a block of A, the product of a block with B, the B_len - 1 *
+ *      coefficients still owed by the previous block, and the scratch space. *
+ *      The stream holds O(B_len + block) ints, however long A is.            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stream_Destroy                                                   *
+ *  Purpose:                                                                  *
+ *      Frees a stream.                                                       *
+ *  Arguments:                                                                *
+ *      stream (Poly_Stream *):                                               *
+ *          The stream. NULL is ignored.                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Poly_Plan_Destroy (polynomial_multiplication.h):                      *
+ *          Frees the plan.                                                   *
+ *      free (stdlib.h):                                                      *
+ *          Frees the buffers and the stream.                                 *
+ *  Method:                                                                   *
+ *      Free the plan and the buffer, then the stream itself.                 *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stream_Push                                                      *
+ *  Purpose:                                                                  *
+ *      Adds the next coefficients of A to a stream, and writes out the       *
+ *      coefficients of A*B that are now known.                               *
+ *  Arguments:                                                                *
+ *      stream (Poly_Stream *):                                               *
+ *          The stream.                                                       *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + block - 1 wide,   *
+ *          for the finished coefficients of the product.                     *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the next coefficients of A.                          *
+ *      A_len (size_t):                                                       *
+ *          The number of coefficients given.                                 *
+ *  Output:                                                                   *
+ *      count (size_t):                                                       *
+ *          The number of coefficients written to P, a multiple of block.     *
+ *  Called Functions:                                                         *
+ *      Poly_Multiply_Prepared_With_Scratch (polynomial_multiplication.h):    *
+ *          Multiplies each full block of A by B.                             *
+ *  Method:                                                                   *
+ *      Overlap-add. The coefficients of A are gathered into blocks. Each     *
+ *      full block is multiplied by B, giving block + B_len - 1 terms, and    *
+ *      the B_len - 1 terms left over from the previous block are added to    *
+ *      the bottom of them. No later block reaches below the top B_len - 1,   *
+ *      so the bottom block terms are finished and written to P, and the top  *
+ *      ones are kept for the next block. Whole blocks given while no partial *
+ *      block is held are multiplied where they are, without being copied.    *
+ *  Notes:                                                                    *
+ *      Each coefficient of P is written once the block of A it ends in is    *
+ *      full, so the output lags the input by at most one block.              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Stream_Finish                                                    *
+ *  Purpose:                                                                  *
+ *      Ends A, and writes out the rest of the coefficients of A*B.           *
+ *  Arguments:                                                                *
+ *      stream (Poly_Stream *):                                               *
+ *          The stream.                                                       *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least block + B_len - 1 wide.   *
+ *  Output:                                                                   *
+ *      count (size_t):                                                       *
+ *          The number of coefficients written to P.                          *
+ *  Called Functions:                                                         *
+ *      Poly_Multiply_Prepared_With_Scratch (polynomial_multiplication.h):    *
+ *          Multiplies the last, partial, block of A by B.                    *
+ *  Method:                                                                   *
+ *      If there is no partial block, write out the B_len - 1 terms left      *
+ *      over from the last block. Otherwise pad the partial block with zeros  *
+ *      and multiply it as a full one. The padding adds nothing, so the       *
+ *      first fill + B_len - 1 terms, with the left over terms added to the   *
+ *      bottom, are the rest of the product, where fill is the length of the  *
+ *      partial block.                                                        *
+ *  Notes:                                                                    *
+ *      With the counts returned by the pushes, the total written is          *
+ *      A_len + B_len - 1 for the whole of A, or zero if A or B is empty, as  *
+ *      with Poly_Multiply. The stream is then empty, and may be used for a   *
+ *      new A.                                                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  The state of an overlap-add product.                                      */
+struct Poly_Stream_Def {
+
+    /*  The plan for products of one block of A with B.                       */
+    Poly_Plan *plan;
+
+    /*  The lengths of B and of the blocks, and the number of coefficients of *
+     *  A held in the partial block. fill is always less than block.          */
+    size_t B_len;
+    size_t block;
+    size_t fill;
+
+    /*  Whether any coefficients of A have been given since the stream was    *
+     *  created or last finished.                                             */
+    int started;
+
+    /*  The partial block of A, block ints, the product of a block with B,    *
+     *  block + B_len - 1 ints, the terms left over from the previous block,  *
+     *  B_len - 1 ints, and the scratch space for the plan. All four are      *
+     *  carved from buffer.                                                   */
+    int *A_block;
+    int *product;
+    int *tail;
+    int *work;
+    int *buffer;
+};
+
+/*  Multiplies a full block of A by B, adds the terms left over from the      *
+ *  previous block, and writes the finished block terms to P.                 */
+static void
+poly_stream_block(Poly_Stream *stream, int *P_coeffs, const int *A_coeffs)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    const size_t overlap = stream->B_len - (size_t)1;
+
+    Poly_Multiply_Prepared_With_Scratch(
+        stream->plan, stream->product, A_coeffs, stream->block, stream->work
+    );
+
+    for (n = (size_t)0; n < overlap; ++n)
+        stream->product[n] += stream->tail[n];
+
+    for (n = (size_t)0; n < stream->block; ++n)
+        P_coeffs[n] = stream->product[n];
+
+    for (n = (size_t)0; n < overlap; ++n)
+        stream->tail[n] = stream->product[stream->block + n];
+}
+/*  End of poly_stream_block.                                                 */
+
+/*  Function for starting a stream of products against B.                     */
+Poly_Stream *
+Poly_Stream_Create(const int *B_coeffs, size_t B_len, size_t block)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Stream *stream;
+    size_t n, overlap, scratch;
+
+    if (block == (size_t)0)
+        block = (B_len > POLY_STREAM_BLOCK ? B_len : POLY_STREAM_BLOCK);
+
+    stream = malloc(sizeof(*stream));
+
+    if (!stream)
+        return NULL;
+
+    stream->plan = Poly_Prepare(B_coeffs, B_len, block);
+
+    if (!stream->plan)
+    {
+        free(stream);
+        return NULL;
+    }
+
+    overlap = (B_len ? B_len - (size_t)1 : (size_t)0);
+    scratch = Poly_Plan_Scratch_Size(stream->plan, block);
+
+    stream->B_len = B_len;
+    stream->block = block;
+    stream->fill = (size_t)0;
+    stream->started = 0;
+    stream->buffer = malloc(
+        sizeof(*stream->buffer) * (2*block + 2*overlap + scratch)
+    );
+
+    if (!stream->buffer)
+    {
+        Poly_Plan_Destroy(stream->plan);
+        free(stream);
+        return NULL;
+    }
+
+    stream->A_block = stream->buffer;
+    stream->product = stream->A_block + block;
+    stream->tail = stream->product + block + overlap;
+    stream->work = stream->tail + overlap;
+
+    for (n = (size_t)0; n < overlap; ++n)
+        stream->tail[n] = 0;
+
+    return stream;
+}
+/*  End of Poly_Stream_Create.                                                */
+
+/*  Function for freeing a stream.                                            */
+void Poly_Stream_Destroy(Poly_Stream *stream)
+{
+    if (!stream)
+        return;
+
+    Poly_Plan_Destroy(stream->plan);
+    free(stream->buffer);
+    free(stream);
+}
+/*  End of Poly_Stream_Destroy.                                               */
+
+/*  Function for adding the next coefficients of A to a stream.               */
+size_t
+Poly_Stream_Push(Poly_Stream *stream, int *P_coeffs,
+                 const int *A_coeffs, size_t A_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, take;
+    size_t count = (size_t)0;
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0 || stream->B_len == (size_t)0)
+        return count;
+
+    stream->started = 1;
+
+    /*  Top up the partial block, if there is one.                            */
+    if (stream->fill > (size_t)0)
+    {
+        take = stream->block - stream->fill;
+
+        if (take > A_len)
+            take = A_len;
+
+        for (n = (size_t)0; n < take; ++n)
+            stream->A_block[stream->fill + n] = A_coeffs[n];
+
+        stream->fill += take;
+        A_coeffs += take;
+        A_len -= take;
+
+        if (stream->fill < stream->block)
+            return count;
+
+        poly_stream_block(stream, P_coeffs, stream->A_block);
+        stream->fill = (size_t)0;
+        count += stream->block;
+    }
+
+    /*  Whole blocks are multiplied where they are.                           */
+    while (A_len >= stream->block)
+    {
+        poly_stream_block(stream, P_coeffs + count, A_coeffs);
+        A_coeffs += stream->block;
+        A_len -= stream->block;
+        count += stream->block;
+    }
+
+    /*  Keep what is left for the next push.                                  */
+    for (n = (size_t)0; n < A_len; ++n)
+        stream->A_block[n] = A_coeffs[n];
+
+    stream->fill = A_len;
+    return count;
+}
+/*  End of Poly_Stream_Push.                                                  */
+
+/*  Function for ending A and writing out the rest of the product.            */
+size_t Poly_Stream_Finish(Poly_Stream *stream, int *P_coeffs)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, count, overlap;
+
+    if (!stream->started)
+        return (size_t)0;
+
+    overlap = stream->B_len - (size_t)1;
+    count = stream->fill + overlap;
+
+    /*  If A ended on a block boundary, only the left over terms remain.      */
+    if (stream->fill == (size_t)0)
+    {
+        for (n = (size_t)0; n < overlap; ++n)
+            P_coeffs[n] = stream->tail[n];
+    }
+
+    else
+    {
+        for (n = stream->fill; n < stream->block; ++n)
+            stream->A_block[n] = 0;
+
+        Poly_Multiply_Prepared_With_Scratch(
+            stream->plan, stream->product,
+            stream->A_block, stream->block, stream->work
+        );
+
+        for (n = (size_t)0; n < overlap; ++n)
+            stream->product[n] += stream->tail[n];
+
+        for (n = (size_t)0; n < count; ++n)
+            P_coeffs[n] = stream->product[n];
+    }
+
+    /*  Reset the stream for the next A.                                      */
+    for (n = (size_t)0; n < overlap; ++n)
+        stream->tail[n] = 0;
+
+    stream->fill = (size_t)0;
+    stream->started = 0;
+    return count;
+}
+/*  End of Poly_Stream_Finish.                                                */
@@ -0,0 +1,633 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Template for the naive method, Scaled_AddTo, Karatsuba, and           *
+ *      Poly_Multiply, instantiated once per coefficient type.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_S                                                        *
+ *  Purpose:                                                                  *
+ *      As Naive_Kernel, for coefficients of type POLY_TYPE. Dispatches to    *
+ *      the fastest kernel the CPU supports.                                  *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Kernel_Init_S                                                   *
+ *  Purpose:                                                                  *
+ *      As Naive_Kernel_Init, storing the kernel used by Naive_Kernel_S.      *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Naive_Product_S                                                       *
+ *      Naive_AddTo_Product_S                                                 *
+ *      Naive_AddTo_Sum_Product_S                                             *
+ *  Purpose:                                                                  *
+ *      As Naive_Product, Naive_AddTo_Product, and Naive_AddTo_Sum_Product.   *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Scaled_AddTo_S                                                        *
+ *  Purpose:                                                                  *
+ *      As Scaled_AddTo, P += c*A.                                            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Karatsuba_Scratch_Size_S                                              *
+ *      Karatsuba_Product_With_Scratch_S                                      *
+ *      Karatsuba_Product_S                                                   *
+ *  Purpose:                                                                  *
+ *      As Karatsuba_Scratch_Size, Karatsuba_Product_With_Scratch, and        *
+ *      Karatsuba_Product. The scratch size counts coefficients of type       *
+ *      POLY_TYPE, and the recursion stops at the POLY_CUTOFF tunable.        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Multiply_S                                                       *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B with the naive method or Karatsuba, with the         *
+ *      operands in either order.                                             *
+ ******************************************************************************
+ *  Method:                                                                   *
+ *      Before including this file, define                                    *
+ *                                                                            *
+ *          POLY_TYPE:      The coefficient type, for example short.          *
+ *          POLY_SUFFIX:    The end of the function names, for example Int16. *
+ *          POLY_CUTOFF:    The member of Poly_Tunables holding the Karatsuba *
+ *                          cutoff for this type.                             *
+ *                                                                            *
+ *      and optionally                                                        *
+ *                                                                            *
+ *          POLY_ARITH:     The type the arithmetic is done in. This defaults *
+ *                          to POLY_TYPE.                                     *
+ *          POLY_LANE:      The type held by the vectors of the kernels. This *
+ *                          defaults to POLY_ARITH.                           *
+ *          POLY_NO_AVX512: Use the AVX2 kernel on CPUs with AVX-512, for the *
+ *                          types where the wider vectors do not pay off.     *
+ *                                                                            *
+ *      The functions above are then defined with _S replaced by the suffix.  *
+ *      The code is the same as the int versions, which are written out by    *
+ *      hand, with the kernel built from poly_template_kernel.h for each      *
+ *      instruction set: portable C, and AVX2, AVX-512, or NEON where         *
+ *      available. As for Naive_Kernel, the kernel is chosen by               *
+ *      Naive_Kernel_Init_S, or on the first call, so the only indirection is *
+ *      one call through a pointer per row kernel, and none in the inner      *
+ *      loops.                                                                *
+ *  Notes:                                                                    *
+ *      Include this from exactly one source file per type. Toom-3 and the    *
+ *      NTT are only provided for int, as their exact divisions and the       *
+ *      choice of primes are specific to 32-bit integers.                     *
+ *                                                                            *
+ *      The integer types set POLY_ARITH and POLY_LANE to unsigned types, so  *
+ *      the products are computed modulo 2^16 or 2^64, and none of the        *
+ *      arithmetic can overflow. Converting back to the signed type wraps     *
+ *      around with every compiler we support. For float and double,          *
+ *      Karatsuba trades some accuracy for speed, the rounding error growing  *
+ *      with the depth of the recursion.                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc and free.                            *
+ *  4.) string.h:                                                             *
+ *          Header file providing memcpy.                                     *
+ *  5.) poly_template_kernel.h:                                               *
+ *          The row kernel, included once per instruction set.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  memcpy found here.                                                        */
+#include <string.h>
+
+/*  Pastes the suffix onto a function name. The extra level of indirection    *
+ *  expands POLY_SUFFIX before pasting.                                       */
+#define POLY_PASTE_(name, suffix) name##_##suffix
+#define POLY_PASTE(name, suffix) POLY_PASTE_(name, suffix)
+#define POLY_NAME(name) POLY_PASTE(name, POLY_SUFFIX)
+
+/*  The types the arithmetic is done in, if not given.                        */
+#ifndef POLY_ARITH
+#define POLY_ARITH POLY_TYPE
+#endif
+
+#ifndef POLY_LANE
+#define POLY_LANE POLY_ARITH
+#endif
+
+/*  Computes x + y and x += a*b in the arithmetic type.                       */
+#define POLY_ADD(x, y) ((POLY_TYPE)((POLY_ARITH)(x) + (POLY_ARITH)(y)))
+#define POLY_ADD_PRODUCT(x, a, b)                                              \
+    ((x) = (POLY_TYPE)((POLY_ARITH)(x) + (POLY_ARITH)(a) * (POLY_ARITH)(b)))
+
+/*  The portable kernel.                                                      */
+#define POLY_KERNEL poly_kernel_portable
+#define POLY_VECTOR_BYTES 0
+#include "poly_template_kernel.h"
+
+#if defined(POLY_HAS_X86_SIMD)
+
+#define POLY_KERNEL poly_kernel_avx2
+#define POLY_VECTOR_BYTES 32
+#define POLY_KERNEL_TARGET "avx2"
+#include "poly_template_kernel.h"
+
+/*  Byte and quad-word multiplies need BW and DQ. Every CPU with AVX-512BW    *
+ *  also has DQ.                                                              */
+#ifndef POLY_NO_AVX512
+#define POLY_KERNEL poly_kernel_avx512
+#define POLY_VECTOR_BYTES 64
+#define POLY_KERNEL_TARGET "avx512f,avx512bw,avx512dq"
+#include "poly_template_kernel.h"
+#endif
+
+/*  The vector extensions need a GCC compatible compiler.                     */
+#elif defined(POLY_HAS_NEON) && defined(__GNUC__)
+
+#define POLY_KERNEL poly_kernel_neon
+#define POLY_VECTOR_BYTES 16
+#include "poly_template_kernel.h"
+
+#endif
+/*  End of #if defined(POLY_HAS_X86_SIMD).                                    */
+
+/*  Function pointer type shared by all of the kernels.                       */
+typedef void
+(*poly_kernel_function)(POLY_TYPE *P_coeffs,
+                        const POLY_TYPE *A0_coeffs,
+                        const POLY_TYPE *A1_coeffs, size_t A_len,
+                        const POLY_TYPE *B_coeffs, size_t B_len);
+
+/*  Forward declaration, the selector is the initial value of the pointer.    */
+static void
+poly_kernel_select(POLY_TYPE *P_coeffs,
+                   const POLY_TYPE *A0_coeffs,
+                   const POLY_TYPE *A1_coeffs, size_t A_len,
+                   const POLY_TYPE *B_coeffs, size_t B_len);
+
+/*  The kernel in use. Set by Naive_Kernel_Init.                              */
+static poly_kernel_function poly_kernel_current = poly_kernel_select;
+
+/*  Function for checking the CPU and storing the best kernel.                */
+void POLY_NAME(Naive_Kernel_Init)(void)
+{
+    poly_kernel_function kernel = poly_kernel_portable;
+
+#if defined(POLY_HAS_X86_SIMD)
+    __builtin_cpu_init();
+
+#ifndef POLY_NO_AVX512
+    if (Poly_Kernel_Allows(POLY_KERNEL_AVX512) &&
+        __builtin_cpu_supports("avx512bw"))
+        kernel = poly_kernel_avx512;
+    else
+#endif
+    if (Poly_Kernel_Allows(POLY_KERNEL_AVX2) &&
+        __builtin_cpu_supports("avx2"))
+        kernel = poly_kernel_avx2;
+#elif defined(POLY_HAS_NEON) && defined(__GNUC__)
+    if (Poly_Kernel_Allows(POLY_KERNEL_NEON))
+        kernel = poly_kernel_neon;
+#endif
+
+    poly_kernel_current = kernel;
+}
+/*  End of Naive_Kernel_Init.                                                 */
+
+/*  Chooses the kernel on the first call, and then calls it.                  */
+static void
+poly_kernel_select(POLY_TYPE *P_coeffs,
+                   const POLY_TYPE *A0_coeffs,
+                   const POLY_TYPE *A1_coeffs, size_t A_len,
+                   const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    POLY_NAME(Naive_Kernel_Init)();
+
+    poly_kernel_current(
+        P_coeffs, A0_coeffs, A1_coeffs, A_len, B_coeffs, B_len
+    );
+}
+/*  End of poly_kernel_select.                                                */
+
+/*  Function for computing P[m + n] += (A0[m] + A1[m]) * B[n].                */
+void
+POLY_NAME(Naive_Kernel)(POLY_TYPE *P_coeffs,
+                        const POLY_TYPE *A0_coeffs,
+                        const POLY_TYPE *A1_coeffs, size_t A_len,
+                        const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const POLY_TYPE *swap;
+    size_t n, len;
+
+    /*  Useful constant cast to type "size_t".                                */
+    const size_t slice = (size_t)NAIVE_SLICE_LENGTH;
+
+    /*  An empty operand contributes nothing.                                 */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    /*  The kernels sweep along B, so it should be the longer operand.        */
+    if (!A1_coeffs && A_len > B_len)
+    {
+        swap = A0_coeffs;
+        A0_coeffs = B_coeffs;
+        B_coeffs = swap;
+
+        len = A_len;
+        A_len = B_len;
+        B_len = len;
+    }
+
+    /*  A long B is fed to the kernel a slice at a time, as in Naive_Kernel.  */
+    for (n = (size_t)0; n < B_len; n += slice)
+    {
+        len = (B_len - n < slice ? B_len - n : slice);
+
+        poly_kernel_current(
+            P_coeffs + n, A0_coeffs, A1_coeffs, A_len, B_coeffs + n, len
+        );
+    }
+}
+/*  End of Naive_Kernel_S.                                                    */
+
+/*  Function for computing P = A*B, with the lengths in either order.         */
+void
+POLY_NAME(Naive_Product)(POLY_TYPE *P_coeffs,
+                         const POLY_TYPE *A_coeffs, size_t A_len,
+                         const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  The number of coefficients in the product.                            */
+    size_t P_len;
+
+    /*  The product with an empty polynomial has no coefficients.             */
+    if (A_len == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    P_len = A_len + B_len - (size_t)1;
+
+    /*  The kernel accumulates, so start from the zero polynomial.            */
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    POLY_NAME(Naive_Kernel)(P_coeffs, A_coeffs, NULL, A_len, B_coeffs, B_len);
+}
+/*  End of Naive_Product_S.                                                   */
+
+/*  Function for computing P += A*B, with the lengths in either order.        */
+void
+POLY_NAME(Naive_AddTo_Product)(POLY_TYPE *P_coeffs,
+                               const POLY_TYPE *A_coeffs, size_t A_len,
+                               const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  The kernel adds every product to P without clearing anything.         */
+    POLY_NAME(Naive_Kernel)(P_coeffs, A_coeffs, NULL, A_len, B_coeffs, B_len);
+}
+/*  End of Naive_AddTo_Product_S.                                             */
+
+/*  Function for computing P += (A0 + A1)*B. A_len <= B_len is fastest.       */
+void
+POLY_NAME(Naive_AddTo_Sum_Product)(POLY_TYPE *P_coeffs,
+                                   const POLY_TYPE *A0_coeffs,
+                                   const POLY_TYPE *A1_coeffs, size_t A_len,
+                                   const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  The kernel adds every product to P without clearing anything.         */
+    POLY_NAME(Naive_Kernel)(
+        P_coeffs, A0_coeffs, A1_coeffs, A_len, B_coeffs, B_len
+    );
+}
+/*  End of Naive_AddTo_Sum_Product_S.                                         */
+
+/*  Computes P += c * A where P and A are polynomials and c is a constant.    */
+void
+POLY_NAME(Scaled_AddTo)(POLY_TYPE *P_coeffs,
+                        const POLY_TYPE *A_coeffs, size_t len,
+                        POLY_TYPE scalar)
+{
+    /*  Variable for indexing over the entries of the polynomial.             */
+    size_t n;
+
+    for (n = (size_t)0; n < len; ++n)
+        POLY_ADD_PRODUCT(P_coeffs[n], scalar, A_coeffs[n]);
+}
+/*  End of Scaled_AddTo_S.                                                    */
+
+/*  Scratch space needed to multiply two length n arrays.                     */
+static size_t poly_karatsuba_balanced_scratch(size_t n, size_t cutoff)
+{
+    /*  The length of the lower half of the split.                            */
+    size_t h;
+
+    /*  Small products are done naively, no scratch space needed.             */
+    if (n <= cutoff)
+        return (size_t)0;
+
+    h = (n + (size_t)1) >> 1;
+
+    /*  Storage for A0 + A1, B0 + B1, and Z1, plus the recursive calls.       */
+    return (size_t)4*h - (size_t)1 + poly_karatsuba_balanced_scratch(h, cutoff);
+}
+/*  End of poly_karatsuba_balanced_scratch.                                   */
+
+/*  Scratch space, in coefficients, needed to multiply A and B.               */
+size_t POLY_NAME(Karatsuba_Scratch_Size)(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t full, rest, chunks;
+
+    /*  Zero cast to type "size_t".                                           */
+    const size_t zero = (size_t)0;
+
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->POLY_CUTOFF;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+        return POLY_NAME(Karatsuba_Scratch_Size)(B_len, A_len);
+
+    /*  Small products are done naively, no scratch space needed.             */
+    if (A_len <= cutoff)
+        return zero;
+
+    full = poly_karatsuba_balanced_scratch(A_len, cutoff);
+
+    if (A_len == B_len)
+        return full;
+
+    /*  Chunks of B after the first are stored in a temporary array of length *
+     *  2*A_len - 1, followed by the scratch space for the product.           */
+    chunks = B_len % A_len;
+
+    if (chunks == zero)
+        rest = zero;
+    else
+        rest = POLY_NAME(Karatsuba_Scratch_Size)(chunks, A_len);
+
+    if (rest > full)
+        full = rest;
+
+    return (size_t)2*A_len - (size_t)1 + full;
+}
+/*  End of Karatsuba_Scratch_Size_S.                                          */
+
+/*  Computes P = A*B for two polynomials of length n.                         */
+static void
+poly_karatsuba_balanced(POLY_TYPE *P_coeffs,
+                        const POLY_TYPE *A_coeffs,
+                        const POLY_TYPE *B_coeffs,
+                        size_t n,
+                        POLY_TYPE *work,
+                        size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, h, l;
+    POLY_TYPE *A_sum, *B_sum, *Z1, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Small products are faster with the naive method.                      */
+    if (n <= cutoff)
+    {
+        POLY_NAME(Naive_Product)(P_coeffs, A_coeffs, n, B_coeffs, n);
+        return;
+    }
+
+    /*  A0 and B0 have length h, A1 and B1 have length l. Note l <= h.        */
+    h = (n + one) >> 1;
+    l = n - h;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_sum = work;
+    B_sum = A_sum + h;
+    Z1 = B_sum + h;
+    rest = Z1 + (2*h - one);
+
+    /*  A0*B0 goes into the lower 2h - 1 coefficients of P, and A1*B1 into    *
+     *  the upper 2l - 1. The coefficient between them must be zero.          */
+    poly_karatsuba_balanced(P_coeffs, A_coeffs, B_coeffs, h, rest, cutoff);
+    poly_karatsuba_balanced(
+        P_coeffs + 2*h, A_coeffs + h, B_coeffs + h, l, rest, cutoff
+    );
+
+    P_coeffs[2*h - one] = 0;
+
+    /*  Compute B0 + B1. B1 may be one shorter than B0.                       */
+    for (k = zero; k < l; ++k)
+        B_sum[k] = POLY_ADD(B_coeffs[k], B_coeffs[h + k]);
+
+    if (l < h)
+        B_sum[l] = B_coeffs[l];
+
+    /*  At the last level of the recursion, (A0 + A1)*(B0 + B1) is computed   *
+     *  without storing A0 + A1, as in Karatsuba_Product_With_Scratch.        */
+    if (h <= cutoff)
+    {
+        for (k = zero; k + one < 2*h; ++k)
+            Z1[k] = 0;
+
+        POLY_NAME(Naive_AddTo_Sum_Product)(
+            Z1, A_coeffs, A_coeffs + h, l, B_sum, h
+        );
+
+        if (l < h)
+            POLY_NAME(Scaled_AddTo)(Z1 + l, B_sum, h, A_coeffs[l]);
+    }
+
+    /*  Otherwise compute A0 + A1 and recurse.                                */
+    else
+    {
+        for (k = zero; k < l; ++k)
+            A_sum[k] = POLY_ADD(A_coeffs[k], A_coeffs[h + k]);
+
+        if (l < h)
+            A_sum[l] = A_coeffs[l];
+
+        poly_karatsuba_balanced(Z1, A_sum, B_sum, h, rest, cutoff);
+    }
+
+    /*  The middle term is Z1 - A0*B0 - A1*B1, shifted by h.                  */
+    POLY_NAME(Scaled_AddTo)(Z1, P_coeffs, 2*h - one, -1);
+    POLY_NAME(Scaled_AddTo)(Z1, P_coeffs + 2*h, 2*l - one, -1);
+    POLY_NAME(Scaled_AddTo)(P_coeffs + h, Z1, 2*h - one, 1);
+}
+/*  End of poly_karatsuba_balanced.                                           */
+
+/*  Computes P = A*B for polynomials of any lengths.                          */
+void
+POLY_NAME(Karatsuba_Product_With_Scratch)(POLY_TYPE *P_coeffs,
+                                          const POLY_TYPE *A_coeffs,
+                                          size_t A_len,
+                                          const POLY_TYPE *B_coeffs,
+                                          size_t B_len,
+                                          POLY_TYPE *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, shift, remainder;
+    POLY_TYPE *T_coeffs, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Length at or below which the naive method is used.                    */
+    const size_t cutoff = Poly_Get_Tunables()->POLY_CUTOFF;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+    {
+        POLY_NAME(Karatsuba_Product_With_Scratch)(
+            P_coeffs, B_coeffs, B_len, A_coeffs, A_len, work
+        );
+
+        return;
+    }
+
+    /*  If A is small enough the naive method handles any length for B.       */
+    if (A_len <= cutoff)
+    {
+        POLY_NAME(Naive_Product)(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    /*  The first chunk of B is multiplied directly into P.                   */
+    poly_karatsuba_balanced(P_coeffs, A_coeffs, B_coeffs, A_len, work, cutoff);
+
+    if (A_len == B_len)
+        return;
+
+    /*  Later chunks overlap the previous product in A_len - 1 terms, so they *
+     *  are computed in a temporary array and then added in.                  */
+    T_coeffs = work;
+    rest = work + (2*A_len - one);
+
+    for (shift = A_len; shift + A_len <= B_len; shift += A_len)
+    {
+        poly_karatsuba_balanced(
+            T_coeffs, A_coeffs, B_coeffs + shift, A_len, rest, cutoff
+        );
+
+        POLY_NAME(Scaled_AddTo)(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+        for (k = A_len - one; k < 2*A_len - one; ++k)
+            P_coeffs[shift + k] = T_coeffs[k];
+    }
+
+    /*  The final chunk of B may be shorter than A.                           */
+    remainder = B_len - shift;
+
+    if (remainder == zero)
+        return;
+
+    POLY_NAME(Karatsuba_Product_With_Scratch)(
+        T_coeffs, B_coeffs + shift, remainder, A_coeffs, A_len, rest
+    );
+
+    POLY_NAME(Scaled_AddTo)(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+    for (k = A_len - one; k < A_len + remainder - one; ++k)
+        P_coeffs[shift + k] = T_coeffs[k];
+}
+/*  End of Karatsuba_Product_With_Scratch_S.                                  */
+
+/*  Computes P = A*B with Karatsuba, allocating the scratch space.            */
+void
+POLY_NAME(Karatsuba_Product)(POLY_TYPE *P_coeffs,
+                             const POLY_TYPE *A_coeffs, size_t A_len,
+                             const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  The amount of scratch space needed for the recursion.                 */
+    const size_t size = POLY_NAME(Karatsuba_Scratch_Size)(A_len, B_len);
+    POLY_TYPE *work;
+
+    /*  Small products need no scratch space at all.                          */
+    if (size == (size_t)0)
+    {
+        POLY_NAME(Naive_Product)(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    work = malloc(sizeof(*work) * size);
+
+    /*  If malloc fails, fall back to the naive method.                       */
+    if (!work)
+    {
+        POLY_NAME(Naive_Product)(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+        return;
+    }
+
+    POLY_NAME(Karatsuba_Product_With_Scratch)(
+        P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+    );
+
+    free(work);
+}
+/*  End of Karatsuba_Product_S.                                               */
+
+/*  Computes P = A*B with the faster of the naive method and Karatsuba.       */
+void
+POLY_NAME(Poly_Multiply)(POLY_TYPE *P_coeffs,
+                         const POLY_TYPE *A_coeffs, size_t A_len,
+                         const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const POLY_TYPE *tmp_coeffs;
+    size_t tmp_len;
+
+    /*  The algorithms all expect the shorter operand first.                  */
+    if (A_len > B_len)
+    {
+        tmp_coeffs = A_coeffs;
+        A_coeffs = B_coeffs;
+        B_coeffs = tmp_coeffs;
+
+        tmp_len = A_len;
+        A_len = B_len;
+        B_len = tmp_len;
+    }
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_len == (size_t)0)
+        return;
+
+    POLY_NAME(Karatsuba_Product)(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+}
+/*  End of Poly_Multiply_S.                                                   */
+
+#undef POLY_ADD_PRODUCT
+#undef POLY_ADD
+#undef POLY_NAME
+#undef POLY_PASTE
+#undef POLY_PASTE_
@@ -0,0 +1,204 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Template for the row kernel of the naive method, included once per    *
+ *      instruction set by poly_template.h.                                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      POLY_KERNEL                                                           *
+ *  Purpose:                                                                  *
+ *      Computes P[m + n] += (A0[m] + A1[m]) * B[n] for all m and n, for      *
+ *      coefficients of type POLY_TYPE.                                       *
+ *  Arguments:                                                                *
+ *      P_coeffs (POLY_TYPE *):                                               *
+ *          A pointer to an array, at least A_len + B_len - 1 wide.           *
+ *      A0_coeffs (const POLY_TYPE *):                                        *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A1_coeffs (const POLY_TYPE *):                                        *
+ *          A pointer to the coefficient array of a polynomial, or NULL.      *
+ *      A_len (size_t):                                                       *
+ *          The length of the A0 and A1 polynomials.                          *
+ *      B_coeffs (const POLY_TYPE *):                                         *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      memcpy (string.h):                                                    *
+ *          Used for the copy of B and the unaligned vector loads and stores. *
+ *  Method:                                                                   *
+ *      As Naive_Kernel_Portable, four rows of A are combined per pass over   *
+ *      P, computing                                                          *
+ *                                                                            *
+ *          P[m + k] += a0 B[k] + a1 B[k - 1] + a2 B[k - 2] + a3 B[k - 3]     *
+ *                                                                            *
+ *      As in the int SIMD kernels, there is no edge code. B is first copied  *
+ *      into a buffer on the stack with three zeros on either side, so        *
+ *      B[k - r] reads as zero outside of B, and each band is one loop over   *
+ *      its B_len + 3 outputs. The last A_len % 4 rows are added one at a     *
+ *      time, straight from B, rather than as a band padded with zero rows    *
+ *      that would cost four products per output of a short A.                *
+ *                                                                            *
+ *      If POLY_VECTOR_BYTES is non-zero, the loops are computed with GCC     *
+ *      vector extensions, POLY_VECTOR_BYTES at a time, loading the shifted   *
+ *      copies of B from the buffer, and the outputs after the last whole     *
+ *      vector are scalar. The function carries POLY_KERNEL_TARGET as a       *
+ *      target attribute, so the same source becomes an AVX2, AVX-512, or     *
+ *      NEON kernel for each coefficient type.                                *
+ *  Notes:                                                                    *
+ *      The arithmetic is done in POLY_ARITH, and the vectors hold POLY_LANE, *
+ *      which are unsigned for the integer types so that overflow wraps.      *
+ *      The four products are added to the output one at a time, in the same  *
+ *      order in the vector and scalar code, so floating point results do not *
+ *      depend on the kernel chosen. Compilers do not contract a*b + c into a *
+ *      fused multiply-add in the ISO C modes.                                *
+ *                                                                            *
+ *      B_len is at most NAIVE_SLICE_LENGTH, as Naive_Kernel_S passes B in    *
+ *      slices. The padding multiplies zeros by coefficients of A, so         *
+ *      an infinite or NaN float coefficient may turn outputs it does not     *
+ *      reach into NaN, as Karatsuba already does.                            *
+ *                                                                            *
+ *      POLY_KERNEL, POLY_VECTOR_BYTES, and POLY_KERNEL_TARGET (if any) must  *
+ *      be defined before including this file, and are undefined at the end.  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) string.h:                                                             *
+ *          Header file providing memcpy. Included by poly_template.h.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function for computing P[m + n] += (A0[m] + A1[m]) * B[n].                */
+#ifdef POLY_KERNEL_TARGET
+__attribute__((target(POLY_KERNEL_TARGET)))
+#endif
+static void
+POLY_KERNEL(POLY_TYPE *P_coeffs,
+            const POLY_TYPE *A0_coeffs,
+            const POLY_TYPE *A1_coeffs, size_t A_len,
+            const POLY_TYPE *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, k, r;
+    POLY_ARITH a[4];
+    POLY_TYPE *row;
+
+    /*  The rows of A in whole bands of four.                                 */
+    const size_t bands = A_len - A_len % (size_t)4;
+
+    /*  B with three zeros on either side.                                    */
+    POLY_TYPE padded[NAIVE_SLICE_LENGTH + 6];
+    const POLY_TYPE * const b = padded + 3;
+
+#if POLY_VECTOR_BYTES != 0
+    typedef POLY_LANE vector __attribute__((vector_size(POLY_VECTOR_BYTES)));
+    vector acc, b0, b1, b2, b3;
+
+    /*  The number of coefficients per vector.                                */
+    const size_t lanes = sizeof(vector) / sizeof(POLY_TYPE);
+#endif
+
+    if (bands > (size_t)0)
+    {
+        padded[0] = padded[1] = padded[2] = 0;
+        memcpy(padded + 3, B_coeffs, sizeof(*B_coeffs) * B_len);
+        padded[B_len + 3] = padded[B_len + 4] = padded[B_len + 5] = 0;
+    }
+
+    /*  Four rows of A at a time, so each output is loaded and stored once    *
+     *  per four rows rather than once per row.                               */
+    for (m = (size_t)0; m < bands; m += (size_t)4)
+    {
+        for (r = (size_t)0; r < (size_t)4; ++r)
+        {
+            a[r] = (POLY_ARITH)A0_coeffs[m + r];
+
+            if (A1_coeffs)
+                a[r] += (POLY_ARITH)A1_coeffs[m + r];
+        }
+
+        row = P_coeffs + m;
+        k = (size_t)0;
+
+#if POLY_VECTOR_BYTES != 0
+        for (; k + lanes <= B_len + (size_t)3; k += lanes)
+        {
+            memcpy(&acc, row + k, sizeof(acc));
+            memcpy(&b0, b + k, sizeof(b0));
+            memcpy(&b1, b + k - 1, sizeof(b1));
+            memcpy(&b2, b + k - 2, sizeof(b2));
+            memcpy(&b3, b + k - 3, sizeof(b3));
+
+            acc += b0 * (POLY_LANE)a[0];
+            acc += b1 * (POLY_LANE)a[1];
+            acc += b2 * (POLY_LANE)a[2];
+            acc += b3 * (POLY_LANE)a[3];
+            memcpy(row + k, &acc, sizeof(acc));
+        }
+#endif
+
+        /*  The outputs after the last whole vector.                          */
+        for (; k < B_len + (size_t)3; ++k)
+        {
+            POLY_ADD_PRODUCT(row[k], a[0], b[k]);
+            POLY_ADD_PRODUCT(row[k], a[1], b[k - 1]);
+            POLY_ADD_PRODUCT(row[k], a[2], b[k - 2]);
+            POLY_ADD_PRODUCT(row[k], a[3], b[k - 3]);
+        }
+    }
+
+    /*  The last A_len % 4 rows, one at a time, which need no padding.        */
+    for (; m < A_len; ++m)
+    {
+        a[0] = (POLY_ARITH)A0_coeffs[m];
+
+        if (A1_coeffs)
+            a[0] += (POLY_ARITH)A1_coeffs[m];
+
+        row = P_coeffs + m;
+        k = (size_t)0;
+
+#if POLY_VECTOR_BYTES != 0
+        for (; k + lanes <= B_len; k += lanes)
+        {
+            memcpy(&acc, row + k, sizeof(acc));
+            memcpy(&b0, B_coeffs + k, sizeof(b0));
+            acc += b0 * (POLY_LANE)a[0];
+            memcpy(row + k, &acc, sizeof(acc));
+        }
+#endif
+
+        for (; k < B_len; ++k)
+            POLY_ADD_PRODUCT(row[k], a[0], B_coeffs[k]);
+    }
+}
+/*  End of POLY_KERNEL.                                                       */
+
+#undef POLY_KERNEL
+#undef POLY_VECTOR_BYTES
+
+#ifdef POLY_KERNEL_TARGET
+#undef POLY_KERNEL_TARGET
+#endif
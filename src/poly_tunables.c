@@ -0,0 +1,163 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Stores the crossover points between the multiplication algorithms.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Get_Tunables                                                     *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the tunables currently in use.                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      tunables (const Poly_Tunables *):                                     *
+ *          The current crossover points. This is never NULL.                 *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Return the address of the file-scope tunables struct.                 *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Poly_Set_Tunables                                                     *
+ *  Purpose:                                                                  *
+ *      Replaces the tunables after checking that they are valid.             *
+ *  Arguments:                                                                *
+ *      tunables (const Poly_Tunables *):                                     *
+ *          The new crossover points.                                         *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, -1 if the values are invalid.                       *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Check the lower bounds needed by the recursions and copy the struct.  *
+ *  Notes:                                                                    *
+ *      The tunables are shared by every thread and are read by each call to  *
+ *      the multiplication routines. They should be set once at start up.     *
+ *      Scratch sizes computed before a change are not valid afterwards.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  The recursions need each piece of the split to be non-empty.              */
+#if KARATSUBA_CUTOFF < 1
+#error "KARATSUBA_CUTOFF must be at least 1."
+#endif
+
+#if TOOM3_CUTOFF < 4
+#error "TOOM3_CUTOFF must be at least 4."
+#endif
+
+#if UNBALANCED_RATIO < 1
+#error "UNBALANCED_RATIO must be at least 1."
+#endif
+
+#if PARALLEL_GRAIN < 4
+#error "PARALLEL_GRAIN must be at least 4."
+#endif
+
+#if KARATSUBA_CUTOFF_INT16 < 1 || KARATSUBA_CUTOFF_INT64 < 1
+#error "KARATSUBA_CUTOFF_INT16 and KARATSUBA_CUTOFF_INT64 must be at least 1."
+#endif
+
+#if KARATSUBA_CUTOFF_FLOAT < 1 || KARATSUBA_CUTOFF_DOUBLE < 1
+#error "KARATSUBA_CUTOFF_FLOAT and KARATSUBA_CUTOFF_DOUBLE must be at least 1."
+#endif
+
+/*  Squares use the product scratch sizes, so must not recurse any deeper.    */
+#if KARATSUBA_SQUARE_CUTOFF < KARATSUBA_CUTOFF
+#error "KARATSUBA_SQUARE_CUTOFF must be at least KARATSUBA_CUTOFF."
+#endif
+
+/*  The tunables in use, initialized with the compile time defaults.          */
+static Poly_Tunables poly_tunables = {
+    KARATSUBA_CUTOFF,
+    NTT_CUTOFF,
+    UNBALANCED_RATIO,
+    PARALLEL_GRAIN,
+    WIDE_NTT_CUTOFF,
+    KARATSUBA_CUTOFF_INT16,
+    KARATSUBA_CUTOFF_INT64,
+    KARATSUBA_CUTOFF_FLOAT,
+    KARATSUBA_CUTOFF_DOUBLE,
+    MOD_NTT_CUTOFF,
+    KARATSUBA_SQUARE_CUTOFF
+};
+
+/*  Function for retrieving the current tunables.                             */
+const Poly_Tunables *Poly_Get_Tunables(void)
+{
+    return &poly_tunables;
+}
+/*  End of Poly_Get_Tunables.                                                 */
+
+/*  Function for replacing the current tunables.                              */
+int Poly_Set_Tunables(const Poly_Tunables *tunables)
+{
+    if (!tunables)
+        return -1;
+
+    /*  Karatsuba needs n >= 2 to split.                                      */
+    if (tunables->karatsuba_cutoff < (size_t)1)
+        return -1;
+
+    if (tunables->karatsuba_cutoff_int16 < (size_t)1)
+        return -1;
+
+    if (tunables->karatsuba_cutoff_int64 < (size_t)1)
+        return -1;
+
+    if (tunables->karatsuba_cutoff_float < (size_t)1)
+        return -1;
+
+    if (tunables->karatsuba_cutoff_double < (size_t)1)
+        return -1;
+
+    if (tunables->unbalanced_ratio < (size_t)1)
+        return -1;
+
+    /*  Karatsuba_Square_With_Scratch is given room for the product A*A.      */
+    if (tunables->karatsuba_square_cutoff < tunables->karatsuba_cutoff)
+        return -1;
+
+    /*  Products longer than the grain are split with Karatsuba.              */
+    if (tunables->parallel_grain < (size_t)4)
+        return -1;
+
+    poly_tunables = *tunables;
+    return 0;
+}
+/*  End of Poly_Set_Tunables.                                                 */
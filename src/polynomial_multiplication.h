@@ -25,28 +25,1602 @@
 /*  size_t typedef is provided here.                                          */
 #include <stddef.h>
 
-/*  Naive multiplication,  P = A * B. Assumes A_len <= B_len.                 */
+/*  SIMD versions of the naive kernel are built for x86 with GCC or clang,    *
+ *  and for ARM with NEON. Define POLY_NO_SIMD to use portable C only.        */
+#if !defined(POLY_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define POLY_HAS_X86_SIMD
+#endif
+
+#if !defined(POLY_NO_SIMD) && defined(__ARM_NEON)
+#define POLY_HAS_NEON
+#endif
+
+/*  Poly_Pool uses POSIX threads on Unix-like systems. Define POLY_NO_THREADS *
+ *  to run every task on the calling thread instead.                          */
+#if !defined(POLY_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define POLY_HAS_PTHREADS
+#endif
+
+/*  Poly_File maps files with POSIX mmap on Unix-like systems. Define         *
+ *  POLY_NO_MMAP to leave it out, after which the files can not be opened.    */
+#if !defined(POLY_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define POLY_HAS_MMAP
+#endif
+
+/*  GCC and clang provide a 128-bit integer on 64-bit targets. It is the      *
+ *  output type of Naive_Product_Wide128.                                     */
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+#define POLY_HAS_INT128
+#endif
+
+/*  Default length at or below which Karatsuba_Product falls back to          *
+ *  Naive_Product. This may be overridden at compile time, with               *
+ *  -DKARATSUBA_CUTOFF=n, or at run time with Poly_Set_Tunables. The SIMD     *
+ *  kernels make the naive method competitive up to much larger lengths.      */
+#ifndef KARATSUBA_CUTOFF
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_CUTOFF 192
+#else
+#define KARATSUBA_CUTOFF 32
+#endif
+#endif
+
+/*  Length at or below which Toom3_Product falls back to Karatsuba. This may  *
+ *  be overridden at compile time with -DTOOM3_CUTOFF=n. Poly_Multiply does   *
+ *  not use Toom-3, so there is no run time tunable for it.                   */
+#ifndef TOOM3_CUTOFF
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define TOOM3_CUTOFF 500
+#else
+#define TOOM3_CUTOFF 150
+#endif
+#endif
+
+/*  Default length of the shorter operand above which Poly_Multiply uses      *
+ *  NTT_Product.                                                              */
+#ifndef NTT_CUTOFF
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define NTT_CUTOFF 100000
+#else
+#define NTT_CUTOFF 10000
+#endif
+#endif
+
+/*  Default ratio B_len / A_len above which Poly_Multiply splits the longer   *
+ *  operand into slices for the NTT, rather than one large transform.         */
+#ifndef UNBALANCED_RATIO
+#define UNBALANCED_RATIO 8
+#endif
+
+/*  Default length at or below which Poly_Multiply_Parallel computes a        *
+ *  product on a single thread, rather than splitting it into tasks.          */
+#ifndef PARALLEL_GRAIN
+#define PARALLEL_GRAIN 4096
+#endif
+
+/*  Default length of the shorter operand above which Poly_Multiply_Wide      *
+ *  uses NTT_Product_Wide rather than Naive_Product_Wide.                     */
+#ifndef WIDE_NTT_CUTOFF
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define WIDE_NTT_CUTOFF 6000
+#else
+#define WIDE_NTT_CUTOFF 1000
+#endif
+#endif
+
+/*  Default lengths at or below which Karatsuba_Product_Int16, _Int64,        *
+ *  _Float, and _Double use the naive method.                                 */
+#ifndef KARATSUBA_CUTOFF_INT16
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_CUTOFF_INT16 900
+#else
+#define KARATSUBA_CUTOFF_INT16 64
+#endif
+#endif
+
+#ifndef KARATSUBA_CUTOFF_INT64
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_CUTOFF_INT64 48
+#else
+#define KARATSUBA_CUTOFF_INT64 32
+#endif
+#endif
+
+#ifndef KARATSUBA_CUTOFF_FLOAT
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_CUTOFF_FLOAT 360
+#else
+#define KARATSUBA_CUTOFF_FLOAT 64
+#endif
+#endif
+
+#ifndef KARATSUBA_CUTOFF_DOUBLE
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_CUTOFF_DOUBLE 150
+#else
+#define KARATSUBA_CUTOFF_DOUBLE 64
+#endif
+#endif
+
+/*  Default length at or below which Poly_Square and Karatsuba_Square use     *
+ *  Naive_Square. This is higher than KARATSUBA_CUTOFF, since the naive       *
+ *  square needs half the work of a naive product, and Karatsuba only saves a *
+ *  little more than that for a square.                                       */
+#ifndef KARATSUBA_SQUARE_CUTOFF
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define KARATSUBA_SQUARE_CUTOFF 480
+#else
+#define KARATSUBA_SQUARE_CUTOFF 96
+#endif
+#endif
+
+/*  Default length of the shorter operand above which Poly_Multiply_Mod uses  *
+ *  NTT_Product_Mod rather than Naive_Product_Mod. The naive kernel is        *
+ *  portable C, so there is one value. It suits 31-bit primes, for small      *
+ *  primes the crossover is higher.                                           */
+#ifndef MOD_NTT_CUTOFF
+#define MOD_NTT_CUTOFF 64
+#endif
+
+/*  Number of products computed side by side by Naive_Batch_Kernel.           */
+#define NAIVE_BATCH_LANES 16
+
+/*  Longest operands Poly_Multiply_Batch puts through Naive_Batch_Kernel.     *
+ *  Longer products are computed one at a time.                               */
+#define NAIVE_BATCH_MAX_LENGTH 64
+
+/*  Naive_Product_Wide sums the products in ints, in tiles of at most         *
+ *  NAIVE_WIDE_ROWS rows of A by NAIVE_WIDE_COLUMNS coefficients of B, and    *
+ *  widens once per tile. If fewer than NAIVE_WIDE_MIN_ROWS rows can be       *
+ *  summed without overflow, it uses the 64-bit kernel instead.               */
+#define NAIVE_WIDE_ROWS 256
+#define NAIVE_WIDE_COLUMNS 512
+#define NAIVE_WIDE_MIN_ROWS 32
+
+/*  Naive_Kernel_Mod sums the products in 64-bit accumulators, for tiles of   *
+ *  at most NAIVE_MOD_COLUMNS outputs at a time.                              */
+#define NAIVE_MOD_COLUMNS 256
+
+/*  Naive_Square works in bands of NAIVE_SQUARE_ROWS coefficients of A. At    *
+ *  or below NAIVE_SQUARE_CUTOFF it forms the whole product A*A instead.      */
+#define NAIVE_SQUARE_ROWS 8
+
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define NAIVE_SQUARE_CUTOFF 64
+#else
+#define NAIVE_SQUARE_CUTOFF 16
+#endif
+
+/*  Naive_AddTo_Sum_Of_Products works in blocks of NAIVE_SUM_BLOCK            *
+ *  coefficients, and Naive_AddTo_Combination_Product forms the combination   *
+ *  NAIVE_COMBINATION_ROWS coefficients at a time.                            */
+#define NAIVE_SUM_BLOCK 256
+#define NAIVE_COMBINATION_ROWS 64
+
+/*  Naive_Short_Product and Naive_Middle_Product work in bands of             *
+ *  NAIVE_SHORT_ROWS and NAIVE_MIDDLE_ROWS rows, with the triangles at the    *
+ *  ends of each band done term by term. At or below NAIVE_SHORT_CUTOFF the   *
+ *  short product forms the whole product on the stack instead.               */
+#define NAIVE_SHORT_ROWS 4
+#define NAIVE_MIDDLE_ROWS 4
+
+#if defined(POLY_HAS_X86_SIMD) || defined(POLY_HAS_NEON)
+#define NAIVE_SHORT_CUTOFF 128
+#else
+#define NAIVE_SHORT_CUTOFF 8
+#endif
+
+/*  Karatsuba_Short_Product splits a short product of length len after the    *
+ *  first KARATSUBA_SHORT_SPLIT tenths of len, rounded up.                    */
+#define KARATSUBA_SHORT_SPLIT 7
+
+/*  Poly_Series_Inverse uses Naive_Series_Inverse for at most                 *
+ *  POLY_INVERSE_CUTOFF coefficients, which also starts the Newton iteration. *
+ *  Poly_Divide uses long division if the divisor or the quotient has at most *
+ *  POLY_DIVIDE_CUTOFF coefficients.                                          */
+#define POLY_INVERSE_CUTOFF 32
+#define POLY_DIVIDE_CUTOFF 32
+
+/*  Naive_Product_Overlap finds NAIVE_OVERLAP_BLOCK coefficients of P at a    *
+ *  time, from the top down, in a buffer on the stack.                        */
+#define NAIVE_OVERLAP_BLOCK 256
+
+/*  Naive_Kernel passes B to the kernels NAIVE_SLICE_LENGTH coefficients at a *
+ *  time, so the part of P they sweep over stays in cache.                    */
+#define NAIVE_SLICE_LENGTH 2048
+
+/*  Poly_Multiply_With_Scratch skips the zeros of an operand of length len,   *
+ *  with m the length of the shorter one, if it has at most len / sqrt(m)     *
+ *  non-zero coefficients, with m taken to be at least SPARSE_ROOT_LENGTH.    *
+ *  Large dense products cost about as much as adding 2 len / sqrt(m) shifted *
+ *  copies of the other operand, and short ones as much as len / 30, as short *
+ *  adds that overlap are slow. Shorter operands than SPARSE_MIN_LENGTH are   *
+ *  multiplied densely without looking.                                       */
+#define SPARSE_MIN_LENGTH 32
+#define SPARSE_ROOT_LENGTH 1024
+
+/*  Poly_Stream_Create uses blocks of the larger of B_len and                 *
+ *  POLY_STREAM_BLOCK coefficients if no block length is given.               */
+#define POLY_STREAM_BLOCK 4096
+
+/*  Poly_File_Create aligns the coefficients to POLY_FILE_ALIGNMENT bytes,    *
+ *  which is also the offset of the coefficients from the start of the file.  *
+ *  It must be a power of two, at least 64, and at most the page size.        */
+#define POLY_FILE_ALIGNMENT 64
+
+/*  Big_Product uses Naive_Big_Product if the shorter integer has at most     *
+ *  BIG_NAIVE_CUTOFF limbs.                                                   */
+#define BIG_NAIVE_CUTOFF 32
+
+/*  Largest modulus supported by Poly_Modulus_Init.                           */
+#define POLY_MODULUS_MAX 0x7FFFFFFFU
+
+/*  Longest product supported by the primes used in NTT_Product. Longer       *
+ *  products are computed with Toom3_Product instead.                         */
+#define NTT_MAX_LENGTH ((size_t)1 << 25)
+
+/*  Crossover points between the multiplication algorithms.                   */
+typedef struct Poly_Tunables_Def {
+
+    /*  Lengths at or below this use the naive method. Must be at least 1.    */
+    size_t karatsuba_cutoff;
+
+    /*  Poly_Multiply uses the NTT if the shorter operand is longer, and      *
+     *  Karatsuba otherwise, above karatsuba_cutoff.                          */
+    size_t ntt_cutoff;
+
+    /*  For the NTT, the longer operand is sliced if B_len > ratio * A_len.   *
+     *  Must be at least 1.                                                   */
+    size_t unbalanced_ratio;
+
+    /*  Poly_Multiply_Parallel does not split products of this length or      *
+     *  shorter across threads. Must be at least 4.                           */
+    size_t parallel_grain;
+
+    /*  Poly_Multiply_Wide uses the NTT if the shorter operand is longer.     */
+    size_t wide_ntt_cutoff;
+
+    /*  As karatsuba_cutoff, for the short, long long, float, and double      *
+     *  coefficient types. Each must be at least 1.                           */
+    size_t karatsuba_cutoff_int16;
+    size_t karatsuba_cutoff_int64;
+    size_t karatsuba_cutoff_float;
+    size_t karatsuba_cutoff_double;
+
+    /*  Poly_Multiply_Mod uses the NTT if the shorter operand is longer.      */
+    size_t mod_ntt_cutoff;
+
+    /*  As karatsuba_cutoff, for squares. Must be at least karatsuba_cutoff.  */
+    size_t karatsuba_square_cutoff;
+} Poly_Tunables;
+
+/*  The algorithms Poly_Multiply may select. Poly_Select_Algorithm chooses    *
+ *  from the lengths alone, and never returns POLY_ALGORITHM_SPARSE, which is *
+ *  used when an operand turns out to be mostly zeros. Toom-3 is not among    *
+ *  them, as it is slower than Karatsuba when exact.                          */
+typedef enum Poly_Algorithm_Def {
+    POLY_ALGORITHM_NAIVE,
+    POLY_ALGORITHM_KARATSUBA,
+    POLY_ALGORITHM_NTT,
+    POLY_ALGORITHM_SPARSE
+} Poly_Algorithm;
+
+/*  The number of algorithms above.                                           */
+#define POLY_ALGORITHM_COUNT 4
+
+/*  A term c x^e of a sparse polynomial. The sparse routines take lists of    *
+ *  terms in increasing order of exponent, with no exponent repeated.         */
+typedef struct Poly_Term_Def {
+    size_t exponent;
+    int coeff;
+} Poly_Term;
+
+/*  The number of buckets in the histograms of lengths of Poly_Stats. Bucket  *
+ *  k counts the products whose shorter operand has floor(log2(len)) = k.     */
+#define POLY_STATS_BUCKETS 64
+
+/*  The totals recorded for one algorithm, see Poly_Stats_Snapshot.           */
+typedef struct Poly_Algorithm_Stats_Def {
+
+    /*  The number of products, and the coefficients of their outputs.        */
+    unsigned long long calls;
+    unsigned long long coeffs;
+
+    /*  The sum of the times of the products, as counted by Poly_Cycles.      */
+    unsigned long long cycles;
+
+    /*  The most levels of recursion any one of the products went through.    */
+    size_t max_depth;
+
+    /*  The histogram of the lengths of the shorter operands.                 */
+    unsigned long long lengths[POLY_STATS_BUCKETS];
+} Poly_Algorithm_Stats;
+
+/*  The totals of every thread, indexed by Poly_Algorithm.                    */
+typedef struct Poly_Stats_Def {
+    Poly_Algorithm_Stats algorithm[POLY_ALGORITHM_COUNT];
+} Poly_Stats;
+
+/*  A product passed to the trace hooks. depth and cycles are zero when it    *
+ *  begins, and are the levels of recursion and the time taken when it ends.  */
+typedef struct Poly_Trace_Event_Def {
+    Poly_Algorithm algorithm;
+    size_t A_len, B_len;
+    size_t depth;
+    unsigned long long cycles;
+} Poly_Trace_Event;
+
+/*  A hook called as a product begins or ends, see Poly_Set_Trace_Hooks.      */
+typedef void (*Poly_Trace_Hook)(const Poly_Trace_Event *event, void *data);
+
+/*  Precomputed constants for arithmetic modulo an odd p < 2^31. The mod p    *
+ *  routines take coefficients in [0, p) and return them in [0, p).           */
+typedef struct Poly_Modulus_Def {
+
+    /*  The modulus.                                                          */
+    unsigned int p;
+
+    /*  -p^-1 mod 2^32 and 2^64 mod p, for Montgomery arithmetic.             */
+    unsigned int p_inv, r2;
+
+    /*  If p is prime, a primitive root and the largest k with 2^k dividing   *
+     *  p - 1, which bounds the length of the NTT. Both are zero otherwise.   */
+    unsigned int g, two_adicity;
+
+    /*  The number of products of residues that may be summed in 64 bits      *
+     *  before a reduction is needed.                                         */
+    size_t lazy;
+} Poly_Modulus;
+
+#ifdef POLY_HAS_INT128
+
+/*  Signed 128-bit integer. __extension__ keeps -pedantic quiet about it.     */
+__extension__ typedef __int128 Poly_Int128;
+
+#endif
+/*  End of #ifdef POLY_HAS_INT128.                                            */
+
+/*  Naive multiplication,  P = A * B. The lengths may be in either order.     */
 extern void
 Naive_Product(int *P_coeffs,
               const int *A_coeffs, size_t A_len,
               const int *B_coeffs, size_t B_len);
 
-/*  Naive multiplication,  P += A * B. Assumes A_len <= B_len.                */
+/*  Naive multiplication,  P += A * B. The lengths may be in either order.    *
+ *  All A_len + B_len - 1 coefficients of P are added to.                     */
 extern void
 Naive_AddTo_Product(int *P_coeffs,
                     const int *A_coeffs, size_t A_len,
                     const int *B_coeffs, size_t B_len);
 
-/*  Naive multiplication,  P += (A0 + A1) * B. Assumes A_len <= B_len.        */
+/*  Naive multiplication,  P += (A0 + A1) * B. The lengths may be in either   *
+ *  order, though A_len <= B_len is faster. All A_len + B_len - 1             *
+ *  coefficients of P are added to.                                           */
 extern void
 Naive_AddTo_Sum_Product(int *P_coeffs,
                         const int *A0_coeffs,
                         const int *A1_coeffs, size_t A_len,
                         const int *B_coeffs, size_t B_len);
 
+/*  Naive multiplication, P = A * B, where P may overlap A or B. Where it     *
+ *  overlaps an operand, P must not start before it, so P = A, P = B, and     *
+ *  P = A = B are all allowed. The lengths may be in either order.            */
+extern void
+Naive_Product_Overlap(int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len);
+
+/*  As Naive_Product_Overlap, computing P += A * B.                           */
+extern void
+Naive_AddTo_Product_Overlap(int *P_coeffs,
+                            const int *A_coeffs, size_t A_len,
+                            const int *B_coeffs, size_t B_len);
+
+/*  Naive squaring, P = A * A, with about half the products of Naive_Product. */
+extern void Naive_Square(int *P_coeffs, const int *A_coeffs, size_t len);
+
+/*  Naive sum of products, P += A[0] * B[0] + ... + A[count-1] * B[count-1],  *
+ *  with every A[i] of length A_len and every B[i] of length B_len. All of P  *
+ *  is added to, with one sweep for all of the terms.                         */
+extern void
+Naive_AddTo_Sum_Of_Products(int *P_coeffs, size_t count,
+                            const int * const *A_coeffs, size_t A_len,
+                            const int * const *B_coeffs, size_t B_len);
+
+/*  Naive product of a linear combination,                                    *
+ *  P += (c[0] A[0] + ... + c[count-1] A[count-1]) * B, with every A[i] of    *
+ *  length A_len. All of P is added to, with one sweep for all of the terms.  */
+extern void
+Naive_AddTo_Combination_Product(int *P_coeffs, size_t count,
+                                const int *scalars,
+                                const int * const *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len);
+
+/*  Naive short product, P = A * B mod x^len, the first len coefficients of   *
+ *  the product. A and B may have any lengths.                                */
+extern void
+Naive_Short_Product(int *P_coeffs,
+                    const int *A_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len,
+                    size_t len);
+
+/*  Naive middle product, the coefficients of x^(B_len - 1) through           *
+ *  x^(A_len - 1) of A * B, A_len - B_len + 1 of them. Assumes                *
+ *  1 <= B_len <= A_len.                                                      */
+extern void
+Naive_Middle_Product(int *P_coeffs,
+                     const int *A_coeffs, size_t A_len,
+                     const int *B_coeffs, size_t B_len);
+
+/*  Naive power series inverse, I = 1 / B mod x^len. Returns 0 on success,    *
+ *  and -1 if B[0] is not 1 or -1, in which case I is not touched.            */
+extern int
+Naive_Series_Inverse(int *I_coeffs,
+                     const int *B_coeffs, size_t B_len,
+                     size_t len);
+
+/*  Long division, A = Q * B + R with deg(R) < deg(B). Q has                  *
+ *  A_len - B_len + 1 terms and R has B_len - 1. Returns 0 on success, and -1 *
+ *  if the leading coefficient of B is not 1 or -1.                           */
+extern int
+Naive_Divide(int *Q_coeffs, int *R_coeffs,
+             const int *A_coeffs, size_t A_len,
+             const int *B_coeffs, size_t B_len);
+
+/*  Row kernel for the naive method, P[m + n] += (A0[m] + A1[m]) * B[n] for   *
+ *  all m < A_len and n < B_len. A1 may be NULL, in which case it is treated  *
+ *  as zero. The lengths may be in either order. Dispatches to the fastest    *
+ *  version the CPU supports.                                                 */
+extern void
+Naive_Kernel(int *P_coeffs,
+             const int *A0_coeffs,
+             const int *A1_coeffs, size_t A_len,
+             const int *B_coeffs, size_t B_len);
+
+/*  Checks the CPU and chooses the kernel used by Naive_Kernel. Otherwise     *
+ *  this is done on the first call, see Poly_Kernel_Init.                     */
+extern void Naive_Kernel_Init(void);
+
+/*  Portable C version of Naive_Kernel.                                       */
+extern void
+Naive_Kernel_Portable(int *P_coeffs,
+                      const int *A0_coeffs,
+                      const int *A1_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len);
+
+#ifdef POLY_HAS_X86_SIMD
+
+/*  AVX2 version of Naive_Kernel. Requires a CPU supporting AVX2.             */
+extern void
+Naive_Kernel_AVX2(int *P_coeffs,
+                  const int *A0_coeffs,
+                  const int *A1_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len);
+
+/*  AVX-512 version of Naive_Kernel. Requires a CPU supporting AVX-512F.      */
+extern void
+Naive_Kernel_AVX512(int *P_coeffs,
+                    const int *A0_coeffs,
+                    const int *A1_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len);
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
+
+#ifdef POLY_HAS_NEON
+
+/*  NEON version of Naive_Kernel.                                             */
+extern void
+Naive_Kernel_NEON(int *P_coeffs,
+                  const int *A0_coeffs,
+                  const int *A1_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len);
+
+#endif
+/*  End of #ifdef POLY_HAS_NEON.                                              */
+
+/*  Naive multiplication of count <= NAIVE_BATCH_LANES products side by side, *
+ *  P[j] = A[j] * B[j], with every length from 1 to NAIVE_BATCH_MAX_LENGTH.   *
+ *  Dispatches to the fastest version the CPU supports.                       */
+extern void
+Naive_Batch_Kernel(int * const *P_coeffs,
+                   const int * const *A_coeffs, const size_t *A_len,
+                   const int * const *B_coeffs, const size_t *B_len,
+                   size_t count);
+
+/*  Checks the CPU and chooses the kernel used by Naive_Batch_Kernel.         */
+extern void Naive_Batch_Kernel_Init(void);
+
+/*  Portable C version of Naive_Batch_Kernel.                                 */
+extern void
+Naive_Batch_Kernel_Portable(int * const *P_coeffs,
+                            const int * const *A_coeffs, const size_t *A_len,
+                            const int * const *B_coeffs, const size_t *B_len,
+                            size_t count);
+
+#ifdef POLY_HAS_X86_SIMD
+
+/*  AVX2 version of Naive_Batch_Kernel. Requires a CPU supporting AVX2.       */
+extern void
+Naive_Batch_Kernel_AVX2(int * const *P_coeffs,
+                        const int * const *A_coeffs, const size_t *A_len,
+                        const int * const *B_coeffs, const size_t *B_len,
+                        size_t count);
+
+/*  AVX-512 version of Naive_Batch_Kernel. Requires AVX-512F.                 */
+extern void
+Naive_Batch_Kernel_AVX512(int * const *P_coeffs,
+                          const int * const *A_coeffs, const size_t *A_len,
+                          const int * const *B_coeffs, const size_t *B_len,
+                          size_t count);
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
+
+#ifdef POLY_HAS_NEON
+
+/*  NEON version of Naive_Batch_Kernel.                                       */
+extern void
+Naive_Batch_Kernel_NEON(int * const *P_coeffs,
+                        const int * const *A_coeffs, const size_t *A_len,
+                        const int * const *B_coeffs, const size_t *B_len,
+                        size_t count);
+
+#endif
+/*  End of #ifdef POLY_HAS_NEON.                                              */
+
+/*  Row kernel with 64-bit outputs, P[m + n] += A[m] * B[n] for all m < A_len *
+ *  and n < B_len. The products are formed in 64 bits. Dispatches to the      *
+ *  fastest version the CPU supports.                                         */
+extern void
+Naive_Kernel_Wide(long long *P_coeffs,
+                  const int *A_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len);
+
+/*  Checks the CPU and chooses the kernel used by Naive_Kernel_Wide.          */
+extern void Naive_Kernel_Wide_Init(void);
+
+/*  Portable C version of Naive_Kernel_Wide.                                  */
+extern void
+Naive_Kernel_Wide_Portable(long long *P_coeffs,
+                           const int *A_coeffs, size_t A_len,
+                           const int *B_coeffs, size_t B_len);
+
+#ifdef POLY_HAS_X86_SIMD
+
+/*  AVX2 version of Naive_Kernel_Wide. Requires a CPU supporting AVX2.        */
+extern void
+Naive_Kernel_Wide_AVX2(long long *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len);
+
+/*  AVX-512 version of Naive_Kernel_Wide. Requires a CPU supporting AVX-512F. */
+extern void
+Naive_Kernel_Wide_AVX512(long long *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len);
+
+#endif
+/*  End of #ifdef POLY_HAS_X86_SIMD.                                          */
+
+#ifdef POLY_HAS_NEON
+
+/*  NEON version of Naive_Kernel_Wide.                                        */
+extern void
+Naive_Kernel_Wide_NEON(long long *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len);
+
+#endif
+/*  End of #ifdef POLY_HAS_NEON.                                              */
+
+/*  Naive multiplication with 64-bit outputs, P = A * B. The result is exact  *
+ *  whenever the coefficients of the product fit in a long long. The lengths  *
+ *  may be in either order.                                                   */
+extern void
+Naive_Product_Wide(long long *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len);
+
+#ifdef POLY_HAS_INT128
+
+/*  Naive multiplication with 128-bit outputs, P = A * B. The result is exact *
+ *  whenever the coefficients of the product fit in a Poly_Int128. The        *
+ *  lengths may be in either order.                                           */
+extern void
+Naive_Product_Wide128(Poly_Int128 *P_coeffs,
+                      const long long *A_coeffs, size_t A_len,
+                      const long long *B_coeffs, size_t B_len);
+
+#endif
+/*  End of #ifdef POLY_HAS_INT128.                                            */
+
 /*  Polynomial addition, P += c*A, where c is a constant scalar.              */
 extern void
 Scaled_AddTo(int *P_coeffs, const int *A_coeffs, size_t len, int scalar);
 
+/*  Lists the non-zero coefficients of a polynomial as terms, returning their *
+ *  number. terms must have room for every non-zero coefficient.              */
+extern size_t
+Sparse_From_Dense(Poly_Term *terms, const int *coeffs, size_t len);
+
+/*  Writes out the coefficients of a sparse polynomial, e + 1 of them, where  *
+ *  e is the exponent of the last term.                                       */
+extern void Sparse_To_Dense(int *coeffs, const Poly_Term *terms, size_t count);
+
+/*  Multiplication of unsigned integers, P = A * B, given as arrays of 32-bit *
+ *  limbs, least significant first. P needs A_len + B_len limbs, all of which *
+ *  are written, and must not overlap A or B. Schoolbook method.              */
+extern void
+Naive_Big_Product(unsigned int *P_limbs,
+                  const unsigned int *A_limbs, size_t A_len,
+                  const unsigned int *B_limbs, size_t B_len);
+
+/*  Multiplication of unsigned integers, P = A * B, as Naive_Big_Product, by  *
+ *  multiplying their 16-bit digits as polynomials with Poly_Multiply_Wide.   */
+extern void
+Big_Product(unsigned int *P_limbs,
+            const unsigned int *A_limbs, size_t A_len,
+            const unsigned int *B_limbs, size_t B_len);
+
+/*  Sparse multiplication, P = A * B, by merging the products of the terms on *
+ *  a heap. P must have room for A_count * B_count terms. Returns the number  *
+ *  written, in increasing order of exponent, leaving out terms that cancel.  */
+extern size_t
+Sparse_Product(Poly_Term *P_terms,
+               const Poly_Term *A_terms, size_t A_count,
+               const Poly_Term *B_terms, size_t B_count);
+
+/*  Sparse times dense multiplication, P = A * B, adding a shifted multiple   *
+ *  of B to P for each term of A. P has length e + B_len, where e is the      *
+ *  exponent of the last term of A.                                           */
+extern void
+Sparse_Dense_Product(int *P_coeffs,
+                     const Poly_Term *A_terms, size_t A_count,
+                     const int *B_coeffs, size_t B_len);
+
+/*  As Sparse_Dense_Product, adding the product to P, P += A * B.             */
+extern void
+Sparse_AddTo_Dense_Product(int *P_coeffs,
+                           const Poly_Term *A_terms, size_t A_count,
+                           const int *B_coeffs, size_t B_len);
+
+/*  Karatsuba multiplication, P = A * B. The lengths may be in either order.  */
+extern void
+Karatsuba_Product(int *P_coeffs,
+                  const int *A_coeffs, size_t A_len,
+                  const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Karatsuba_Product_With_Scratch.         */
+extern size_t Karatsuba_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  Karatsuba multiplication, P = A * B, with caller supplied scratch space.  *
+ *  work must have room for Karatsuba_Scratch_Size(A_len, B_len) ints. The    *
+ *  lengths may be in either order.                                           */
+extern void
+Karatsuba_Product_With_Scratch(int *P_coeffs,
+                               const int *A_coeffs, size_t A_len,
+                               const int *B_coeffs, size_t B_len,
+                               int *work);
+
+/*  Karatsuba squaring, P = A * A, recursing into three squares.              */
+extern void Karatsuba_Square(int *P_coeffs, const int *A_coeffs, size_t len);
+
+/*  Karatsuba squaring with caller supplied scratch space. work must have     *
+ *  room for Karatsuba_Scratch_Size(len, len) ints.                           */
+extern void
+Karatsuba_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                              int *work);
+
+/*  Karatsuba short product, P = A * B mod x^len. Only the first len          *
+ *  coefficients of the product are computed.                                 */
+extern void
+Karatsuba_Short_Product(int *P_coeffs,
+                        const int *A_coeffs, size_t A_len,
+                        const int *B_coeffs, size_t B_len,
+                        size_t len);
+
+/*  Scratch space, in ints, needed by Karatsuba_Short_Product_With_Scratch.   */
+extern size_t
+Karatsuba_Short_Scratch_Size(size_t A_len, size_t B_len, size_t len);
+
+/*  As Karatsuba_Short_Product, with caller supplied scratch space. work must *
+ *  have room for Karatsuba_Short_Scratch_Size(A_len, B_len, len) ints.       */
+extern void
+Karatsuba_Short_Product_With_Scratch(int *P_coeffs,
+                                     const int *A_coeffs, size_t A_len,
+                                     const int *B_coeffs, size_t B_len,
+                                     size_t len, int *work);
+
+/*  Transposed Karatsuba middle product, the coefficients of x^(B_len - 1)    *
+ *  through x^(A_len - 1) of A * B. Assumes 1 <= B_len <= A_len.              */
+extern void
+Karatsuba_Middle_Product(int *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Karatsuba_Middle_Product_With_Scratch.  */
+extern size_t Karatsuba_Middle_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Karatsuba_Middle_Product, with caller supplied scratch space. work     *
+ *  must have room for Karatsuba_Middle_Scratch_Size(A_len, B_len) ints.      */
+extern void
+Karatsuba_Middle_Product_With_Scratch(int *P_coeffs,
+                                      const int *A_coeffs, size_t A_len,
+                                      const int *B_coeffs, size_t B_len,
+                                      int *work);
+
+/*  Evaluates A = A0 + x^k A1 + x^2k A2 at 1, -1, and -2, storing the results *
+ *  in E. A0 and A1 have length k, A2 has length l <= k. The values are       *
+ *  computed modulo 2^64.                                                     */
+extern void
+Toom3_Evaluate(long long *E_coeffs, const long long *A_coeffs,
+               size_t k, size_t l);
+
+/*  Recovers P = A*B from the point-wise products of the Toom-3 split. Each   *
+ *  call loses the top bit, so P is exact modulo 2^m if the products are      *
+ *  exact modulo 2^(m+1).                                                     */
+extern void
+Toom3_Interpolate(long long *P_coeffs, long long *W_coeffs, size_t k, size_t l);
+
+/*  Toom-Cook 3-way multiplication, P = A * B. The lengths may be in either   *
+ *  order.                                                                    */
+extern void
+Toom3_Product(int *P_coeffs,
+              const int *A_coeffs, size_t A_len,
+              const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Toom3_Product_With_Scratch.             */
+extern size_t Toom3_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  Toom-Cook 3-way multiplication, P = A * B, with caller supplied scratch   *
+ *  space. work must have room for Toom3_Scratch_Size(A_len, B_len) ints.     *
+ *  The lengths may be in either order.                                       */
+extern void
+Toom3_Product_With_Scratch(int *P_coeffs,
+                           const int *A_coeffs, size_t A_len,
+                           const int *B_coeffs, size_t B_len,
+                           int *work);
+
+/*  Toom-Cook 3-way squaring, P = A * A, recursing into five squares.         */
+extern void Toom3_Square(int *P_coeffs, const int *A_coeffs, size_t len);
+
+/*  Toom-Cook 3-way squaring with caller supplied scratch space. work must    *
+ *  have room for Toom3_Scratch_Size(len, len) ints.                          */
+extern void
+Toom3_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                          int *work);
+
+/*  Number theoretic transform multiplication, P = A * B. The result is       *
+ *  exact, and equal to Naive_Product, whenever Naive_Product does not        *
+ *  overflow.                                                                 */
+extern void
+NTT_Product(int *P_coeffs,
+            const int *A_coeffs, size_t A_len,
+            const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by NTT_Product_With_Scratch.               */
+extern size_t NTT_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  Scratch space, in ints, needed by NTT_AddTo_Sum_Of_Products_With_Scratch. */
+extern size_t NTT_Scratch_Size_Sum(size_t A_len, size_t B_len);
+
+/*  Scratch space, in ints, needed by NTT_Middle_Product_With_Scratch.        */
+extern size_t NTT_Scratch_Size_Middle(size_t A_len, size_t B_len);
+
+/*  Number theoretic transform multiplication, P = A * B, with caller         *
+ *  supplied scratch space. work must have room for                           *
+ *  NTT_Scratch_Size(A_len, B_len) ints.                                      */
+extern void
+NTT_Product_With_Scratch(int *P_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len,
+                         int *work);
+
+/*  Number theoretic transform squaring, P = A * A, with one forward          *
+ *  transform per prime rather than two.                                      */
+extern void NTT_Square(int *P_coeffs, const int *A_coeffs, size_t len);
+
+/*  As NTT_Square, with caller supplied scratch space. work must have room    *
+ *  for NTT_Scratch_Size(len, len) ints.                                      */
+extern void
+NTT_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                        int *work);
+
+/*  Number theoretic transform multiplication with 64-bit outputs, P = A * B. *
+ *  The result is exact, and equal to Naive_Product_Wide, whenever the        *
+ *  coefficients of the product fit in a long long.                           */
+extern void
+NTT_Product_Wide(long long *P_coeffs,
+                 const int *A_coeffs, size_t A_len,
+                 const int *B_coeffs, size_t B_len);
+
+/*  As NTT_Product_Wide, with caller supplied scratch space. work must have   *
+ *  room for NTT_Scratch_Size(A_len, B_len) ints.                             */
+extern void
+NTT_Product_Wide_With_Scratch(long long *P_coeffs,
+                              const int *A_coeffs, size_t A_len,
+                              const int *B_coeffs, size_t B_len,
+                              int *work);
+
+/*  The roots of unity for transforms of length N modulo the primes used by   *
+ *  NTT_Product, 3 N / 2 unsigned ints. N must be a power of two from 2 to    *
+ *  NTT_MAX_LENGTH.                                                           */
+extern void NTT_Roots(unsigned int *roots, size_t N);
+
+/*  The transforms of length N of B, with B_len <= N, modulo the primes used  *
+ *  by NTT_Product, 3 N unsigned ints, for reuse by NTT_Product_Spectra.      */
+extern void
+NTT_Spectrum(unsigned int *S, const int *B_coeffs, size_t B_len,
+             size_t N, const unsigned int *roots);
+
+/*  Computes P = A * B, of length len <= N, from the spectra of A and B.      *
+ *  work must have room for 3 len + N ints.                                   */
+extern void
+NTT_Product_Spectra(int *P_coeffs, size_t len,
+                    const unsigned int *SA, const unsigned int *SB,
+                    size_t N, const unsigned int *roots, int *work);
+
+/*  Number theoretic transform sum of products,                               *
+ *  P += A[0] * B[0] + ... + A[count-1] * B[count-1], with one inverse        *
+ *  transform for the whole sum. All of P is added to. work must have room    *
+ *  for NTT_Scratch_Size_Sum(A_len, B_len) ints.                              */
+extern void
+NTT_AddTo_Sum_Of_Products_With_Scratch(int *P_coeffs, size_t count,
+                                       const int * const *A_coeffs,
+                                       size_t A_len,
+                                       const int * const *B_coeffs,
+                                       size_t B_len,
+                                       int *work);
+
+/*  Number theoretic transform middle product, the coefficients of            *
+ *  x^(B_len - 1) through x^(A_len - 1) of A * B, with transforms of length   *
+ *  at least A_len. Assumes 1 <= B_len <= A_len.                              */
+extern void
+NTT_Middle_Product(int *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len);
+
+/*  As NTT_Middle_Product, with caller supplied scratch space. work must have *
+ *  room for NTT_Scratch_Size_Middle(A_len, B_len) ints.                      */
+extern void
+NTT_Middle_Product_With_Scratch(int *P_coeffs,
+                                const int *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len,
+                                int *work);
+
+/*  Returns the tunables currently in use. This is never NULL.                */
+extern const Poly_Tunables *Poly_Get_Tunables(void);
+
+/*  Replaces the tunables. Returns 0 on success, and -1 if the values are     *
+ *  invalid, in which case nothing is changed. This is not thread safe, and   *
+ *  should be done at start up before any products are computed.              */
+extern int Poly_Set_Tunables(const Poly_Tunables *tunables);
+
+/*  Reads tunables from a file of "name = value" lines, as written by         *
+ *  poly_tune. Returns 0 on success and -1 on failure.                        */
+extern int Poly_Load_Tunables(const char *filename);
+
+/*  Returns the algorithm Poly_Multiply uses for the given lengths.           */
+extern Poly_Algorithm Poly_Select_Algorithm(size_t A_len, size_t B_len);
+
+/*  Reads the cycle counter of the CPU, rdtsc on x86 and cntvct_el0 on ARM64. *
+ *  Other CPUs use clock. Only differences on the same machine are useful.    */
+extern unsigned long long Poly_Cycles(void);
+
+/*  Sums the counters of every thread into stats, without locking. Returns 0, *
+ *  or -1 with stats zeroed if the library was built without POLY_INSTRUMENT. */
+extern int Poly_Stats_Snapshot(Poly_Stats *stats);
+
+/*  Sets hooks called on the computing thread as each product begins and      *
+ *  ends, either of which may be NULL. Returns 0, or -1 if the library was    *
+ *  built without POLY_INSTRUMENT. Not thread safe, set it at start up.       */
+extern int
+Poly_Set_Trace_Hooks(Poly_Trace_Hook begin, Poly_Trace_Hook end, void *data);
+
+/*  With POLY_INSTRUMENT, Poly_Multiply_With_Scratch and the square and plan  *
+ *  versions of it record each product they compute, and the Karatsuba and    *
+ *  Toom-3 recursions their depth. Products between POLY_STATS_NEST and       *
+ *  POLY_STATS_UNNEST are part of one recorded on another thread, as for the  *
+ *  tasks of Poly_Multiply_Parallel. Without it these expand to nothing.      */
+#ifdef POLY_INSTRUMENT
+
+extern void
+Poly_Stats_Begin(Poly_Algorithm algorithm, size_t A_len, size_t B_len);
+
+extern void Poly_Stats_End(void);
+extern void Poly_Stats_Descend(void);
+extern void Poly_Stats_Ascend(void);
+extern void Poly_Stats_Nest(void);
+extern void Poly_Stats_Unnest(void);
+
+#define POLY_STATS_BEGIN(algorithm, A_len, B_len)                              \
+    Poly_Stats_Begin(algorithm, A_len, B_len)
+
+#define POLY_STATS_END() Poly_Stats_End()
+#define POLY_STATS_DESCEND() Poly_Stats_Descend()
+#define POLY_STATS_ASCEND() Poly_Stats_Ascend()
+#define POLY_STATS_NEST() Poly_Stats_Nest()
+#define POLY_STATS_UNNEST() Poly_Stats_Unnest()
+
+#else
+
+#define POLY_STATS_BEGIN(algorithm, A_len, B_len) ((void)0)
+#define POLY_STATS_END() ((void)0)
+#define POLY_STATS_DESCEND() ((void)0)
+#define POLY_STATS_ASCEND() ((void)0)
+#define POLY_STATS_NEST() ((void)0)
+#define POLY_STATS_UNNEST() ((void)0)
+
+#endif
+/*  End of #ifdef POLY_INSTRUMENT.                                            */
+
+/*  Multiplication, P = A * B, using the fastest available algorithm.         */
+extern void
+Poly_Multiply(int *P_coeffs,
+              const int *A_coeffs, size_t A_len,
+              const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Poly_Multiply_With_Scratch.             */
+extern size_t Poly_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  Multiplication, P = A * B, using the fastest available algorithm and      *
+ *  caller supplied scratch space. work must have room for                    *
+ *  Poly_Scratch_Size(A_len, B_len) ints.                                     */
+extern void
+Poly_Multiply_With_Scratch(int *P_coeffs,
+                           const int *A_coeffs, size_t A_len,
+                           const int *B_coeffs, size_t B_len,
+                           int *work);
+
+/*  In place multiplication, A = A * B, using the fastest available           *
+ *  algorithm. A must have room for A_len + B_len - 1 ints. B may be A, but   *
+ *  must not otherwise overlap it.                                            */
+extern void
+Poly_Multiply_In_Place(int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Poly_Multiply_In_Place_With_Scratch.    */
+extern size_t Poly_In_Place_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Poly_Multiply_In_Place, with caller supplied scratch space. work must  *
+ *  have room for Poly_In_Place_Scratch_Size(A_len, B_len) ints.              */
+extern void
+Poly_Multiply_In_Place_With_Scratch(int *A_coeffs, size_t A_len,
+                                    const int *B_coeffs, size_t B_len,
+                                    int *work);
+
+/*  Multiplication of polynomials in vars variables by Kronecker substitution *
+ *  into one product by Poly_Multiply. A has length A_dims[k] in variable k,  *
+ *  with the last variable varying fastest, and likewise for B. P then has    *
+ *  length A_dims[k] + B_dims[k] - 1 in variable k, stored in the same way.   */
+extern void
+Poly_Multiply_Multivariate(int *P_coeffs,
+                           const int *A_coeffs, const size_t *A_dims,
+                           const int *B_coeffs, const size_t *B_dims,
+                           size_t vars);
+
+/*  Scratch space, in ints, needed by                                         *
+ *  Poly_Multiply_Multivariate_With_Scratch.                                  */
+extern size_t
+Poly_Multivariate_Scratch_Size(const size_t *A_dims, const size_t *B_dims,
+                               size_t vars);
+
+/*  As Poly_Multiply_Multivariate, with caller supplied scratch space. work   *
+ *  must have room for Poly_Multivariate_Scratch_Size(A_dims, B_dims, vars).  */
+extern void
+Poly_Multiply_Multivariate_With_Scratch(int *P_coeffs,
+                                        const int *A_coeffs,
+                                        const size_t *A_dims,
+                                        const int *B_coeffs,
+                                        const size_t *B_dims,
+                                        size_t vars, int *work);
+
+/*  Squaring, P = A * A, using the squaring version of the fastest algorithm. *
+ *  Poly_Multiply does this when given the same array as both operands.       */
+extern void Poly_Square(int *P_coeffs, const int *A_coeffs, size_t len);
+
+/*  As Poly_Square, with caller supplied scratch space. work must have room   *
+ *  for Poly_Scratch_Size(len, len) ints.                                     */
+extern void
+Poly_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                         int *work);
+
+/*  Sum of products, P += A[0] * B[0] + ... + A[count-1] * B[count-1], using  *
+ *  the fastest available algorithm. Every A[i] has length A_len and every    *
+ *  B[i] has length B_len. All A_len + B_len - 1 coefficients of P are added  *
+ *  to, and P is swept once for the whole sum.                                */
+extern void
+Poly_AddTo_Sum_Of_Products(int *P_coeffs, size_t count,
+                           const int * const *A_coeffs, size_t A_len,
+                           const int * const *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by                                         *
+ *  Poly_AddTo_Sum_Of_Products_With_Scratch.                                  */
+extern size_t Poly_Sum_Of_Products_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Poly_AddTo_Sum_Of_Products, with caller supplied scratch space. work   *
+ *  must have room for Poly_Sum_Of_Products_Scratch_Size(A_len, B_len) ints.  */
+extern void
+Poly_AddTo_Sum_Of_Products_With_Scratch(int *P_coeffs, size_t count,
+                                        const int * const *A_coeffs,
+                                        size_t A_len,
+                                        const int * const *B_coeffs,
+                                        size_t B_len,
+                                        int *work);
+
+/*  Product of a linear combination,                                          *
+ *  P += (c[0] A[0] + ... + c[count-1] A[count-1]) * B, using the fastest     *
+ *  available algorithm. Every A[i] has length A_len. All of P is added to.   */
+extern void
+Poly_AddTo_Combination_Product(int *P_coeffs, size_t count,
+                               const int *scalars,
+                               const int * const *A_coeffs, size_t A_len,
+                               const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by                                         *
+ *  Poly_AddTo_Combination_Product_With_Scratch.                              */
+extern size_t
+Poly_Combination_Product_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Poly_AddTo_Combination_Product, with caller supplied scratch space.    *
+ *  work must have room for Poly_Combination_Product_Scratch_Size(A_len,      *
+ *  B_len) ints.                                                              */
+extern void
+Poly_AddTo_Combination_Product_With_Scratch(int *P_coeffs, size_t count,
+                                            const int *scalars,
+                                            const int * const *A_coeffs,
+                                            size_t A_len,
+                                            const int *B_coeffs,
+                                            size_t B_len,
+                                            int *work);
+
+/*  Short product, P = A * B mod x^len, using the fastest available           *
+ *  algorithm. A and B may have any lengths.                                  */
+extern void
+Poly_Short_Product(int *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len,
+                   size_t len);
+
+/*  Scratch space, in ints, needed by Poly_Short_Product_With_Scratch.        */
+extern size_t Poly_Short_Scratch_Size(size_t A_len, size_t B_len, size_t len);
+
+/*  As Poly_Short_Product, with caller supplied scratch space. work must have *
+ *  room for Poly_Short_Scratch_Size(A_len, B_len, len) ints.                 */
+extern void
+Poly_Short_Product_With_Scratch(int *P_coeffs,
+                                const int *A_coeffs, size_t A_len,
+                                const int *B_coeffs, size_t B_len,
+                                size_t len, int *work);
+
+/*  Middle product, the coefficients of x^(B_len - 1) through x^(A_len - 1)   *
+ *  of A * B, using the fastest available algorithm. Assumes                  *
+ *  1 <= B_len <= A_len.                                                      */
+extern void
+Poly_Middle_Product(int *P_coeffs,
+                    const int *A_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Poly_Middle_Product_With_Scratch.       */
+extern size_t Poly_Middle_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Poly_Middle_Product, with caller supplied scratch space. work must     *
+ *  have room for Poly_Middle_Scratch_Size(A_len, B_len) ints.                */
+extern void
+Poly_Middle_Product_With_Scratch(int *P_coeffs,
+                                 const int *A_coeffs, size_t A_len,
+                                 const int *B_coeffs, size_t B_len,
+                                 int *work);
+
+/*  Power series inverse, I = 1 / B mod x^len, by Newton iteration on the     *
+ *  fast short and middle products. Returns 0 on success, and -1 if B[0] is   *
+ *  not 1 or -1.                                                              */
+extern int
+Poly_Series_Inverse(int *I_coeffs,
+                    const int *B_coeffs, size_t B_len,
+                    size_t len);
+
+/*  Scratch space, in ints, needed by Poly_Series_Inverse_With_Scratch.       */
+extern size_t Poly_Series_Inverse_Scratch_Size(size_t B_len, size_t len);
+
+/*  As Poly_Series_Inverse, with caller supplied scratch space. work must     *
+ *  have room for Poly_Series_Inverse_Scratch_Size(B_len, len) ints.          */
+extern int
+Poly_Series_Inverse_With_Scratch(int *I_coeffs,
+                                 const int *B_coeffs, size_t B_len,
+                                 size_t len, int *work);
+
+/*  Division with remainder, A = Q * B + R with deg(R) < deg(B), in about the *
+ *  time of a product. Returns 0 on success, and -1 if the leading            *
+ *  coefficient of B is not 1 or -1.                                          */
+extern int
+Poly_Divide(int *Q_coeffs, int *R_coeffs,
+            const int *A_coeffs, size_t A_len,
+            const int *B_coeffs, size_t B_len);
+
+/*  Scratch space, in ints, needed by Poly_Divide_With_Scratch.               */
+extern size_t Poly_Divide_Scratch_Size(size_t A_len, size_t B_len);
+
+/*  As Poly_Divide, with caller supplied scratch space. work must have room   *
+ *  for Poly_Divide_Scratch_Size(A_len, B_len) ints.                          */
+extern int
+Poly_Divide_With_Scratch(int *Q_coeffs, int *R_coeffs,
+                         const int *A_coeffs, size_t A_len,
+                         const int *B_coeffs, size_t B_len,
+                         int *work);
+
+/*  Precomputed data for many products against one polynomial B, see          *
+ *  Poly_Prepare.                                                             */
+typedef struct Poly_Plan_Def Poly_Plan;
+
+/*  Builds a plan for products A * B with A about A_len long, storing B's     *
+ *  transforms or Karatsuba sums. B is copied. Returns NULL on failure.       */
+extern Poly_Plan *Poly_Prepare(const int *B_coeffs, size_t B_len, size_t A_len);
+
+/*  Frees a plan. NULL is ignored.                                            */
+extern void Poly_Plan_Destroy(Poly_Plan *plan);
+
+/*  Scratch space, in ints, needed by Poly_Multiply_Prepared_With_Scratch.    */
+extern size_t Poly_Plan_Scratch_Size(const Poly_Plan *plan, size_t A_len);
+
+/*  Multiplication, P = A * B, for the B of a plan, with caller supplied      *
+ *  scratch space. work must have room for Poly_Plan_Scratch_Size(plan,       *
+ *  A_len) ints. A plan may be shared by several threads.                     */
+extern void
+Poly_Multiply_Prepared_With_Scratch(const Poly_Plan *plan, int *P_coeffs,
+                                    const int *A_coeffs, size_t A_len,
+                                    int *work);
+
+/*  Multiplication, P = A * B, for the B of a plan.                           */
+extern void
+Poly_Multiply_Prepared(const Poly_Plan *plan, int *P_coeffs,
+                       const int *A_coeffs, size_t A_len);
+
+/*  The state of a product A * B by overlap-add, with A given a piece at a    *
+ *  time, see Poly_Stream_Create.                                             */
+typedef struct Poly_Stream_Def Poly_Stream;
+
+/*  Starts a stream for the product of B with an A of any length, multiplied  *
+ *  block coefficients at a time. block = 0 picks a length. B is copied.      *
+ *  Returns NULL on failure.                                                  */
+extern Poly_Stream *
+Poly_Stream_Create(const int *B_coeffs, size_t B_len, size_t block);
+
+/*  Frees a stream. NULL is ignored.                                          */
+extern void Poly_Stream_Destroy(Poly_Stream *stream);
+
+/*  Gives the next A_len coefficients of A, and writes the coefficients of    *
+ *  A * B finished by them to P, which needs room for A_len + block - 1 ints. *
+ *  Returns the number written, a multiple of block.                          */
+extern size_t
+Poly_Stream_Push(Poly_Stream *stream, int *P_coeffs,
+                 const int *A_coeffs, size_t A_len);
+
+/*  Ends A, and writes the rest of A * B to P, which needs room for           *
+ *  block + B_len - 1 ints. Returns the number written. The stream may then   *
+ *  be used for a new A.                                                      */
+extern size_t Poly_Stream_Finish(Poly_Stream *stream, int *P_coeffs);
+
+/*  Precomputed data for many divisions by one polynomial B, see              *
+ *  Poly_Divisor_Prepare.                                                     */
+typedef struct Poly_Divisor_Def Poly_Divisor;
+
+/*  Builds a plan for divisions of polynomials about A_len long by B, storing *
+ *  the inverse of the reversed divisor. B is copied. Returns NULL if the     *
+ *  leading coefficient of B is not 1 or -1, or on failure.                   */
+extern Poly_Divisor *
+Poly_Divisor_Prepare(const int *B_coeffs, size_t B_len, size_t A_len);
+
+/*  Frees a plan for divisions. NULL is ignored.                              */
+extern void Poly_Divisor_Destroy(Poly_Divisor *plan);
+
+/*  Scratch space, in ints, needed by Poly_Divide_Prepared_With_Scratch.      */
+extern size_t Poly_Divisor_Scratch_Size(const Poly_Divisor *plan, size_t A_len);
+
+/*  Division with remainder, A = Q * B + R, for the B of a plan, with caller  *
+ *  supplied scratch space. work must have room for                           *
+ *  Poly_Divisor_Scratch_Size(plan, A_len) ints. A plan may be shared by      *
+ *  several threads.                                                          */
+extern void
+Poly_Divide_Prepared_With_Scratch(const Poly_Divisor *plan,
+                                  int *Q_coeffs, int *R_coeffs,
+                                  const int *A_coeffs, size_t A_len,
+                                  int *work);
+
+/*  Division with remainder, A = Q * B + R, for the B of a plan.              */
+extern void
+Poly_Divide_Prepared(const Poly_Divisor *plan,
+                     int *Q_coeffs, int *R_coeffs,
+                     const int *A_coeffs, size_t A_len);
+
+/*  Multiplication with 64-bit outputs, P = A * B, using Naive_Product_Wide   *
+ *  or NTT_Product_Wide. The operands may be given in either order.           */
+extern void
+Poly_Multiply_Wide(long long *P_coeffs,
+                   const int *A_coeffs, size_t A_len,
+                   const int *B_coeffs, size_t B_len);
+
+/*  Sets up mod for arithmetic modulo p. Returns 0 on success, and -1 if p is *
+ *  even, less than 3, or greater than POLY_MODULUS_MAX.                      */
+extern int Poly_Modulus_Init(Poly_Modulus *mod, unsigned int p);
+
+/*  Computes P[m + n] += A[m] * B[n] mod p for all m and n.                   */
+extern void
+Naive_Kernel_Mod(unsigned int *P_coeffs,
+                 const unsigned int *A_coeffs, size_t A_len,
+                 const unsigned int *B_coeffs, size_t B_len,
+                 const Poly_Modulus *mod);
+
+/*  Naive multiplication modulo p, P = A * B mod p.                           */
+extern void
+Naive_Product_Mod(unsigned int *P_coeffs,
+                  const unsigned int *A_coeffs, size_t A_len,
+                  const unsigned int *B_coeffs, size_t B_len,
+                  const Poly_Modulus *mod);
+
+/*  As Naive_AddTo_Product, modulo p. The coefficients of P must lie in       *
+ *  [0, p).                                                                   */
+extern void
+Naive_AddTo_Product_Mod(unsigned int *P_coeffs,
+                        const unsigned int *A_coeffs, size_t A_len,
+                        const unsigned int *B_coeffs, size_t B_len,
+                        const Poly_Modulus *mod);
+
+/*  Computes P += c * A mod p for a scalar c in [0, p).                       */
+extern void
+Scaled_AddTo_Mod(unsigned int *P_coeffs,
+                 const unsigned int *A_coeffs, size_t len,
+                 unsigned int scalar, const Poly_Modulus *mod);
+
+/*  Number theoretic transform multiplication modulo p, P = A * B mod p. If   *
+ *  p is not prime, or p - 1 has too few factors of two for the length of     *
+ *  the product, this uses Naive_Product_Mod.                                 */
+extern void
+NTT_Product_Mod(unsigned int *P_coeffs,
+                const unsigned int *A_coeffs, size_t A_len,
+                const unsigned int *B_coeffs, size_t B_len,
+                const Poly_Modulus *mod);
+
+/*  Scratch space, in unsigned ints, needed by NTT_Product_Mod_With_Scratch.  *
+ *  This is zero if the product is computed with the naive method.            */
+extern size_t
+NTT_Scratch_Size_Mod(size_t A_len, size_t B_len, const Poly_Modulus *mod);
+
+/*  As NTT_Product_Mod, with caller supplied scratch space. work must have    *
+ *  room for NTT_Scratch_Size_Mod(A_len, B_len, mod) unsigned ints.           */
+extern void
+NTT_Product_Mod_With_Scratch(unsigned int *P_coeffs,
+                             const unsigned int *A_coeffs, size_t A_len,
+                             const unsigned int *B_coeffs, size_t B_len,
+                             unsigned int *work, const Poly_Modulus *mod);
+
+/*  Multiplication modulo p, P = A * B mod p, using Naive_Product_Mod or      *
+ *  NTT_Product_Mod. The operands may be given in either order.               */
+extern void
+Poly_Multiply_Mod(unsigned int *P_coeffs,
+                  const unsigned int *A_coeffs, size_t A_len,
+                  const unsigned int *B_coeffs, size_t B_len,
+                  const Poly_Modulus *mod);
+
+/*  Chooses the SIMD kernels of every coefficient type for the CPU. The       *
+ *  kernels are otherwise chosen on first use, which is a data race if that   *
+ *  happens on several threads at once. Poly_Pool_Create calls this, and a    *
+ *  program computing products on threads of its own must call it before      *
+ *  starting them.                                                            */
+extern void Poly_Kernel_Init(void);
+
+/*  The instruction sets of the SIMD kernels, in the order they are preferred *
+ *  on one CPU. POLY_KERNEL_BEST lifts any cap.                               */
+typedef enum Poly_Kernel_Level_Def {
+    POLY_KERNEL_PORTABLE,
+    POLY_KERNEL_AVX2,
+    POLY_KERNEL_AVX512,
+    POLY_KERNEL_NEON,
+    POLY_KERNEL_BEST
+} Poly_Kernel_Level;
+
+/*  Caps the SIMD kernels at the given level and chooses them again, so that  *
+ *  the slower kernels can be tested on a CPU that would never use them. A    *
+ *  routine with no kernel for that level uses the best one below it. Returns *
+ *  0 on success, and -1 if the CPU or the build lacks the instruction set,   *
+ *  in which case nothing changes. Must not be called while other threads     *
+ *  are computing products.                                                   */
+extern int Poly_Set_Kernel_Level(Poly_Kernel_Level level);
+
+/*  Returns 1 if the kernels of the given level are within the cap, else 0.   */
+extern int Poly_Kernel_Allows(Poly_Kernel_Level level);
+
+/*  A reusable pool of worker threads, see Poly_Pool_Create.                  */
+typedef struct Poly_Pool_Def Poly_Pool;
+
+/*  The context of the thread running a task, giving access to its queue of   *
+ *  tasks and its scratch arena.                                              */
+typedef struct Poly_Worker_Def Poly_Worker;
+
+/*  A unit of work for a Poly_Pool. The caller owns the memory, and sets func *
+ *  and data. The remaining members are used by the pool.                     */
+typedef struct Poly_Task_Def {
+    void (*func)(Poly_Worker *worker, void *data);
+    void *data;
+    size_t *pending;
+    struct Poly_Task_Def *prev;
+    struct Poly_Task_Def *next;
+} Poly_Task;
+
+/*  Starts a pool of worker threads. If threads is zero, one thread is        *
+ *  started per online processor. Returns NULL on failure.                    */
+extern Poly_Pool *Poly_Pool_Create(size_t threads);
+
+/*  Stops the worker threads and frees the pool. No call to Poly_Pool_Run may *
+ *  be in progress.                                                           */
+extern void Poly_Pool_Destroy(Poly_Pool *pool);
+
+/*  The number of worker threads in the pool. This is zero if threads are not *
+ *  available, in which case every task is run by the calling thread.         */
+extern size_t Poly_Pool_Threads(const Poly_Pool *pool);
+
+/*  Runs func(worker, data) on one of the workers of the pool, and waits for  *
+ *  it to return. May be called from several threads at once.                 */
+extern void
+Poly_Pool_Run(Poly_Pool *pool,
+              void (*func)(Poly_Worker *worker, void *data),
+              void *data);
+
+/*  Queues a task to be run by any worker, and increments *pending. It is     *
+ *  decremented once the task has returned. Only callable from a task.        */
+extern void
+Poly_Worker_Spawn(Poly_Worker *worker, Poly_Task *task, size_t *pending);
+
+/*  Runs queued tasks, including those of other workers, until *pending is    *
+ *  zero. Only callable from a task.                                          */
+extern void Poly_Worker_Join(Poly_Worker *worker, size_t *pending);
+
+/*  Returns len ints of scratch space from the arena of the worker. Blocks    *
+ *  must be released in the reverse order. Returns NULL on failure.           */
+extern int *Poly_Worker_Scratch(Poly_Worker *worker, size_t len);
+
+/*  Releases a block returned by Poly_Worker_Scratch. NULL is ignored.        */
+extern void Poly_Worker_Release(Poly_Worker *worker, int *scratch);
+
+/*  Multiplication, P = A * B, with the sub-products of Karatsuba steps       *
+ *  computed in parallel by the workers of pool. If pool is NULL this is the  *
+ *  same as Poly_Multiply.                                                    */
+extern void
+Poly_Multiply_Parallel(Poly_Pool *pool,
+                       int *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len);
+
+/*  Computes P[i] = A[i] * B[i] for i = 0, ..., count - 1. The operands of    *
+ *  each product have lengths A_len[i] and B_len[i], in either order. Short   *
+ *  products are computed NAIVE_BATCH_LANES at a time, and the batch is       *
+ *  shared between the workers of pool, which may be NULL.                    */
+extern void
+Poly_Multiply_Batch(Poly_Pool *pool, size_t count,
+                    int * const *P_coeffs,
+                    const int * const *A_coeffs, const size_t *A_len,
+                    const int * const *B_coeffs, const size_t *B_len);
+
+/*  As Poly_Multiply_Batch, for products of the same lengths stored at fixed  *
+ *  strides, so that product i is P + i*P_stride = (A + i*A_stride) *         *
+ *  (B + i*B_stride). The strides count ints.                                 */
+extern void
+Poly_Multiply_Batch_Strided(Poly_Pool *pool, size_t count,
+                            int *P_coeffs, size_t P_stride,
+                            const int *A_coeffs, size_t A_len, size_t A_stride,
+                            const int *B_coeffs, size_t B_len, size_t B_stride);
+
+/*  A backend, such as a GPU, that Poly_Multiply, Poly_Multiply_Batch and     *
+ *  Poly_Multiply_Batch_Strided hand work to, see Poly_Set_Offload. Each      *
+ *  function returns 0 if it computed the products, or anything else to have  *
+ *  them computed on the CPU as usual, and may be NULL. They must not call    *
+ *  those three functions themselves, as the product would be offered again.  *
+ *  multiply may be called by several threads at once, for instance for the   *
+ *  long products of a batch shared between the workers of a pool.            */
+typedef struct Poly_Offload_Def {
+
+    /*  Computes P = A * B, given the shorter operand first, A_len >= 1.      */
+    int (*multiply)(int *P_coeffs,
+                    const int *A_coeffs, size_t A_len,
+                    const int *B_coeffs, size_t B_len,
+                    void *data);
+
+    /*  Computes a batch of products, as Poly_Multiply_Batch.                 */
+    int (*batch)(size_t count,
+                 int * const *P_coeffs,
+                 const int * const *A_coeffs, const size_t *A_len,
+                 const int * const *B_coeffs, const size_t *B_len,
+                 void *data);
+
+    /*  Computes a batch of products, as Poly_Multiply_Batch_Strided.         */
+    int (*batch_strided)(size_t count,
+                         int *P_coeffs, size_t P_stride,
+                         const int *A_coeffs, size_t A_len, size_t A_stride,
+                         const int *B_coeffs, size_t B_len, size_t B_stride,
+                         void *data);
+
+    /*  Products whose shorter operand has fewer than min_length coefficients *
+     *  and batches of fewer than min_batch products stay on the CPU, where   *
+     *  the transfers would cost more than they save.                         */
+    size_t min_length;
+    size_t min_batch;
+
+    /*  Passed to each of the functions.                                      */
+    void *data;
+} Poly_Offload;
+
+/*  Registers the backend for offloaded products, which is copied. NULL       *
+ *  removes it. Not thread safe, set it at start up.                          */
+extern void Poly_Set_Offload(const Poly_Offload *offload);
+
+/*  The registered backend, or NULL if there is none.                         */
+extern const Poly_Offload *Poly_Get_Offload(void);
+
+/*  Offer a product or a batch to the backend, as used by Poly_Multiply and   *
+ *  Poly_Multiply_Batch. Return 0 if the backend computed it, and -1 if no    *
+ *  backend is registered, the work is below its thresholds, or it declined.  */
+extern int
+Poly_Offload_Multiply(int *P_coeffs,
+                      const int *A_coeffs, size_t A_len,
+                      const int *B_coeffs, size_t B_len);
+
+extern int
+Poly_Offload_Batch(size_t count,
+                   int * const *P_coeffs,
+                   const int * const *A_coeffs, const size_t *A_len,
+                   const int * const *B_coeffs, const size_t *B_len);
+
+extern int
+Poly_Offload_Batch_Strided(size_t count,
+                           int *P_coeffs, size_t P_stride,
+                           const int *A_coeffs, size_t A_len, size_t A_stride,
+                           const int *B_coeffs, size_t B_len, size_t B_stride);
+
+/*  Declares the functions for polynomials with coefficients of a given type, *
+ *  named by appending a suffix to the names of the int functions. These are  *
+ *  defined by poly_template.h, see poly_int16.c for example.                 */
+#define POLY_DECLARE_TYPE(type, suffix)                                        \
+extern void Naive_Kernel_Init_##suffix(void);                                  \
+                                                                               \
+extern void                                                                    \
+Naive_Kernel_##suffix(type *P_coeffs,                                          \
+                      const type *A0_coeffs,                                   \
+                      const type *A1_coeffs, size_t A_len,                     \
+                      const type *B_coeffs, size_t B_len);                     \
+                                                                               \
+extern void                                                                    \
+Naive_Product_##suffix(type *P_coeffs,                                         \
+                       const type *A_coeffs, size_t A_len,                     \
+                       const type *B_coeffs, size_t B_len);                    \
+                                                                               \
+extern void                                                                    \
+Naive_AddTo_Product_##suffix(type *P_coeffs,                                   \
+                             const type *A_coeffs, size_t A_len,               \
+                             const type *B_coeffs, size_t B_len);              \
+                                                                               \
+extern void                                                                    \
+Naive_AddTo_Sum_Product_##suffix(type *P_coeffs,                               \
+                                 const type *A0_coeffs,                        \
+                                 const type *A1_coeffs, size_t A_len,          \
+                                 const type *B_coeffs, size_t B_len);          \
+                                                                               \
+extern void                                                                    \
+Scaled_AddTo_##suffix(type *P_coeffs, const type *A_coeffs, size_t len,        \
+                      type scalar);                                            \
+                                                                               \
+extern size_t Karatsuba_Scratch_Size_##suffix(size_t A_len, size_t B_len);     \
+                                                                               \
+extern void                                                                    \
+Karatsuba_Product_With_Scratch_##suffix(type *P_coeffs,                        \
+                                        const type *A_coeffs, size_t A_len,    \
+                                        const type *B_coeffs, size_t B_len,    \
+                                        type *work);                           \
+                                                                               \
+extern void                                                                    \
+Karatsuba_Product_##suffix(type *P_coeffs,                                     \
+                           const type *A_coeffs, size_t A_len,                 \
+                           const type *B_coeffs, size_t B_len);                \
+                                                                               \
+extern void                                                                    \
+Poly_Multiply_##suffix(type *P_coeffs,                                         \
+                       const type *A_coeffs, size_t A_len,                     \
+                       const type *B_coeffs, size_t B_len)
+
+/*  Coefficients of type short, computed modulo 2^16.                         */
+POLY_DECLARE_TYPE(short, Int16);
+
+/*  Coefficients of type long long, computed modulo 2^64.                     */
+POLY_DECLARE_TYPE(long long, Int64);
+
+/*  Coefficients of type float and double.                                    */
+POLY_DECLARE_TYPE(float, Float);
+POLY_DECLARE_TYPE(double, Double);
+
+/*  The coefficient types of a polynomial file, as stored in its header. The  *
+ *  C types are short, int, long long, float, and double, in that order.      */
+typedef enum Poly_File_Type_Def {
+    POLY_FILE_INT16 = 1,
+    POLY_FILE_INT32 = 2,
+    POLY_FILE_INT64 = 3,
+    POLY_FILE_FLOAT = 4,
+    POLY_FILE_DOUBLE = 5
+} Poly_File_Type;
+
+/*  A polynomial file mapped into memory, see Poly_File_Open. The format is   *
+ *  described in poly_file.c.                                                 */
+typedef struct Poly_File_Def Poly_File;
+
+/*  Maps a polynomial file for reading. Returns NULL if the file can not be   *
+ *  mapped, is malformed, or does not match the C types of this machine.      */
+extern Poly_File *Poly_File_Open(const char *path);
+
+/*  Creates a polynomial file of len zero coefficients, mapped for writing.   *
+ *  An existing file is replaced. The space is allocated up front, so a full  *
+ *  disk fails here. Returns NULL on failure, with errno set.                 */
+extern Poly_File *
+Poly_File_Create(const char *path, Poly_File_Type type, size_t len);
+
+/*  Unmaps a polynomial file, first syncing what was written to the file.     *
+ *  Returns 0 on success and -1 if either failed. NULL is ignored.            */
+extern int Poly_File_Close(Poly_File *file);
+
+/*  The coefficients of a mapped file, aligned for its type, which may be     *
+ *  passed to the product functions as they are.                              */
+extern const void *Poly_File_Coeffs(const Poly_File *file);
+
+/*  The coefficients of a file from Poly_File_Create, for writing a result    *
+ *  into. NULL for a file from Poly_File_Open.                                */
+extern void *Poly_File_Data(Poly_File *file);
+
+/*  The number of coefficients and the coefficient type of a mapped file.     */
+extern size_t Poly_File_Length(const Poly_File *file);
+extern Poly_File_Type Poly_File_Get_Type(const Poly_File *file);
+
+/*  Multiplies the polynomials in the files A_path and B_path, of the same    *
+ *  type, writing the product to a new file P_path with Poly_Multiply or the  *
+ *  function for the type. Returns 0 on success and -1 on failure, which      *
+ *  includes P_path being the file of A or of B.                              */
+extern int
+Poly_File_Multiply(const char *P_path, const char *A_path, const char *B_path);
+
+/*  With C11, the function for a coefficient type may be selected from the    *
+ *  type of the output, for example Poly_Multiply_Generic(P, A, m, B, n).     */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+#define POLY_GENERIC(name, P)                                                  \
+    _Generic((P),                                                              \
+        short *: name##_Int16,                                                 \
+        int *: name,                                                           \
+        long long *: name##_Int64,                                             \
+        float *: name##_Float,                                                 \
+        double *: name##_Double                                                \
+    )
+
+#define Naive_Product_Generic(P, ...)                                          \
+    POLY_GENERIC(Naive_Product, P)(P, __VA_ARGS__)
+
+#define Naive_AddTo_Product_Generic(P, ...)                                    \
+    POLY_GENERIC(Naive_AddTo_Product, P)(P, __VA_ARGS__)
+
+#define Naive_AddTo_Sum_Product_Generic(P, ...)                                \
+    POLY_GENERIC(Naive_AddTo_Sum_Product, P)(P, __VA_ARGS__)
+
+#define Scaled_AddTo_Generic(P, ...)                                           \
+    POLY_GENERIC(Scaled_AddTo, P)(P, __VA_ARGS__)
+
+#define Karatsuba_Product_Generic(P, ...)                                      \
+    POLY_GENERIC(Karatsuba_Product, P)(P, __VA_ARGS__)
+
+#define Karatsuba_Product_With_Scratch_Generic(P, ...)                         \
+    POLY_GENERIC(Karatsuba_Product_With_Scratch, P)(P, __VA_ARGS__)
+
+#define Poly_Multiply_Generic(P, ...)                                          \
+    POLY_GENERIC(Poly_Multiply, P)(P, __VA_ARGS__)
+
+#endif
+/*  End of #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L.      */
+
 #endif
 /*  End of include guard.                                                     */
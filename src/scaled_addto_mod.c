@@ -0,0 +1,99 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds a scalar multiple of a polynomial to another, modulo p.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Scaled_AddTo_Mod                                                      *
+ *  Purpose:                                                                  *
+ *      Computes P += c * A mod p.                                            *
+ *  Arguments:                                                                *
+ *      P_coeffs (unsigned int *):                                            *
+ *          A pointer to an array of residues, at least len wide.             *
+ *      A_coeffs (const unsigned int *):                                      *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *      scalar (unsigned int):                                                *
+ *          The constant c, in [0, p).                                        *
+ *      mod (const Poly_Modulus *):                                           *
+ *          The modulus, set up by Poly_Modulus_Init.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Put c in Montgomery form once, c R mod p. A Montgomery product of     *
+ *      A[n] with it is then the ordinary residue c A[n] mod p, so each       *
+ *      coefficient costs one reduction and no division.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Computes a b / 2^32 mod p for a, b in [0, p).                             */
+static unsigned int
+scaled_addto_mod_mul(unsigned int a, unsigned int b, const Poly_Modulus *mod)
+{
+    const unsigned long long t = (unsigned long long)a * b;
+    const unsigned int m = (unsigned int)t * mod->p_inv;
+    const unsigned int u = (unsigned int)(
+        (t + (unsigned long long)m * mod->p) >> 32
+    );
+
+    return (u >= mod->p ? u - mod->p : u);
+}
+/*  End of scaled_addto_mod_mul.                                              */
+
+/*  Computes P += c * A mod p where P and A are polynomials.                  */
+void
+Scaled_AddTo_Mod(unsigned int *P_coeffs,
+                 const unsigned int *A_coeffs, size_t len,
+                 unsigned int scalar, const Poly_Modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned int u;
+
+    /*  c R mod p, so the Montgomery products below are ordinary residues.    */
+    const unsigned int c = scaled_addto_mod_mul(scalar, mod->r2, mod);
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        u = P_coeffs[n] + scaled_addto_mod_mul(A_coeffs[n], c, mod);
+        P_coeffs[n] = (u >= mod->p ? u - mod->p : u);
+    }
+}
+/*  End of Scaled_AddTo_Mod.                                                  */
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts polynomials between the dense and sparse formats.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Sparse_From_Dense                                                     *
+ *  Purpose:                                                                  *
+ *      Lists the non-zero terms of a polynomial.                             *
+ *  Arguments:                                                                *
+ *      terms (Poly_Term *):                                                  *
+ *          A pointer to an array of terms, at least as wide as the number    *
+ *          of non-zero coefficients. len always suffices.                    *
+ *      coeffs (const int *):                                                 *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the polynomial.                                     *
+ *  Output:                                                                   *
+ *      count (size_t):                                                       *
+ *          The number of terms written.                                      *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Append each non-zero coefficient with its index as the exponent.      *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Sparse_To_Dense                                                       *
+ *  Purpose:                                                                  *
+ *      Writes out the coefficients of a sparse polynomial.                   *
+ *  Arguments:                                                                *
+ *      coeffs (int *):                                                       *
+ *          A pointer to an array of ints, at least e + 1 wide, where e is    *
+ *          the exponent of the last term.                                    *
+ *      terms (const Poly_Term *):                                            *
+ *          The terms, in increasing order of exponent.                       *
+ *      count (size_t):                                                       *
+ *          The number of terms.                                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Zero the array and store each coefficient at its exponent.            *
+ *  Notes:                                                                    *
+ *      If there are no terms, coeffs is not touched.                         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for listing the non-zero terms of a polynomial.                  */
+size_t Sparse_From_Dense(Poly_Term *terms, const int *coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    size_t count = (size_t)0;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        if (coeffs[n] == 0)
+            continue;
+
+        terms[count].exponent = n;
+        terms[count].coeff = coeffs[n];
+        ++count;
+    }
+
+    return count;
+}
+/*  End of Sparse_From_Dense.                                                 */
+
+/*  Function for writing out the coefficients of a sparse polynomial.         */
+void Sparse_To_Dense(int *coeffs, const Poly_Term *terms, size_t count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+
+    if (count == (size_t)0)
+        return;
+
+    len = terms[count - (size_t)1].exponent + (size_t)1;
+
+    for (n = (size_t)0; n < len; ++n)
+        coeffs[n] = 0;
+
+    for (n = (size_t)0; n < count; ++n)
+        coeffs[terms[n].exponent] = terms[n].coeff;
+}
+/*  End of Sparse_To_Dense.                                                   */
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies a sparse polynomial by a dense one.                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Sparse_Dense_Product                                                  *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B where A is given by its non-zero terms and B by its  *
+ *      coefficients.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least e + B_len wide, where e   *
+ *          is the exponent of the last term of A.                            *
+ *      A_terms (const Poly_Term *):                                          *
+ *          The terms of A, in increasing order of exponent.                  *
+ *      A_count (size_t):                                                     *
+ *          The number of terms of A.                                         *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds the multiple of B for each term of A.                        *
+ *  Method:                                                                   *
+ *      Zero P, and add c x^e B to it for each term c x^e of A. This takes    *
+ *      A_count B_len operations, against the A_len B_len of the naive dense  *
+ *      product, and the adds are contiguous and vectorize.                   *
+ *  Notes:                                                                    *
+ *      If A has no terms or B is empty, P is not touched.                    *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Sparse_AddTo_Dense_Product                                            *
+ *  Purpose:                                                                  *
+ *      Computes P += A*B where A is given by its non-zero terms and B by its *
+ *      coefficients.                                                         *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least e + B_len wide, where e   *
+ *          is the exponent of the last term of A.                            *
+ *      A_terms (const Poly_Term *):                                          *
+ *          The terms of A, in increasing order of exponent.                  *
+ *      A_count (size_t):                                                     *
+ *          The number of terms of A.                                         *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Scaled_AddTo (polynomial_multiplication.h):                           *
+ *          Adds the multiple of B for each term of A.                        *
+ *  Method:                                                                   *
+ *      As Sparse_Dense_Product, without zeroing P first.                     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Function for computing P += A*B with A sparse and B dense.                */
+void
+Sparse_AddTo_Dense_Product(int *P_coeffs,
+                           const Poly_Term *A_terms, size_t A_count,
+                           const int *B_coeffs, size_t B_len)
+{
+    /*  Variable for indexing over the terms of A.                            */
+    size_t n;
+
+    for (n = (size_t)0; n < A_count; ++n)
+        Scaled_AddTo(
+            P_coeffs + A_terms[n].exponent, B_coeffs, B_len, A_terms[n].coeff
+        );
+}
+/*  End of Sparse_AddTo_Dense_Product.                                        */
+
+/*  Function for computing P = A*B with A sparse and B dense.                 */
+void
+Sparse_Dense_Product(int *P_coeffs,
+                     const Poly_Term *A_terms, size_t A_count,
+                     const int *B_coeffs, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, P_len;
+
+    /*  The product with an empty polynomial is empty.                        */
+    if (A_count == (size_t)0 || B_len == (size_t)0)
+        return;
+
+    P_len = A_terms[A_count - (size_t)1].exponent + B_len;
+
+    for (n = (size_t)0; n < P_len; ++n)
+        P_coeffs[n] = 0;
+
+    Sparse_AddTo_Dense_Product(P_coeffs, A_terms, A_count, B_coeffs, B_len);
+}
+/*  End of Sparse_Dense_Product.                                              */
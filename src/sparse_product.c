@@ -0,0 +1,292 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two sparse polynomials, given as lists of terms.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Sparse_Product                                                        *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B for polynomials given by their non-zero terms.       *
+ *  Arguments:                                                                *
+ *      P_terms (Poly_Term *):                                                *
+ *          A pointer to an array of terms, at least A_count * B_count wide.  *
+ *      A_terms (const Poly_Term *):                                          *
+ *          The terms of A, in increasing order of exponent.                  *
+ *      A_count (size_t):                                                     *
+ *          The number of terms of A.                                         *
+ *      B_terms (const Poly_Term *):                                          *
+ *          The terms of B, in increasing order of exponent.                  *
+ *      B_count (size_t):                                                     *
+ *          The number of terms of B.                                         *
+ *  Output:                                                                   *
+ *      count (size_t):                                                       *
+ *          The number of terms written to P.                                 *
+ *  Called Functions:                                                         *
+ *      malloc (stdlib.h):                                                    *
+ *          Allocates the heap.                                               *
+ *      free (stdlib.h):                                                      *
+ *          Releases the heap.                                                *
+ *      qsort (stdlib.h):                                                     *
+ *          Used if the heap can not be allocated.                            *
+ *  Method:                                                                   *
+ *      Johnson's heap merge. With A the operand with fewer terms, row i of   *
+ *      the products is A[i] times each term of B, in increasing order. A     *
+ *      heap holds the next product of each row started so far, keyed on the  *
+ *      exponent, so the products come off it in increasing order and equal   *
+ *      exponents are summed as they arrive. Row i + 1 is only started once   *
+ *      the first product of row i is taken, so the heap stays small while    *
+ *      the exponents are far apart. This takes O(A_count B_count log A_count)*
+ *      time and O(A_count) memory, however far apart the exponents are.      *
+ *  Notes:                                                                    *
+ *      The terms of P are in increasing order of exponent, and terms that    *
+ *      cancel are left out. If the heap can not be allocated, every product  *
+ *      is written to P and they are sorted and combined, which is slower.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ *  3.) stdlib.h:                                                             *
+ *          Header file providing malloc, free, and qsort.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  malloc, free, and qsort found here.                                       */
+#include <stdlib.h>
+
+/*  The next product of a row, A[i] times B[j], and its exponent.             */
+typedef struct sparse_product_entry_def {
+    size_t exponent;
+    size_t i, j;
+} sparse_product_entry;
+
+/*  Orders terms by exponent, for qsort.                                      */
+static int sparse_product_compare(const void *a, const void *b)
+{
+    const size_t x = ((const Poly_Term *)a)->exponent;
+    const size_t y = ((const Poly_Term *)b)->exponent;
+    return (x > y) - (x < y);
+}
+/*  End of sparse_product_compare.                                            */
+
+/*  Adds a term to the end of P, summing it with the last if the exponents    *
+ *  are equal, and overwriting the last if it cancelled to zero.              */
+static void
+sparse_product_append(Poly_Term *P_terms, size_t *count,
+                      size_t exponent, int coeff)
+{
+    if (*count > (size_t)0)
+    {
+        Poly_Term * const last = P_terms + *count - 1;
+
+        if (last->exponent == exponent)
+        {
+            last->coeff += coeff;
+            return;
+        }
+
+        if (last->coeff == 0)
+            --*count;
+    }
+
+    P_terms[*count].exponent = exponent;
+    P_terms[*count].coeff = coeff;
+    ++*count;
+}
+/*  End of sparse_product_append.                                             */
+
+/*  Moves the entry at index k of the heap up until its parent is smaller.    */
+static void sparse_product_sift_up(sparse_product_entry *heap, size_t k)
+{
+    const sparse_product_entry entry = heap[k];
+    size_t parent;
+
+    while (k > (size_t)0)
+    {
+        parent = (k - (size_t)1) >> 1;
+
+        if (heap[parent].exponent <= entry.exponent)
+            break;
+
+        heap[k] = heap[parent];
+        k = parent;
+    }
+
+    heap[k] = entry;
+}
+/*  End of sparse_product_sift_up.                                            */
+
+/*  Moves the entry at the root of the heap down until its children are       *
+ *  larger.                                                                   */
+static void sparse_product_sift_down(sparse_product_entry *heap, size_t size)
+{
+    const sparse_product_entry entry = heap[0];
+    size_t k = (size_t)0;
+    size_t child;
+
+    for (;;)
+    {
+        child = (k << 1) + (size_t)1;
+
+        if (child >= size)
+            break;
+
+        if (child + (size_t)1 < size &&
+            heap[child + (size_t)1].exponent < heap[child].exponent)
+            ++child;
+
+        if (entry.exponent <= heap[child].exponent)
+            break;
+
+        heap[k] = heap[child];
+        k = child;
+    }
+
+    heap[k] = entry;
+}
+/*  End of sparse_product_sift_down.                                          */
+
+/*  Function for multiplying two sparse polynomials.                          */
+size_t
+Sparse_Product(Poly_Term *P_terms,
+               const Poly_Term *A_terms, size_t A_count,
+               const Poly_Term *B_terms, size_t B_count)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    sparse_product_entry *heap;
+    sparse_product_entry top;
+    const Poly_Term *tmp_terms;
+    size_t tmp_count, size, count, i, j;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  The heap has one entry per row, so use the operand with fewer terms.  */
+    if (A_count > B_count)
+    {
+        tmp_terms = A_terms;
+        A_terms = B_terms;
+        B_terms = tmp_terms;
+
+        tmp_count = A_count;
+        A_count = B_count;
+        B_count = tmp_count;
+    }
+
+    /*  The product with an empty polynomial has no terms.                    */
+    if (A_count == zero)
+        return zero;
+
+    count = zero;
+    heap = malloc(sizeof(*heap) * A_count);
+
+    /*  If malloc fails, sort all of the products instead.                    */
+    if (!heap)
+    {
+        for (i = zero; i < A_count; ++i)
+        {
+            for (j = zero; j < B_count; ++j)
+            {
+                P_terms[i*B_count + j].exponent =
+                    A_terms[i].exponent + B_terms[j].exponent;
+
+                P_terms[i*B_count + j].coeff =
+                    A_terms[i].coeff * B_terms[j].coeff;
+            }
+        }
+
+        qsort(P_terms, A_count*B_count, sizeof(*P_terms),
+              sparse_product_compare);
+
+        /*  Combining in place is safe, as count never passes the index.      */
+        for (i = zero; i < A_count*B_count; ++i)
+            sparse_product_append(
+                P_terms, &count, P_terms[i].exponent, P_terms[i].coeff
+            );
+    }
+
+    else
+    {
+        /*  Start with the first product of the first row.                    */
+        heap[0].exponent = A_terms[0].exponent + B_terms[0].exponent;
+        heap[0].i = heap[0].j = zero;
+        size = one;
+
+        while (size > zero)
+        {
+            top = heap[0];
+            i = top.i;
+            j = top.j;
+
+            sparse_product_append(
+                P_terms, &count, top.exponent,
+                A_terms[i].coeff * B_terms[j].coeff
+            );
+
+            /*  Replace the root with the next product of its row, or with    *
+             *  the last entry if the row is finished.                        */
+            if (j + one < B_count)
+            {
+                heap[0].exponent = A_terms[i].exponent +
+                                   B_terms[j + one].exponent;
+                heap[0].j = j + one;
+            }
+
+            else
+                heap[0] = heap[--size];
+
+            if (size > zero)
+                sparse_product_sift_down(heap, size);
+
+            /*  The first product of row i was taken, so start row i + 1.     */
+            if (j == zero && i + one < A_count)
+            {
+                heap[size].exponent = A_terms[i + one].exponent +
+                                      B_terms[0].exponent;
+                heap[size].i = i + one;
+                heap[size].j = zero;
+                sparse_product_sift_up(heap, size);
+                ++size;
+            }
+        }
+
+        free(heap);
+    }
+
+    /*  The last term may have cancelled too.                                 */
+    if (count > zero && P_terms[count - one].coeff == 0)
+        --count;
+
+    return count;
+}
+/*  End of Sparse_Product.                                                    */
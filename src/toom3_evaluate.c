@@ -0,0 +1,101 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluation step of the Toom-Cook 3-way algorithm.                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Toom3_Evaluate                                                        *
+ *  Purpose:                                                                  *
+ *      Given A = A0 + x^k A1 + x^{2k} A2, computes the polynomials           *
+ *      A(1) = A0 + A1 + A2, A(-1) = A0 - A1 + A2, and A(-2) = A0 - 2 A1 +    *
+ *      4 A2, where A0 and A1 have length k and A2 has length l <= k.         *
+ *  Arguments:                                                                *
+ *      E_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, at least 3k wide. A(1) is    *
+ *          stored in the first k entries, A(-1) in the next k, and A(-2) in  *
+ *          the last k.                                                       *
+ *      A_coeffs (const long long *):                                         *
+ *          A pointer to the coefficient array of a polynomial, 2k + l wide.  *
+ *      k (size_t):                                                           *
+ *          The length of the A0 and A1 pieces.                               *
+ *      l (size_t):                                                           *
+ *          The length of the A2 piece.                                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      With t = A0 + A2 we have A(1) = t + A1, A(-1) = t - A1, and           *
+ *      A(-2) = 2 (A(-1) + A2) - A0. This is done in a single pass.           *
+ *  Notes:                                                                    *
+ *      This is a utility function for the Toom-Cook algorithm. The values    *
+ *      at 0 and at infinity are A0 and A2, which need not be copied. The     *
+ *      arithmetic is unsigned, so the values are exact modulo 2^64.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Evaluates the three pieces of A at the points 1, -1, and -2.              */
+void
+Toom3_Evaluate(long long *E_coeffs, const long long *A_coeffs,
+               size_t k, size_t l)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long long t, a0, a1, a2, m1;
+
+    /*  Pointers to the three pieces of A, and the three outputs.             */
+    const long long *A0 = A_coeffs;
+    const long long *A1 = A_coeffs + k;
+    const long long *A2 = A_coeffs + 2*k;
+    long long *E_p1 = E_coeffs;
+    long long *E_m1 = E_coeffs + k;
+    long long *E_m2 = E_coeffs + 2*k;
+
+    /*  Loop over the entries and evaluate. A2 is zero past its length.       */
+    for (n = (size_t)0; n < k; ++n)
+    {
+        a0 = (unsigned long long)A0[n];
+        a1 = (unsigned long long)A1[n];
+        a2 = (n < l ? (unsigned long long)A2[n] : 0ULL);
+        t = a0 + a2;
+        m1 = t - a1;
+        E_p1[n] = (long long)(t + a1);
+        E_m1[n] = (long long)m1;
+        E_m2[n] = (long long)(2ULL*(m1 + a2) - a0);
+    }
+}
+/*  End of Toom3_Evaluate.                                                    */
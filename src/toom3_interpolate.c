@@ -0,0 +1,150 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Interpolation step of the Toom-Cook 3-way algorithm.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Toom3_Interpolate                                                     *
+ *  Purpose:                                                                  *
+ *      Recovers the product P = A*B from the five point-wise products        *
+ *      W(0), W(1), W(-1), W(-2), and W(inf) of the Toom-Cook 3-way split.    *
+ *  Arguments:                                                                *
+ *      P_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, 4k + 2l - 1 wide. On input   *
+ *          the first 2k - 1 entries contain W(0) = A0*B0, and the 2l - 1     *
+ *          entries starting at 4k contain W(inf) = A2*B2. On output it       *
+ *          contains P.                                                       *
+ *      W_coeffs (long long *):                                               *
+ *          A pointer to an array of long longs, 3 (2k - 1) wide, containing  *
+ *          W(1), W(-1), and W(-2), in that order. This is overwritten.       *
+ *      k (size_t):                                                           *
+ *          The length of the A0, A1, B0, and B1 pieces.                      *
+ *      l (size_t):                                                           *
+ *          The length of the A2 and B2 pieces, 0 < l <= k.                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Scaled_AddTo_Int64 (polynomial_multiplication.h):                     *
+ *          Computes P += c*A, used to add R1, R2, and R3 into P.             *
+ *  Method:                                                                   *
+ *      Write P = R0 + x^k R1 + x^{2k} R2 + x^{3k} R3 + x^{4k} R4. Following  *
+ *      Bodrato, R0 = W(0), R4 = W(inf), and                                  *
+ *                                                                            *
+ *          R3 = (W(-2) - W(1)) / 3                                           *
+ *          R1 = (W(1) - W(-1)) / 2                                           *
+ *          R2 = W(-1) - W(0)                                                 *
+ *          R3 = (R2 - R3) / 2 + 2 W(inf)                                     *
+ *          R2 = R2 + R1 - W(inf)                                             *
+ *          R1 = R1 - R3                                                      *
+ *                                                                            *
+ *      R1, R2, and R3 are then added into P at their offsets.                *
+ *                                                                            *
+ *      The arithmetic is unsigned, modulo 2^64. The true values divided by 3 *
+ *      are multiples of 3, and 3 is invertible modulo 2^64, so multiplying   *
+ *      by the inverse 0xAAAAAAAAAAAAAAAB gives the quotient exactly modulo   *
+ *      2^64. 2 is not invertible, and a shift gives the halves only modulo   *
+ *      2^63, so each level of the recursion loses the top bit.               *
+ *  Notes:                                                                    *
+ *      This is a utility function for the Toom-Cook algorithm. If the        *
+ *      point-wise products are exact modulo 2^m, P is exact modulo 2^(m-1),  *
+ *      whatever the size of the values. Toom3_Product starts from m = 64,    *
+ *      so 32 levels may be taken before the low 32 bits are affected.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Combines the five point-wise products into P = A*B.                       */
+void
+Toom3_Interpolate(long long *P_coeffs, long long *W_coeffs, size_t k, size_t l)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, top;
+    unsigned long long w0, w1, w_m1, w_m2, w_inf, r1, r2, r3;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t one = (size_t)1;
+
+    /*  The inverse of 3 modulo 2^64.                                         */
+    const unsigned long long third = 0xAAAAAAAAAAAAAAABULL;
+
+    /*  Lengths of the point-wise products.                                   */
+    const size_t len = 2*k - one;
+    const size_t inf_len = 2*l - one;
+
+    /*  The point-wise products. These are overwritten by R1, R2, and R3.     */
+    long long *R1 = W_coeffs;
+    long long *R2 = W_coeffs + len;
+    long long *R3 = W_coeffs + 2*len;
+    const long long *R0 = P_coeffs;
+    const long long *R4 = P_coeffs + 4*k;
+
+    /*  Bodrato's sequence, one coefficient at a time. W(inf) is zero past    *
+     *  its length.                                                           */
+    for (n = (size_t)0; n < len; ++n)
+    {
+        w0 = (unsigned long long)R0[n];
+        w1 = (unsigned long long)R1[n];
+        w_m1 = (unsigned long long)R2[n];
+        w_m2 = (unsigned long long)R3[n];
+        w_inf = (n < inf_len ? (unsigned long long)R4[n] : 0ULL);
+
+        r3 = (w_m2 - w1) * third;
+        r1 = (w1 - w_m1) >> 1;
+        r2 = w_m1 - w0;
+        r3 = ((r2 - r3) >> 1) + 2ULL*w_inf;
+        r2 = r2 + r1 - w_inf;
+        r1 = r1 - r3;
+
+        R1[n] = (long long)r1;
+        R2[n] = (long long)r2;
+        R3[n] = (long long)r3;
+    }
+
+    /*  The gap between W(0) and W(inf) must be zeroed before adding.         */
+    for (n = len; n < 4*k; ++n)
+        P_coeffs[n] = 0;
+
+    /*  R3 only has k + 2l - 1 non-zero terms, the rest fall outside of P.    */
+    top = k + inf_len;
+
+    if (top > len)
+        top = len;
+
+    Scaled_AddTo_Int64(P_coeffs + k, R1, len, 1);
+    Scaled_AddTo_Int64(P_coeffs + 2*k, R2, len, 1);
+    Scaled_AddTo_Int64(P_coeffs + 3*k, R3, top, 1);
+}
+/*  End of Toom3_Interpolate.                                                 */
@@ -0,0 +1,323 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Toom-Cook 3-way multiplication using caller supplied scratch space.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Toom3_Product_With_Scratch                                            *
+ *  Purpose:                                                                  *
+ *      Computes P = A*B using the Toom-Cook 3-way algorithm without          *
+ *      allocating any memory.                                                *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least A_len + B_len - 1 wide.   *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Toom3_Scratch_Size(A_len, B_len) wide.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *          Computes the products with A below the Toom-3 cutoff.             *
+ *      Karatsuba_Product_With_Scratch_Int64 (polynomial_multiplication.h):   *
+ *          Computes the 64-bit products below the Toom-3 cutoff.             *
+ *      Toom3_Evaluate (polynomial_multiplication.h):                         *
+ *          Evaluates the pieces of A and B at 1, -1, and -2.                 *
+ *      Toom3_Interpolate (polynomial_multiplication.h):                      *
+ *          Recovers A*B from the five point-wise products.                   *
+ *      Scaled_AddTo_Int64 (polynomial_multiplication.h):                     *
+ *          Computes P += c*A, used to combine the chunks of B.               *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^k A1 + x^{2k} A2, where k = ceil(n / 3), and         *
+ *      similarly for B. The product A*B is a polynomial in x^k of degree 4,  *
+ *      which is determined by its values at 0, 1, -1, -2, and infinity.      *
+ *      This requires five products of a third of the size, computed          *
+ *      recursively, instead of nine. Once the length is at most              *
+ *      TOOM3_CUTOFF the Karatsuba method is used instead.                    *
+ *                                                                            *
+ *      If A_len < B_len, B is split into chunks of length A_len. Each chunk  *
+ *      is multiplied by A with the balanced algorithm, and the overlapping   *
+ *      parts of consecutive products are added together.                     *
+ *                                                                            *
+ *      The interpolation divides by 2, which is not invertible modulo 2^32,  *
+ *      so in int arithmetic the top bits would be lost once the evaluations  *
+ *      wrap around. Instead A and the chunks of B are widened to long long,  *
+ *      and the recursion, down to Karatsuba_Product_With_Scratch_Int64, is   *
+ *      done modulo 2^64. Each level loses one bit of the 64, see             *
+ *      Toom3_Interpolate, so the low 32 bits are exact for any length that   *
+ *      fits in memory, and are narrowed back into P.                         *
+ *  Notes:                                                                    *
+ *      The lengths may be given in either order. The operands are exchanged  *
+ *      first if A is the longer.                                             *
+ *                                                                            *
+ *      The result is exact modulo 2^32, and equal to that of Naive_Product,  *
+ *      whatever the size of the coefficients.                                *
+ *                                                                            *
+ *      No memory is allocated, so one scratch array may be reused for every  *
+ *      product, for example one per thread. The tunables must not change     *
+ *      between sizing the scratch array and calling this function.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  The first address in the int array work at which a long long may be       *
+ *  stored. Toom3_Scratch_Size leaves room for the padding.                   */
+static long long *toom3_product_align(int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const size_t size = sizeof(long long);
+    const size_t offset = (size_t)work % size;
+
+    if (offset == (size_t)0)
+        return (long long *)(void *)work;
+
+    return (long long *)(void *)((char *)work + (size - offset));
+}
+/*  End of toom3_product_align.                                               */
+
+/*  Computes P = A*B modulo 2^64 for two polynomials of length n.             */
+static void
+toom3_balanced(long long *P_coeffs,
+               const long long *A_coeffs,
+               const long long *B_coeffs,
+               size_t n,
+               long long *work,
+               size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, l, len;
+    long long *A_eval, *B_eval, *W_coeffs, *rest;
+
+    /*  Below the cutoff the Karatsuba method is faster.                      */
+    if (n <= cutoff)
+    {
+        Karatsuba_Product_With_Scratch_Int64(
+            P_coeffs, A_coeffs, n, B_coeffs, n, work
+        );
+
+        return;
+    }
+
+    /*  Count the level for the recursion depth, see POLY_INSTRUMENT.         */
+    POLY_STATS_DESCEND();
+
+    /*  A0, A1, B0, and B1 have length k, A2 and B2 have length l <= k.       */
+    k = (n + (size_t)2) / (size_t)3;
+    l = n - (size_t)2*k;
+    len = (size_t)2*k - (size_t)1;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_eval = work;
+    B_eval = A_eval + 3*k;
+    W_coeffs = B_eval + 3*k;
+    rest = W_coeffs + 3*len;
+
+    /*  Evaluate A and B at 1, -1, and -2.                                    */
+    Toom3_Evaluate(A_eval, A_coeffs, k, l);
+    Toom3_Evaluate(B_eval, B_coeffs, k, l);
+
+    /*  W(0) = A0*B0 and W(inf) = A2*B2 are computed in place in P.           */
+    toom3_balanced(P_coeffs, A_coeffs, B_coeffs, k, rest, cutoff);
+    toom3_balanced(
+        P_coeffs + 4*k, A_coeffs + 2*k, B_coeffs + 2*k, l, rest, cutoff
+    );
+
+    /*  The remaining point-wise products, W(1), W(-1), and W(-2).            */
+    toom3_balanced(W_coeffs, A_eval, B_eval, k, rest, cutoff);
+    toom3_balanced(W_coeffs + len, A_eval + k, B_eval + k, k, rest, cutoff);
+    toom3_balanced(
+        W_coeffs + 2*len, A_eval + 2*k, B_eval + 2*k, k, rest, cutoff
+    );
+
+    Toom3_Interpolate(P_coeffs, W_coeffs, k, l);
+    POLY_STATS_ASCEND();
+}
+/*  End of toom3_balanced.                                                    */
+
+/*  Computes P = A*B modulo 2^64 for polynomials of any lengths.              */
+static void
+toom3_unbalanced(long long *P_coeffs,
+                 const long long *A_coeffs, size_t A_len,
+                 const long long *B_coeffs, size_t B_len,
+                 long long *work,
+                 size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, shift, remainder;
+    long long *T_coeffs, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+    {
+        toom3_unbalanced(
+            P_coeffs, B_coeffs, B_len, A_coeffs, A_len, work, cutoff
+        );
+
+        return;
+    }
+
+    /*  If A is small, Karatsuba handles any length for B.                    */
+    if (A_len <= cutoff)
+    {
+        Karatsuba_Product_With_Scratch_Int64(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    /*  The first chunk of B is multiplied directly into P.                   */
+    toom3_balanced(P_coeffs, A_coeffs, B_coeffs, A_len, work, cutoff);
+
+    if (A_len == B_len)
+        return;
+
+    /*  Later chunks overlap the previous product in A_len - 1 terms, so they *
+     *  are computed in a temporary array and then added in.                  */
+    T_coeffs = work;
+    rest = work + (2*A_len - one);
+
+    for (shift = A_len; shift + A_len <= B_len; shift += A_len)
+    {
+        toom3_balanced(
+            T_coeffs, A_coeffs, B_coeffs + shift, A_len, rest, cutoff
+        );
+
+        Scaled_AddTo_Int64(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+        for (k = A_len - one; k < 2*A_len - one; ++k)
+            P_coeffs[shift + k] = T_coeffs[k];
+    }
+
+    /*  The final chunk of B may be shorter than A.                           */
+    remainder = B_len - shift;
+
+    if (remainder == zero)
+        return;
+
+    toom3_unbalanced(
+        T_coeffs, B_coeffs + shift, remainder, A_coeffs, A_len, rest, cutoff
+    );
+
+    Scaled_AddTo_Int64(P_coeffs + shift, T_coeffs, A_len - one, 1);
+
+    for (k = A_len - one; k < A_len + remainder - one; ++k)
+        P_coeffs[shift + k] = T_coeffs[k];
+}
+/*  End of toom3_unbalanced.                                                  */
+
+/*  Computes P = A*B for polynomials of any lengths.                          */
+void
+Toom3_Product_With_Scratch(int *P_coeffs,
+                           const int *A_coeffs, size_t A_len,
+                           const int *B_coeffs, size_t B_len,
+                           int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, shift, len, first;
+    long long *A_wide, *B_wide, *T_wide, *rest;
+
+    /*  Useful constants cast to type "size_t".                               */
+    const size_t zero = (size_t)0;
+    const size_t one = (size_t)1;
+
+    /*  Length at or below which the Karatsuba method is used.                */
+    const size_t cutoff = (size_t)TOOM3_CUTOFF;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+    {
+        Toom3_Product_With_Scratch(
+            P_coeffs, B_coeffs, B_len, A_coeffs, A_len, work
+        );
+
+        return;
+    }
+
+    /*  If A is small, Karatsuba handles any length for B, modulo 2^32.       */
+    if (A_len <= cutoff)
+    {
+        Karatsuba_Product_With_Scratch(
+            P_coeffs, A_coeffs, A_len, B_coeffs, B_len, work
+        );
+
+        return;
+    }
+
+    /*  A, a chunk of B, and their product, widened to 64 bits.               */
+    A_wide = toom3_product_align(work);
+    B_wide = A_wide + A_len;
+    T_wide = B_wide + A_len;
+    rest = T_wide + (2*A_len - one);
+
+    for (n = zero; n < A_len; ++n)
+        A_wide[n] = A_coeffs[n];
+
+    /*  B is taken a chunk of length A_len at a time, so the wide copies stay *
+     *  small however long B is. The last chunk may be shorter.               */
+    for (shift = zero; shift < B_len; shift += A_len)
+    {
+        len = (B_len - shift < A_len ? B_len - shift : A_len);
+
+        for (n = zero; n < len; ++n)
+            B_wide[n] = B_coeffs[shift + n];
+
+        toom3_unbalanced(T_wide, A_wide, A_len, B_wide, len, rest, cutoff);
+
+        /*  The first A_len - 1 terms overlap the previous chunk's product.   */
+        first = (shift == zero ? zero : A_len - one);
+
+        for (n = zero; n < first; ++n)
+            P_coeffs[shift + n] = (int)(
+                (unsigned int)P_coeffs[shift + n] + (unsigned int)T_wide[n]
+            );
+
+        for (n = first; n < A_len + len - one; ++n)
+            P_coeffs[shift + n] = (int)(unsigned int)T_wide[n];
+    }
+}
+/*  End of Toom3_Product_With_Scratch.                                        */
@@ -0,0 +1,178 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the scratch space needed by Toom3_Product_With_Scratch.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Toom3_Scratch_Size                                                    *
+ *  Purpose:                                                                  *
+ *      Returns the number of ints of scratch space that                      *
+ *      Toom3_Product_With_Scratch needs to compute A*B.                      *
+ *  Arguments:                                                                *
+ *      A_len (size_t):                                                       *
+ *          The length of the A polynomial.                                   *
+ *      B_len (size_t):                                                       *
+ *          The length of the B polynomial.                                   *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The number of ints the scratch array must hold.                   *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Scratch_Size (polynomial_multiplication.h):                 *
+ *          Scratch space for the products with A below the Toom-3 cutoff.    *
+ *      Karatsuba_Scratch_Size_Int64 (polynomial_multiplication.h):           *
+ *          Scratch space for the 64-bit products below the Toom-3 cutoff.    *
+ *  Method:                                                                   *
+ *      Follow the recursion in Toom3_Product_With_Scratch, which works with  *
+ *      long longs. Each balanced level of length n, with k = ceil(n / 3),    *
+ *      stores the evaluations of A and B at 1, -1, and -2, and the three     *
+ *      point-wise products, for a total of 12k - 3. The rest of the array is *
+ *      reused by the five recursive products. Unbalanced products            *
+ *      additionally store one chunk product of length 2 A_len - 1. The top   *
+ *      level stores the 64-bit copies of A, of a chunk of B, and of their    *
+ *      product. The count is converted to ints, with room for aligning the   *
+ *      long longs.                                                           *
+ *  Notes:                                                                    *
+ *      The result is 0 if the product is computed naively. The lengths may   *
+ *      be given in either order. The size depends on the tunables, and is    *
+ *      only valid while they are fixed.                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  Number of long longs of scratch space needed to multiply two length n     *
+ *  arrays.                                                                   */
+static size_t toom3_balanced_scratch(size_t n, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, l, outer, inner;
+
+    /*  Below the cutoff the Karatsuba method is used.                        */
+    if (n <= cutoff)
+        return Karatsuba_Scratch_Size_Int64(n, n);
+
+    k = (n + (size_t)2) / (size_t)3;
+    l = n - (size_t)2*k;
+
+    /*  The five products have length k, except for A2*B2, of length l.       */
+    outer = toom3_balanced_scratch(k, cutoff);
+    inner = toom3_balanced_scratch(l, cutoff);
+
+    if (inner > outer)
+        outer = inner;
+
+    /*  Storage for the evaluations and point-wise products.                  */
+    return (size_t)12*k - (size_t)3 + outer;
+}
+/*  End of toom3_balanced_scratch.                                            */
+
+/*  Number of long longs of scratch space needed to multiply A and B.         */
+static size_t
+toom3_unbalanced_scratch(size_t A_len, size_t B_len, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t full, rest, chunks;
+
+    /*  Zero cast to type "size_t".                                           */
+    const size_t zero = (size_t)0;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+        return toom3_unbalanced_scratch(B_len, A_len, cutoff);
+
+    /*  Small products are done with Karatsuba.                               */
+    if (A_len <= cutoff)
+        return Karatsuba_Scratch_Size_Int64(A_len, B_len);
+
+    full = toom3_balanced_scratch(A_len, cutoff);
+
+    if (A_len == B_len)
+        return full;
+
+    /*  Chunks of B after the first are stored in a temporary array of length *
+     *  2*A_len - 1, followed by the scratch space for the product.           */
+    chunks = B_len % A_len;
+
+    if (chunks == zero)
+        rest = zero;
+    else
+        rest = toom3_unbalanced_scratch(chunks, A_len, cutoff);
+
+    if (rest > full)
+        full = rest;
+
+    return (size_t)2*A_len - (size_t)1 + full;
+}
+/*  End of toom3_unbalanced_scratch.                                          */
+
+/*  Number of ints of scratch space needed to multiply A and B.               */
+size_t Toom3_Scratch_Size(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t wide, rest, chunks;
+
+    /*  Zero cast to type "size_t".                                           */
+    const size_t zero = (size_t)0;
+
+    /*  Length at or below which the Karatsuba method is used.                */
+    const size_t cutoff = (size_t)TOOM3_CUTOFF;
+
+    /*  The lengths may be given in either order, B is taken as the longer.   */
+    if (A_len > B_len)
+        return Toom3_Scratch_Size(B_len, A_len);
+
+    /*  Small products are done with the int Karatsuba method.                */
+    if (A_len <= cutoff)
+        return Karatsuba_Scratch_Size(A_len, B_len);
+
+    /*  Every chunk of B but the last has length A_len.                       */
+    wide = toom3_balanced_scratch(A_len, cutoff);
+    chunks = B_len % A_len;
+
+    if (chunks == zero)
+        rest = zero;
+    else
+        rest = toom3_unbalanced_scratch(chunks, A_len, cutoff);
+
+    if (rest > wide)
+        wide = rest;
+
+    /*  The copies of A and of a chunk of B, their product, and one more long *
+     *  long of padding for the alignment.                                    */
+    wide += (size_t)4*A_len;
+
+    return wide * (sizeof(long long) / sizeof(int));
+}
+/*  End of Toom3_Scratch_Size.                                                */
@@ -0,0 +1,182 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Toom-Cook 3-way squaring using caller supplied scratch space.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      Toom3_Square_With_Scratch                                             *
+ *  Purpose:                                                                  *
+ *      Computes P = A*A using the Toom-Cook 3-way algorithm without          *
+ *      allocating any memory.                                                *
+ *  Arguments:                                                                *
+ *      P_coeffs (int *):                                                     *
+ *          A pointer to an array of ints, at least 2 len - 1 wide.           *
+ *      A_coeffs (const int *):                                               *
+ *          A pointer to the coefficient array of a polynomial.               *
+ *      len (size_t):                                                         *
+ *          The length of the A polynomial.                                   *
+ *      work (int *):                                                         *
+ *          Scratch space, at least Toom3_Scratch_Size(len, len) wide.        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      Karatsuba_Square_With_Scratch (polynomial_multiplication.h):          *
+ *          Computes the squares of length at most the Toom-3 cutoff.         *
+ *      Karatsuba_Product_With_Scratch_Int64 (polynomial_multiplication.h):   *
+ *          Computes the 64-bit squares below the Toom-3 cutoff.              *
+ *      Toom3_Evaluate (polynomial_multiplication.h):                         *
+ *          Evaluates the pieces of A at 1, -1, and -2.                       *
+ *      Toom3_Interpolate (polynomial_multiplication.h):                      *
+ *          Recovers A*A from the five point-wise squares.                    *
+ *  Method:                                                                   *
+ *      Split A = A0 + x^k A1 + x^{2k} A2, where k = ceil(len / 3). The       *
+ *      square A*A is a polynomial in x^k of degree 4, determined by its      *
+ *      values at 0, 1, -1, -2, and infinity, which are the squares of the    *
+ *      values of A. A is evaluated once, rather than A and B, and the five   *
+ *      squares are computed recursively. Once the length is at most          *
+ *      TOOM3_CUTOFF the Karatsuba method is used instead.                    *
+ *                                                                            *
+ *      As in Toom3_Product_With_Scratch, A is widened to long long and the   *
+ *      recursion is done modulo 2^64, so that the halvings of the            *
+ *      interpolation leave the low 32 bits exact.                            *
+ *  Notes:                                                                    *
+ *      The result is exact modulo 2^32, and equal to that of Naive_Square.   *
+ *      This needs less scratch space than Toom3_Product_With_Scratch, so an  *
+ *      array sized for the product of A with itself may be used.             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototype.                    *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include "polynomial_multiplication.h"
+
+/*  size_t provided here.                                                     */
+#include <stddef.h>
+
+/*  The first address in the int array work at which a long long may be       *
+ *  stored. Toom3_Scratch_Size leaves room for the padding.                   */
+static long long *toom3_square_align(int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const size_t size = sizeof(long long);
+    const size_t offset = (size_t)work % size;
+
+    if (offset == (size_t)0)
+        return (long long *)(void *)work;
+
+    return (long long *)(void *)((char *)work + (size - offset));
+}
+/*  End of toom3_square_align.                                                */
+
+/*  Computes P = A*A modulo 2^64 for a polynomial of length n.                */
+static void
+toom3_square(long long *P_coeffs, const long long *A_coeffs, size_t n,
+             long long *work, size_t cutoff)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, l, len;
+    long long *A_eval, *W_coeffs, *rest;
+
+    /*  Below the cutoff the Karatsuba method is faster.                      */
+    if (n <= cutoff)
+    {
+        Karatsuba_Product_With_Scratch_Int64(
+            P_coeffs, A_coeffs, n, A_coeffs, n, work
+        );
+
+        return;
+    }
+
+    /*  Count the level for the recursion depth, see POLY_INSTRUMENT.         */
+    POLY_STATS_DESCEND();
+
+    /*  A0 and A1 have length k, A2 has length l <= k.                        */
+    k = (n + (size_t)2) / (size_t)3;
+    l = n - (size_t)2*k;
+    len = (size_t)2*k - (size_t)1;
+
+    /*  Carve the scratch space up for this level of the recursion.           */
+    A_eval = work;
+    W_coeffs = A_eval + 3*k;
+    rest = W_coeffs + 3*len;
+
+    /*  Evaluate A at 1, -1, and -2.                                          */
+    Toom3_Evaluate(A_eval, A_coeffs, k, l);
+
+    /*  W(0) = A0*A0 and W(inf) = A2*A2 are computed in place in P.           */
+    toom3_square(P_coeffs, A_coeffs, k, rest, cutoff);
+    toom3_square(P_coeffs + 4*k, A_coeffs + 2*k, l, rest, cutoff);
+
+    /*  The remaining point-wise squares, W(1), W(-1), and W(-2).             */
+    toom3_square(W_coeffs, A_eval, k, rest, cutoff);
+    toom3_square(W_coeffs + len, A_eval + k, k, rest, cutoff);
+    toom3_square(W_coeffs + 2*len, A_eval + 2*k, k, rest, cutoff);
+
+    Toom3_Interpolate(P_coeffs, W_coeffs, k, l);
+    POLY_STATS_ASCEND();
+}
+/*  End of toom3_square.                                                      */
+
+/*  Function for computing P = A*A with the Toom-Cook 3-way algorithm.        */
+void
+Toom3_Square_With_Scratch(int *P_coeffs, const int *A_coeffs, size_t len,
+                          int *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    long long *A_wide, *T_wide;
+
+    /*  Length at or below which the Karatsuba method is used.                */
+    const size_t cutoff = (size_t)TOOM3_CUTOFF;
+
+    /*  The square of the empty polynomial is empty.                          */
+    if (len == (size_t)0)
+        return;
+
+    /*  Small squares are exact modulo 2^32 with the int Karatsuba method.    */
+    if (len <= cutoff)
+    {
+        Karatsuba_Square_With_Scratch(P_coeffs, A_coeffs, len, work);
+        return;
+    }
+
+    /*  A and its square, widened to 64 bits.                                 */
+    A_wide = toom3_square_align(work);
+    T_wide = A_wide + len;
+
+    for (n = (size_t)0; n < len; ++n)
+        A_wide[n] = A_coeffs[n];
+
+    toom3_square(T_wide, A_wide, len, T_wide + (2*len - (size_t)1), cutoff);
+
+    for (n = (size_t)0; n < 2*len - (size_t)1; ++n)
+        P_coeffs[n] = (int)(unsigned int)T_wide[n];
+}
+/*  End of Toom3_Square_With_Scratch.                                         */
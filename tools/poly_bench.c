@@ -0,0 +1,2996 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Times the multiplication routines over a sweep of lengths and shapes  *
+ *      and writes the results as CSV or JSON, for catching regressions.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      main                                                                  *
+ *  Purpose:                                                                  *
+ *      Runs the benchmarks and prints one record per timing.                 *
+ *  Arguments:                                                                *
+ *      argc (int):                                                           *
+ *          The number of command line arguments.                             *
+ *      argv (char **):                                                       *
+ *          The arguments. The supported options are:                         *
+ *              -json:          Write JSON instead of CSV.                    *
+ *              -quick:         Time each case for less long. Noisier.        *
+ *              -kernel name:   Only time routines whose name contains name.  *
+ *              -type name:     Only time routines of this coefficient type.  *
+ *              -max-len n:     Stop the sweep at length n, default 1000000.  *
+ *              -max-time s:    Stop a sweep once a call takes s seconds.     *
+ *              -tunables file: Load the tunables from file first.            *
+ *              -list:          Print the routines and types, and exit.       *
+ *              -check:         Check the outputs against the schoolbook      *
+ *                              method, and exit unless -baseline is given.   *
+ *              -level name:    Only check with the kernels of this level,    *
+ *                              portable, avx2, avx512, or neon.              *
+ *              -baseline file: Compare the timings with those in file.       *
+ *              -tolerance x:   The slowdown, against the baseline, that      *
+ *                              counts as a regression, default 1.75.         *
+ *              filename:       Write to this file instead of stdout.         *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, 1 on failure, a wrong output, or a regression.      *
+ *  Called Functions:                                                         *
+ *      Poly_Load_Tunables (polynomial_multiplication.h):                     *
+ *          Reads the tunables given with -tunables.                          *
+ *      Poly_Modulus_Init (polynomial_multiplication.h):                      *
+ *          Sets up the prime for the modular routines.                       *
+ *      Poly_Set_Tunables (polynomial_multiplication.h):                      *
+ *          Lowers parallel_grain for the checks.                             *
+ *      Poly_Pool_Create (polynomial_multiplication.h):                       *
+ *          Starts the threads of the parallel and batched routines.          *
+ *      Poly_Set_Kernel_Level (polynomial_multiplication.h):                  *
+ *          Caps the SIMD kernels for each round of checks.                   *
+ *      Poly_Set_Offload, Poly_Get_Offload (polynomial_multiplication.h):     *
+ *          Register and look up the mock backend of the offload checks.      *
+ *      Every routine in bench_kernels (polynomial_multiplication.h):         *
+ *          The routines being timed.                                         *
+ *      clock (time.h):                                                       *
+ *          Used for timing.                                                  *
+ *  Method:                                                                   *
+ *      Each routine is swept over the lengths 1, 2, 5, 10, 20, 50, ... up    *
+ *      to the maximum. For each length L of the longer operand, the shorter  *
+ *      has length L / r for the shapes r = 1, 16, and 1024, skipping those   *
+ *      where it would be empty. Squares and Scaled_AddTo have one operand,   *
+ *      and only use r = 1. Middle products take the longer operand as the    *
+ *      L outputs wanted, so A has length L + L / r - 1. The sums of products *
+ *      add 4 products with these lengths, and the combination products       *
+ *      multiply B by a combination of 4 operands of the shorter length.      *
+ *                                                                            *
+ *      A timing repeats the call, doubling the count until enough time has   *
+ *      passed to measure, and keeps the best of several runs, as poly_tune   *
+ *      does. Once one call takes longer than the -max-time limit, the rest   *
+ *      of that sweep is skipped. This keeps the naive method from running    *
+ *      for hours on the longest products while still timing them as far as   *
+ *      is practical.                                                         *
+ *                                                                            *
+ *      Three rates are given for each timing.                                *
+ *                                                                            *
+ *          ns_per_coeff:   Nanoseconds per coefficient written.              *
+ *          gflops:         The multiplies and adds of the schoolbook method  *
+ *                          divided by the time, in billions per second. This *
+ *                          is a "GFLOP/s-equivalent" that compares different *
+ *                          algorithms for the same product on one scale.     *
+ *          gbytes_per_s:   The bytes that must be read and written at least  *
+ *                          once divided by the time, in billions per second. *
+ *                          This counts the operands, the output, and the old *
+ *                          output for routines that add to P.                *
+ *                                                                            *
+ *      With -check, each routine is first run on 24 fixed shapes, from 1 by  *
+ *      1 to 4096 by 4096 and including the most unbalanced, and on 24        *
+ *      random ones. This is done with small values in both operands, with    *
+ *      one in 64 coefficients of A non-zero, and, for the integer and        *
+ *      modular types, with values over the full range of the type. Products  *
+ *      with equal lengths are also run with A and B the same array. The      *
+ *      outputs are compared with a schoolbook product computed here, modulo  *
+ *      2^16, 2^32, or 2^64 to match the type, modulo the prime, or in full   *
+ *      for the 128-bit outputs, and the 16 coefficients after the output     *
+ *      are checked for stray writes. The int routines must agree with        *
+ *      Naive_Product for any values. The small values keep the float types   *
+ *      and the 64-bit outputs exact.                                         *
+ *                                                                            *
+ *      The checks are repeated with the kernels capped at each instruction   *
+ *      set the CPU has, portable C, AVX2, AVX-512, or NEON, so the kernels   *
+ *      that a faster CPU would not use are checked on it too.                *
+ *                                                                            *
+ *      Poly_Multiply and the batches are then checked with a mock backend    *
+ *      registered with Poly_Set_Offload, which computes what it accepts with *
+ *      Naive_Product. It accepts the work, declines it, removes itself       *
+ *      during its call and declines, and is registered with thresholds above *
+ *      the work. The output must be right each time, the backend must be     *
+ *      called once, with the shorter operand first, and never for work below *
+ *      its thresholds or after it is removed.                                *
+ *                                                                            *
+ *      The parallel and batched routines are checked on a pool of 4          *
+ *      threads, with the parallel_grain tunable lowered to 64 so that the    *
+ *      checked lengths are split. The sparse routines always have a sparse   *
+ *      A. A divisor has its leading coefficient, and the series to invert    *
+ *      its constant term, set to 1 or -1.                                    *
+ *                                                                            *
+ *      With -baseline, each timing is looked up in an earlier CSV output by  *
+ *      its routine, type, shape, and lengths, and is a regression if it is   *
+ *      more than the -tolerance times slower. Timings not in the baseline    *
+ *      are not compared.                                                     *
+ *  Notes:                                                                    *
+ *      The CSV columns, and the JSON fields, are                             *
+ *                                                                            *
+ *          kernel, type, shape, A_len, B_len, seconds,                       *
+ *          ns_per_coeff, gflops, gbytes_per_s                                *
+ *                                                                            *
+ *      where shape is "1:r" and B_len is 0 for Scaled_AddTo. For the         *
+ *      batches A_len and B_len are those of the first product. The timings   *
+ *      do not check their outputs. They include the copy of A into P for     *
+ *      the products written over A, and the conversions to and from terms    *
+ *      for the sparse products. A plan or stream is built once for each      *
+ *      set of operands, and is not timed. Typical use is:                    *
+ *                                                                            *
+ *          poly_bench bench_output.txt                                       *
+ *          poly_bench -json -kernel Karatsuba -max-len 100000                *
+ *          poly_bench -check                                                 *
+ *          poly_bench -quick -check -baseline bench_output.txt               *
+ *                                                                            *
+ *      Short timings are noisy, in particular with -quick, so a baseline is  *
+ *      best taken with the same options on the same machine.                 *
+ *                                                                            *
+ *      New routines are benchmarked by adding a wrapper and an entry to      *
+ *      bench_kernels below.                                                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdio.h:                                                              *
+ *          Header file providing fprintf, fopen, fgets, sscanf, and fclose.  *
+ *  4.) stdlib.h:                                                             *
+ *          Header file providing malloc, realloc, free, rand, srand, and     *
+ *          strtod.                                                           *
+ *  5.) string.h:                                                             *
+ *          Header file providing strcmp and strstr.                          *
+ *  6.) time.h:                                                               *
+ *          Header file providing clock and CLOCKS_PER_SEC.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  fprintf, fopen, fgets, sscanf, and fclose found here.                     */
+#include <stdio.h>
+
+/*  malloc, realloc, free, rand, srand, and strtod found here.                */
+#include <stdlib.h>
+
+/*  strcmp and strstr found here.                                             */
+#include <string.h>
+
+/*  clock and CLOCKS_PER_SEC found here.                                      */
+#include <time.h>
+
+/*  Default length at which the sweeps stop.                                  */
+#define BENCH_MAX_LEN 1000000
+
+/*  Number of runs per timing, of which the fastest is kept.                  */
+#define BENCH_RUNS 3
+
+/*  Longest operand checked with -check, and the number of random shapes.     */
+#define BENCH_CHECK_LEN 4096
+#define BENCH_CHECK_RANDOM 24
+
+/*  The seed for the operands of each timed routine, so that it gets the same *
+ *  values whatever ran before it, and -check timings match the baseline.     */
+#define BENCH_SEED 1U
+
+/*  Number of coefficients past the output checked for stray writes.          */
+#define BENCH_GUARD 16
+
+/*  The threads, and the parallel_grain tunable, used for the checks of the   *
+ *  parallel and batched routines, so that the checked lengths are split.     */
+#define BENCH_CHECK_THREADS 4
+#define BENCH_CHECK_GRAIN 64
+
+/*  Most products in one call of the batched routines.                        */
+#define BENCH_BATCH_COUNT 20
+
+/*  The products in a sum of products, and the terms of a combination.        */
+#define BENCH_TERMS 4
+
+/*  Room for the longest output of the checks, a batch of products of length  *
+ *  2 BENCH_CHECK_LEN - 1.                                                    */
+#define BENCH_CHECK_OUT (BENCH_BATCH_COUNT * 2 * BENCH_CHECK_LEN)
+
+/*  Default slowdown, against the -baseline timings, that counts as a         *
+ *  regression.                                                               */
+#define BENCH_TOLERANCE 1.75
+
+/*  What a routine computes, which sets the lengths and the rates.            */
+#define BENCH_PRODUCT 0
+#define BENCH_ADDTO 1
+#define BENCH_SUM 2
+#define BENCH_SCALE 3
+#define BENCH_SQUARE 4
+#define BENCH_SHORT 5
+#define BENCH_MIDDLE 6
+#define BENCH_SPARSE 7
+#define BENCH_BATCH 8
+#define BENCH_STRIDED 9
+#define BENCH_DIVIDE 10
+#define BENCH_INVERSE 11
+#define BENCH_BIG 12
+#define BENCH_MULTI 13
+#define BENCH_SUMS 14
+#define BENCH_COMBINATION 15
+#define BENCH_OVERLAP 16
+
+/*  The coefficient types, which set how the operands are filled.             */
+#define BENCH_INT32 0
+#define BENCH_INT16 1
+#define BENCH_INT64 2
+#define BENCH_FLOAT 3
+#define BENCH_DOUBLE 4
+#define BENCH_MOD 5
+#define BENCH_WIDE 6
+#define BENCH_WIDE128 7
+
+/*  The names of the types, indexed by the values above.                      */
+static const char * const bench_type_names[] = {
+    "int32", "int16", "int64", "float", "double", "mod32", "wide64", "wide128"
+};
+
+/*  The names of the kernel levels, indexed by Poly_Kernel_Level.             */
+static const char * const bench_level_names[] = {
+    "portable", "avx2", "avx512", "neon"
+};
+
+/*  The number of levels above.                                               */
+#define BENCH_LEVELS (sizeof(bench_level_names) / sizeof(bench_level_names[0]))
+
+/*  The ratios of the longer operand to the shorter one.                      */
+static const size_t bench_ratios[] = {1, 16, 1024};
+
+/*  A routine to time, called with the shorter length s and the longer L.     */
+typedef struct bench_kernel_def {
+    const char *name;
+    int kind;
+    int type;
+
+    /*  The sizes, in bytes, of the input and output coefficients.            */
+    size_t in_size;
+    size_t out_size;
+
+    /*  The bytes of scratch space needed, or NULL if there is none.          */
+    size_t (*scratch)(size_t s, size_t L);
+
+    /*  Computes one product.                                                 */
+    void (*run)(size_t s, size_t L);
+} bench_kernel;
+
+/*  The operand buffers shared by all of the timings.                         */
+static void *bench_A, *bench_B, *bench_P, *bench_work;
+static size_t bench_work_len;
+
+/*  The prime used by the modular routines.                                   */
+static Poly_Modulus bench_modulus;
+
+/*  Minimum length of time, in seconds, spent on each run.                    */
+static double bench_min_time = 0.05;
+
+/*  A sweep stops once one call takes at least this long, in seconds.         */
+static double bench_max_time = 1.0;
+
+/*  The threads used by the parallel and batched routines.                    */
+static Poly_Pool *bench_pool;
+
+/*  Counts the fills of the buffers, so that a plan or stream built for the   *
+ *  old contents is not reused.                                               */
+static unsigned long bench_generation;
+
+/*  The plan for Poly_Multiply_Prepared, and the operand it was built for.    */
+static Poly_Plan *bench_plan;
+static const void *bench_plan_B;
+static size_t bench_plan_s, bench_plan_L;
+static unsigned long bench_plan_generation;
+
+/*  The stream for Poly_Stream, and the operand it was built for.             */
+static Poly_Stream *bench_stream;
+static const void *bench_stream_B;
+static size_t bench_stream_s;
+static unsigned long bench_stream_generation;
+
+/*  The pieces the other operand is pushed to a stream in, repeated. Some are *
+ *  shorter than a block, and some span several.                              */
+static const size_t bench_stream_pieces[] = {1, 1000, 7, 100, 3, 4096};
+
+/*  The products of one call of Poly_Multiply_Batch.                          */
+static int *bench_batch_P[BENCH_BATCH_COUNT];
+static const int *bench_batch_A[BENCH_BATCH_COUNT];
+static const int *bench_batch_B[BENCH_BATCH_COUNT];
+static size_t bench_batch_A_len[BENCH_BATCH_COUNT];
+static size_t bench_batch_B_len[BENCH_BATCH_COUNT];
+
+/*  The operands of the sums of products and the combination products.        */
+static const int *bench_terms_A[BENCH_TERMS];
+static const int *bench_terms_B[BENCH_TERMS];
+static const int bench_scalars[BENCH_TERMS] = {3, -1, 2, -5};
+
+/*  Makes sure the scratch array has room for size bytes.                     */
+static int bench_reserve(size_t size)
+{
+    void *work;
+
+    if (size <= bench_work_len)
+        return 0;
+
+    work = realloc(bench_work, size);
+
+    if (!work)
+        return -1;
+
+    bench_work = work;
+    bench_work_len = size;
+    return 0;
+}
+/*  End of bench_reserve.                                                     */
+
+/*  Scratch sizes, in bytes, of the routines that take scratch space.         */
+static size_t bench_karatsuba_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Karatsuba_Scratch_Size(s, L);
+}
+/*  End of bench_karatsuba_scratch.                                           */
+
+static size_t bench_toom3_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Toom3_Scratch_Size(s, L);
+}
+/*  End of bench_toom3_scratch.                                               */
+
+static size_t bench_ntt_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * NTT_Scratch_Size(s, L);
+}
+/*  End of bench_ntt_scratch.                                                 */
+
+static size_t bench_poly_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Scratch_Size(s, L);
+}
+/*  End of bench_poly_scratch.                                                */
+
+static size_t bench_short_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Short_Scratch_Size(s, L, L);
+}
+/*  End of bench_short_scratch.                                               */
+
+static size_t bench_karatsuba_short_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Karatsuba_Short_Scratch_Size(s, L, L);
+}
+/*  End of bench_karatsuba_short_scratch.                                     */
+
+static size_t bench_karatsuba_middle_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Karatsuba_Middle_Scratch_Size(L + s - (size_t)1, s);
+}
+/*  End of bench_karatsuba_middle_scratch.                                    */
+
+static size_t bench_ntt_middle_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * NTT_Scratch_Size_Middle(L + s - (size_t)1, s);
+}
+/*  End of bench_ntt_middle_scratch.                                          */
+
+static size_t bench_ntt_sums_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * NTT_Scratch_Size_Sum(s, L);
+}
+/*  End of bench_ntt_sums_scratch.                                            */
+
+static size_t bench_sums_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Sum_Of_Products_Scratch_Size(s, L);
+}
+/*  End of bench_sums_scratch.                                                */
+
+static size_t bench_combination_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Combination_Product_Scratch_Size(s, L);
+}
+/*  End of bench_combination_scratch.                                         */
+
+static size_t bench_middle_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Middle_Scratch_Size(L + s - (size_t)1, s);
+}
+/*  End of bench_middle_scratch.                                              */
+
+static size_t bench_ntt_mod_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * NTT_Scratch_Size_Mod(s, L, &bench_modulus);
+}
+/*  End of bench_ntt_mod_scratch.                                             */
+
+static size_t bench_scratch_int16(size_t s, size_t L)
+{
+    return sizeof(short) * Karatsuba_Scratch_Size_Int16(s, L);
+}
+/*  End of bench_scratch_int16.                                               */
+
+static size_t bench_scratch_int64(size_t s, size_t L)
+{
+    return sizeof(long long) * Karatsuba_Scratch_Size_Int64(s, L);
+}
+/*  End of bench_scratch_int64.                                               */
+
+static size_t bench_scratch_float(size_t s, size_t L)
+{
+    return sizeof(float) * Karatsuba_Scratch_Size_Float(s, L);
+}
+/*  End of bench_scratch_float.                                               */
+
+static size_t bench_scratch_double(size_t s, size_t L)
+{
+    return sizeof(double) * Karatsuba_Scratch_Size_Double(s, L);
+}
+/*  End of bench_scratch_double.                                              */
+
+static size_t bench_in_place_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_In_Place_Scratch_Size(s, L);
+}
+/*  End of bench_in_place_scratch.                                            */
+
+static size_t bench_divide_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Divide_Scratch_Size(L + s - (size_t)1, s);
+}
+/*  End of bench_divide_scratch.                                              */
+
+static size_t bench_inverse_scratch(size_t s, size_t L)
+{
+    return sizeof(int) * Poly_Series_Inverse_Scratch_Size(s, L);
+}
+/*  End of bench_inverse_scratch.                                             */
+
+/*  Returns the plan for products with B of length L and A of length s,       *
+ *  building it if the last one was for other operands. NULL on failure.      */
+static Poly_Plan *bench_get_plan(size_t s, size_t L)
+{
+    if (bench_plan && bench_plan_B == bench_B && bench_plan_s == s &&
+        bench_plan_L == L && bench_plan_generation == bench_generation)
+        return bench_plan;
+
+    Poly_Plan_Destroy(bench_plan);
+    bench_plan = Poly_Prepare(bench_B, L, s);
+    bench_plan_B = bench_B;
+    bench_plan_s = s;
+    bench_plan_L = L;
+    bench_plan_generation = bench_generation;
+    return bench_plan;
+}
+/*  End of bench_get_plan.                                                    */
+
+/*  Returns the stream for products with the A of length s, in blocks of s    *
+ *  coefficients, building it if the last one was for another operand. NULL   *
+ *  on failure.                                                               */
+static Poly_Stream *bench_get_stream(size_t s)
+{
+    if (bench_stream && bench_stream_B == bench_A && bench_stream_s == s &&
+        bench_stream_generation == bench_generation)
+        return bench_stream;
+
+    Poly_Stream_Destroy(bench_stream);
+    bench_stream = Poly_Stream_Create(bench_A, s, s);
+    bench_stream_B = bench_A;
+    bench_stream_s = s;
+    bench_stream_generation = bench_generation;
+    return bench_stream;
+}
+/*  End of bench_get_stream.                                                  */
+
+/*  A plan or stream that can not be built is reported as scratch space that  *
+ *  can not be allocated.                                                     */
+static size_t bench_prepared_scratch(size_t s, size_t L)
+{
+    const Poly_Plan * const plan = bench_get_plan(s, L);
+
+    if (!plan)
+        return (size_t)-1;
+
+    return sizeof(int) * Poly_Plan_Scratch_Size(plan, s);
+}
+/*  End of bench_prepared_scratch.                                            */
+
+static size_t bench_stream_scratch(size_t s, size_t L)
+{
+    (void)L;
+    return (bench_get_stream(s) ? (size_t)0 : (size_t)-1);
+}
+/*  End of bench_stream_scratch.                                              */
+
+/*  Returns the number of non-zero coefficients of a polynomial.              */
+static size_t bench_nonzero(const int *coeffs, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, count = (size_t)0;
+
+    for (n = (size_t)0; n < len; ++n)
+        if (coeffs[n] != 0)
+            ++count;
+
+    return count;
+}
+/*  End of bench_nonzero.                                                     */
+
+/*  The sparse routines take their terms from the scratch space.              */
+static size_t bench_sparse_scratch(size_t s, size_t L)
+{
+    const size_t A_count = bench_nonzero(bench_A, s);
+    const size_t B_count = bench_nonzero(bench_B, L);
+    return sizeof(Poly_Term) * (A_count + B_count + A_count * B_count);
+}
+/*  End of bench_sparse_scratch.                                              */
+
+static size_t bench_sparse_dense_scratch(size_t s, size_t L)
+{
+    (void)L;
+    return sizeof(Poly_Term) * bench_nonzero(bench_A, s);
+}
+/*  End of bench_sparse_dense_scratch.                                        */
+
+/*  The lengths in two variables of an operand with len coefficients.         */
+static void bench_multi_dims(size_t *dims, size_t len)
+{
+    dims[0] = (len % (size_t)2 == (size_t)0 ? (size_t)2 : (size_t)1);
+    dims[1] = len / dims[0];
+}
+/*  End of bench_multi_dims.                                                  */
+
+static size_t bench_multi_scratch(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_dims[2], B_dims[2];
+
+    bench_multi_dims(A_dims, s);
+    bench_multi_dims(B_dims, L);
+    return sizeof(int) *
+           Poly_Multivariate_Scratch_Size(A_dims, B_dims, (size_t)2);
+}
+/*  End of bench_multi_scratch.                                               */
+
+/*  The number of products in a batch whose longer operands have length L.    */
+static size_t bench_batch_count(size_t L)
+{
+    const size_t count = (size_t)BENCH_MAX_LEN / L;
+    return (count < BENCH_BATCH_COUNT ? count : (size_t)BENCH_BATCH_COUNT);
+}
+/*  End of bench_batch_count.                                                 */
+
+/*  Sets up the products of a batch, with product i of A + i, of length       *
+ *  s - i mod s, and B + i, of length L - 3i mod L, so that the lengths       *
+ *  differ. The outputs are stored one after another. Returns the number of   *
+ *  output coefficients.                                                      */
+static size_t bench_batch_setup(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, out_len = (size_t)0;
+    const size_t count = bench_batch_count(L);
+
+    for (k = (size_t)0; k < count; ++k)
+    {
+        bench_batch_A_len[k] = s - k % s;
+        bench_batch_B_len[k] = L - ((size_t)3 * k) % L;
+        bench_batch_A[k] = (const int *)bench_A + k;
+        bench_batch_B[k] = (const int *)bench_B + k;
+        bench_batch_P[k] = (int *)bench_P + out_len;
+        out_len += bench_batch_A_len[k] + bench_batch_B_len[k] - (size_t)1;
+    }
+
+    return out_len;
+}
+/*  End of bench_batch_setup.                                                 */
+
+/*  Sets up the operands of the sums of products, with term k taken from      *
+ *  A + kD and B + kD for D = BENCH_MAX_LEN / BENCH_TERMS. The combination    *
+ *  products use the same A and all share B.                                  */
+static void bench_terms_setup(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    const size_t stride = (size_t)BENCH_MAX_LEN / (size_t)BENCH_TERMS;
+
+    for (k = (size_t)0; k < (size_t)BENCH_TERMS; ++k)
+    {
+        bench_terms_A[k] = (const int *)bench_A + k * stride;
+        bench_terms_B[k] = (const int *)bench_B + k * stride;
+    }
+}
+/*  End of bench_terms_setup.                                                 */
+
+/*  The routines for int coefficients.                                        */
+static void bench_naive(size_t s, size_t L)
+{
+    Naive_Product(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive.                                                       */
+
+static void bench_naive_addto(size_t s, size_t L)
+{
+    Naive_AddTo_Product(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_addto.                                                 */
+
+static void bench_naive_addto_sum(size_t s, size_t L)
+{
+    /*  A0 and A1 are the two halves of the A buffer.                         */
+    const int *A = bench_A;
+    Naive_AddTo_Sum_Product(bench_P, A, A + BENCH_MAX_LEN, s, bench_B, L);
+}
+/*  End of bench_naive_addto_sum.                                             */
+
+static void bench_naive_sums(size_t s, size_t L)
+{
+    bench_terms_setup();
+
+    Naive_AddTo_Sum_Of_Products(
+        bench_P, BENCH_TERMS, bench_terms_A, s, bench_terms_B, L
+    );
+}
+/*  End of bench_naive_sums.                                                  */
+
+static void bench_naive_combination(size_t s, size_t L)
+{
+    bench_terms_setup();
+
+    Naive_AddTo_Combination_Product(
+        bench_P, BENCH_TERMS, bench_scalars, bench_terms_A, s, bench_B, L
+    );
+}
+/*  End of bench_naive_combination.                                           */
+
+static void bench_scaled_addto(size_t s, size_t L)
+{
+    (void)s;
+    Scaled_AddTo(bench_P, bench_A, L, 3);
+}
+/*  End of bench_scaled_addto.                                                */
+
+static void bench_naive_square(size_t s, size_t L)
+{
+    (void)s;
+    Naive_Square(bench_P, bench_A, L);
+}
+/*  End of bench_naive_square.                                                */
+
+static void bench_karatsuba(size_t s, size_t L)
+{
+    Karatsuba_Product_With_Scratch(bench_P, bench_A, s, bench_B, L, bench_work);
+}
+/*  End of bench_karatsuba.                                                   */
+
+static void bench_karatsuba_square(size_t s, size_t L)
+{
+    (void)s;
+    Karatsuba_Square_With_Scratch(bench_P, bench_A, L, bench_work);
+}
+/*  End of bench_karatsuba_square.                                            */
+
+static void bench_toom3(size_t s, size_t L)
+{
+    Toom3_Product_With_Scratch(bench_P, bench_A, s, bench_B, L, bench_work);
+}
+/*  End of bench_toom3.                                                       */
+
+static void bench_toom3_square(size_t s, size_t L)
+{
+    (void)s;
+    Toom3_Square_With_Scratch(bench_P, bench_A, L, bench_work);
+}
+/*  End of bench_toom3_square.                                                */
+
+static void bench_ntt(size_t s, size_t L)
+{
+    NTT_Product_With_Scratch(bench_P, bench_A, s, bench_B, L, bench_work);
+}
+/*  End of bench_ntt.                                                         */
+
+static void bench_ntt_square(size_t s, size_t L)
+{
+    (void)s;
+    NTT_Square_With_Scratch(bench_P, bench_A, L, bench_work);
+}
+/*  End of bench_ntt_square.                                                  */
+
+static void bench_poly(size_t s, size_t L)
+{
+    Poly_Multiply_With_Scratch(bench_P, bench_A, s, bench_B, L, bench_work);
+}
+/*  End of bench_poly.                                                        */
+
+static void bench_poly_square(size_t s, size_t L)
+{
+    (void)s;
+    Poly_Square_With_Scratch(bench_P, bench_A, L, bench_work);
+}
+/*  End of bench_poly_square.                                                 */
+
+static void bench_naive_short(size_t s, size_t L)
+{
+    Naive_Short_Product(bench_P, bench_A, s, bench_B, L, L);
+}
+/*  End of bench_naive_short.                                                 */
+
+static void bench_poly_short(size_t s, size_t L)
+{
+    Poly_Short_Product_With_Scratch(
+        bench_P, bench_A, s, bench_B, L, L, bench_work
+    );
+}
+/*  End of bench_poly_short.                                                  */
+
+static void bench_karatsuba_short(size_t s, size_t L)
+{
+    Karatsuba_Short_Product_With_Scratch(
+        bench_P, bench_A, s, bench_B, L, L, bench_work
+    );
+}
+/*  End of bench_karatsuba_short.                                             */
+
+static void bench_naive_middle(size_t s, size_t L)
+{
+    Naive_Middle_Product(bench_P, bench_A, L + s - (size_t)1, bench_B, s);
+}
+/*  End of bench_naive_middle.                                                */
+
+static void bench_poly_middle(size_t s, size_t L)
+{
+    Poly_Middle_Product_With_Scratch(
+        bench_P, bench_A, L + s - (size_t)1, bench_B, s, bench_work
+    );
+}
+/*  End of bench_poly_middle.                                                 */
+
+static void bench_karatsuba_middle(size_t s, size_t L)
+{
+    Karatsuba_Middle_Product_With_Scratch(
+        bench_P, bench_A, L + s - (size_t)1, bench_B, s, bench_work
+    );
+}
+/*  End of bench_karatsuba_middle.                                            */
+
+static void bench_ntt_middle(size_t s, size_t L)
+{
+    NTT_Middle_Product_With_Scratch(
+        bench_P, bench_A, L + s - (size_t)1, bench_B, s, bench_work
+    );
+}
+/*  End of bench_ntt_middle.                                                  */
+
+static void bench_ntt_sums(size_t s, size_t L)
+{
+    bench_terms_setup();
+
+    NTT_AddTo_Sum_Of_Products_With_Scratch(
+        bench_P, BENCH_TERMS, bench_terms_A, s, bench_terms_B, L, bench_work
+    );
+}
+/*  End of bench_ntt_sums.                                                    */
+
+static void bench_poly_sums(size_t s, size_t L)
+{
+    bench_terms_setup();
+
+    Poly_AddTo_Sum_Of_Products_With_Scratch(
+        bench_P, BENCH_TERMS, bench_terms_A, s, bench_terms_B, L, bench_work
+    );
+}
+/*  End of bench_poly_sums.                                                   */
+
+static void bench_poly_combination(size_t s, size_t L)
+{
+    bench_terms_setup();
+
+    Poly_AddTo_Combination_Product_With_Scratch(
+        bench_P, BENCH_TERMS, bench_scalars, bench_terms_A, s,
+        bench_B, L, bench_work
+    );
+}
+/*  End of bench_poly_combination.                                            */
+
+/*  The products written over an operand, with P starting out as A.           */
+static void bench_naive_overlap(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    int * const P = bench_P;
+    const int * const A = bench_A;
+
+    for (n = (size_t)0; n < s; ++n)
+        P[n] = A[n];
+
+    Naive_Product_Overlap(P, P, s, bench_B, L);
+}
+/*  End of bench_naive_overlap.                                               */
+
+static void bench_naive_addto_overlap(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    int * const P = bench_P;
+    const int * const A = bench_A;
+
+    for (n = (size_t)0; n < s; ++n)
+        P[n] = A[n];
+
+    Naive_AddTo_Product_Overlap(P, P, s, bench_B, L);
+}
+/*  End of bench_naive_addto_overlap.                                         */
+
+static void bench_in_place(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    int * const P = bench_P;
+    const int * const A = bench_A;
+
+    for (n = (size_t)0; n < s; ++n)
+        P[n] = A[n];
+
+    Poly_Multiply_In_Place_With_Scratch(P, s, bench_B, L, bench_work);
+}
+/*  End of bench_in_place.                                                    */
+
+/*  The routines that share the products between threads.                     */
+static void bench_parallel(size_t s, size_t L)
+{
+    Poly_Multiply_Parallel(bench_pool, bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_parallel.                                                    */
+
+static void bench_batch(size_t s, size_t L)
+{
+    bench_batch_setup(s, L);
+
+    Poly_Multiply_Batch(
+        bench_pool, bench_batch_count(L), bench_batch_P,
+        bench_batch_A, bench_batch_A_len, bench_batch_B, bench_batch_B_len
+    );
+}
+/*  End of bench_batch.                                                       */
+
+/*  Product i is (A + i(s + 1)) * (B + i(L + 1)), written to P + i(s + L),    *
+ *  leaving one coefficient between the outputs untouched.                    */
+static void bench_batch_strided(size_t s, size_t L)
+{
+    Poly_Multiply_Batch_Strided(
+        bench_pool, bench_batch_count(L), bench_P, s + L,
+        bench_A, s, s + (size_t)1, bench_B, L, L + (size_t)1
+    );
+}
+/*  End of bench_batch_strided.                                               */
+
+/*  The products against a prepared operand.                                  */
+static void bench_prepared(size_t s, size_t L)
+{
+    Poly_Multiply_Prepared_With_Scratch(
+        bench_get_plan(s, L), bench_P, bench_A, s, bench_work
+    );
+}
+/*  End of bench_prepared.                                                    */
+
+/*  The stream holds A, and B is pushed in pieces of varying lengths.         */
+static void bench_poly_stream(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, piece, k = (size_t)0, count = (size_t)0;
+    Poly_Stream * const stream = bench_get_stream(s);
+    int * const P = bench_P;
+    const int * const B = bench_B;
+
+    /*  The number of piece lengths.                                          */
+    const size_t pieces = sizeof(bench_stream_pieces) / sizeof(size_t);
+
+    for (n = (size_t)0; n < L; n += piece)
+    {
+        piece = bench_stream_pieces[k++ % pieces];
+
+        if (piece > L - n)
+            piece = L - n;
+
+        count += Poly_Stream_Push(stream, P + count, B + n, piece);
+    }
+
+    Poly_Stream_Finish(stream, P + count);
+}
+/*  End of bench_poly_stream.                                                 */
+
+/*  The sparse products, converting the operands to terms and the product     *
+ *  back, so that P holds the same dense output as the other routines.        */
+static void bench_sparse(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, A_count, B_count, count;
+    Poly_Term *A_terms, *B_terms, *P_terms;
+    int * const P = bench_P;
+
+    A_terms = bench_work;
+    A_count = Sparse_From_Dense(A_terms, bench_A, s);
+    B_terms = A_terms + A_count;
+    B_count = Sparse_From_Dense(B_terms, bench_B, L);
+    P_terms = B_terms + B_count;
+    count = Sparse_Product(P_terms, A_terms, A_count, B_terms, B_count);
+    n = (size_t)0;
+
+    if (count > (size_t)0)
+    {
+        Sparse_To_Dense(P, P_terms, count);
+        n = P_terms[count - (size_t)1].exponent + (size_t)1;
+    }
+
+    /*  The terms that cancelled at the top.                                  */
+    for (; n < s + L - (size_t)1; ++n)
+        P[n] = 0;
+}
+/*  End of bench_sparse.                                                      */
+
+static void bench_sparse_dense(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, A_count;
+    Poly_Term * const A_terms = bench_work;
+    int * const P = bench_P;
+
+    A_count = Sparse_From_Dense(A_terms, bench_A, s);
+    n = (size_t)0;
+
+    if (A_count > (size_t)0)
+    {
+        Sparse_Dense_Product(P, A_terms, A_count, bench_B, L);
+        n = A_terms[A_count - (size_t)1].exponent + L;
+    }
+
+    /*  The top of A is zero.                                                 */
+    for (; n < s + L - (size_t)1; ++n)
+        P[n] = 0;
+}
+/*  End of bench_sparse_dense.                                                */
+
+/*  Division of A, of length L + s - 1, by B, of length s, whose leading      *
+ *  coefficient is made 1 or -1. P holds Q, of length L, then R.              */
+static void bench_divide(size_t s, size_t L)
+{
+    int * const B = bench_B;
+    int * const P = bench_P;
+
+    B[s - (size_t)1] = (B[s - (size_t)1] < 0 ? -1 : 1);
+
+    Poly_Divide_With_Scratch(
+        P, P + L, bench_A, L + s - (size_t)1, B, s, bench_work
+    );
+}
+/*  End of bench_divide.                                                      */
+
+/*  The first L coefficients of 1 / B, with B[0] made 1 or -1.                */
+static void bench_inverse(size_t s, size_t L)
+{
+    int * const B = bench_B;
+
+    B[0] = (B[0] < 0 ? -1 : 1);
+    Poly_Series_Inverse_With_Scratch(bench_P, B, s, L, bench_work);
+}
+/*  End of bench_inverse.                                                     */
+
+/*  The operands read as integers of s and L limbs.                           */
+static void bench_big(size_t s, size_t L)
+{
+    Big_Product(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_big.                                                         */
+
+/*  The operands read as polynomials in two variables, see bench_multi_dims.  */
+static void bench_multi(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_dims[2], B_dims[2];
+
+    bench_multi_dims(A_dims, s);
+    bench_multi_dims(B_dims, L);
+
+    Poly_Multiply_Multivariate_With_Scratch(
+        bench_P, bench_A, A_dims, bench_B, B_dims, (size_t)2, bench_work
+    );
+}
+/*  End of bench_multi.                                                       */
+
+/*  The routines with 64-bit outputs, and those modulo a prime.               */
+static void bench_naive_wide(size_t s, size_t L)
+{
+    Naive_Product_Wide(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_wide.                                                  */
+
+static void bench_ntt_wide(size_t s, size_t L)
+{
+    NTT_Product_Wide_With_Scratch(bench_P, bench_A, s, bench_B, L, bench_work);
+}
+/*  End of bench_ntt_wide.                                                    */
+
+static void bench_poly_wide(size_t s, size_t L)
+{
+    Poly_Multiply_Wide(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_poly_wide.                                                   */
+
+#ifdef POLY_HAS_INT128
+static void bench_naive_wide128(size_t s, size_t L)
+{
+    Naive_Product_Wide128(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_wide128.                                               */
+#endif
+/*  End of #ifdef POLY_HAS_INT128.                                            */
+
+static void bench_naive_mod(size_t s, size_t L)
+{
+    Naive_Product_Mod(bench_P, bench_A, s, bench_B, L, &bench_modulus);
+}
+/*  End of bench_naive_mod.                                                   */
+
+static void bench_naive_addto_mod(size_t s, size_t L)
+{
+    Naive_AddTo_Product_Mod(bench_P, bench_A, s, bench_B, L, &bench_modulus);
+}
+/*  End of bench_naive_addto_mod.                                             */
+
+static void bench_scaled_addto_mod(size_t s, size_t L)
+{
+    (void)s;
+    Scaled_AddTo_Mod(bench_P, bench_A, L, 3U, &bench_modulus);
+}
+/*  End of bench_scaled_addto_mod.                                            */
+
+static void bench_ntt_mod(size_t s, size_t L)
+{
+    NTT_Product_Mod_With_Scratch(
+        bench_P, bench_A, s, bench_B, L, bench_work, &bench_modulus
+    );
+}
+/*  End of bench_ntt_mod.                                                     */
+
+static void bench_poly_mod(size_t s, size_t L)
+{
+    Poly_Multiply_Mod(bench_P, bench_A, s, bench_B, L, &bench_modulus);
+}
+/*  End of bench_poly_mod.                                                    */
+
+/*  The routines for the other coefficient types.                             */
+static void bench_naive_int16(size_t s, size_t L)
+{
+    Naive_Product_Int16(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_int16.                                                 */
+
+static void bench_karatsuba_int16(size_t s, size_t L)
+{
+    Karatsuba_Product_With_Scratch_Int16(
+        bench_P, bench_A, s, bench_B, L, bench_work
+    );
+}
+/*  End of bench_karatsuba_int16.                                             */
+
+static void bench_naive_int64(size_t s, size_t L)
+{
+    Naive_Product_Int64(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_int64.                                                 */
+
+static void bench_karatsuba_int64(size_t s, size_t L)
+{
+    Karatsuba_Product_With_Scratch_Int64(
+        bench_P, bench_A, s, bench_B, L, bench_work
+    );
+}
+/*  End of bench_karatsuba_int64.                                             */
+
+static void bench_naive_float(size_t s, size_t L)
+{
+    Naive_Product_Float(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_float.                                                 */
+
+static void bench_karatsuba_float(size_t s, size_t L)
+{
+    Karatsuba_Product_With_Scratch_Float(
+        bench_P, bench_A, s, bench_B, L, bench_work
+    );
+}
+/*  End of bench_karatsuba_float.                                             */
+
+static void bench_naive_double(size_t s, size_t L)
+{
+    Naive_Product_Double(bench_P, bench_A, s, bench_B, L);
+}
+/*  End of bench_naive_double.                                                */
+
+static void bench_karatsuba_double(size_t s, size_t L)
+{
+    Karatsuba_Product_With_Scratch_Double(
+        bench_P, bench_A, s, bench_B, L, bench_work
+    );
+}
+/*  End of bench_karatsuba_double.                                            */
+
+/*  Every routine that is benchmarked.                                        */
+static const bench_kernel bench_kernels[] = {
+    {"Naive_Product", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive},
+    {"Naive_AddTo_Product", BENCH_ADDTO, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_addto},
+    {"Naive_AddTo_Sum_Product", BENCH_SUM, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_addto_sum},
+    {"Naive_AddTo_Sum_Of_Products", BENCH_SUMS, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_sums},
+    {"Naive_AddTo_Combination_Product", BENCH_COMBINATION, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_combination},
+    {"Scaled_AddTo", BENCH_SCALE, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_scaled_addto},
+    {"Naive_Square", BENCH_SQUARE, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_square},
+    {"Naive_Short_Product", BENCH_SHORT, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_short},
+    {"Naive_Middle_Product", BENCH_MIDDLE, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_middle},
+    {"Karatsuba_Product", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_karatsuba_scratch, bench_karatsuba},
+    {"Karatsuba_Square", BENCH_SQUARE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_karatsuba_scratch,
+     bench_karatsuba_square},
+    {"Karatsuba_Short_Product", BENCH_SHORT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_karatsuba_short_scratch,
+     bench_karatsuba_short},
+    {"Karatsuba_Middle_Product", BENCH_MIDDLE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_karatsuba_middle_scratch,
+     bench_karatsuba_middle},
+    {"Toom3_Product", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_toom3_scratch, bench_toom3},
+    {"Toom3_Square", BENCH_SQUARE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_toom3_scratch, bench_toom3_square},
+    {"NTT_Product", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_ntt_scratch, bench_ntt},
+    {"NTT_Square", BENCH_SQUARE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_ntt_scratch, bench_ntt_square},
+    {"NTT_Middle_Product", BENCH_MIDDLE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_ntt_middle_scratch, bench_ntt_middle},
+    {"NTT_AddTo_Sum_Of_Products", BENCH_SUMS, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_ntt_sums_scratch, bench_ntt_sums},
+    {"Poly_Multiply", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_poly_scratch, bench_poly},
+    {"Poly_Square", BENCH_SQUARE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_poly_scratch, bench_poly_square},
+    {"Poly_Short_Product", BENCH_SHORT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_short_scratch, bench_poly_short},
+    {"Poly_Middle_Product", BENCH_MIDDLE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_middle_scratch, bench_poly_middle},
+    {"Poly_AddTo_Sum_Of_Products", BENCH_SUMS, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_sums_scratch, bench_poly_sums},
+    {"Poly_AddTo_Combination_Product", BENCH_COMBINATION, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_combination_scratch,
+     bench_poly_combination},
+    {"Naive_Product_Overlap", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_overlap},
+    {"Naive_AddTo_Product_Overlap", BENCH_OVERLAP, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_naive_addto_overlap},
+    {"Poly_Multiply_In_Place", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_in_place_scratch, bench_in_place},
+    {"Poly_Multiply_Parallel", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_parallel},
+    {"Poly_Multiply_Batch", BENCH_BATCH, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_batch},
+    {"Poly_Multiply_Batch_Strided", BENCH_STRIDED, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_batch_strided},
+    {"Poly_Multiply_Prepared", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_prepared_scratch, bench_prepared},
+    {"Poly_Stream", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_stream_scratch, bench_poly_stream},
+    {"Sparse_Product", BENCH_SPARSE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_sparse_scratch, bench_sparse},
+    {"Sparse_Dense_Product", BENCH_SPARSE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_sparse_dense_scratch,
+     bench_sparse_dense},
+    {"Poly_Divide", BENCH_DIVIDE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_divide_scratch, bench_divide},
+    {"Poly_Series_Inverse", BENCH_INVERSE, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_inverse_scratch, bench_inverse},
+    {"Big_Product", BENCH_BIG, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_big},
+    {"Poly_Multiply_Multivariate", BENCH_MULTI, BENCH_INT32,
+     sizeof(int), sizeof(int), bench_multi_scratch, bench_multi},
+    {"Naive_Product_Wide", BENCH_PRODUCT, BENCH_WIDE,
+     sizeof(int), sizeof(long long), NULL, bench_naive_wide},
+    {"NTT_Product_Wide", BENCH_PRODUCT, BENCH_WIDE,
+     sizeof(int), sizeof(long long), bench_ntt_scratch, bench_ntt_wide},
+    {"Poly_Multiply_Wide", BENCH_PRODUCT, BENCH_WIDE,
+     sizeof(int), sizeof(long long), NULL, bench_poly_wide},
+#ifdef POLY_HAS_INT128
+    {"Naive_Product_Wide128", BENCH_PRODUCT, BENCH_WIDE128,
+     sizeof(long long), sizeof(Poly_Int128), NULL, bench_naive_wide128},
+#endif
+    {"Naive_Product_Mod", BENCH_PRODUCT, BENCH_MOD,
+     sizeof(int), sizeof(int), NULL, bench_naive_mod},
+    {"Naive_AddTo_Product_Mod", BENCH_ADDTO, BENCH_MOD,
+     sizeof(int), sizeof(int), NULL, bench_naive_addto_mod},
+    {"Scaled_AddTo_Mod", BENCH_SCALE, BENCH_MOD,
+     sizeof(int), sizeof(int), NULL, bench_scaled_addto_mod},
+    {"NTT_Product_Mod", BENCH_PRODUCT, BENCH_MOD,
+     sizeof(int), sizeof(int), bench_ntt_mod_scratch, bench_ntt_mod},
+    {"Poly_Multiply_Mod", BENCH_PRODUCT, BENCH_MOD,
+     sizeof(int), sizeof(int), NULL, bench_poly_mod},
+    {"Naive_Product_Int16", BENCH_PRODUCT, BENCH_INT16,
+     sizeof(short), sizeof(short), NULL, bench_naive_int16},
+    {"Karatsuba_Product_Int16", BENCH_PRODUCT, BENCH_INT16,
+     sizeof(short), sizeof(short), bench_scratch_int16,
+     bench_karatsuba_int16},
+    {"Naive_Product_Int64", BENCH_PRODUCT, BENCH_INT64,
+     sizeof(long long), sizeof(long long), NULL, bench_naive_int64},
+    {"Karatsuba_Product_Int64", BENCH_PRODUCT, BENCH_INT64,
+     sizeof(long long), sizeof(long long), bench_scratch_int64,
+     bench_karatsuba_int64},
+    {"Naive_Product_Float", BENCH_PRODUCT, BENCH_FLOAT,
+     sizeof(float), sizeof(float), NULL, bench_naive_float},
+    {"Karatsuba_Product_Float", BENCH_PRODUCT, BENCH_FLOAT,
+     sizeof(float), sizeof(float), bench_scratch_float,
+     bench_karatsuba_float},
+    {"Naive_Product_Double", BENCH_PRODUCT, BENCH_DOUBLE,
+     sizeof(double), sizeof(double), NULL, bench_naive_double},
+    {"Karatsuba_Product_Double", BENCH_PRODUCT, BENCH_DOUBLE,
+     sizeof(double), sizeof(double), bench_scratch_double,
+     bench_karatsuba_double}
+};
+
+/*  The number of routines in bench_kernels.                                  */
+#define BENCH_KERNELS (sizeof(bench_kernels) / sizeof(bench_kernels[0]))
+
+/*  Fills the operand buffers with random values of the given type, the same  *
+ *  ones on every call. If sparse is set, all but one in 64 of the            *
+ *  coefficients of A are zero.                                               */
+static void bench_fill(int type, int sparse)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  The buffers hold 2 BENCH_MAX_LEN coefficients of any of the types.    */
+    const size_t len = (size_t)2 * (size_t)BENCH_MAX_LEN;
+
+    srand(BENCH_SEED);
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        switch (type)
+        {
+            case BENCH_INT16:
+                ((short *)bench_A)[n] = (short)(rand() % 3 - 1);
+                ((short *)bench_B)[n] = (short)(rand() % 3 - 1);
+                break;
+
+            case BENCH_INT64:
+            case BENCH_WIDE128:
+                ((long long *)bench_A)[n] = rand() % 3 - 1;
+                ((long long *)bench_B)[n] = rand() % 3 - 1;
+                break;
+
+            case BENCH_FLOAT:
+                ((float *)bench_A)[n] = (float)rand() / (float)RAND_MAX;
+                ((float *)bench_B)[n] = (float)rand() / (float)RAND_MAX;
+                break;
+
+            case BENCH_DOUBLE:
+                ((double *)bench_A)[n] = (double)rand() / RAND_MAX;
+                ((double *)bench_B)[n] = (double)rand() / RAND_MAX;
+                break;
+
+            /*  The routines that add to P need it reduced as well.           */
+            case BENCH_MOD:
+                ((unsigned int *)bench_A)[n] =
+                    (unsigned int)rand() % bench_modulus.p;
+                ((unsigned int *)bench_B)[n] =
+                    (unsigned int)rand() % bench_modulus.p;
+                ((unsigned int *)bench_P)[n] =
+                    (unsigned int)rand() % bench_modulus.p;
+                break;
+
+            /*  Small coefficients let Naive_Product_Wide defer the widening. */
+            default:
+                ((int *)bench_A)[n] = rand() % 3 - 1;
+                ((int *)bench_B)[n] = rand() % 3 - 1;
+                break;
+        }
+
+        /*  Only the sparse routines, with int coefficients, ask for this.    */
+        if (sparse && rand() % 64 != 0)
+            ((int *)bench_A)[n] = 0;
+    }
+
+    ++bench_generation;
+}
+/*  End of bench_fill.                                                        */
+
+/*  Returns 1 for the routines that add to P, and 0 for those that write it.  */
+static int bench_adds(int kind)
+{
+    return (kind == BENCH_ADDTO || kind == BENCH_SUM || kind == BENCH_SCALE ||
+            kind == BENCH_SUMS || kind == BENCH_COMBINATION ||
+            kind == BENCH_OVERLAP);
+}
+/*  End of bench_adds.                                                        */
+
+/*  Computes the lengths passed to a routine, the number of coefficients it   *
+ *  writes, and its schoolbook operation count and compulsory traffic.        */
+static void
+bench_model(const bench_kernel *kernel, size_t s, size_t L,
+            size_t *A_len, size_t *B_len, size_t *out_len,
+            double *ops, double *bytes)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, count, A_dims[2], B_dims[2];
+    const double in = (double)kernel->in_size;
+    const double out = (double)kernel->out_size;
+    const double ds = (double)s;
+    const double dL = (double)L;
+
+    switch (kernel->kind)
+    {
+        case BENCH_SCALE:
+            *A_len = L;
+            *B_len = (size_t)0;
+            *out_len = L;
+            *ops = 2.0 * dL;
+            *bytes = dL * in + 2.0 * dL * out;
+            return;
+
+        case BENCH_SQUARE:
+            *A_len = *B_len = L;
+            *out_len = (size_t)2 * L - (size_t)1;
+            *ops = 2.0 * dL * dL;
+            *bytes = dL * in + (double)*out_len * out;
+            return;
+
+        /*  The pairs of coefficients whose product lands below x^L.          */
+        case BENCH_SHORT:
+            *A_len = s;
+            *B_len = L;
+            *out_len = L;
+            *ops = 2.0 * (ds * dL - 0.5 * ds * (ds - 1.0));
+            *bytes = (ds + dL) * in + dL * out;
+            return;
+
+        case BENCH_MIDDLE:
+            *A_len = L + s - (size_t)1;
+            *B_len = s;
+            *out_len = L;
+            *ops = 2.0 * ds * dL;
+            *bytes = (dL + 2.0 * ds - 1.0) * in + dL * out;
+            return;
+
+        /*  The lengths of the first product, and the totals of the batch.    */
+        case BENCH_BATCH:
+            *out_len = bench_batch_setup(s, L);
+            *A_len = s;
+            *B_len = L;
+            *ops = *bytes = 0.0;
+
+            for (k = (size_t)0; k < bench_batch_count(L); ++k)
+            {
+                *ops += 2.0 * (double)bench_batch_A_len[k] *
+                        (double)bench_batch_B_len[k];
+                *bytes += (double)(bench_batch_A_len[k] +
+                                   bench_batch_B_len[k]) * in;
+            }
+
+            *bytes += (double)*out_len * out;
+            return;
+
+        /*  The coefficients between the outputs are counted as written.      */
+        case BENCH_STRIDED:
+            count = bench_batch_count(L);
+            *A_len = s;
+            *B_len = L;
+            *out_len = count * (s + L) - (size_t)1;
+            *ops = 2.0 * (double)count * ds * dL;
+            *bytes = (double)count * (ds + dL) * in + (double)*out_len * out;
+            return;
+
+        /*  A quotient of length L and a remainder of length s - 1.           */
+        case BENCH_DIVIDE:
+            *A_len = L + s - (size_t)1;
+            *B_len = s;
+            *out_len = L + s - (size_t)1;
+            *ops = 2.0 * ds * dL;
+            *bytes = (dL + 2.0 * ds - 1.0) * in + (double)*out_len * out;
+            return;
+
+        /*  L coefficients of the inverse of a B of length s.                 */
+        case BENCH_INVERSE:
+            *A_len = L;
+            *B_len = s;
+            *out_len = L;
+            *ops = 2.0 * ds * dL;
+            *bytes = ds * in + dL * out;
+            return;
+
+        case BENCH_BIG:
+            *A_len = s;
+            *B_len = L;
+            *out_len = s + L;
+            *ops = 2.0 * ds * dL;
+            *bytes = (ds + dL) * (in + out);
+            return;
+
+        case BENCH_MULTI:
+            bench_multi_dims(A_dims, s);
+            bench_multi_dims(B_dims, L);
+            *A_len = s;
+            *B_len = L;
+            *out_len = (A_dims[0] + B_dims[0] - (size_t)1) *
+                       (A_dims[1] + B_dims[1] - (size_t)1);
+            *ops = 2.0 * ds * dL;
+            *bytes = (ds + dL) * in + (double)*out_len * out;
+            return;
+
+        default:
+            *A_len = s;
+            *B_len = L;
+            *out_len = s + L - (size_t)1;
+            *ops = 2.0 * ds * dL;
+            *bytes = (ds + dL) * in + (double)*out_len * out;
+
+            /*  Routines that add to P read it as well.                       */
+            if (bench_adds(kernel->kind))
+                *bytes += (double)*out_len * out;
+
+            /*  Forming A0 + A1 reads the second row and adds it in.          */
+            if (kernel->kind == BENCH_SUM)
+            {
+                *ops += ds;
+                *bytes += ds * in;
+            }
+
+            /*  The other products of a sum of products.                      */
+            if (kernel->kind == BENCH_SUMS)
+            {
+                *ops *= (double)BENCH_TERMS;
+                *bytes += (double)(BENCH_TERMS - 1) * (ds + dL) * in;
+            }
+
+            /*  Forming the combination reads the other terms, and scales     *
+             *  and adds them in.                                             */
+            if (kernel->kind == BENCH_COMBINATION)
+            {
+                *ops += (double)(2 * BENCH_TERMS - 1) * ds;
+                *bytes += (double)(BENCH_TERMS - 1) * ds * in;
+            }
+
+            return;
+    }
+}
+/*  End of bench_model.                                                       */
+
+/*  Returns the time, in seconds, of one call of the routine. slow is set if  *
+ *  a single call took at least bench_max_time. Returns a negative value if   *
+ *  the scratch space can not be allocated.                                   */
+static double
+bench_time(const bench_kernel *kernel, size_t s, size_t L, int *slow)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long count, calls;
+    double elapsed, best = -1.0;
+    clock_t start;
+    int run;
+
+    *slow = 0;
+
+    if (kernel->scratch && bench_reserve(kernel->scratch(s, L)) != 0)
+        return -1.0;
+
+    for (run = 0; run < BENCH_RUNS; ++run)
+    {
+        /*  Repeat the call until enough time has passed to measure.          */
+        calls = 1UL;
+
+        do {
+            start = clock();
+
+            for (count = 0UL; count < calls; ++count)
+                kernel->run(s, L);
+
+            elapsed = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+            calls *= 2UL;
+        } while (elapsed < bench_min_time);
+
+        elapsed /= (double)(calls / 2UL);
+
+        if (best < 0.0 || elapsed < best)
+            best = elapsed;
+
+        /*  One slow call is timing enough, and ends the sweep.               */
+        if (calls == 2UL && elapsed >= bench_max_time)
+        {
+            *slow = 1;
+            break;
+        }
+    }
+
+    return best;
+}
+/*  End of bench_time.                                                        */
+
+/*  Writes the header of the output.                                          */
+static void bench_begin(FILE *fp, int json)
+{
+    if (json)
+        fprintf(fp, "[\n");
+    else
+        fprintf(fp, "kernel,type,shape,A_len,B_len,seconds,"
+                    "ns_per_coeff,gflops,gbytes_per_s\n");
+}
+/*  End of bench_begin.                                                       */
+
+/*  Writes one timing as a CSV line or a JSON object.                         */
+static void
+bench_write(FILE *fp, int json, int first, const bench_kernel *kernel,
+            size_t ratio, size_t s, size_t L, double seconds)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_len, B_len, out_len;
+    double ops, bytes;
+
+    bench_model(kernel, s, L, &A_len, &B_len, &out_len, &ops, &bytes);
+
+    if (json)
+        fprintf(fp, "%s  {\"kernel\": \"%s\", \"type\": \"%s\", "
+                    "\"shape\": \"1:%lu\", \"A_len\": %lu, \"B_len\": %lu, "
+                    "\"seconds\": %.6e, \"ns_per_coeff\": %.6g, "
+                    "\"gflops\": %.6g, \"gbytes_per_s\": %.6g}",
+                (first ? "" : ",\n"), kernel->name,
+                bench_type_names[kernel->type], (unsigned long)ratio,
+                (unsigned long)A_len, (unsigned long)B_len, seconds,
+                seconds * 1.0E9 / (double)out_len, ops / seconds * 1.0E-9,
+                bytes / seconds * 1.0E-9);
+    else
+        fprintf(fp, "%s,%s,1:%lu,%lu,%lu,%.6e,%.6g,%.6g,%.6g\n",
+                kernel->name, bench_type_names[kernel->type],
+                (unsigned long)ratio, (unsigned long)A_len,
+                (unsigned long)B_len, seconds,
+                seconds * 1.0E9 / (double)out_len, ops / seconds * 1.0E-9,
+                bytes / seconds * 1.0E-9);
+
+    fflush(fp);
+}
+/*  End of bench_write.                                                       */
+
+/*  Writes the end of the output.                                             */
+static void bench_end(FILE *fp, int json, int empty)
+{
+    if (json)
+        fprintf(fp, "%s]\n", (empty ? "" : "\n"));
+}
+/*  End of bench_end.                                                         */
+
+/*  Returns the next length of the sweep 1, 2, 5, 10, 20, 50, ...             */
+static size_t bench_next_length(size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t scale = (size_t)1;
+
+    while (L >= (size_t)10 * scale)
+        scale *= (size_t)10;
+
+    if (L == scale)
+        return (size_t)2 * scale;
+
+    if (L == (size_t)2 * scale)
+        return (size_t)5 * scale;
+
+    return (size_t)10 * scale;
+}
+/*  End of bench_next_length.                                                 */
+
+/*  The fixed shapes checked, as pairs s <= L. Besides the trivial lengths,   *
+ *  these sit on either side of the SIMD tile widths and the cutoffs, and     *
+ *  include the most unbalanced products.                                     */
+static const size_t bench_check_shapes[][2] = {
+    {1, 1}, {1, 2}, {2, 2}, {1, 3}, {2, 3}, {3, 3}, {7, 7}, {8, 9},
+    {1, 1000}, {2, 1000}, {3, 4096}, {15, 16}, {16, 16}, {17, 17},
+    {31, 33}, {63, 64}, {64, 64}, {65, 65}, {100, 1000}, {255, 257},
+    {512, 512}, {1000, 1000}, {1023, 1024}, {4096, 4096}
+};
+
+/*  The reference result, the old output for the routines that add to P, and  *
+ *  the sum A0 + A1, each with room for BENCH_CHECK_OUT coefficients.         */
+static unsigned long long *bench_ref, *bench_old, *bench_sum;
+
+/*  Returns the type of the inputs of the routines of the given type.         */
+static int bench_in_type(int type)
+{
+    if (type == BENCH_WIDE)
+        return BENCH_INT32;
+
+    if (type == BENCH_WIDE128)
+        return BENCH_INT64;
+
+    return type;
+}
+/*  End of bench_in_type.                                                     */
+
+/*  Returns coefficient n of a buffer of the given type, as a two's           *
+ *  complement integer. The float types hold integers in the checks.          */
+static unsigned long long bench_get(const void *buf, int type, size_t n)
+{
+    switch (type)
+    {
+        case BENCH_INT16:
+            return (unsigned long long)(long long)((const short *)buf)[n];
+
+        case BENCH_INT64:
+        case BENCH_WIDE:
+            return (unsigned long long)((const long long *)buf)[n];
+
+        case BENCH_FLOAT:
+            return (unsigned long long)(long long)((const float *)buf)[n];
+
+        case BENCH_DOUBLE:
+            return (unsigned long long)(long long)((const double *)buf)[n];
+
+        case BENCH_MOD:
+            return ((const unsigned int *)buf)[n];
+
+        default:
+            return (unsigned long long)(long long)((const int *)buf)[n];
+    }
+}
+/*  End of bench_get.                                                         */
+
+/*  Returns 1 if coefficient n of the output, of the given type, equals the   *
+ *  reference value, compared modulo 2^16 and 2^32 for those types.           */
+static int bench_equal(const void *buf, int type, size_t n,
+                       unsigned long long value)
+{
+    switch (type)
+    {
+        case BENCH_INT16:
+            return (bench_get(buf, type, n) & 0xFFFFULL) == (value & 0xFFFFULL);
+
+        case BENCH_INT64:
+        case BENCH_WIDE:
+            return bench_get(buf, type, n) == value;
+
+        case BENCH_FLOAT:
+            return ((const float *)buf)[n] == (float)(long long)value;
+
+        case BENCH_DOUBLE:
+            return ((const double *)buf)[n] == (double)(long long)value;
+
+        default:
+            return (bench_get(buf, type, n) & 0xFFFFFFFFULL) ==
+                   (value & 0xFFFFFFFFULL);
+    }
+}
+/*  End of bench_equal.                                                       */
+
+/*  Returns 64 random bits. rand gives at least 15 bits, so five calls do.    */
+static unsigned long long bench_random(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long long bits = 0ULL;
+    int k;
+
+    for (k = 0; k < 5; ++k)
+        bits = (bits << 15) ^ (unsigned long long)rand();
+
+    return bits;
+}
+/*  End of bench_random.                                                      */
+
+/*  Fills the operand buffers for the checks. The values are small enough for *
+ *  the float types to be exact, and large enough for the 64-bit and 128-bit  *
+ *  outputs to need more than 32 and 64 bits. int16 is computed modulo 2^16,  *
+ *  so any values do. If sparse is set, all but one in 64 of the coefficients *
+ *  of A are zero. The output is filled too, as the old values of the         *
+ *  routines that add to P.                                                   */
+static void bench_check_fill(int type, int sparse)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    long long a, b, p;
+
+    /*  The buffers hold 2 BENCH_MAX_LEN coefficients of any of the types.    */
+    const size_t len = (size_t)2 * (size_t)BENCH_MAX_LEN;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        a = rand() % 15 - 7;
+        b = rand() % 15 - 7;
+        p = rand() % 15 - 7;
+
+        if (sparse && rand() % 64 != 0)
+            a = 0;
+
+        switch (type)
+        {
+            /*  Arithmetic modulo 2^16 is exact, so use any values.           */
+            case BENCH_INT16:
+                ((short *)bench_A)[n] = (short)(a ? rand() - RAND_MAX/2 : 0);
+                ((short *)bench_B)[n] = (short)(rand() - RAND_MAX/2);
+                break;
+
+            /*  Values of 20 bits, so that the outputs need the 64 bits.      */
+            case BENCH_INT64:
+                ((long long *)bench_A)[n] = a * (rand() % 0x20000);
+                ((long long *)bench_B)[n] = b * (rand() % 0x20000);
+                break;
+
+            /*  Karatsuba's sums must stay below 2^24 to be exact in float.   */
+            case BENCH_FLOAT:
+                ((float *)bench_A)[n] = (float)(a % 2);
+                ((float *)bench_B)[n] = (float)(b % 2);
+                break;
+
+            case BENCH_DOUBLE:
+                ((double *)bench_A)[n] = (double)a;
+                ((double *)bench_B)[n] = (double)b;
+                break;
+
+            case BENCH_MOD:
+                ((unsigned int *)bench_A)[n] =
+                    a ? (unsigned int)rand() % bench_modulus.p : 0U;
+                ((unsigned int *)bench_B)[n] =
+                    (unsigned int)rand() % bench_modulus.p;
+                ((unsigned int *)bench_P)[n] =
+                    (unsigned int)rand() % bench_modulus.p;
+                break;
+
+            case BENCH_WIDE:
+                ((int *)bench_A)[n] = (int)(a * (rand() % 0x20000));
+                ((int *)bench_B)[n] = (int)(b * (rand() % 0x20000));
+                break;
+
+            /*  Values of 53 bits, whose products need more than 64.          */
+            case BENCH_WIDE128:
+                ((long long *)bench_A)[n] =
+                    a * (long long)(bench_random() % 0x4000000000000ULL);
+                ((long long *)bench_B)[n] =
+                    b * (long long)(bench_random() % 0x4000000000000ULL);
+                break;
+
+            default:
+                ((int *)bench_A)[n] = (int)a;
+                ((int *)bench_B)[n] = (int)b;
+                ((int *)bench_P)[n] = (int)p;
+                break;
+        }
+    }
+
+    ++bench_generation;
+}
+/*  End of bench_check_fill.                                                  */
+
+/*  Returns 1 for the types whose routines are exact for any values, modulo   *
+ *  2^16, 2^32, 2^64, or the prime.                                           */
+static int bench_exact(int type)
+{
+    return (type == BENCH_INT32 || type == BENCH_INT16 ||
+            type == BENCH_INT64 || type == BENCH_MOD);
+}
+/*  End of bench_exact.                                                       */
+
+/*  As bench_check_fill, with values over the full range of the type, for     *
+ *  the types accepted by bench_exact. The int routines must then agree with  *
+ *  Naive_Product modulo 2^32, however large their intermediate values get.   */
+static void bench_check_fill_full(int type, int sparse)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long long a, b, p;
+
+    /*  The buffers hold 2 BENCH_MAX_LEN coefficients of any of the types.    */
+    const size_t len = (size_t)2 * (size_t)BENCH_MAX_LEN;
+
+    for (n = (size_t)0; n < len; ++n)
+    {
+        a = bench_random();
+        b = bench_random();
+        p = bench_random();
+
+        if (sparse && rand() % 64 != 0)
+            a = 0ULL;
+
+        switch (type)
+        {
+            case BENCH_INT16:
+                ((short *)bench_A)[n] = (short)(unsigned short)a;
+                ((short *)bench_B)[n] = (short)(unsigned short)b;
+                break;
+
+            case BENCH_INT64:
+                ((long long *)bench_A)[n] = (long long)a;
+                ((long long *)bench_B)[n] = (long long)b;
+                break;
+
+            case BENCH_MOD:
+                ((unsigned int *)bench_A)[n] =
+                    (unsigned int)(a % bench_modulus.p);
+                ((unsigned int *)bench_B)[n] =
+                    (unsigned int)(b % bench_modulus.p);
+                ((unsigned int *)bench_P)[n] =
+                    (unsigned int)(p % bench_modulus.p);
+                break;
+
+            default:
+                ((int *)bench_A)[n] = (int)(unsigned int)a;
+                ((int *)bench_B)[n] = (int)(unsigned int)b;
+                ((int *)bench_P)[n] = (int)(unsigned int)p;
+                break;
+        }
+    }
+
+    ++bench_generation;
+}
+/*  End of bench_check_fill_full.                                             */
+
+/*  Returns a random length from 1 to max_len, with small lengths as likely   *
+ *  as large ones, so that the cutoffs at every scale are crossed.            */
+static size_t bench_random_length(size_t max_len)
+{
+    while (max_len > (size_t)1 && rand() % 2)
+        max_len /= (size_t)2;
+
+    return (size_t)1 + (size_t)rand() % max_len;
+}
+/*  End of bench_random_length.                                               */
+
+/*  Adds the schoolbook product of X and Y to R, modulo 2^64, or modulo the   *
+ *  prime for the modular routines.                                           */
+static void
+bench_accumulate(int type, unsigned long long *R,
+                 const void *X, size_t X_len, int X_type,
+                 const void *Y, size_t Y_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, n;
+    unsigned long long x, t;
+    const unsigned long long p = bench_modulus.p;
+
+    /*  The wide routines take narrower inputs.                               */
+    const int Y_type = bench_in_type(type);
+
+    for (m = (size_t)0; m < X_len; ++m)
+    {
+        x = bench_get(X, X_type, m);
+
+        if (x == 0ULL)
+            continue;
+
+        for (n = (size_t)0; n < Y_len; ++n)
+        {
+            if (type != BENCH_MOD)
+            {
+                R[m + n] += x * bench_get(Y, Y_type, n);
+                continue;
+            }
+
+            t = R[m + n] + x * bench_get(Y, Y_type, n) % p;
+            R[m + n] = (t >= p ? t - p : t);
+        }
+    }
+}
+/*  End of bench_accumulate.                                                  */
+
+/*  Computes the schoolbook product of X and Y into R.                        */
+static void
+bench_convolve(int type, unsigned long long *R,
+               const void *X, size_t X_len, int X_type,
+               const void *Y, size_t Y_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    for (n = (size_t)0; n < X_len + Y_len - (size_t)1; ++n)
+        R[n] = 0ULL;
+
+    bench_accumulate(type, R, X, X_len, X_type, Y, Y_len);
+}
+/*  End of bench_convolve.                                                    */
+
+/*  The reference for a batch set up by bench_batch_setup, with the outputs   *
+ *  one after another.                                                        */
+static void bench_reference_batch(int type, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, offset;
+
+    for (k = (size_t)0; k < bench_batch_count(L); ++k)
+    {
+        offset = (size_t)(bench_batch_P[k] - (int *)bench_P);
+
+        bench_convolve(
+            type, bench_ref + offset, bench_batch_A[k], bench_batch_A_len[k],
+            type, bench_batch_B[k], bench_batch_B_len[k]
+        );
+    }
+}
+/*  End of bench_reference_batch.                                             */
+
+/*  The reference for bench_batch_strided. The coefficient between two        *
+ *  outputs must keep its old value.                                          */
+static void bench_reference_strided(int type, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    const size_t count = bench_batch_count(L);
+
+    for (k = (size_t)0; k < count; ++k)
+    {
+        bench_convolve(
+            type, bench_ref + k * (s + L),
+            (const int *)bench_A + k * (s + (size_t)1), s, type,
+            (const int *)bench_B + k * (L + (size_t)1), L
+        );
+
+        if (k + (size_t)1 < count)
+            bench_ref[k * (s + L) + s + L - (size_t)1] =
+                bench_old[k * (s + L) + s + L - (size_t)1];
+    }
+}
+/*  End of bench_reference_strided.                                           */
+
+/*  The reference for bench_divide, by long division modulo 2^64. The leading *
+ *  coefficient of B is 1 or -1, which is its own inverse.                    */
+static void bench_reference_divide(int type, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, n;
+    unsigned long long q;
+    const unsigned long long lead = bench_get(bench_B, type, s - (size_t)1);
+
+    /*  The remainder starts as A, and shrinks by one term per step.          */
+    for (n = (size_t)0; n < L + s - (size_t)1; ++n)
+        bench_sum[n] = bench_get(bench_A, type, n);
+
+    for (k = L; k > (size_t)0; --k)
+    {
+        q = bench_sum[k + s - (size_t)2] * lead;
+        bench_ref[k - (size_t)1] = q;
+
+        for (n = (size_t)0; n < s; ++n)
+            bench_sum[k - (size_t)1 + n] -= q * bench_get(bench_B, type, n);
+    }
+
+    for (n = (size_t)0; n < s - (size_t)1; ++n)
+        bench_ref[L + n] = bench_sum[n];
+}
+/*  End of bench_reference_divide.                                            */
+
+/*  The reference for bench_inverse, from I_0 = 1 / B_0 = B_0 and             *
+ *  I_n = -B_0 (B_1 I_{n-1} + ... + B_{s-1} I_{n-s+1}), modulo 2^64.          */
+static void bench_reference_inverse(int type, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, n;
+    unsigned long long t;
+    const unsigned long long unit = bench_get(bench_B, type, (size_t)0);
+
+    for (n = (size_t)0; n < L; ++n)
+    {
+        t = (n == (size_t)0 ? 1ULL : 0ULL);
+
+        for (k = (size_t)1; k < s && k <= n; ++k)
+            t -= bench_get(bench_B, type, k) * bench_ref[n - k];
+
+        bench_ref[n] = t * unit;
+    }
+}
+/*  End of bench_reference_inverse.                                           */
+
+/*  The reference for bench_big, by the schoolbook method on 32-bit limbs.    */
+static void bench_reference_big(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, n;
+    unsigned long long a, t, carry;
+    const unsigned int * const A = bench_A;
+    const unsigned int * const B = bench_B;
+
+    for (n = (size_t)0; n < s + L; ++n)
+        bench_ref[n] = 0ULL;
+
+    /*  A limb product plus two limbs is at most 2^64 - 1.                    */
+    for (m = (size_t)0; m < s; ++m)
+    {
+        a = A[m];
+        carry = 0ULL;
+
+        for (n = (size_t)0; n < L; ++n)
+        {
+            t = a * B[n] + bench_ref[m + n] + carry;
+            bench_ref[m + n] = t & 0xFFFFFFFFULL;
+            carry = t >> 32;
+        }
+
+        bench_ref[m + L] = carry;
+    }
+}
+/*  End of bench_reference_big.                                               */
+
+/*  The reference for bench_multi, adding the products of each row of A with  *
+ *  each row of B into the row of P they land on.                             */
+static void
+bench_reference_multi(int type, size_t s, size_t L, size_t out_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, j, n, A_dims[2], B_dims[2];
+    const int * const A = bench_A;
+    const int * const B = bench_B;
+
+    bench_multi_dims(A_dims, s);
+    bench_multi_dims(B_dims, L);
+
+    /*  The length of a row of P.                                             */
+    n = A_dims[1] + B_dims[1] - (size_t)1;
+
+    for (i = (size_t)0; i < out_len; ++i)
+        bench_ref[i] = 0ULL;
+
+    for (i = (size_t)0; i < A_dims[0]; ++i)
+        for (j = (size_t)0; j < B_dims[0]; ++j)
+            bench_accumulate(
+                type, bench_ref + (i + j) * n, A + i * A_dims[1], A_dims[1],
+                type, B + j * B_dims[1], B_dims[1]
+            );
+}
+/*  End of bench_reference_multi.                                             */
+
+/*  The reference for the sums of products set up by bench_terms_setup.       */
+static void bench_reference_sums(int type, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+
+    bench_convolve(
+        type, bench_ref, bench_terms_A[0], s, type, bench_terms_B[0], L
+    );
+
+    for (k = (size_t)1; k < (size_t)BENCH_TERMS; ++k)
+        bench_accumulate(
+            type, bench_ref, bench_terms_A[k], s, type, bench_terms_B[k], L
+        );
+}
+/*  End of bench_reference_sums.                                              */
+
+/*  The reference for the combination products, forming the combination of    *
+ *  the terms modulo 2^64 and multiplying it by B.                            */
+static void bench_reference_combination(int type, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, n;
+    unsigned long long c;
+
+    for (n = (size_t)0; n < s; ++n)
+        bench_sum[n] = 0ULL;
+
+    for (k = (size_t)0; k < (size_t)BENCH_TERMS; ++k)
+    {
+        c = (unsigned long long)(long long)bench_scalars[k];
+
+        for (n = (size_t)0; n < s; ++n)
+            bench_sum[n] += c * bench_get(bench_terms_A[k], type, n);
+    }
+
+    bench_convolve(type, bench_ref, bench_sum, s, BENCH_INT64, bench_B, L);
+}
+/*  End of bench_reference_combination.                                       */
+
+#ifdef POLY_HAS_INT128
+
+/*  The reference for the 128-bit outputs, computed in 128 bits over the      *
+ *  reference buffer. The values of bench_check_fill can not overflow.        */
+static void bench_reference_wide128(size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, n;
+    Poly_Int128 * const R = (Poly_Int128 *)bench_ref;
+    const long long * const A = bench_A;
+    const long long * const B = bench_B;
+
+    for (n = (size_t)0; n < s + L - (size_t)1; ++n)
+        R[n] = 0;
+
+    for (m = (size_t)0; m < s; ++m)
+        for (n = (size_t)0; n < L; ++n)
+            R[m + n] += (Poly_Int128)A[m] * (Poly_Int128)B[n];
+}
+/*  End of bench_reference_wide128.                                           */
+
+#endif
+/*  End of #ifdef POLY_HAS_INT128.                                            */
+
+/*  Runs a routine on the current buffers and compares the output with the    *
+ *  schoolbook method. Returns the number of wrong or stray coefficients.     */
+static size_t bench_check_one(const bench_kernel *kernel, size_t s, size_t L)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_len, B_len, out_len, n, first, wrong = (size_t)0;
+    unsigned long long value;
+    double ops, bytes;
+    unsigned char *guard;
+    int equal;
+    const int type = kernel->type;
+    const int in_type = bench_in_type(type);
+    const unsigned long long p = bench_modulus.p;
+
+    bench_model(kernel, s, L, &A_len, &B_len, &out_len, &ops, &bytes);
+
+    if (kernel->scratch && bench_reserve(kernel->scratch(s, L)) != 0)
+    {
+        fprintf(stderr, "    %lu x %lu: malloc failed.\n",
+                (unsigned long)s, (unsigned long)L);
+        return (size_t)1;
+    }
+
+    /*  Save the old output, and mark the coefficients after it.              */
+    for (n = (size_t)0; n < out_len; ++n)
+        bench_old[n] = bench_get(bench_P, in_type, n);
+
+    /*  The routines written over A add to a P that starts out as A.          */
+    if (kernel->kind == BENCH_OVERLAP)
+        for (n = (size_t)0; n < s; ++n)
+            bench_old[n] = bench_get(bench_A, in_type, n);
+
+    guard = (unsigned char *)bench_P + out_len * kernel->out_size;
+
+    for (n = (size_t)0; n < BENCH_GUARD * kernel->out_size; ++n)
+        guard[n] = 0xA5U;
+
+    kernel->run(s, L);
+
+    /*  The reference, and the coefficient of it that P starts at.            */
+    first = (size_t)0;
+
+    switch (kernel->kind)
+    {
+        case BENCH_SCALE:
+            for (n = (size_t)0; n < L; ++n)
+                bench_ref[n] = 3ULL * bench_get(bench_A, in_type, n);
+
+            if (type == BENCH_MOD)
+                for (n = (size_t)0; n < L; ++n)
+                    bench_ref[n] %= p;
+
+            break;
+
+        case BENCH_SQUARE:
+            bench_convolve(type, bench_ref, bench_A, L, in_type, bench_A, L);
+            break;
+
+        case BENCH_SUM:
+            for (n = (size_t)0; n < s; ++n)
+                bench_sum[n] = bench_get(bench_A, in_type, n) +
+                    bench_get(bench_A, in_type, n + (size_t)BENCH_MAX_LEN);
+
+            bench_convolve(
+                type, bench_ref, bench_sum, s, BENCH_INT64, bench_B, L
+            );
+
+            break;
+
+        case BENCH_SUMS:
+            bench_reference_sums(type, s, L);
+            break;
+
+        case BENCH_COMBINATION:
+            bench_reference_combination(type, s, L);
+            break;
+
+        case BENCH_MIDDLE:
+            bench_convolve(
+                type, bench_ref, bench_A, A_len, in_type, bench_B, B_len
+            );
+
+            first = s - (size_t)1;
+            break;
+
+        case BENCH_BATCH:
+            bench_reference_batch(type, L);
+            break;
+
+        case BENCH_STRIDED:
+            bench_reference_strided(type, s, L);
+            break;
+
+        case BENCH_DIVIDE:
+            bench_reference_divide(type, s, L);
+            break;
+
+        case BENCH_INVERSE:
+            bench_reference_inverse(type, s, L);
+            break;
+
+        case BENCH_BIG:
+            bench_reference_big(s, L);
+            break;
+
+        case BENCH_MULTI:
+            bench_reference_multi(type, s, L, out_len);
+            break;
+
+        default:
+#ifdef POLY_HAS_INT128
+            if (type == BENCH_WIDE128)
+            {
+                bench_reference_wide128(s, L);
+                break;
+            }
+#endif
+            bench_convolve(type, bench_ref, bench_A, s, in_type, bench_B, L);
+            break;
+    }
+
+    for (n = (size_t)0; n < out_len; ++n)
+    {
+        value = bench_ref[first + n];
+
+        /*  Both values are below p for the modular routines.                 */
+        if (bench_adds(kernel->kind))
+        {
+            value += bench_old[n];
+
+            if (type == BENCH_MOD && value >= p)
+                value -= p;
+        }
+
+#ifdef POLY_HAS_INT128
+        /*  The 128-bit outputs are compared in full.                         */
+        if (type == BENCH_WIDE128)
+            equal = (((const Poly_Int128 *)bench_P)[n] ==
+                     ((const Poly_Int128 *)bench_ref)[n]);
+        else
+#endif
+            equal = bench_equal(bench_P, type, n, value);
+
+        if (!equal)
+        {
+            if (wrong == (size_t)0)
+                fprintf(stderr, "    %lu x %lu: wrong coefficient %lu.\n",
+                        (unsigned long)s, (unsigned long)L, (unsigned long)n);
+
+            ++wrong;
+        }
+    }
+
+    for (n = (size_t)0; n < BENCH_GUARD * kernel->out_size; ++n)
+    {
+        if (guard[n] != 0xA5U)
+        {
+            fprintf(stderr, "    %lu x %lu: wrote past the output.\n",
+                    (unsigned long)s, (unsigned long)L);
+            ++wrong;
+            break;
+        }
+    }
+
+    /*  A longer shape reads the guard as old output, and the modular         *
+     *  routines need that below p.                                           */
+    for (n = (size_t)0; n < BENCH_GUARD * kernel->out_size; ++n)
+        guard[n] = 0U;
+
+    return wrong;
+}
+/*  End of bench_check_one.                                                   */
+
+/*  Checks a routine over the fixed shapes and random ones, on dense, sparse, *
+ *  and full-range operands, and for products with A and B the same array.    *
+ *  Returns the number of cases that failed.                                  */
+static size_t bench_check(const bench_kernel *kernel, size_t max_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, s, L, failed = (size_t)0;
+    void *B;
+    int pass, sparse;
+
+    /*  The number of fixed shapes.                                           */
+    const size_t shapes = sizeof(bench_check_shapes) / sizeof(size_t[2]);
+
+    /*  Small dense values, sparse ones, and values over the full range.      */
+    for (pass = 0; pass < 3; ++pass)
+    {
+        /*  The sparse routines always get a sparse A.                        */
+        sparse = (pass == 1 || kernel->kind == BENCH_SPARSE);
+
+        if (pass < 2)
+            bench_check_fill(kernel->type, sparse);
+        else if (bench_exact(kernel->type))
+            bench_check_fill_full(kernel->type, sparse);
+        else
+            break;
+
+        for (k = (size_t)0; k < shapes + (size_t)BENCH_CHECK_RANDOM; ++k)
+        {
+            if (k < shapes)
+            {
+                s = bench_check_shapes[k][0];
+                L = bench_check_shapes[k][1];
+            }
+
+            else
+            {
+                L = bench_random_length(max_len);
+                s = bench_random_length(L);
+            }
+
+            if (L > max_len || s == (size_t)0 || s > L)
+                continue;
+
+            /*  Routines with one operand only use L.                         */
+            if ((kernel->kind == BENCH_SCALE || kernel->kind == BENCH_SQUARE)
+                && s != L)
+                continue;
+
+            if (bench_check_one(kernel, s, L) != (size_t)0)
+                ++failed;
+
+            /*  The same array for both operands, which Poly_Multiply takes   *
+             *  as a square.                                                  */
+            if (kernel->kind == BENCH_PRODUCT && s == L)
+            {
+                B = bench_B;
+                bench_B = bench_A;
+
+                if (bench_check_one(kernel, s, L) != (size_t)0)
+                    ++failed;
+
+                bench_B = B;
+            }
+        }
+    }
+
+    return failed;
+}
+/*  End of bench_check.                                                       */
+
+/*  How the mock backend of the offload checks treats the work it gets, and   *
+ *  work below its thresholds, which it should never get.                     */
+#define BENCH_OFFLOAD_ACCEPT 0
+#define BENCH_OFFLOAD_DECLINE 1
+#define BENCH_OFFLOAD_REMOVE 2
+#define BENCH_OFFLOAD_BELOW 3
+#define BENCH_OFFLOAD_CASES 4
+
+static const char * const bench_offload_names[] = {
+    "accepted", "declined", "removed", "below the thresholds"
+};
+
+/*  The state of the mock backend, passed to it as its data.                  */
+typedef struct bench_offload_def {
+    int mode;
+    size_t calls;
+    int misordered;
+} bench_offload;
+
+/*  Counts a call of the mock backend, removes the backend for                *
+ *  BENCH_OFFLOAD_REMOVE, and returns whether the work is to be done here.    */
+static int bench_offload_accepts(bench_offload *state)
+{
+    ++state->calls;
+
+    if (state->mode == BENCH_OFFLOAD_REMOVE)
+        Poly_Set_Offload(NULL);
+
+    return (state->mode == BENCH_OFFLOAD_ACCEPT);
+}
+/*  End of bench_offload_accepts.                                             */
+
+/*  The functions of the mock backend, which compute on the CPU what they     *
+ *  accept, and leave P untouched otherwise.                                  */
+static int
+bench_offload_multiply(int *P_coeffs,
+                       const int *A_coeffs, size_t A_len,
+                       const int *B_coeffs, size_t B_len,
+                       void *data)
+{
+    bench_offload * const state = data;
+
+    if (A_len > B_len)
+        state->misordered = 1;
+
+    if (!bench_offload_accepts(state))
+        return -1;
+
+    Naive_Product(P_coeffs, A_coeffs, A_len, B_coeffs, B_len);
+    return 0;
+}
+/*  End of bench_offload_multiply.                                            */
+
+static int
+bench_offload_batch(size_t count,
+                    int * const *P_coeffs,
+                    const int * const *A_coeffs, const size_t *A_len,
+                    const int * const *B_coeffs, const size_t *B_len,
+                    void *data)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+
+    if (!bench_offload_accepts(data))
+        return -1;
+
+    for (k = (size_t)0; k < count; ++k)
+        Naive_Product(P_coeffs[k], A_coeffs[k], A_len[k],
+                      B_coeffs[k], B_len[k]);
+
+    return 0;
+}
+/*  End of bench_offload_batch.                                               */
+
+static int
+bench_offload_batch_strided(size_t count,
+                            int *P_coeffs, size_t P_stride,
+                            const int *A_coeffs, size_t A_len, size_t A_stride,
+                            const int *B_coeffs, size_t B_len, size_t B_stride,
+                            void *data)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+
+    if (!bench_offload_accepts(data))
+        return -1;
+
+    for (k = (size_t)0; k < count; ++k)
+        Naive_Product(P_coeffs + k * P_stride, A_coeffs + k * A_stride, A_len,
+                      B_coeffs + k * B_stride, B_len);
+
+    return 0;
+}
+/*  End of bench_offload_batch_strided.                                       */
+
+/*  Poly_Multiply with the longer operand first, which the backend should     *
+ *  get second.                                                               */
+static void bench_offload_product(size_t s, size_t L)
+{
+    Poly_Multiply(bench_P, bench_B, L, bench_A, s);
+}
+/*  End of bench_offload_product.                                             */
+
+/*  The routines that offer work to the backend, each checked with a backend  *
+ *  of only the matching function.                                            */
+static const bench_kernel bench_offload_kernels[] = {
+    {"Poly_Multiply", BENCH_PRODUCT, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_offload_product},
+    {"Poly_Multiply_Batch", BENCH_BATCH, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_batch},
+    {"Poly_Multiply_Batch_Strided", BENCH_STRIDED, BENCH_INT32,
+     sizeof(int), sizeof(int), NULL, bench_batch_strided}
+};
+
+/*  The number of routines above.                                             */
+#define BENCH_OFFLOAD_KERNELS \
+    (sizeof(bench_offload_kernels) / sizeof(bench_offload_kernels[0]))
+
+/*  The lengths of the offloaded products.                                    */
+#define BENCH_OFFLOAD_SHORT 37
+#define BENCH_OFFLOAD_LONG 100
+
+/*  Checks one of bench_offload_kernels against the mock backend, accepting,  *
+ *  declining, removing itself during its call, and with thresholds above     *
+ *  the work. The output must be right in each case, and the backend must be  *
+ *  called exactly once, or never for work below its thresholds or once it is *
+ *  removed. Returns the number of cases that failed.                         */
+static size_t bench_check_offload(const bench_kernel *kernel)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t wrong, expected, failed = (size_t)0;
+    int mode;
+    bench_offload state;
+    Poly_Offload offload;
+    const size_t s = (size_t)BENCH_OFFLOAD_SHORT;
+    const size_t L = (size_t)BENCH_OFFLOAD_LONG;
+
+    bench_check_fill(kernel->type, 0);
+
+    for (mode = 0; mode < BENCH_OFFLOAD_CASES; ++mode)
+    {
+        state.mode = mode;
+        state.calls = (size_t)0;
+        state.misordered = 0;
+
+        /*  Only the function that the routine offers work to is given, since *
+         *  the workers of a batch declined by the backend offer its long     *
+         *  products again, concurrently.                                     */
+        offload.multiply = NULL;
+        offload.batch = NULL;
+        offload.batch_strided = NULL;
+
+        if (kernel->kind == BENCH_PRODUCT)
+            offload.multiply = bench_offload_multiply;
+        else if (kernel->kind == BENCH_BATCH)
+            offload.batch = bench_offload_batch;
+        else
+            offload.batch_strided = bench_offload_batch_strided;
+
+        offload.min_length = (size_t)1;
+        offload.min_batch = (size_t)1;
+        offload.data = &state;
+
+        /*  The backend would accept it, but should not be asked.             */
+        if (mode == BENCH_OFFLOAD_BELOW)
+        {
+            state.mode = BENCH_OFFLOAD_ACCEPT;
+            offload.min_length = s + (size_t)1;
+            offload.min_batch = bench_batch_count(L) + (size_t)1;
+        }
+
+        Poly_Set_Offload(&offload);
+        wrong = bench_check_one(kernel, s, L);
+        expected = (mode == BENCH_OFFLOAD_BELOW ? (size_t)0 : (size_t)1);
+
+        /*  Once removed, the backend stays unused.                           */
+        if (mode == BENCH_OFFLOAD_REMOVE)
+        {
+            if (Poly_Get_Offload())
+            {
+                fprintf(stderr, "    %s: the backend is still registered.\n",
+                        bench_offload_names[mode]);
+                ++wrong;
+            }
+
+            wrong += bench_check_one(kernel, s, L);
+        }
+
+        if (state.calls != expected)
+        {
+            fprintf(stderr, "    %s: %lu calls of the backend, not %lu.\n",
+                    bench_offload_names[mode], (unsigned long)state.calls,
+                    (unsigned long)expected);
+            ++wrong;
+        }
+
+        if (state.misordered)
+        {
+            fprintf(stderr, "    %s: the longer operand was given first.\n",
+                    bench_offload_names[mode]);
+            ++wrong;
+        }
+
+        Poly_Set_Offload(NULL);
+
+        if (wrong != (size_t)0)
+            ++failed;
+    }
+
+    return failed;
+}
+/*  End of bench_check_offload.                                               */
+
+/*  One timing from a baseline file.                                          */
+typedef struct bench_record_def {
+    char kernel[64];
+    char type[16];
+    unsigned long ratio, A_len, B_len;
+    double seconds;
+} bench_record;
+
+/*  The timings of the baseline, if one was given.                            */
+static bench_record *bench_baseline;
+static size_t bench_baseline_len;
+
+/*  Reads the timings of a CSV file written by poly_bench. Returns 0 on       *
+ *  success and -1 on failure.                                                */
+static int bench_read_baseline(const char *filename)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    char line[512];
+    bench_record record, *records;
+    size_t capacity = (size_t)0;
+    FILE *fp = fopen(filename, "r");
+
+    if (!fp)
+        return -1;
+
+    while (fgets(line, (int)sizeof(line), fp))
+    {
+        /*  The header, and anything else that is not a timing, is skipped.   */
+        if (sscanf(line, "%63[^,],%15[^,],1:%lu,%lu,%lu,%lf",
+                   record.kernel, record.type, &record.ratio,
+                   &record.A_len, &record.B_len, &record.seconds) != 6)
+            continue;
+
+        if (bench_baseline_len == capacity)
+        {
+            capacity = (capacity ? (size_t)2 * capacity : (size_t)256);
+            records = realloc(bench_baseline, sizeof(*records) * capacity);
+
+            if (!records)
+            {
+                fclose(fp);
+                return -1;
+            }
+
+            bench_baseline = records;
+        }
+
+        bench_baseline[bench_baseline_len++] = record;
+    }
+
+    fclose(fp);
+    return 0;
+}
+/*  End of bench_read_baseline.                                               */
+
+/*  Compares a timing with the baseline. Returns 1 if it is more than         *
+ *  tolerance times slower than the baseline timing of the same case, and 0   *
+ *  otherwise, or if the baseline does not have the case.                     */
+static int
+bench_compare(const bench_kernel *kernel, size_t ratio, size_t s, size_t L,
+              double seconds, double tolerance)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t A_len, B_len, out_len, k;
+    double ops, bytes;
+    const bench_record *record;
+
+    bench_model(kernel, s, L, &A_len, &B_len, &out_len, &ops, &bytes);
+
+    for (k = (size_t)0; k < bench_baseline_len; ++k)
+    {
+        record = bench_baseline + k;
+
+        if (record->ratio != (unsigned long)ratio ||
+            record->A_len != (unsigned long)A_len ||
+            record->B_len != (unsigned long)B_len ||
+            strcmp(record->kernel, kernel->name) != 0 ||
+            strcmp(record->type, bench_type_names[kernel->type]) != 0)
+            continue;
+
+        if (seconds <= tolerance * record->seconds)
+            return 0;
+
+        fprintf(stderr, "    %lu x %lu: %.3e s, %.2f times the baseline.\n",
+                (unsigned long)A_len, (unsigned long)B_len, seconds,
+                seconds / record->seconds);
+        return 1;
+    }
+
+    return 0;
+}
+/*  End of bench_compare.                                                     */
+
+/*  Frees the buffers.                                                        */
+static void bench_free(void)
+{
+    free(bench_A);
+    free(bench_B);
+    free(bench_P);
+    free(bench_work);
+    free(bench_ref);
+    free(bench_old);
+    free(bench_sum);
+    free(bench_baseline);
+    Poly_Plan_Destroy(bench_plan);
+    Poly_Stream_Destroy(bench_stream);
+    Poly_Pool_Destroy(bench_pool);
+}
+/*  End of bench_free.                                                        */
+
+int main(int argc, char **argv)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const char *filename = NULL, *kernel_name = NULL, *type_name = NULL;
+    const char *tunables = NULL, *baseline = NULL, *level_name = NULL;
+    const bench_kernel *kernel;
+    Poly_Tunables saved, lowered;
+    size_t k, r, s, L, level, levels = (size_t)0;
+    size_t max_len = (size_t)BENCH_MAX_LEN;
+    size_t failed, failures = (size_t)0, regressions = (size_t)0;
+    double seconds, tolerance = BENCH_TOLERANCE;
+    int json = 0, first = 1, check = 0, slow, arg;
+    FILE *fp;
+
+    /*  The buffers have room for 2 BENCH_MAX_LEN coefficients of 8 bytes,    *
+     *  and the output for as many of 16 bytes.                               */
+    const size_t size = (size_t)16 * (size_t)BENCH_MAX_LEN;
+
+    for (arg = 1; arg < argc; ++arg)
+    {
+        if (strcmp(argv[arg], "-json") == 0)
+            json = 1;
+        else if (strcmp(argv[arg], "-quick") == 0)
+            bench_min_time = 0.01;
+        else if (strcmp(argv[arg], "-list") == 0)
+        {
+            for (k = (size_t)0; k < BENCH_KERNELS; ++k)
+                printf("%s %s\n", bench_kernels[k].name,
+                       bench_type_names[bench_kernels[k].type]);
+
+            return 0;
+        }
+        else if (arg + 1 < argc && strcmp(argv[arg], "-kernel") == 0)
+            kernel_name = argv[++arg];
+        else if (arg + 1 < argc && strcmp(argv[arg], "-type") == 0)
+            type_name = argv[++arg];
+        else if (arg + 1 < argc && strcmp(argv[arg], "-tunables") == 0)
+            tunables = argv[++arg];
+        else if (arg + 1 < argc && strcmp(argv[arg], "-max-len") == 0)
+            max_len = (size_t)strtod(argv[++arg], NULL);
+        else if (arg + 1 < argc && strcmp(argv[arg], "-max-time") == 0)
+            bench_max_time = strtod(argv[++arg], NULL);
+        else if (strcmp(argv[arg], "-check") == 0)
+            check = 1;
+        else if (arg + 1 < argc && strcmp(argv[arg], "-level") == 0)
+            level_name = argv[++arg];
+        else if (arg + 1 < argc && strcmp(argv[arg], "-baseline") == 0)
+            baseline = argv[++arg];
+        else if (arg + 1 < argc && strcmp(argv[arg], "-tolerance") == 0)
+            tolerance = strtod(argv[++arg], NULL);
+        else if (argv[arg][0] == '-' || filename)
+        {
+            fprintf(stderr, "Usage: %s [-json] [-quick] [-list] "
+                            "[-kernel name] [-type name] [-max-len n] "
+                            "[-max-time s] [-tunables file] [-check] "
+                            "[-level name] [-baseline file] [-tolerance x] "
+                            "[file]\n",
+                    argv[0]);
+            return 1;
+        }
+        else
+            filename = argv[arg];
+    }
+
+    if (max_len > (size_t)BENCH_MAX_LEN)
+        max_len = (size_t)BENCH_MAX_LEN;
+
+    if (tunables && Poly_Load_Tunables(tunables) != 0)
+    {
+        fprintf(stderr, "Error: could not load %s.\n", tunables);
+        return 1;
+    }
+
+    if (baseline && bench_read_baseline(baseline) != 0)
+    {
+        fprintf(stderr, "Error: could not read %s.\n", baseline);
+        return 1;
+    }
+
+    /*  A 31-bit NTT prime, the slowest case for the naive method.            */
+    Poly_Modulus_Init(&bench_modulus, 2013265921U);
+
+    bench_A = malloc(size);
+    bench_B = malloc(size);
+    bench_P = malloc((size_t)2 * size);
+
+    /*  The reference holds the longest output of the checks.                 */
+    bench_ref = malloc(sizeof(*bench_ref) * (size_t)BENCH_CHECK_OUT);
+    bench_old = malloc(sizeof(*bench_old) * (size_t)BENCH_CHECK_OUT);
+    bench_sum = malloc(sizeof(*bench_sum) * (size_t)BENCH_CHECK_OUT);
+
+    if (!bench_A || !bench_B || !bench_P ||
+        !bench_ref || !bench_old || !bench_sum)
+    {
+        fprintf(stderr, "Error: malloc failed.\n");
+        return 1;
+    }
+
+    /*  The parallel routines split even the short products of the checks.    */
+    if (check)
+    {
+        saved = lowered = *Poly_Get_Tunables();
+        lowered.parallel_grain = BENCH_CHECK_GRAIN;
+        Poly_Set_Tunables(&lowered);
+        bench_pool = Poly_Pool_Create(BENCH_CHECK_THREADS);
+
+        if (!bench_pool)
+        {
+            fprintf(stderr, "Error: could not start the threads.\n");
+            bench_free();
+            return 1;
+        }
+    }
+
+    /*  Compare every selected routine with the schoolbook method, once for   *
+     *  each level of kernel the CPU has.                                     */
+    for (level = (size_t)0; check && level < BENCH_LEVELS; ++level)
+    {
+        if (level_name && strcmp(bench_level_names[level], level_name))
+            continue;
+
+        if (Poly_Set_Kernel_Level((Poly_Kernel_Level)level) != 0)
+            continue;
+
+        fprintf(stderr, "With the %s kernels:\n", bench_level_names[level]);
+        ++levels;
+
+        for (k = (size_t)0; k < BENCH_KERNELS; ++k)
+        {
+            kernel = bench_kernels + k;
+
+            if (kernel_name && !strstr(kernel->name, kernel_name))
+                continue;
+
+            if (type_name &&
+                strcmp(bench_type_names[kernel->type], type_name))
+                continue;
+
+            fprintf(stderr, "Checking %s:\n", kernel->name);
+            L = (max_len < (size_t)BENCH_CHECK_LEN ? max_len : BENCH_CHECK_LEN);
+            failed = bench_check(kernel, L);
+
+            if (failed)
+                fprintf(stderr, "    %lu cases failed.\n",
+                        (unsigned long)failed);
+
+            failures += failed;
+        }
+    }
+
+    /*  The routines that offer work to a backend, with the best kernels.     */
+    if (check)
+        Poly_Set_Kernel_Level(POLY_KERNEL_BEST);
+
+    for (k = (size_t)0; check && k < BENCH_OFFLOAD_KERNELS; ++k)
+    {
+        kernel = bench_offload_kernels + k;
+
+        if (kernel_name && !strstr(kernel->name, kernel_name))
+            continue;
+
+        if (type_name && strcmp(bench_type_names[kernel->type], type_name))
+            continue;
+
+        fprintf(stderr, "Checking %s with a backend:\n", kernel->name);
+        failed = bench_check_offload(kernel);
+
+        if (failed)
+            fprintf(stderr, "    %lu cases failed.\n", (unsigned long)failed);
+
+        failures += failed;
+    }
+
+    /*  The timings use the tunables given, the best kernels, and one thread  *
+     *  per processor.                                                        */
+    if (check)
+    {
+        Poly_Pool_Destroy(bench_pool);
+        Poly_Set_Tunables(&saved);
+        bench_pool = NULL;
+
+        if (levels == (size_t)0)
+        {
+            fprintf(stderr, "Error: the CPU has no %s kernels.\n", level_name);
+            ++failures;
+        }
+    }
+
+    /*  Without a baseline to compare with, -check only checks.               */
+    if (check && !baseline)
+    {
+        fprintf(stderr, "%s\n", (failures ? "FAILED" : "All checks passed."));
+        bench_free();
+        return (failures ? 1 : 0);
+    }
+
+    bench_pool = Poly_Pool_Create((size_t)0);
+
+    if (!bench_pool)
+    {
+        fprintf(stderr, "Error: could not start the threads.\n");
+        bench_free();
+        return 1;
+    }
+
+    if (!filename)
+        fp = stdout;
+    else
+    {
+        fp = fopen(filename, "w");
+
+        if (!fp)
+        {
+            fprintf(stderr, "Error: could not open %s.\n", filename);
+            return 1;
+        }
+    }
+
+    bench_begin(fp, json);
+
+    for (k = (size_t)0; k < BENCH_KERNELS; ++k)
+    {
+        kernel = bench_kernels + k;
+
+        if (kernel_name && !strstr(kernel->name, kernel_name))
+            continue;
+
+        if (type_name && strcmp(bench_type_names[kernel->type], type_name))
+            continue;
+
+        fprintf(stderr, "Timing %s:\n", kernel->name);
+        bench_fill(kernel->type, kernel->kind == BENCH_SPARSE);
+
+        for (r = (size_t)0; r < sizeof(bench_ratios) / sizeof(size_t); ++r)
+        {
+            /*  Routines with one operand only have the one shape.            */
+            if (r > (size_t)0 && (kernel->kind == BENCH_SCALE ||
+                                  kernel->kind == BENCH_SQUARE))
+                break;
+
+            for (L = (size_t)1; L <= max_len; L = bench_next_length(L))
+            {
+                s = L / bench_ratios[r];
+
+                if (s == (size_t)0)
+                    continue;
+
+                seconds = bench_time(kernel, s, L, &slow);
+
+                if (seconds < 0.0)
+                {
+                    fprintf(stderr, "    L = %7lu: malloc failed.\n",
+                            (unsigned long)L);
+                    break;
+                }
+
+                bench_write(
+                    fp, json, first, kernel, bench_ratios[r], s, L, seconds
+                );
+
+                regressions += (size_t)bench_compare(
+                    kernel, bench_ratios[r], s, L, seconds, tolerance
+                );
+
+                first = 0;
+
+                if (slow)
+                    break;
+            }
+        }
+    }
+
+    bench_end(fp, json, first);
+
+    if (fp != stdout)
+        fclose(fp);
+
+    if (baseline)
+        fprintf(stderr, "%lu timings slower than the baseline.\n",
+                (unsigned long)regressions);
+
+    if (failures)
+        fprintf(stderr, "FAILED: %lu checks.\n", (unsigned long)failures);
+
+    bench_free();
+    return (failures || regressions ? 1 : 0);
+}
+/*  End of main.                                                              */
@@ -0,0 +1,840 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of polynomial_multiplication.                           *
+ *                                                                            *
+ *  polynomial_multiplication is free software: you can redistribute it       *
+ *  and/or modify it under the terms of the GNU General Public License as     *
+ *  published by the Free Software Foundation, either version 3 of the        *
+ *  License, or (at your option) any later version.                           *
+ *                                                                            *
+ *  polynomial_multiplication is distributed in the hope that it will be      *
+ *  useful, but WITHOUT ANY WARRANTY; without even the implied warranty of    *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with polynomial_multiplication.  If not, see                        *
+ *  <https://www.gnu.org/licenses/>.                                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Measures the crossover points between the multiplication algorithms   *
+ *      on the current machine and writes them out for Poly_Load_Tunables.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      main                                                                  *
+ *  Purpose:                                                                  *
+ *      Tunes the cutoffs and prints them as a config file or a header.       *
+ *  Arguments:                                                                *
+ *      argc (int):                                                           *
+ *          The number of command line arguments.                             *
+ *      argv (char **):                                                       *
+ *          The arguments. The supported options are:                         *
+ *              -header:    Write #define lines instead of "name = value".    *
+ *              -quick:     Time each candidate for less long. Noisier.       *
+ *              filename:   Write to this file instead of stdout.             *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          0 on success, 1 on failure.                                       *
+ *  Called Functions:                                                         *
+ *      Poly_Set_Tunables (polynomial_multiplication.h):                      *
+ *          Installs the candidate cutoffs being timed.                       *
+ *      Naive_Product (polynomial_multiplication.h):                          *
+ *      Karatsuba_Product_With_Scratch (polynomial_multiplication.h):         *
+ *      Naive_Square (polynomial_multiplication.h):                           *
+ *      Karatsuba_Square_With_Scratch (polynomial_multiplication.h):          *
+ *      NTT_Product_With_Scratch (polynomial_multiplication.h):               *
+ *      Poly_Multiply_With_Scratch (polynomial_multiplication.h):             *
+ *      Naive_Product_Wide (polynomial_multiplication.h):                     *
+ *      NTT_Product_Wide_With_Scratch (polynomial_multiplication.h):          *
+ *      Naive_Product_Mod (polynomial_multiplication.h):                      *
+ *      NTT_Product_Mod_With_Scratch (polynomial_multiplication.h):           *
+ *      Naive_Product_Int16, _Int64, _Float, _Double:                         *
+ *      Karatsuba_Product_With_Scratch_Int16, _Int64, _Float, _Double:        *
+ *          The routines being timed.                                         *
+ *      clock (time.h):                                                       *
+ *          Used for timing.                                                  *
+ *  Method:                                                                   *
+ *      Each cutoff is found in turn, from the bottom up, in the same way     *
+ *      as GMP's tuneup program. For a length n the slower algorithm is       *
+ *      timed against one level of the faster one, that is, the faster        *
+ *      algorithm with its own cutoff set to n - 1 so that the recursion      *
+ *      drops straight to the tiers that have already been tuned. The sizes   *
+ *      are swept in steps of about 1/8 until the faster algorithm wins, and  *
+ *      a binary search between the last loss and the first win finds the     *
+ *      crossover. The cutoff is one less than the first winning length.      *
+ *                                                                            *
+ *      The square cutoff is found the same way with Naive_Square and         *
+ *      Karatsuba_Square_With_Scratch, starting just above the Karatsuba      *
+ *      cutoff, which is its lower bound.                                     *
+ *                                                                            *
+ *      Poly_Multiply never selects Toom-3, so the NTT cutoff is found        *
+ *      against Karatsuba.                                                    *
+ *                                                                            *
+ *      The unbalanced ratio is found by sweeping powers of two, timing a     *
+ *      product that is 32 times longer in one operand than the other.        *
+ *      The parallel grain is written out unchanged, as it depends on the     *
+ *      number of threads in use rather than on the algorithms.               *
+ *                                                                            *
+ *      The wide cutoff is found by the same search, timing the 64-bit naive  *
+ *      method against the 64-bit NTT. It uses coefficients of about 20 bits, *
+ *      which are too large for Naive_Product_Wide to defer the widening. For *
+ *      small coefficients the naive method is faster, and the true crossover *
+ *      higher.                                                               *
+ *                                                                            *
+ *      The mod p cutoff is found the same way, with Naive_Product_Mod and    *
+ *      NTT_Product_Mod_With_Scratch modulo the prime 2013265921. Smaller     *
+ *      moduli reduce less often, which favours the naive method.             *
+ *                                                                            *
+ *      Last, the Karatsuba cutoff is found for each of the other coefficient *
+ *      types, short, long long, float, and double.                           *
+ *  Notes:                                                                    *
+ *      Each timing is the best of several runs to reduce the noise. Run it   *
+ *      on an otherwise idle machine. Typical use is:                         *
+ *                                                                            *
+ *          poly_tune tunables.txt                                            *
+ *                                                                            *
+ *      and then Poly_Load_Tunables("tunables.txt") at start up. Or, to bake  *
+ *      the values in at compile time:                                        *
+ *                                                                            *
+ *          poly_tune -header poly_tuned.h                                    *
+ *          cc -include poly_tuned.h ...                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) polynomial_multiplication.h:                                          *
+ *          Header file containing the function prototypes.                   *
+ *  2.) stddef.h:                                                             *
+ *          Header file providing the size_t typedef and NULL.                *
+ *  3.) stdio.h:                                                              *
+ *          Header file providing fprintf, fopen, and fclose.                 *
+ *  4.) stdlib.h:                                                             *
+ *          Header file providing malloc, free, and rand.                     *
+ *  5.) string.h:                                                             *
+ *          Header file providing strcmp.                                     *
+ *  6.) time.h:                                                               *
+ *          Header file providing clock and CLOCKS_PER_SEC.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes given here.                                           */
+#include "polynomial_multiplication.h"
+
+/*  size_t and NULL provided here.                                            */
+#include <stddef.h>
+
+/*  fprintf, fopen, and fclose found here.                                    */
+#include <stdio.h>
+
+/*  malloc, free, and rand found here.                                        */
+#include <stdlib.h>
+
+/*  strcmp found here.                                                        */
+#include <string.h>
+
+/*  clock and CLOCKS_PER_SEC found here.                                      */
+#include <time.h>
+
+/*  Search ranges for each of the cutoffs.                                    */
+#define TUNE_KARATSUBA_MAX 1024
+#define TUNE_NTT_MAX 262144
+#define TUNE_WIDE_MAX 32768
+
+/*  Number of runs per timing, of which the fastest is kept.                  */
+#define TUNE_RUNS 3
+
+/*  The operand buffers shared by all of the timings.                         */
+static int *tune_A, *tune_B, *tune_P, *tune_work;
+static long long *tune_P_wide;
+static size_t tune_work_len;
+
+/*  If set, the naive method and the NTT are timed with 64-bit outputs.       */
+static int tune_wide = 0;
+
+/*  If set, the naive method and Karatsuba are timed squaring A.              */
+static int tune_square = 0;
+
+/*  If set, the naive method and the NTT are timed modulo tune_modulus.       */
+static int tune_mod = 0;
+static Poly_Modulus tune_modulus;
+
+/*  The coefficient type timed by the naive method and Karatsuba.             */
+#define TUNE_INT 0
+#define TUNE_INT16 1
+#define TUNE_INT64 2
+#define TUNE_FLOAT 3
+#define TUNE_DOUBLE 4
+static int tune_type = TUNE_INT;
+
+/*  The names of the cutoffs for each type, indexed by tune_type.             */
+static const char * const tune_type_names[] = {
+    "karatsuba_cutoff",
+    "karatsuba_cutoff_int16",
+    "karatsuba_cutoff_int64",
+    "karatsuba_cutoff_float",
+    "karatsuba_cutoff_double"
+};
+
+/*  Buffers for the types other than int, each with room for the longest      *
+ *  product of the Karatsuba search.                                          */
+static void *tune_A_type, *tune_B_type, *tune_P_type;
+
+/*  Minimum length of time, in seconds, spent on each run.                    */
+static double tune_min_time = 0.05;
+
+/*  The cutoffs found so far. Tiers not yet tuned are set out of reach.       */
+static Poly_Tunables tune_current;
+
+/*  Makes sure the scratch array has room for len ints.                       */
+static int tune_reserve(size_t len)
+{
+    int *work;
+
+    if (len <= tune_work_len)
+        return 0;
+
+    work = realloc(tune_work, sizeof(*work) * len);
+
+    if (!work)
+        return -1;
+
+    tune_work = work;
+    tune_work_len = len;
+    return 0;
+}
+/*  End of tune_reserve.                                                      */
+
+/*  The Karatsuba cutoff of tunables for the type being timed.                */
+static size_t *tune_type_cutoff(Poly_Tunables *t)
+{
+    switch (tune_type)
+    {
+        case TUNE_INT16:
+            return &t->karatsuba_cutoff_int16;
+
+        case TUNE_INT64:
+            return &t->karatsuba_cutoff_int64;
+
+        case TUNE_FLOAT:
+            return &t->karatsuba_cutoff_float;
+
+        case TUNE_DOUBLE:
+            return &t->karatsuba_cutoff_double;
+
+        default:
+            if (tune_square)
+                return &t->karatsuba_square_cutoff;
+
+            return &t->karatsuba_cutoff;
+    }
+}
+/*  End of tune_type_cutoff.                                                  */
+
+/*  Number of ints of scratch space holding the Karatsuba scratch space for   *
+ *  the type being timed.                                                     */
+static size_t tune_type_scratch(size_t A_len, size_t B_len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t size, bytes;
+
+    switch (tune_type)
+    {
+        case TUNE_INT16:
+            size = Karatsuba_Scratch_Size_Int16(A_len, B_len);
+            bytes = size * sizeof(short);
+            break;
+
+        case TUNE_INT64:
+            size = Karatsuba_Scratch_Size_Int64(A_len, B_len);
+            bytes = size * sizeof(long long);
+            break;
+
+        case TUNE_FLOAT:
+            size = Karatsuba_Scratch_Size_Float(A_len, B_len);
+            bytes = size * sizeof(float);
+            break;
+
+        case TUNE_DOUBLE:
+            size = Karatsuba_Scratch_Size_Double(A_len, B_len);
+            bytes = size * sizeof(double);
+            break;
+
+        default:
+            return Karatsuba_Scratch_Size(A_len, B_len);
+    }
+
+    return (bytes + sizeof(int) - (size_t)1) / sizeof(int);
+}
+/*  End of tune_type_scratch.                                                 */
+
+/*  Computes one naive or Karatsuba product for a type other than int.        */
+static void tune_call_type(int karatsuba, size_t A_len, size_t B_len)
+{
+    switch (tune_type)
+    {
+        case TUNE_INT16:
+            if (karatsuba)
+                Karatsuba_Product_With_Scratch_Int16(
+                    tune_P_type, tune_A_type, A_len,
+                    tune_B_type, B_len, (short *)tune_work
+                );
+            else
+                Naive_Product_Int16(
+                    tune_P_type, tune_A_type, A_len, tune_B_type, B_len
+                );
+
+            break;
+
+        case TUNE_INT64:
+            if (karatsuba)
+                Karatsuba_Product_With_Scratch_Int64(
+                    tune_P_type, tune_A_type, A_len,
+                    tune_B_type, B_len, (long long *)tune_work
+                );
+            else
+                Naive_Product_Int64(
+                    tune_P_type, tune_A_type, A_len, tune_B_type, B_len
+                );
+
+            break;
+
+        case TUNE_FLOAT:
+            if (karatsuba)
+                Karatsuba_Product_With_Scratch_Float(
+                    tune_P_type, tune_A_type, A_len,
+                    tune_B_type, B_len, (float *)tune_work
+                );
+            else
+                Naive_Product_Float(
+                    tune_P_type, tune_A_type, A_len, tune_B_type, B_len
+                );
+
+            break;
+
+        default:
+            if (karatsuba)
+                Karatsuba_Product_With_Scratch_Double(
+                    tune_P_type, tune_A_type, A_len,
+                    tune_B_type, B_len, (double *)tune_work
+                );
+            else
+                Naive_Product_Double(
+                    tune_P_type, tune_A_type, A_len, tune_B_type, B_len
+                );
+
+            break;
+    }
+}
+/*  End of tune_call_type.                                                    */
+
+/*  Fills the buffers for the type being timed with small random values.      */
+static void tune_fill_type(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    for (n = 0; n < (size_t)TUNE_KARATSUBA_MAX; ++n)
+    {
+        switch (tune_type)
+        {
+            case TUNE_INT16:
+                ((short *)tune_A_type)[n] = (short)(rand() % 3 - 1);
+                ((short *)tune_B_type)[n] = (short)(rand() % 3 - 1);
+                break;
+
+            case TUNE_INT64:
+                ((long long *)tune_A_type)[n] = rand() % 3 - 1;
+                ((long long *)tune_B_type)[n] = rand() % 3 - 1;
+                break;
+
+            case TUNE_FLOAT:
+                ((float *)tune_A_type)[n] = (float)rand() / (float)RAND_MAX;
+                ((float *)tune_B_type)[n] = (float)rand() / (float)RAND_MAX;
+                break;
+
+            default:
+                ((double *)tune_A_type)[n] = (double)rand() / RAND_MAX;
+                ((double *)tune_B_type)[n] = (double)rand() / RAND_MAX;
+                break;
+        }
+    }
+}
+/*  End of tune_fill_type.                                                    */
+
+/*  Computes one product of the given algorithm.                              */
+static void tune_call(Poly_Algorithm algorithm, size_t A_len, size_t B_len)
+{
+    if (tune_type != TUNE_INT)
+    {
+        tune_call_type(algorithm == POLY_ALGORITHM_KARATSUBA, A_len, B_len);
+        return;
+    }
+
+    if (tune_square)
+    {
+        if (algorithm == POLY_ALGORITHM_KARATSUBA)
+            Karatsuba_Square_With_Scratch(tune_P, tune_A, A_len, tune_work);
+        else
+            Naive_Square(tune_P, tune_A, A_len);
+
+        return;
+    }
+
+    switch (algorithm)
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            Karatsuba_Product_With_Scratch(
+                tune_P, tune_A, A_len, tune_B, B_len, tune_work
+            );
+
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            if (tune_mod)
+                NTT_Product_Mod_With_Scratch(
+                    (unsigned int *)tune_P,
+                    (const unsigned int *)tune_A, A_len,
+                    (const unsigned int *)tune_B, B_len,
+                    (unsigned int *)tune_work, &tune_modulus
+                );
+            else if (tune_wide)
+                NTT_Product_Wide_With_Scratch(
+                    tune_P_wide, tune_A, A_len, tune_B, B_len, tune_work
+                );
+            else
+                NTT_Product_With_Scratch(
+                    tune_P, tune_A, A_len, tune_B, B_len, tune_work
+                );
+
+            break;
+
+        default:
+            if (tune_mod)
+                Naive_Product_Mod(
+                    (unsigned int *)tune_P,
+                    (const unsigned int *)tune_A, A_len,
+                    (const unsigned int *)tune_B, B_len, &tune_modulus
+                );
+            else if (tune_wide)
+                Naive_Product_Wide(tune_P_wide, tune_A, A_len, tune_B, B_len);
+            else
+                Naive_Product(tune_P, tune_A, A_len, tune_B, B_len);
+
+            break;
+    }
+}
+/*  End of tune_call.                                                         */
+
+/*  Returns the time, in seconds, of one product with the given tunables.     *
+ *  If algorithm is negative, Poly_Multiply_With_Scratch is timed instead.    *
+ *  Returns a negative value if the scratch space can not be allocated.       */
+static double
+tune_time(int algorithm, size_t A_len, size_t B_len, const Poly_Tunables *t)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long count, calls;
+    double elapsed, best = -1.0;
+    clock_t start;
+    size_t size;
+    int run;
+
+    if (Poly_Set_Tunables(t) != 0)
+        return -1.0;
+
+    switch (algorithm)
+    {
+        case POLY_ALGORITHM_KARATSUBA:
+            size = tune_type_scratch(A_len, B_len);
+            break;
+
+        case POLY_ALGORITHM_NTT:
+            if (tune_mod)
+                size = NTT_Scratch_Size_Mod(A_len, B_len, &tune_modulus);
+            else
+                size = NTT_Scratch_Size(A_len, B_len);
+
+            break;
+
+        case POLY_ALGORITHM_NAIVE:
+            size = (size_t)0;
+            break;
+
+        default:
+            size = Poly_Scratch_Size(A_len, B_len);
+            break;
+    }
+
+    if (tune_reserve(size) != 0)
+        return -1.0;
+
+    for (run = 0; run < TUNE_RUNS; ++run)
+    {
+        /*  Repeat the product until enough time has passed to measure.       */
+        calls = 1UL;
+
+        do {
+            start = clock();
+
+            for (count = 0UL; count < calls; ++count)
+            {
+                if (algorithm < 0)
+                    Poly_Multiply_With_Scratch(
+                        tune_P, tune_A, A_len, tune_B, B_len, tune_work
+                    );
+                else
+                    tune_call((Poly_Algorithm)algorithm, A_len, B_len);
+            }
+
+            elapsed = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+            calls *= 2UL;
+        } while (elapsed < tune_min_time);
+
+        elapsed /= (double)(calls / 2UL);
+
+        if (best < 0.0 || elapsed < best)
+            best = elapsed;
+    }
+
+    return best;
+}
+/*  End of tune_time.                                                         */
+
+/*  Returns 1 if one level of the faster algorithm beats the slower one for   *
+ *  length n products, and 0 otherwise.                                       */
+static int tune_faster(Poly_Algorithm slow, Poly_Algorithm fast, size_t n)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Tunables t = tune_current;
+    double slow_time, fast_time;
+
+    slow_time = tune_time((int)slow, n, n, &t);
+
+    /*  One split, after which the already tuned tiers take over.             */
+    if (fast == POLY_ALGORITHM_KARATSUBA)
+        *tune_type_cutoff(&t) = n - (size_t)1;
+
+    fast_time = tune_time((int)fast, n, n, &t);
+
+    if (slow_time < 0.0 || fast_time < 0.0)
+        return 0;
+
+    fprintf(stderr, "    n = %6lu: %.3e s vs %.3e s\n",
+            (unsigned long)n, slow_time, fast_time);
+
+    return fast_time < slow_time;
+}
+/*  End of tune_faster.                                                       */
+
+/*  Finds the smallest n in [low, high] where the faster algorithm wins, and  *
+ *  returns the cutoff, n - 1. If it never wins, high is returned.            */
+static size_t
+tune_crossover(Poly_Algorithm slow, Poly_Algorithm fast,
+               size_t low, size_t high)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, next, mid, last = low;
+
+    /*  Sweep up in steps of about 1/8. The NTT cost jumps at powers of two,  *
+     *  so a plain bisection of the whole range can step over a crossover.    */
+    for (n = low; n <= high; n = next)
+    {
+        next = n + (n / (size_t)8 > (size_t)1 ? n / (size_t)8 : (size_t)1);
+
+        if (!tune_faster(slow, fast, n))
+        {
+            last = n;
+            continue;
+        }
+
+        /*  Ignore a win that does not hold at the next step, it is noise.    */
+        if (next <= high && !tune_faster(slow, fast, next))
+        {
+            last = next;
+            continue;
+        }
+
+        break;
+    }
+
+    if (n > high)
+        return high;
+
+    if (n == low)
+        return low - (size_t)1;
+
+    /*  Bisect between the last loss and the first win.                       */
+    while (n - last > (size_t)1)
+    {
+        mid = last + (n - last) / (size_t)2;
+
+        if (tune_faster(slow, fast, mid))
+            n = mid;
+        else
+            last = mid;
+    }
+
+    return last;
+}
+/*  End of tune_crossover.                                                    */
+
+/*  Finds the best ratio at which lopsided NTT products are sliced.           */
+static size_t tune_ratio(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    Poly_Tunables t = tune_current;
+    size_t ratio, best_ratio = (size_t)1;
+    double elapsed, best = -1.0;
+
+    /*  The shortest product that uses the NTT, against one 32 times longer.  */
+    const size_t A_len = tune_current.ntt_cutoff + (size_t)1;
+    const size_t B_len = (size_t)32 * A_len;
+
+    for (ratio = (size_t)1; ratio <= (size_t)32; ratio *= (size_t)2)
+    {
+        t.unbalanced_ratio = ratio;
+        elapsed = tune_time(-1, A_len, B_len, &t);
+
+        if (elapsed < 0.0)
+            continue;
+
+        fprintf(stderr, "    ratio = %2lu: %.3e s\n",
+                (unsigned long)ratio, elapsed);
+
+        if (best < 0.0 || elapsed < best)
+        {
+            best = elapsed;
+            best_ratio = ratio;
+        }
+    }
+
+    return best_ratio;
+}
+/*  End of tune_ratio.                                                        */
+
+/*  Writes the tunables in either the config file or the header format.       */
+static void tune_write(FILE *fp, const Poly_Tunables *t, int header)
+{
+    if (header)
+    {
+        fprintf(fp, "/*  Generated by poly_tune. */\n");
+        fprintf(fp, "#define KARATSUBA_CUTOFF %lu\n",
+                (unsigned long)t->karatsuba_cutoff);
+        fprintf(fp, "#define NTT_CUTOFF %lu\n",
+                (unsigned long)t->ntt_cutoff);
+        fprintf(fp, "#define UNBALANCED_RATIO %lu\n",
+                (unsigned long)t->unbalanced_ratio);
+        fprintf(fp, "#define PARALLEL_GRAIN %lu\n",
+                (unsigned long)t->parallel_grain);
+        fprintf(fp, "#define WIDE_NTT_CUTOFF %lu\n",
+                (unsigned long)t->wide_ntt_cutoff);
+        fprintf(fp, "#define KARATSUBA_CUTOFF_INT16 %lu\n",
+                (unsigned long)t->karatsuba_cutoff_int16);
+        fprintf(fp, "#define KARATSUBA_CUTOFF_INT64 %lu\n",
+                (unsigned long)t->karatsuba_cutoff_int64);
+        fprintf(fp, "#define KARATSUBA_CUTOFF_FLOAT %lu\n",
+                (unsigned long)t->karatsuba_cutoff_float);
+        fprintf(fp, "#define KARATSUBA_CUTOFF_DOUBLE %lu\n",
+                (unsigned long)t->karatsuba_cutoff_double);
+        fprintf(fp, "#define MOD_NTT_CUTOFF %lu\n",
+                (unsigned long)t->mod_ntt_cutoff);
+        fprintf(fp, "#define KARATSUBA_SQUARE_CUTOFF %lu\n",
+                (unsigned long)t->karatsuba_square_cutoff);
+    }
+    else
+    {
+        fprintf(fp, "# Generated by poly_tune.\n");
+        fprintf(fp, "karatsuba_cutoff = %lu\n",
+                (unsigned long)t->karatsuba_cutoff);
+        fprintf(fp, "ntt_cutoff = %lu\n",
+                (unsigned long)t->ntt_cutoff);
+        fprintf(fp, "unbalanced_ratio = %lu\n",
+                (unsigned long)t->unbalanced_ratio);
+        fprintf(fp, "parallel_grain = %lu\n",
+                (unsigned long)t->parallel_grain);
+        fprintf(fp, "wide_ntt_cutoff = %lu\n",
+                (unsigned long)t->wide_ntt_cutoff);
+        fprintf(fp, "karatsuba_cutoff_int16 = %lu\n",
+                (unsigned long)t->karatsuba_cutoff_int16);
+        fprintf(fp, "karatsuba_cutoff_int64 = %lu\n",
+                (unsigned long)t->karatsuba_cutoff_int64);
+        fprintf(fp, "karatsuba_cutoff_float = %lu\n",
+                (unsigned long)t->karatsuba_cutoff_float);
+        fprintf(fp, "karatsuba_cutoff_double = %lu\n",
+                (unsigned long)t->karatsuba_cutoff_double);
+        fprintf(fp, "mod_ntt_cutoff = %lu\n",
+                (unsigned long)t->mod_ntt_cutoff);
+        fprintf(fp, "karatsuba_square_cutoff = %lu\n",
+                (unsigned long)t->karatsuba_square_cutoff);
+    }
+}
+/*  End of tune_write.                                                        */
+
+int main(int argc, char **argv)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const char *filename = NULL;
+    int header = 0;
+    size_t n, max_len;
+    FILE *fp;
+    int k;
+
+    for (k = 1; k < argc; ++k)
+    {
+        if (strcmp(argv[k], "-header") == 0)
+            header = 1;
+        else if (strcmp(argv[k], "-quick") == 0)
+            tune_min_time = 0.01;
+        else if (argv[k][0] == '-' || filename)
+        {
+            fprintf(stderr, "Usage: %s [-header] [-quick] [file]\n", argv[0]);
+            return 1;
+        }
+        else
+            filename = argv[k];
+    }
+
+    /*  The ratio sweep uses the longest operands, 33 times the NTT maximum.  */
+    max_len = (size_t)33 * (size_t)TUNE_NTT_MAX;
+
+    tune_A = malloc(sizeof(*tune_A) * max_len);
+    tune_B = malloc(sizeof(*tune_B) * max_len);
+    tune_P = malloc(sizeof(*tune_P) * (2 * max_len));
+    tune_P_wide = malloc(sizeof(*tune_P_wide) * (2 * TUNE_WIDE_MAX));
+
+    /*  long long and double are the widest of the other types.               */
+    tune_A_type = malloc(sizeof(double) * TUNE_KARATSUBA_MAX);
+    tune_B_type = malloc(sizeof(double) * TUNE_KARATSUBA_MAX);
+    tune_P_type = malloc(sizeof(double) * (2 * TUNE_KARATSUBA_MAX));
+
+    if (!tune_A || !tune_B || !tune_P || !tune_P_wide ||
+        !tune_A_type || !tune_B_type || !tune_P_type)
+    {
+        fprintf(stderr, "Error: malloc failed.\n");
+        return 1;
+    }
+
+    /*  Small coefficients, of -1, 0, and 1.                                  */
+    for (n = 0; n < max_len; ++n)
+    {
+        tune_A[n] = rand() % 3 - 1;
+        tune_B[n] = rand() % 3 - 1;
+    }
+
+    /*  Start with every fast algorithm out of reach.                         */
+    tune_current.karatsuba_cutoff = (size_t)TUNE_KARATSUBA_MAX;
+    tune_current.ntt_cutoff = (size_t)TUNE_NTT_MAX;
+    tune_current.unbalanced_ratio = (size_t)UNBALANCED_RATIO;
+    tune_current.parallel_grain = (size_t)PARALLEL_GRAIN;
+    tune_current.wide_ntt_cutoff = (size_t)TUNE_WIDE_MAX;
+    tune_current.karatsuba_cutoff_int16 = (size_t)TUNE_KARATSUBA_MAX;
+    tune_current.karatsuba_cutoff_int64 = (size_t)TUNE_KARATSUBA_MAX;
+    tune_current.karatsuba_cutoff_float = (size_t)TUNE_KARATSUBA_MAX;
+    tune_current.karatsuba_cutoff_double = (size_t)TUNE_KARATSUBA_MAX;
+    tune_current.mod_ntt_cutoff = (size_t)TUNE_WIDE_MAX;
+    tune_current.karatsuba_square_cutoff = (size_t)TUNE_KARATSUBA_MAX;
+
+    fprintf(stderr, "Tuning karatsuba_cutoff:\n");
+    tune_current.karatsuba_cutoff = tune_crossover(
+        POLY_ALGORITHM_NAIVE, POLY_ALGORITHM_KARATSUBA,
+        (size_t)2, (size_t)TUNE_KARATSUBA_MAX
+    );
+
+    /*  The square cutoff may not be below the product cutoff.                */
+    fprintf(stderr, "Tuning karatsuba_square_cutoff:\n");
+    tune_square = 1;
+    tune_current.karatsuba_square_cutoff = tune_crossover(
+        POLY_ALGORITHM_NAIVE, POLY_ALGORITHM_KARATSUBA,
+        tune_current.karatsuba_cutoff + (size_t)1, (size_t)TUNE_KARATSUBA_MAX
+    );
+
+    tune_square = 0;
+
+    /*  Poly_Multiply goes straight from Karatsuba to the NTT.                */
+    fprintf(stderr, "Tuning ntt_cutoff:\n");
+    tune_current.ntt_cutoff = tune_crossover(
+        POLY_ALGORITHM_KARATSUBA, POLY_ALGORITHM_NTT,
+        tune_current.karatsuba_cutoff + (size_t)1, (size_t)TUNE_NTT_MAX
+    );
+
+    fprintf(stderr, "Tuning unbalanced_ratio:\n");
+    tune_current.unbalanced_ratio = tune_ratio();
+
+    /*  Roughly 20-bit coefficients, where the wide products are needed.      */
+    for (n = 0; n < (size_t)TUNE_WIDE_MAX; ++n)
+    {
+        tune_A[n] = (rand() % 2048 - 1024) * 1024 + rand() % 1024;
+        tune_B[n] = (rand() % 2048 - 1024) * 1024 + rand() % 1024;
+    }
+
+    fprintf(stderr, "Tuning wide_ntt_cutoff:\n");
+    tune_wide = 1;
+    tune_current.wide_ntt_cutoff = tune_crossover(
+        POLY_ALGORITHM_NAIVE, POLY_ALGORITHM_NTT,
+        (size_t)64, (size_t)TUNE_WIDE_MAX
+    );
+
+    tune_wide = 0;
+
+    /*  Residues modulo a 31-bit NTT prime, the slowest case for the naive    *
+     *  method, which can only sum two products per reduction.                */
+    Poly_Modulus_Init(&tune_modulus, 2013265921U);
+
+    for (n = 0; n < (size_t)TUNE_WIDE_MAX; ++n)
+    {
+        tune_A[n] = (int)((unsigned int)rand() % tune_modulus.p);
+        tune_B[n] = (int)((unsigned int)rand() % tune_modulus.p);
+    }
+
+    fprintf(stderr, "Tuning mod_ntt_cutoff:\n");
+    tune_mod = 1;
+    tune_current.mod_ntt_cutoff = tune_crossover(
+        POLY_ALGORITHM_NAIVE, POLY_ALGORITHM_NTT,
+        (size_t)16, (size_t)TUNE_WIDE_MAX
+    );
+
+    tune_mod = 0;
+
+    for (k = TUNE_INT16; k <= TUNE_DOUBLE; ++k)
+    {
+        tune_type = k;
+        tune_fill_type();
+
+        fprintf(stderr, "Tuning %s:\n", tune_type_names[k]);
+        *tune_type_cutoff(&tune_current) = tune_crossover(
+            POLY_ALGORITHM_NAIVE, POLY_ALGORITHM_KARATSUBA,
+            (size_t)2, (size_t)TUNE_KARATSUBA_MAX
+        );
+    }
+
+    free(tune_A);
+    free(tune_B);
+    free(tune_P);
+    free(tune_P_wide);
+    free(tune_A_type);
+    free(tune_B_type);
+    free(tune_P_type);
+    free(tune_work);
+
+    if (!filename)
+    {
+        tune_write(stdout, &tune_current, header);
+        return 0;
+    }
+
+    fp = fopen(filename, "w");
+
+    if (!fp)
+    {
+        fprintf(stderr, "Error: could not open %s.\n", filename);
+        return 1;
+    }
+
+    tune_write(fp, &tune_current, header);
+    fclose(fp);
+    return 0;
+}
+/*  End of main.                                                              */